@@ -0,0 +1,89 @@
+#!/usr/bin/bash
+# Compiler throughput benchmark on a generated module.
+# Usage: [STRINGS=N] ./bench.sh [FUNCTIONS] [THREADS]
+set -e
+
+FUNCS=${1:-4000}
+THREADS=${2:-$(nproc)}
+SRC=build/bench.em
+
+mkdir -p build
+make -s
+
+# Generate a module with FUNCS small functions plus a main calling them
+{
+    for ((i = 0; i < FUNCS; i++)); do
+        echo "function f$i(a, b) {"
+        echo "  let x = a * $i + b;"
+        echo "  for (let j = 0; j < 10; j = j + 1) {"
+        echo "    x = x + j * $i;"
+        echo "  }"
+        echo "  if (x > $i) {"
+        echo "    print(\"f$i big\");"
+        echo "  } else {"
+        echo "    print(x);"
+        echo "  }"
+        echo "  return x;"
+        echo "}"
+    done
+    echo "function main() {"
+    for ((i = 0; i < FUNCS; i += 100)); do
+        echo "  print(f$i(1, 2));"
+    done
+    echo "  return 0;"
+    echo "}"
+} > $SRC
+
+echo "Module: $FUNCS functions, $(wc -c < $SRC) bytes"
+
+time_run() {
+    local start end
+    start=$(date +%s%N)
+    ./build/main $SRC -o "$2" -j "$1" > /dev/null
+    end=$(date +%s%N)
+    echo "  -j $1: $(( (end - start) / 1000000 )) ms"
+}
+
+time_run 1 build/bench_j1.ssa
+time_run "$THREADS" build/bench_jn.ssa
+
+if cmp -s build/bench_j1.ssa build/bench_jn.ssa; then
+    echo "Output identical across thread counts"
+else
+    echo "ERROR: output differs between -j 1 and -j $THREADS"
+    exit 1
+fi
+
+./build/main $SRC -o build/bench_j1.ssa -stats | grep -E '^(IR|Peak RSS):'
+echo "Streaming:"
+./build/main $SRC -o build/bench_stream.ssa -stream -stats | grep -E '^(IR|Peak RSS):'
+echo "Optimized (-O2):"
+./build/main $SRC -o build/bench_o2.ssa -O2 -stats | grep -vE '^(Parsing|Generating|Emitting|Success)'
+
+# Module passes hand functions back to the parallel workers; check that
+# no two threads share state (an arena) while doing it
+if make -s tsan 2>/dev/null; then
+    if ./build/main_tsan $SRC -o build/bench_tsan.ssa -O3 -j 4 > build/bench_tsan.log 2>&1; then
+        echo "ThreadSanitizer (-O3 -j 4): no races"
+    else
+        grep -m1 -A8 'WARNING: ThreadSanitizer' build/bench_tsan.log
+        echo "ERROR: ThreadSanitizer reported a race at -O3 -j 4"
+        exit 1
+    fi
+fi
+
+# String-heavy module: one print per literal, as in a message catalog
+STRINGS=${STRINGS:-200000}
+{
+    echo "function main() {"
+    for ((i = 0; i < STRINGS; i++)); do
+        echo "  print(\"message $i\");"
+    done
+    echo "  return 0;"
+    echo "}"
+} > build/catalog.em
+
+start=$(date +%s%N)
+./build/main build/catalog.em -o build/catalog.ssa -merge-strings > /dev/null
+end=$(date +%s%N)
+echo "Catalog: $STRINGS literals in $(( (end - start) / 1000000 )) ms"
@@ -0,0 +1,48043 @@
+function f0(a, b) {
+  let x = a * 0 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 0;
+  }
+  if (x > 0) {
+    print("f0 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1(a, b) {
+  let x = a * 1 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1;
+  }
+  if (x > 1) {
+    print("f1 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2(a, b) {
+  let x = a * 2 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2;
+  }
+  if (x > 2) {
+    print("f2 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3(a, b) {
+  let x = a * 3 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3;
+  }
+  if (x > 3) {
+    print("f3 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f4(a, b) {
+  let x = a * 4 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 4;
+  }
+  if (x > 4) {
+    print("f4 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f5(a, b) {
+  let x = a * 5 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 5;
+  }
+  if (x > 5) {
+    print("f5 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f6(a, b) {
+  let x = a * 6 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 6;
+  }
+  if (x > 6) {
+    print("f6 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f7(a, b) {
+  let x = a * 7 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 7;
+  }
+  if (x > 7) {
+    print("f7 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f8(a, b) {
+  let x = a * 8 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 8;
+  }
+  if (x > 8) {
+    print("f8 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f9(a, b) {
+  let x = a * 9 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 9;
+  }
+  if (x > 9) {
+    print("f9 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f10(a, b) {
+  let x = a * 10 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 10;
+  }
+  if (x > 10) {
+    print("f10 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f11(a, b) {
+  let x = a * 11 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 11;
+  }
+  if (x > 11) {
+    print("f11 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f12(a, b) {
+  let x = a * 12 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 12;
+  }
+  if (x > 12) {
+    print("f12 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f13(a, b) {
+  let x = a * 13 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 13;
+  }
+  if (x > 13) {
+    print("f13 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f14(a, b) {
+  let x = a * 14 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 14;
+  }
+  if (x > 14) {
+    print("f14 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f15(a, b) {
+  let x = a * 15 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 15;
+  }
+  if (x > 15) {
+    print("f15 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f16(a, b) {
+  let x = a * 16 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 16;
+  }
+  if (x > 16) {
+    print("f16 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f17(a, b) {
+  let x = a * 17 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 17;
+  }
+  if (x > 17) {
+    print("f17 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f18(a, b) {
+  let x = a * 18 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 18;
+  }
+  if (x > 18) {
+    print("f18 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f19(a, b) {
+  let x = a * 19 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 19;
+  }
+  if (x > 19) {
+    print("f19 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f20(a, b) {
+  let x = a * 20 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 20;
+  }
+  if (x > 20) {
+    print("f20 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f21(a, b) {
+  let x = a * 21 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 21;
+  }
+  if (x > 21) {
+    print("f21 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f22(a, b) {
+  let x = a * 22 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 22;
+  }
+  if (x > 22) {
+    print("f22 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f23(a, b) {
+  let x = a * 23 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 23;
+  }
+  if (x > 23) {
+    print("f23 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f24(a, b) {
+  let x = a * 24 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 24;
+  }
+  if (x > 24) {
+    print("f24 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f25(a, b) {
+  let x = a * 25 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 25;
+  }
+  if (x > 25) {
+    print("f25 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f26(a, b) {
+  let x = a * 26 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 26;
+  }
+  if (x > 26) {
+    print("f26 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f27(a, b) {
+  let x = a * 27 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 27;
+  }
+  if (x > 27) {
+    print("f27 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f28(a, b) {
+  let x = a * 28 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 28;
+  }
+  if (x > 28) {
+    print("f28 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f29(a, b) {
+  let x = a * 29 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 29;
+  }
+  if (x > 29) {
+    print("f29 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f30(a, b) {
+  let x = a * 30 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 30;
+  }
+  if (x > 30) {
+    print("f30 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f31(a, b) {
+  let x = a * 31 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 31;
+  }
+  if (x > 31) {
+    print("f31 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f32(a, b) {
+  let x = a * 32 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 32;
+  }
+  if (x > 32) {
+    print("f32 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f33(a, b) {
+  let x = a * 33 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 33;
+  }
+  if (x > 33) {
+    print("f33 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f34(a, b) {
+  let x = a * 34 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 34;
+  }
+  if (x > 34) {
+    print("f34 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f35(a, b) {
+  let x = a * 35 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 35;
+  }
+  if (x > 35) {
+    print("f35 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f36(a, b) {
+  let x = a * 36 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 36;
+  }
+  if (x > 36) {
+    print("f36 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f37(a, b) {
+  let x = a * 37 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 37;
+  }
+  if (x > 37) {
+    print("f37 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f38(a, b) {
+  let x = a * 38 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 38;
+  }
+  if (x > 38) {
+    print("f38 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f39(a, b) {
+  let x = a * 39 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 39;
+  }
+  if (x > 39) {
+    print("f39 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f40(a, b) {
+  let x = a * 40 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 40;
+  }
+  if (x > 40) {
+    print("f40 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f41(a, b) {
+  let x = a * 41 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 41;
+  }
+  if (x > 41) {
+    print("f41 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f42(a, b) {
+  let x = a * 42 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 42;
+  }
+  if (x > 42) {
+    print("f42 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f43(a, b) {
+  let x = a * 43 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 43;
+  }
+  if (x > 43) {
+    print("f43 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f44(a, b) {
+  let x = a * 44 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 44;
+  }
+  if (x > 44) {
+    print("f44 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f45(a, b) {
+  let x = a * 45 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 45;
+  }
+  if (x > 45) {
+    print("f45 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f46(a, b) {
+  let x = a * 46 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 46;
+  }
+  if (x > 46) {
+    print("f46 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f47(a, b) {
+  let x = a * 47 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 47;
+  }
+  if (x > 47) {
+    print("f47 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f48(a, b) {
+  let x = a * 48 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 48;
+  }
+  if (x > 48) {
+    print("f48 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f49(a, b) {
+  let x = a * 49 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 49;
+  }
+  if (x > 49) {
+    print("f49 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f50(a, b) {
+  let x = a * 50 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 50;
+  }
+  if (x > 50) {
+    print("f50 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f51(a, b) {
+  let x = a * 51 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 51;
+  }
+  if (x > 51) {
+    print("f51 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f52(a, b) {
+  let x = a * 52 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 52;
+  }
+  if (x > 52) {
+    print("f52 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f53(a, b) {
+  let x = a * 53 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 53;
+  }
+  if (x > 53) {
+    print("f53 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f54(a, b) {
+  let x = a * 54 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 54;
+  }
+  if (x > 54) {
+    print("f54 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f55(a, b) {
+  let x = a * 55 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 55;
+  }
+  if (x > 55) {
+    print("f55 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f56(a, b) {
+  let x = a * 56 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 56;
+  }
+  if (x > 56) {
+    print("f56 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f57(a, b) {
+  let x = a * 57 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 57;
+  }
+  if (x > 57) {
+    print("f57 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f58(a, b) {
+  let x = a * 58 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 58;
+  }
+  if (x > 58) {
+    print("f58 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f59(a, b) {
+  let x = a * 59 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 59;
+  }
+  if (x > 59) {
+    print("f59 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f60(a, b) {
+  let x = a * 60 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 60;
+  }
+  if (x > 60) {
+    print("f60 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f61(a, b) {
+  let x = a * 61 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 61;
+  }
+  if (x > 61) {
+    print("f61 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f62(a, b) {
+  let x = a * 62 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 62;
+  }
+  if (x > 62) {
+    print("f62 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f63(a, b) {
+  let x = a * 63 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 63;
+  }
+  if (x > 63) {
+    print("f63 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f64(a, b) {
+  let x = a * 64 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 64;
+  }
+  if (x > 64) {
+    print("f64 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f65(a, b) {
+  let x = a * 65 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 65;
+  }
+  if (x > 65) {
+    print("f65 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f66(a, b) {
+  let x = a * 66 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 66;
+  }
+  if (x > 66) {
+    print("f66 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f67(a, b) {
+  let x = a * 67 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 67;
+  }
+  if (x > 67) {
+    print("f67 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f68(a, b) {
+  let x = a * 68 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 68;
+  }
+  if (x > 68) {
+    print("f68 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f69(a, b) {
+  let x = a * 69 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 69;
+  }
+  if (x > 69) {
+    print("f69 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f70(a, b) {
+  let x = a * 70 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 70;
+  }
+  if (x > 70) {
+    print("f70 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f71(a, b) {
+  let x = a * 71 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 71;
+  }
+  if (x > 71) {
+    print("f71 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f72(a, b) {
+  let x = a * 72 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 72;
+  }
+  if (x > 72) {
+    print("f72 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f73(a, b) {
+  let x = a * 73 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 73;
+  }
+  if (x > 73) {
+    print("f73 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f74(a, b) {
+  let x = a * 74 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 74;
+  }
+  if (x > 74) {
+    print("f74 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f75(a, b) {
+  let x = a * 75 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 75;
+  }
+  if (x > 75) {
+    print("f75 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f76(a, b) {
+  let x = a * 76 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 76;
+  }
+  if (x > 76) {
+    print("f76 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f77(a, b) {
+  let x = a * 77 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 77;
+  }
+  if (x > 77) {
+    print("f77 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f78(a, b) {
+  let x = a * 78 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 78;
+  }
+  if (x > 78) {
+    print("f78 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f79(a, b) {
+  let x = a * 79 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 79;
+  }
+  if (x > 79) {
+    print("f79 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f80(a, b) {
+  let x = a * 80 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 80;
+  }
+  if (x > 80) {
+    print("f80 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f81(a, b) {
+  let x = a * 81 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 81;
+  }
+  if (x > 81) {
+    print("f81 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f82(a, b) {
+  let x = a * 82 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 82;
+  }
+  if (x > 82) {
+    print("f82 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f83(a, b) {
+  let x = a * 83 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 83;
+  }
+  if (x > 83) {
+    print("f83 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f84(a, b) {
+  let x = a * 84 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 84;
+  }
+  if (x > 84) {
+    print("f84 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f85(a, b) {
+  let x = a * 85 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 85;
+  }
+  if (x > 85) {
+    print("f85 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f86(a, b) {
+  let x = a * 86 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 86;
+  }
+  if (x > 86) {
+    print("f86 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f87(a, b) {
+  let x = a * 87 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 87;
+  }
+  if (x > 87) {
+    print("f87 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f88(a, b) {
+  let x = a * 88 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 88;
+  }
+  if (x > 88) {
+    print("f88 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f89(a, b) {
+  let x = a * 89 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 89;
+  }
+  if (x > 89) {
+    print("f89 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f90(a, b) {
+  let x = a * 90 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 90;
+  }
+  if (x > 90) {
+    print("f90 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f91(a, b) {
+  let x = a * 91 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 91;
+  }
+  if (x > 91) {
+    print("f91 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f92(a, b) {
+  let x = a * 92 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 92;
+  }
+  if (x > 92) {
+    print("f92 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f93(a, b) {
+  let x = a * 93 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 93;
+  }
+  if (x > 93) {
+    print("f93 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f94(a, b) {
+  let x = a * 94 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 94;
+  }
+  if (x > 94) {
+    print("f94 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f95(a, b) {
+  let x = a * 95 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 95;
+  }
+  if (x > 95) {
+    print("f95 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f96(a, b) {
+  let x = a * 96 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 96;
+  }
+  if (x > 96) {
+    print("f96 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f97(a, b) {
+  let x = a * 97 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 97;
+  }
+  if (x > 97) {
+    print("f97 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f98(a, b) {
+  let x = a * 98 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 98;
+  }
+  if (x > 98) {
+    print("f98 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f99(a, b) {
+  let x = a * 99 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 99;
+  }
+  if (x > 99) {
+    print("f99 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f100(a, b) {
+  let x = a * 100 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 100;
+  }
+  if (x > 100) {
+    print("f100 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f101(a, b) {
+  let x = a * 101 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 101;
+  }
+  if (x > 101) {
+    print("f101 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f102(a, b) {
+  let x = a * 102 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 102;
+  }
+  if (x > 102) {
+    print("f102 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f103(a, b) {
+  let x = a * 103 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 103;
+  }
+  if (x > 103) {
+    print("f103 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f104(a, b) {
+  let x = a * 104 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 104;
+  }
+  if (x > 104) {
+    print("f104 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f105(a, b) {
+  let x = a * 105 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 105;
+  }
+  if (x > 105) {
+    print("f105 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f106(a, b) {
+  let x = a * 106 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 106;
+  }
+  if (x > 106) {
+    print("f106 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f107(a, b) {
+  let x = a * 107 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 107;
+  }
+  if (x > 107) {
+    print("f107 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f108(a, b) {
+  let x = a * 108 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 108;
+  }
+  if (x > 108) {
+    print("f108 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f109(a, b) {
+  let x = a * 109 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 109;
+  }
+  if (x > 109) {
+    print("f109 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f110(a, b) {
+  let x = a * 110 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 110;
+  }
+  if (x > 110) {
+    print("f110 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f111(a, b) {
+  let x = a * 111 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 111;
+  }
+  if (x > 111) {
+    print("f111 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f112(a, b) {
+  let x = a * 112 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 112;
+  }
+  if (x > 112) {
+    print("f112 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f113(a, b) {
+  let x = a * 113 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 113;
+  }
+  if (x > 113) {
+    print("f113 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f114(a, b) {
+  let x = a * 114 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 114;
+  }
+  if (x > 114) {
+    print("f114 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f115(a, b) {
+  let x = a * 115 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 115;
+  }
+  if (x > 115) {
+    print("f115 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f116(a, b) {
+  let x = a * 116 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 116;
+  }
+  if (x > 116) {
+    print("f116 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f117(a, b) {
+  let x = a * 117 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 117;
+  }
+  if (x > 117) {
+    print("f117 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f118(a, b) {
+  let x = a * 118 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 118;
+  }
+  if (x > 118) {
+    print("f118 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f119(a, b) {
+  let x = a * 119 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 119;
+  }
+  if (x > 119) {
+    print("f119 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f120(a, b) {
+  let x = a * 120 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 120;
+  }
+  if (x > 120) {
+    print("f120 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f121(a, b) {
+  let x = a * 121 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 121;
+  }
+  if (x > 121) {
+    print("f121 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f122(a, b) {
+  let x = a * 122 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 122;
+  }
+  if (x > 122) {
+    print("f122 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f123(a, b) {
+  let x = a * 123 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 123;
+  }
+  if (x > 123) {
+    print("f123 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f124(a, b) {
+  let x = a * 124 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 124;
+  }
+  if (x > 124) {
+    print("f124 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f125(a, b) {
+  let x = a * 125 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 125;
+  }
+  if (x > 125) {
+    print("f125 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f126(a, b) {
+  let x = a * 126 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 126;
+  }
+  if (x > 126) {
+    print("f126 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f127(a, b) {
+  let x = a * 127 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 127;
+  }
+  if (x > 127) {
+    print("f127 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f128(a, b) {
+  let x = a * 128 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 128;
+  }
+  if (x > 128) {
+    print("f128 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f129(a, b) {
+  let x = a * 129 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 129;
+  }
+  if (x > 129) {
+    print("f129 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f130(a, b) {
+  let x = a * 130 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 130;
+  }
+  if (x > 130) {
+    print("f130 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f131(a, b) {
+  let x = a * 131 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 131;
+  }
+  if (x > 131) {
+    print("f131 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f132(a, b) {
+  let x = a * 132 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 132;
+  }
+  if (x > 132) {
+    print("f132 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f133(a, b) {
+  let x = a * 133 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 133;
+  }
+  if (x > 133) {
+    print("f133 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f134(a, b) {
+  let x = a * 134 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 134;
+  }
+  if (x > 134) {
+    print("f134 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f135(a, b) {
+  let x = a * 135 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 135;
+  }
+  if (x > 135) {
+    print("f135 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f136(a, b) {
+  let x = a * 136 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 136;
+  }
+  if (x > 136) {
+    print("f136 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f137(a, b) {
+  let x = a * 137 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 137;
+  }
+  if (x > 137) {
+    print("f137 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f138(a, b) {
+  let x = a * 138 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 138;
+  }
+  if (x > 138) {
+    print("f138 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f139(a, b) {
+  let x = a * 139 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 139;
+  }
+  if (x > 139) {
+    print("f139 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f140(a, b) {
+  let x = a * 140 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 140;
+  }
+  if (x > 140) {
+    print("f140 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f141(a, b) {
+  let x = a * 141 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 141;
+  }
+  if (x > 141) {
+    print("f141 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f142(a, b) {
+  let x = a * 142 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 142;
+  }
+  if (x > 142) {
+    print("f142 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f143(a, b) {
+  let x = a * 143 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 143;
+  }
+  if (x > 143) {
+    print("f143 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f144(a, b) {
+  let x = a * 144 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 144;
+  }
+  if (x > 144) {
+    print("f144 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f145(a, b) {
+  let x = a * 145 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 145;
+  }
+  if (x > 145) {
+    print("f145 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f146(a, b) {
+  let x = a * 146 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 146;
+  }
+  if (x > 146) {
+    print("f146 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f147(a, b) {
+  let x = a * 147 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 147;
+  }
+  if (x > 147) {
+    print("f147 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f148(a, b) {
+  let x = a * 148 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 148;
+  }
+  if (x > 148) {
+    print("f148 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f149(a, b) {
+  let x = a * 149 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 149;
+  }
+  if (x > 149) {
+    print("f149 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f150(a, b) {
+  let x = a * 150 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 150;
+  }
+  if (x > 150) {
+    print("f150 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f151(a, b) {
+  let x = a * 151 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 151;
+  }
+  if (x > 151) {
+    print("f151 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f152(a, b) {
+  let x = a * 152 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 152;
+  }
+  if (x > 152) {
+    print("f152 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f153(a, b) {
+  let x = a * 153 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 153;
+  }
+  if (x > 153) {
+    print("f153 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f154(a, b) {
+  let x = a * 154 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 154;
+  }
+  if (x > 154) {
+    print("f154 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f155(a, b) {
+  let x = a * 155 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 155;
+  }
+  if (x > 155) {
+    print("f155 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f156(a, b) {
+  let x = a * 156 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 156;
+  }
+  if (x > 156) {
+    print("f156 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f157(a, b) {
+  let x = a * 157 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 157;
+  }
+  if (x > 157) {
+    print("f157 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f158(a, b) {
+  let x = a * 158 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 158;
+  }
+  if (x > 158) {
+    print("f158 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f159(a, b) {
+  let x = a * 159 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 159;
+  }
+  if (x > 159) {
+    print("f159 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f160(a, b) {
+  let x = a * 160 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 160;
+  }
+  if (x > 160) {
+    print("f160 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f161(a, b) {
+  let x = a * 161 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 161;
+  }
+  if (x > 161) {
+    print("f161 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f162(a, b) {
+  let x = a * 162 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 162;
+  }
+  if (x > 162) {
+    print("f162 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f163(a, b) {
+  let x = a * 163 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 163;
+  }
+  if (x > 163) {
+    print("f163 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f164(a, b) {
+  let x = a * 164 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 164;
+  }
+  if (x > 164) {
+    print("f164 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f165(a, b) {
+  let x = a * 165 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 165;
+  }
+  if (x > 165) {
+    print("f165 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f166(a, b) {
+  let x = a * 166 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 166;
+  }
+  if (x > 166) {
+    print("f166 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f167(a, b) {
+  let x = a * 167 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 167;
+  }
+  if (x > 167) {
+    print("f167 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f168(a, b) {
+  let x = a * 168 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 168;
+  }
+  if (x > 168) {
+    print("f168 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f169(a, b) {
+  let x = a * 169 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 169;
+  }
+  if (x > 169) {
+    print("f169 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f170(a, b) {
+  let x = a * 170 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 170;
+  }
+  if (x > 170) {
+    print("f170 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f171(a, b) {
+  let x = a * 171 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 171;
+  }
+  if (x > 171) {
+    print("f171 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f172(a, b) {
+  let x = a * 172 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 172;
+  }
+  if (x > 172) {
+    print("f172 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f173(a, b) {
+  let x = a * 173 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 173;
+  }
+  if (x > 173) {
+    print("f173 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f174(a, b) {
+  let x = a * 174 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 174;
+  }
+  if (x > 174) {
+    print("f174 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f175(a, b) {
+  let x = a * 175 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 175;
+  }
+  if (x > 175) {
+    print("f175 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f176(a, b) {
+  let x = a * 176 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 176;
+  }
+  if (x > 176) {
+    print("f176 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f177(a, b) {
+  let x = a * 177 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 177;
+  }
+  if (x > 177) {
+    print("f177 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f178(a, b) {
+  let x = a * 178 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 178;
+  }
+  if (x > 178) {
+    print("f178 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f179(a, b) {
+  let x = a * 179 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 179;
+  }
+  if (x > 179) {
+    print("f179 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f180(a, b) {
+  let x = a * 180 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 180;
+  }
+  if (x > 180) {
+    print("f180 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f181(a, b) {
+  let x = a * 181 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 181;
+  }
+  if (x > 181) {
+    print("f181 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f182(a, b) {
+  let x = a * 182 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 182;
+  }
+  if (x > 182) {
+    print("f182 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f183(a, b) {
+  let x = a * 183 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 183;
+  }
+  if (x > 183) {
+    print("f183 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f184(a, b) {
+  let x = a * 184 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 184;
+  }
+  if (x > 184) {
+    print("f184 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f185(a, b) {
+  let x = a * 185 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 185;
+  }
+  if (x > 185) {
+    print("f185 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f186(a, b) {
+  let x = a * 186 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 186;
+  }
+  if (x > 186) {
+    print("f186 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f187(a, b) {
+  let x = a * 187 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 187;
+  }
+  if (x > 187) {
+    print("f187 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f188(a, b) {
+  let x = a * 188 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 188;
+  }
+  if (x > 188) {
+    print("f188 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f189(a, b) {
+  let x = a * 189 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 189;
+  }
+  if (x > 189) {
+    print("f189 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f190(a, b) {
+  let x = a * 190 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 190;
+  }
+  if (x > 190) {
+    print("f190 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f191(a, b) {
+  let x = a * 191 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 191;
+  }
+  if (x > 191) {
+    print("f191 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f192(a, b) {
+  let x = a * 192 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 192;
+  }
+  if (x > 192) {
+    print("f192 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f193(a, b) {
+  let x = a * 193 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 193;
+  }
+  if (x > 193) {
+    print("f193 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f194(a, b) {
+  let x = a * 194 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 194;
+  }
+  if (x > 194) {
+    print("f194 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f195(a, b) {
+  let x = a * 195 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 195;
+  }
+  if (x > 195) {
+    print("f195 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f196(a, b) {
+  let x = a * 196 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 196;
+  }
+  if (x > 196) {
+    print("f196 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f197(a, b) {
+  let x = a * 197 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 197;
+  }
+  if (x > 197) {
+    print("f197 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f198(a, b) {
+  let x = a * 198 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 198;
+  }
+  if (x > 198) {
+    print("f198 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f199(a, b) {
+  let x = a * 199 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 199;
+  }
+  if (x > 199) {
+    print("f199 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f200(a, b) {
+  let x = a * 200 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 200;
+  }
+  if (x > 200) {
+    print("f200 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f201(a, b) {
+  let x = a * 201 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 201;
+  }
+  if (x > 201) {
+    print("f201 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f202(a, b) {
+  let x = a * 202 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 202;
+  }
+  if (x > 202) {
+    print("f202 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f203(a, b) {
+  let x = a * 203 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 203;
+  }
+  if (x > 203) {
+    print("f203 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f204(a, b) {
+  let x = a * 204 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 204;
+  }
+  if (x > 204) {
+    print("f204 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f205(a, b) {
+  let x = a * 205 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 205;
+  }
+  if (x > 205) {
+    print("f205 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f206(a, b) {
+  let x = a * 206 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 206;
+  }
+  if (x > 206) {
+    print("f206 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f207(a, b) {
+  let x = a * 207 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 207;
+  }
+  if (x > 207) {
+    print("f207 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f208(a, b) {
+  let x = a * 208 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 208;
+  }
+  if (x > 208) {
+    print("f208 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f209(a, b) {
+  let x = a * 209 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 209;
+  }
+  if (x > 209) {
+    print("f209 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f210(a, b) {
+  let x = a * 210 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 210;
+  }
+  if (x > 210) {
+    print("f210 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f211(a, b) {
+  let x = a * 211 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 211;
+  }
+  if (x > 211) {
+    print("f211 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f212(a, b) {
+  let x = a * 212 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 212;
+  }
+  if (x > 212) {
+    print("f212 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f213(a, b) {
+  let x = a * 213 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 213;
+  }
+  if (x > 213) {
+    print("f213 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f214(a, b) {
+  let x = a * 214 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 214;
+  }
+  if (x > 214) {
+    print("f214 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f215(a, b) {
+  let x = a * 215 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 215;
+  }
+  if (x > 215) {
+    print("f215 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f216(a, b) {
+  let x = a * 216 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 216;
+  }
+  if (x > 216) {
+    print("f216 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f217(a, b) {
+  let x = a * 217 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 217;
+  }
+  if (x > 217) {
+    print("f217 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f218(a, b) {
+  let x = a * 218 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 218;
+  }
+  if (x > 218) {
+    print("f218 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f219(a, b) {
+  let x = a * 219 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 219;
+  }
+  if (x > 219) {
+    print("f219 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f220(a, b) {
+  let x = a * 220 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 220;
+  }
+  if (x > 220) {
+    print("f220 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f221(a, b) {
+  let x = a * 221 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 221;
+  }
+  if (x > 221) {
+    print("f221 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f222(a, b) {
+  let x = a * 222 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 222;
+  }
+  if (x > 222) {
+    print("f222 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f223(a, b) {
+  let x = a * 223 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 223;
+  }
+  if (x > 223) {
+    print("f223 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f224(a, b) {
+  let x = a * 224 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 224;
+  }
+  if (x > 224) {
+    print("f224 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f225(a, b) {
+  let x = a * 225 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 225;
+  }
+  if (x > 225) {
+    print("f225 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f226(a, b) {
+  let x = a * 226 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 226;
+  }
+  if (x > 226) {
+    print("f226 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f227(a, b) {
+  let x = a * 227 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 227;
+  }
+  if (x > 227) {
+    print("f227 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f228(a, b) {
+  let x = a * 228 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 228;
+  }
+  if (x > 228) {
+    print("f228 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f229(a, b) {
+  let x = a * 229 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 229;
+  }
+  if (x > 229) {
+    print("f229 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f230(a, b) {
+  let x = a * 230 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 230;
+  }
+  if (x > 230) {
+    print("f230 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f231(a, b) {
+  let x = a * 231 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 231;
+  }
+  if (x > 231) {
+    print("f231 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f232(a, b) {
+  let x = a * 232 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 232;
+  }
+  if (x > 232) {
+    print("f232 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f233(a, b) {
+  let x = a * 233 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 233;
+  }
+  if (x > 233) {
+    print("f233 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f234(a, b) {
+  let x = a * 234 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 234;
+  }
+  if (x > 234) {
+    print("f234 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f235(a, b) {
+  let x = a * 235 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 235;
+  }
+  if (x > 235) {
+    print("f235 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f236(a, b) {
+  let x = a * 236 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 236;
+  }
+  if (x > 236) {
+    print("f236 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f237(a, b) {
+  let x = a * 237 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 237;
+  }
+  if (x > 237) {
+    print("f237 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f238(a, b) {
+  let x = a * 238 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 238;
+  }
+  if (x > 238) {
+    print("f238 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f239(a, b) {
+  let x = a * 239 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 239;
+  }
+  if (x > 239) {
+    print("f239 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f240(a, b) {
+  let x = a * 240 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 240;
+  }
+  if (x > 240) {
+    print("f240 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f241(a, b) {
+  let x = a * 241 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 241;
+  }
+  if (x > 241) {
+    print("f241 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f242(a, b) {
+  let x = a * 242 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 242;
+  }
+  if (x > 242) {
+    print("f242 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f243(a, b) {
+  let x = a * 243 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 243;
+  }
+  if (x > 243) {
+    print("f243 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f244(a, b) {
+  let x = a * 244 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 244;
+  }
+  if (x > 244) {
+    print("f244 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f245(a, b) {
+  let x = a * 245 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 245;
+  }
+  if (x > 245) {
+    print("f245 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f246(a, b) {
+  let x = a * 246 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 246;
+  }
+  if (x > 246) {
+    print("f246 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f247(a, b) {
+  let x = a * 247 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 247;
+  }
+  if (x > 247) {
+    print("f247 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f248(a, b) {
+  let x = a * 248 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 248;
+  }
+  if (x > 248) {
+    print("f248 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f249(a, b) {
+  let x = a * 249 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 249;
+  }
+  if (x > 249) {
+    print("f249 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f250(a, b) {
+  let x = a * 250 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 250;
+  }
+  if (x > 250) {
+    print("f250 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f251(a, b) {
+  let x = a * 251 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 251;
+  }
+  if (x > 251) {
+    print("f251 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f252(a, b) {
+  let x = a * 252 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 252;
+  }
+  if (x > 252) {
+    print("f252 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f253(a, b) {
+  let x = a * 253 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 253;
+  }
+  if (x > 253) {
+    print("f253 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f254(a, b) {
+  let x = a * 254 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 254;
+  }
+  if (x > 254) {
+    print("f254 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f255(a, b) {
+  let x = a * 255 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 255;
+  }
+  if (x > 255) {
+    print("f255 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f256(a, b) {
+  let x = a * 256 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 256;
+  }
+  if (x > 256) {
+    print("f256 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f257(a, b) {
+  let x = a * 257 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 257;
+  }
+  if (x > 257) {
+    print("f257 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f258(a, b) {
+  let x = a * 258 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 258;
+  }
+  if (x > 258) {
+    print("f258 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f259(a, b) {
+  let x = a * 259 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 259;
+  }
+  if (x > 259) {
+    print("f259 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f260(a, b) {
+  let x = a * 260 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 260;
+  }
+  if (x > 260) {
+    print("f260 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f261(a, b) {
+  let x = a * 261 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 261;
+  }
+  if (x > 261) {
+    print("f261 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f262(a, b) {
+  let x = a * 262 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 262;
+  }
+  if (x > 262) {
+    print("f262 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f263(a, b) {
+  let x = a * 263 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 263;
+  }
+  if (x > 263) {
+    print("f263 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f264(a, b) {
+  let x = a * 264 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 264;
+  }
+  if (x > 264) {
+    print("f264 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f265(a, b) {
+  let x = a * 265 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 265;
+  }
+  if (x > 265) {
+    print("f265 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f266(a, b) {
+  let x = a * 266 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 266;
+  }
+  if (x > 266) {
+    print("f266 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f267(a, b) {
+  let x = a * 267 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 267;
+  }
+  if (x > 267) {
+    print("f267 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f268(a, b) {
+  let x = a * 268 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 268;
+  }
+  if (x > 268) {
+    print("f268 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f269(a, b) {
+  let x = a * 269 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 269;
+  }
+  if (x > 269) {
+    print("f269 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f270(a, b) {
+  let x = a * 270 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 270;
+  }
+  if (x > 270) {
+    print("f270 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f271(a, b) {
+  let x = a * 271 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 271;
+  }
+  if (x > 271) {
+    print("f271 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f272(a, b) {
+  let x = a * 272 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 272;
+  }
+  if (x > 272) {
+    print("f272 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f273(a, b) {
+  let x = a * 273 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 273;
+  }
+  if (x > 273) {
+    print("f273 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f274(a, b) {
+  let x = a * 274 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 274;
+  }
+  if (x > 274) {
+    print("f274 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f275(a, b) {
+  let x = a * 275 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 275;
+  }
+  if (x > 275) {
+    print("f275 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f276(a, b) {
+  let x = a * 276 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 276;
+  }
+  if (x > 276) {
+    print("f276 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f277(a, b) {
+  let x = a * 277 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 277;
+  }
+  if (x > 277) {
+    print("f277 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f278(a, b) {
+  let x = a * 278 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 278;
+  }
+  if (x > 278) {
+    print("f278 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f279(a, b) {
+  let x = a * 279 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 279;
+  }
+  if (x > 279) {
+    print("f279 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f280(a, b) {
+  let x = a * 280 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 280;
+  }
+  if (x > 280) {
+    print("f280 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f281(a, b) {
+  let x = a * 281 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 281;
+  }
+  if (x > 281) {
+    print("f281 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f282(a, b) {
+  let x = a * 282 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 282;
+  }
+  if (x > 282) {
+    print("f282 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f283(a, b) {
+  let x = a * 283 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 283;
+  }
+  if (x > 283) {
+    print("f283 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f284(a, b) {
+  let x = a * 284 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 284;
+  }
+  if (x > 284) {
+    print("f284 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f285(a, b) {
+  let x = a * 285 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 285;
+  }
+  if (x > 285) {
+    print("f285 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f286(a, b) {
+  let x = a * 286 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 286;
+  }
+  if (x > 286) {
+    print("f286 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f287(a, b) {
+  let x = a * 287 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 287;
+  }
+  if (x > 287) {
+    print("f287 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f288(a, b) {
+  let x = a * 288 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 288;
+  }
+  if (x > 288) {
+    print("f288 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f289(a, b) {
+  let x = a * 289 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 289;
+  }
+  if (x > 289) {
+    print("f289 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f290(a, b) {
+  let x = a * 290 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 290;
+  }
+  if (x > 290) {
+    print("f290 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f291(a, b) {
+  let x = a * 291 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 291;
+  }
+  if (x > 291) {
+    print("f291 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f292(a, b) {
+  let x = a * 292 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 292;
+  }
+  if (x > 292) {
+    print("f292 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f293(a, b) {
+  let x = a * 293 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 293;
+  }
+  if (x > 293) {
+    print("f293 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f294(a, b) {
+  let x = a * 294 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 294;
+  }
+  if (x > 294) {
+    print("f294 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f295(a, b) {
+  let x = a * 295 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 295;
+  }
+  if (x > 295) {
+    print("f295 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f296(a, b) {
+  let x = a * 296 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 296;
+  }
+  if (x > 296) {
+    print("f296 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f297(a, b) {
+  let x = a * 297 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 297;
+  }
+  if (x > 297) {
+    print("f297 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f298(a, b) {
+  let x = a * 298 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 298;
+  }
+  if (x > 298) {
+    print("f298 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f299(a, b) {
+  let x = a * 299 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 299;
+  }
+  if (x > 299) {
+    print("f299 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f300(a, b) {
+  let x = a * 300 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 300;
+  }
+  if (x > 300) {
+    print("f300 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f301(a, b) {
+  let x = a * 301 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 301;
+  }
+  if (x > 301) {
+    print("f301 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f302(a, b) {
+  let x = a * 302 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 302;
+  }
+  if (x > 302) {
+    print("f302 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f303(a, b) {
+  let x = a * 303 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 303;
+  }
+  if (x > 303) {
+    print("f303 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f304(a, b) {
+  let x = a * 304 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 304;
+  }
+  if (x > 304) {
+    print("f304 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f305(a, b) {
+  let x = a * 305 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 305;
+  }
+  if (x > 305) {
+    print("f305 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f306(a, b) {
+  let x = a * 306 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 306;
+  }
+  if (x > 306) {
+    print("f306 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f307(a, b) {
+  let x = a * 307 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 307;
+  }
+  if (x > 307) {
+    print("f307 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f308(a, b) {
+  let x = a * 308 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 308;
+  }
+  if (x > 308) {
+    print("f308 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f309(a, b) {
+  let x = a * 309 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 309;
+  }
+  if (x > 309) {
+    print("f309 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f310(a, b) {
+  let x = a * 310 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 310;
+  }
+  if (x > 310) {
+    print("f310 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f311(a, b) {
+  let x = a * 311 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 311;
+  }
+  if (x > 311) {
+    print("f311 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f312(a, b) {
+  let x = a * 312 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 312;
+  }
+  if (x > 312) {
+    print("f312 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f313(a, b) {
+  let x = a * 313 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 313;
+  }
+  if (x > 313) {
+    print("f313 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f314(a, b) {
+  let x = a * 314 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 314;
+  }
+  if (x > 314) {
+    print("f314 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f315(a, b) {
+  let x = a * 315 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 315;
+  }
+  if (x > 315) {
+    print("f315 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f316(a, b) {
+  let x = a * 316 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 316;
+  }
+  if (x > 316) {
+    print("f316 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f317(a, b) {
+  let x = a * 317 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 317;
+  }
+  if (x > 317) {
+    print("f317 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f318(a, b) {
+  let x = a * 318 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 318;
+  }
+  if (x > 318) {
+    print("f318 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f319(a, b) {
+  let x = a * 319 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 319;
+  }
+  if (x > 319) {
+    print("f319 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f320(a, b) {
+  let x = a * 320 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 320;
+  }
+  if (x > 320) {
+    print("f320 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f321(a, b) {
+  let x = a * 321 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 321;
+  }
+  if (x > 321) {
+    print("f321 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f322(a, b) {
+  let x = a * 322 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 322;
+  }
+  if (x > 322) {
+    print("f322 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f323(a, b) {
+  let x = a * 323 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 323;
+  }
+  if (x > 323) {
+    print("f323 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f324(a, b) {
+  let x = a * 324 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 324;
+  }
+  if (x > 324) {
+    print("f324 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f325(a, b) {
+  let x = a * 325 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 325;
+  }
+  if (x > 325) {
+    print("f325 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f326(a, b) {
+  let x = a * 326 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 326;
+  }
+  if (x > 326) {
+    print("f326 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f327(a, b) {
+  let x = a * 327 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 327;
+  }
+  if (x > 327) {
+    print("f327 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f328(a, b) {
+  let x = a * 328 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 328;
+  }
+  if (x > 328) {
+    print("f328 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f329(a, b) {
+  let x = a * 329 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 329;
+  }
+  if (x > 329) {
+    print("f329 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f330(a, b) {
+  let x = a * 330 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 330;
+  }
+  if (x > 330) {
+    print("f330 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f331(a, b) {
+  let x = a * 331 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 331;
+  }
+  if (x > 331) {
+    print("f331 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f332(a, b) {
+  let x = a * 332 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 332;
+  }
+  if (x > 332) {
+    print("f332 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f333(a, b) {
+  let x = a * 333 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 333;
+  }
+  if (x > 333) {
+    print("f333 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f334(a, b) {
+  let x = a * 334 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 334;
+  }
+  if (x > 334) {
+    print("f334 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f335(a, b) {
+  let x = a * 335 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 335;
+  }
+  if (x > 335) {
+    print("f335 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f336(a, b) {
+  let x = a * 336 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 336;
+  }
+  if (x > 336) {
+    print("f336 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f337(a, b) {
+  let x = a * 337 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 337;
+  }
+  if (x > 337) {
+    print("f337 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f338(a, b) {
+  let x = a * 338 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 338;
+  }
+  if (x > 338) {
+    print("f338 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f339(a, b) {
+  let x = a * 339 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 339;
+  }
+  if (x > 339) {
+    print("f339 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f340(a, b) {
+  let x = a * 340 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 340;
+  }
+  if (x > 340) {
+    print("f340 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f341(a, b) {
+  let x = a * 341 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 341;
+  }
+  if (x > 341) {
+    print("f341 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f342(a, b) {
+  let x = a * 342 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 342;
+  }
+  if (x > 342) {
+    print("f342 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f343(a, b) {
+  let x = a * 343 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 343;
+  }
+  if (x > 343) {
+    print("f343 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f344(a, b) {
+  let x = a * 344 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 344;
+  }
+  if (x > 344) {
+    print("f344 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f345(a, b) {
+  let x = a * 345 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 345;
+  }
+  if (x > 345) {
+    print("f345 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f346(a, b) {
+  let x = a * 346 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 346;
+  }
+  if (x > 346) {
+    print("f346 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f347(a, b) {
+  let x = a * 347 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 347;
+  }
+  if (x > 347) {
+    print("f347 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f348(a, b) {
+  let x = a * 348 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 348;
+  }
+  if (x > 348) {
+    print("f348 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f349(a, b) {
+  let x = a * 349 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 349;
+  }
+  if (x > 349) {
+    print("f349 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f350(a, b) {
+  let x = a * 350 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 350;
+  }
+  if (x > 350) {
+    print("f350 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f351(a, b) {
+  let x = a * 351 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 351;
+  }
+  if (x > 351) {
+    print("f351 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f352(a, b) {
+  let x = a * 352 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 352;
+  }
+  if (x > 352) {
+    print("f352 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f353(a, b) {
+  let x = a * 353 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 353;
+  }
+  if (x > 353) {
+    print("f353 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f354(a, b) {
+  let x = a * 354 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 354;
+  }
+  if (x > 354) {
+    print("f354 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f355(a, b) {
+  let x = a * 355 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 355;
+  }
+  if (x > 355) {
+    print("f355 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f356(a, b) {
+  let x = a * 356 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 356;
+  }
+  if (x > 356) {
+    print("f356 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f357(a, b) {
+  let x = a * 357 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 357;
+  }
+  if (x > 357) {
+    print("f357 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f358(a, b) {
+  let x = a * 358 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 358;
+  }
+  if (x > 358) {
+    print("f358 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f359(a, b) {
+  let x = a * 359 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 359;
+  }
+  if (x > 359) {
+    print("f359 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f360(a, b) {
+  let x = a * 360 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 360;
+  }
+  if (x > 360) {
+    print("f360 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f361(a, b) {
+  let x = a * 361 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 361;
+  }
+  if (x > 361) {
+    print("f361 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f362(a, b) {
+  let x = a * 362 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 362;
+  }
+  if (x > 362) {
+    print("f362 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f363(a, b) {
+  let x = a * 363 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 363;
+  }
+  if (x > 363) {
+    print("f363 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f364(a, b) {
+  let x = a * 364 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 364;
+  }
+  if (x > 364) {
+    print("f364 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f365(a, b) {
+  let x = a * 365 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 365;
+  }
+  if (x > 365) {
+    print("f365 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f366(a, b) {
+  let x = a * 366 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 366;
+  }
+  if (x > 366) {
+    print("f366 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f367(a, b) {
+  let x = a * 367 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 367;
+  }
+  if (x > 367) {
+    print("f367 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f368(a, b) {
+  let x = a * 368 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 368;
+  }
+  if (x > 368) {
+    print("f368 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f369(a, b) {
+  let x = a * 369 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 369;
+  }
+  if (x > 369) {
+    print("f369 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f370(a, b) {
+  let x = a * 370 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 370;
+  }
+  if (x > 370) {
+    print("f370 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f371(a, b) {
+  let x = a * 371 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 371;
+  }
+  if (x > 371) {
+    print("f371 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f372(a, b) {
+  let x = a * 372 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 372;
+  }
+  if (x > 372) {
+    print("f372 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f373(a, b) {
+  let x = a * 373 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 373;
+  }
+  if (x > 373) {
+    print("f373 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f374(a, b) {
+  let x = a * 374 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 374;
+  }
+  if (x > 374) {
+    print("f374 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f375(a, b) {
+  let x = a * 375 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 375;
+  }
+  if (x > 375) {
+    print("f375 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f376(a, b) {
+  let x = a * 376 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 376;
+  }
+  if (x > 376) {
+    print("f376 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f377(a, b) {
+  let x = a * 377 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 377;
+  }
+  if (x > 377) {
+    print("f377 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f378(a, b) {
+  let x = a * 378 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 378;
+  }
+  if (x > 378) {
+    print("f378 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f379(a, b) {
+  let x = a * 379 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 379;
+  }
+  if (x > 379) {
+    print("f379 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f380(a, b) {
+  let x = a * 380 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 380;
+  }
+  if (x > 380) {
+    print("f380 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f381(a, b) {
+  let x = a * 381 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 381;
+  }
+  if (x > 381) {
+    print("f381 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f382(a, b) {
+  let x = a * 382 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 382;
+  }
+  if (x > 382) {
+    print("f382 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f383(a, b) {
+  let x = a * 383 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 383;
+  }
+  if (x > 383) {
+    print("f383 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f384(a, b) {
+  let x = a * 384 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 384;
+  }
+  if (x > 384) {
+    print("f384 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f385(a, b) {
+  let x = a * 385 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 385;
+  }
+  if (x > 385) {
+    print("f385 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f386(a, b) {
+  let x = a * 386 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 386;
+  }
+  if (x > 386) {
+    print("f386 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f387(a, b) {
+  let x = a * 387 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 387;
+  }
+  if (x > 387) {
+    print("f387 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f388(a, b) {
+  let x = a * 388 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 388;
+  }
+  if (x > 388) {
+    print("f388 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f389(a, b) {
+  let x = a * 389 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 389;
+  }
+  if (x > 389) {
+    print("f389 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f390(a, b) {
+  let x = a * 390 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 390;
+  }
+  if (x > 390) {
+    print("f390 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f391(a, b) {
+  let x = a * 391 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 391;
+  }
+  if (x > 391) {
+    print("f391 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f392(a, b) {
+  let x = a * 392 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 392;
+  }
+  if (x > 392) {
+    print("f392 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f393(a, b) {
+  let x = a * 393 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 393;
+  }
+  if (x > 393) {
+    print("f393 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f394(a, b) {
+  let x = a * 394 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 394;
+  }
+  if (x > 394) {
+    print("f394 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f395(a, b) {
+  let x = a * 395 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 395;
+  }
+  if (x > 395) {
+    print("f395 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f396(a, b) {
+  let x = a * 396 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 396;
+  }
+  if (x > 396) {
+    print("f396 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f397(a, b) {
+  let x = a * 397 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 397;
+  }
+  if (x > 397) {
+    print("f397 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f398(a, b) {
+  let x = a * 398 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 398;
+  }
+  if (x > 398) {
+    print("f398 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f399(a, b) {
+  let x = a * 399 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 399;
+  }
+  if (x > 399) {
+    print("f399 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f400(a, b) {
+  let x = a * 400 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 400;
+  }
+  if (x > 400) {
+    print("f400 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f401(a, b) {
+  let x = a * 401 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 401;
+  }
+  if (x > 401) {
+    print("f401 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f402(a, b) {
+  let x = a * 402 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 402;
+  }
+  if (x > 402) {
+    print("f402 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f403(a, b) {
+  let x = a * 403 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 403;
+  }
+  if (x > 403) {
+    print("f403 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f404(a, b) {
+  let x = a * 404 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 404;
+  }
+  if (x > 404) {
+    print("f404 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f405(a, b) {
+  let x = a * 405 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 405;
+  }
+  if (x > 405) {
+    print("f405 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f406(a, b) {
+  let x = a * 406 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 406;
+  }
+  if (x > 406) {
+    print("f406 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f407(a, b) {
+  let x = a * 407 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 407;
+  }
+  if (x > 407) {
+    print("f407 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f408(a, b) {
+  let x = a * 408 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 408;
+  }
+  if (x > 408) {
+    print("f408 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f409(a, b) {
+  let x = a * 409 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 409;
+  }
+  if (x > 409) {
+    print("f409 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f410(a, b) {
+  let x = a * 410 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 410;
+  }
+  if (x > 410) {
+    print("f410 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f411(a, b) {
+  let x = a * 411 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 411;
+  }
+  if (x > 411) {
+    print("f411 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f412(a, b) {
+  let x = a * 412 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 412;
+  }
+  if (x > 412) {
+    print("f412 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f413(a, b) {
+  let x = a * 413 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 413;
+  }
+  if (x > 413) {
+    print("f413 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f414(a, b) {
+  let x = a * 414 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 414;
+  }
+  if (x > 414) {
+    print("f414 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f415(a, b) {
+  let x = a * 415 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 415;
+  }
+  if (x > 415) {
+    print("f415 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f416(a, b) {
+  let x = a * 416 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 416;
+  }
+  if (x > 416) {
+    print("f416 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f417(a, b) {
+  let x = a * 417 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 417;
+  }
+  if (x > 417) {
+    print("f417 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f418(a, b) {
+  let x = a * 418 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 418;
+  }
+  if (x > 418) {
+    print("f418 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f419(a, b) {
+  let x = a * 419 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 419;
+  }
+  if (x > 419) {
+    print("f419 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f420(a, b) {
+  let x = a * 420 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 420;
+  }
+  if (x > 420) {
+    print("f420 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f421(a, b) {
+  let x = a * 421 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 421;
+  }
+  if (x > 421) {
+    print("f421 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f422(a, b) {
+  let x = a * 422 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 422;
+  }
+  if (x > 422) {
+    print("f422 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f423(a, b) {
+  let x = a * 423 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 423;
+  }
+  if (x > 423) {
+    print("f423 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f424(a, b) {
+  let x = a * 424 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 424;
+  }
+  if (x > 424) {
+    print("f424 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f425(a, b) {
+  let x = a * 425 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 425;
+  }
+  if (x > 425) {
+    print("f425 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f426(a, b) {
+  let x = a * 426 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 426;
+  }
+  if (x > 426) {
+    print("f426 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f427(a, b) {
+  let x = a * 427 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 427;
+  }
+  if (x > 427) {
+    print("f427 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f428(a, b) {
+  let x = a * 428 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 428;
+  }
+  if (x > 428) {
+    print("f428 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f429(a, b) {
+  let x = a * 429 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 429;
+  }
+  if (x > 429) {
+    print("f429 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f430(a, b) {
+  let x = a * 430 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 430;
+  }
+  if (x > 430) {
+    print("f430 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f431(a, b) {
+  let x = a * 431 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 431;
+  }
+  if (x > 431) {
+    print("f431 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f432(a, b) {
+  let x = a * 432 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 432;
+  }
+  if (x > 432) {
+    print("f432 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f433(a, b) {
+  let x = a * 433 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 433;
+  }
+  if (x > 433) {
+    print("f433 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f434(a, b) {
+  let x = a * 434 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 434;
+  }
+  if (x > 434) {
+    print("f434 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f435(a, b) {
+  let x = a * 435 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 435;
+  }
+  if (x > 435) {
+    print("f435 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f436(a, b) {
+  let x = a * 436 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 436;
+  }
+  if (x > 436) {
+    print("f436 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f437(a, b) {
+  let x = a * 437 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 437;
+  }
+  if (x > 437) {
+    print("f437 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f438(a, b) {
+  let x = a * 438 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 438;
+  }
+  if (x > 438) {
+    print("f438 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f439(a, b) {
+  let x = a * 439 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 439;
+  }
+  if (x > 439) {
+    print("f439 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f440(a, b) {
+  let x = a * 440 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 440;
+  }
+  if (x > 440) {
+    print("f440 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f441(a, b) {
+  let x = a * 441 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 441;
+  }
+  if (x > 441) {
+    print("f441 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f442(a, b) {
+  let x = a * 442 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 442;
+  }
+  if (x > 442) {
+    print("f442 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f443(a, b) {
+  let x = a * 443 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 443;
+  }
+  if (x > 443) {
+    print("f443 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f444(a, b) {
+  let x = a * 444 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 444;
+  }
+  if (x > 444) {
+    print("f444 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f445(a, b) {
+  let x = a * 445 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 445;
+  }
+  if (x > 445) {
+    print("f445 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f446(a, b) {
+  let x = a * 446 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 446;
+  }
+  if (x > 446) {
+    print("f446 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f447(a, b) {
+  let x = a * 447 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 447;
+  }
+  if (x > 447) {
+    print("f447 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f448(a, b) {
+  let x = a * 448 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 448;
+  }
+  if (x > 448) {
+    print("f448 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f449(a, b) {
+  let x = a * 449 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 449;
+  }
+  if (x > 449) {
+    print("f449 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f450(a, b) {
+  let x = a * 450 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 450;
+  }
+  if (x > 450) {
+    print("f450 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f451(a, b) {
+  let x = a * 451 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 451;
+  }
+  if (x > 451) {
+    print("f451 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f452(a, b) {
+  let x = a * 452 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 452;
+  }
+  if (x > 452) {
+    print("f452 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f453(a, b) {
+  let x = a * 453 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 453;
+  }
+  if (x > 453) {
+    print("f453 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f454(a, b) {
+  let x = a * 454 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 454;
+  }
+  if (x > 454) {
+    print("f454 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f455(a, b) {
+  let x = a * 455 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 455;
+  }
+  if (x > 455) {
+    print("f455 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f456(a, b) {
+  let x = a * 456 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 456;
+  }
+  if (x > 456) {
+    print("f456 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f457(a, b) {
+  let x = a * 457 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 457;
+  }
+  if (x > 457) {
+    print("f457 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f458(a, b) {
+  let x = a * 458 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 458;
+  }
+  if (x > 458) {
+    print("f458 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f459(a, b) {
+  let x = a * 459 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 459;
+  }
+  if (x > 459) {
+    print("f459 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f460(a, b) {
+  let x = a * 460 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 460;
+  }
+  if (x > 460) {
+    print("f460 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f461(a, b) {
+  let x = a * 461 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 461;
+  }
+  if (x > 461) {
+    print("f461 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f462(a, b) {
+  let x = a * 462 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 462;
+  }
+  if (x > 462) {
+    print("f462 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f463(a, b) {
+  let x = a * 463 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 463;
+  }
+  if (x > 463) {
+    print("f463 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f464(a, b) {
+  let x = a * 464 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 464;
+  }
+  if (x > 464) {
+    print("f464 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f465(a, b) {
+  let x = a * 465 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 465;
+  }
+  if (x > 465) {
+    print("f465 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f466(a, b) {
+  let x = a * 466 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 466;
+  }
+  if (x > 466) {
+    print("f466 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f467(a, b) {
+  let x = a * 467 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 467;
+  }
+  if (x > 467) {
+    print("f467 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f468(a, b) {
+  let x = a * 468 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 468;
+  }
+  if (x > 468) {
+    print("f468 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f469(a, b) {
+  let x = a * 469 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 469;
+  }
+  if (x > 469) {
+    print("f469 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f470(a, b) {
+  let x = a * 470 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 470;
+  }
+  if (x > 470) {
+    print("f470 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f471(a, b) {
+  let x = a * 471 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 471;
+  }
+  if (x > 471) {
+    print("f471 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f472(a, b) {
+  let x = a * 472 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 472;
+  }
+  if (x > 472) {
+    print("f472 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f473(a, b) {
+  let x = a * 473 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 473;
+  }
+  if (x > 473) {
+    print("f473 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f474(a, b) {
+  let x = a * 474 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 474;
+  }
+  if (x > 474) {
+    print("f474 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f475(a, b) {
+  let x = a * 475 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 475;
+  }
+  if (x > 475) {
+    print("f475 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f476(a, b) {
+  let x = a * 476 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 476;
+  }
+  if (x > 476) {
+    print("f476 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f477(a, b) {
+  let x = a * 477 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 477;
+  }
+  if (x > 477) {
+    print("f477 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f478(a, b) {
+  let x = a * 478 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 478;
+  }
+  if (x > 478) {
+    print("f478 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f479(a, b) {
+  let x = a * 479 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 479;
+  }
+  if (x > 479) {
+    print("f479 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f480(a, b) {
+  let x = a * 480 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 480;
+  }
+  if (x > 480) {
+    print("f480 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f481(a, b) {
+  let x = a * 481 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 481;
+  }
+  if (x > 481) {
+    print("f481 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f482(a, b) {
+  let x = a * 482 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 482;
+  }
+  if (x > 482) {
+    print("f482 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f483(a, b) {
+  let x = a * 483 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 483;
+  }
+  if (x > 483) {
+    print("f483 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f484(a, b) {
+  let x = a * 484 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 484;
+  }
+  if (x > 484) {
+    print("f484 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f485(a, b) {
+  let x = a * 485 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 485;
+  }
+  if (x > 485) {
+    print("f485 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f486(a, b) {
+  let x = a * 486 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 486;
+  }
+  if (x > 486) {
+    print("f486 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f487(a, b) {
+  let x = a * 487 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 487;
+  }
+  if (x > 487) {
+    print("f487 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f488(a, b) {
+  let x = a * 488 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 488;
+  }
+  if (x > 488) {
+    print("f488 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f489(a, b) {
+  let x = a * 489 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 489;
+  }
+  if (x > 489) {
+    print("f489 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f490(a, b) {
+  let x = a * 490 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 490;
+  }
+  if (x > 490) {
+    print("f490 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f491(a, b) {
+  let x = a * 491 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 491;
+  }
+  if (x > 491) {
+    print("f491 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f492(a, b) {
+  let x = a * 492 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 492;
+  }
+  if (x > 492) {
+    print("f492 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f493(a, b) {
+  let x = a * 493 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 493;
+  }
+  if (x > 493) {
+    print("f493 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f494(a, b) {
+  let x = a * 494 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 494;
+  }
+  if (x > 494) {
+    print("f494 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f495(a, b) {
+  let x = a * 495 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 495;
+  }
+  if (x > 495) {
+    print("f495 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f496(a, b) {
+  let x = a * 496 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 496;
+  }
+  if (x > 496) {
+    print("f496 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f497(a, b) {
+  let x = a * 497 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 497;
+  }
+  if (x > 497) {
+    print("f497 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f498(a, b) {
+  let x = a * 498 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 498;
+  }
+  if (x > 498) {
+    print("f498 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f499(a, b) {
+  let x = a * 499 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 499;
+  }
+  if (x > 499) {
+    print("f499 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f500(a, b) {
+  let x = a * 500 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 500;
+  }
+  if (x > 500) {
+    print("f500 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f501(a, b) {
+  let x = a * 501 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 501;
+  }
+  if (x > 501) {
+    print("f501 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f502(a, b) {
+  let x = a * 502 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 502;
+  }
+  if (x > 502) {
+    print("f502 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f503(a, b) {
+  let x = a * 503 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 503;
+  }
+  if (x > 503) {
+    print("f503 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f504(a, b) {
+  let x = a * 504 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 504;
+  }
+  if (x > 504) {
+    print("f504 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f505(a, b) {
+  let x = a * 505 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 505;
+  }
+  if (x > 505) {
+    print("f505 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f506(a, b) {
+  let x = a * 506 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 506;
+  }
+  if (x > 506) {
+    print("f506 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f507(a, b) {
+  let x = a * 507 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 507;
+  }
+  if (x > 507) {
+    print("f507 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f508(a, b) {
+  let x = a * 508 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 508;
+  }
+  if (x > 508) {
+    print("f508 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f509(a, b) {
+  let x = a * 509 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 509;
+  }
+  if (x > 509) {
+    print("f509 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f510(a, b) {
+  let x = a * 510 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 510;
+  }
+  if (x > 510) {
+    print("f510 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f511(a, b) {
+  let x = a * 511 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 511;
+  }
+  if (x > 511) {
+    print("f511 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f512(a, b) {
+  let x = a * 512 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 512;
+  }
+  if (x > 512) {
+    print("f512 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f513(a, b) {
+  let x = a * 513 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 513;
+  }
+  if (x > 513) {
+    print("f513 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f514(a, b) {
+  let x = a * 514 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 514;
+  }
+  if (x > 514) {
+    print("f514 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f515(a, b) {
+  let x = a * 515 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 515;
+  }
+  if (x > 515) {
+    print("f515 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f516(a, b) {
+  let x = a * 516 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 516;
+  }
+  if (x > 516) {
+    print("f516 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f517(a, b) {
+  let x = a * 517 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 517;
+  }
+  if (x > 517) {
+    print("f517 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f518(a, b) {
+  let x = a * 518 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 518;
+  }
+  if (x > 518) {
+    print("f518 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f519(a, b) {
+  let x = a * 519 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 519;
+  }
+  if (x > 519) {
+    print("f519 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f520(a, b) {
+  let x = a * 520 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 520;
+  }
+  if (x > 520) {
+    print("f520 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f521(a, b) {
+  let x = a * 521 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 521;
+  }
+  if (x > 521) {
+    print("f521 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f522(a, b) {
+  let x = a * 522 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 522;
+  }
+  if (x > 522) {
+    print("f522 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f523(a, b) {
+  let x = a * 523 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 523;
+  }
+  if (x > 523) {
+    print("f523 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f524(a, b) {
+  let x = a * 524 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 524;
+  }
+  if (x > 524) {
+    print("f524 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f525(a, b) {
+  let x = a * 525 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 525;
+  }
+  if (x > 525) {
+    print("f525 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f526(a, b) {
+  let x = a * 526 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 526;
+  }
+  if (x > 526) {
+    print("f526 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f527(a, b) {
+  let x = a * 527 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 527;
+  }
+  if (x > 527) {
+    print("f527 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f528(a, b) {
+  let x = a * 528 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 528;
+  }
+  if (x > 528) {
+    print("f528 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f529(a, b) {
+  let x = a * 529 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 529;
+  }
+  if (x > 529) {
+    print("f529 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f530(a, b) {
+  let x = a * 530 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 530;
+  }
+  if (x > 530) {
+    print("f530 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f531(a, b) {
+  let x = a * 531 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 531;
+  }
+  if (x > 531) {
+    print("f531 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f532(a, b) {
+  let x = a * 532 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 532;
+  }
+  if (x > 532) {
+    print("f532 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f533(a, b) {
+  let x = a * 533 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 533;
+  }
+  if (x > 533) {
+    print("f533 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f534(a, b) {
+  let x = a * 534 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 534;
+  }
+  if (x > 534) {
+    print("f534 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f535(a, b) {
+  let x = a * 535 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 535;
+  }
+  if (x > 535) {
+    print("f535 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f536(a, b) {
+  let x = a * 536 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 536;
+  }
+  if (x > 536) {
+    print("f536 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f537(a, b) {
+  let x = a * 537 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 537;
+  }
+  if (x > 537) {
+    print("f537 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f538(a, b) {
+  let x = a * 538 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 538;
+  }
+  if (x > 538) {
+    print("f538 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f539(a, b) {
+  let x = a * 539 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 539;
+  }
+  if (x > 539) {
+    print("f539 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f540(a, b) {
+  let x = a * 540 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 540;
+  }
+  if (x > 540) {
+    print("f540 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f541(a, b) {
+  let x = a * 541 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 541;
+  }
+  if (x > 541) {
+    print("f541 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f542(a, b) {
+  let x = a * 542 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 542;
+  }
+  if (x > 542) {
+    print("f542 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f543(a, b) {
+  let x = a * 543 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 543;
+  }
+  if (x > 543) {
+    print("f543 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f544(a, b) {
+  let x = a * 544 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 544;
+  }
+  if (x > 544) {
+    print("f544 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f545(a, b) {
+  let x = a * 545 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 545;
+  }
+  if (x > 545) {
+    print("f545 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f546(a, b) {
+  let x = a * 546 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 546;
+  }
+  if (x > 546) {
+    print("f546 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f547(a, b) {
+  let x = a * 547 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 547;
+  }
+  if (x > 547) {
+    print("f547 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f548(a, b) {
+  let x = a * 548 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 548;
+  }
+  if (x > 548) {
+    print("f548 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f549(a, b) {
+  let x = a * 549 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 549;
+  }
+  if (x > 549) {
+    print("f549 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f550(a, b) {
+  let x = a * 550 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 550;
+  }
+  if (x > 550) {
+    print("f550 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f551(a, b) {
+  let x = a * 551 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 551;
+  }
+  if (x > 551) {
+    print("f551 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f552(a, b) {
+  let x = a * 552 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 552;
+  }
+  if (x > 552) {
+    print("f552 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f553(a, b) {
+  let x = a * 553 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 553;
+  }
+  if (x > 553) {
+    print("f553 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f554(a, b) {
+  let x = a * 554 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 554;
+  }
+  if (x > 554) {
+    print("f554 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f555(a, b) {
+  let x = a * 555 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 555;
+  }
+  if (x > 555) {
+    print("f555 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f556(a, b) {
+  let x = a * 556 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 556;
+  }
+  if (x > 556) {
+    print("f556 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f557(a, b) {
+  let x = a * 557 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 557;
+  }
+  if (x > 557) {
+    print("f557 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f558(a, b) {
+  let x = a * 558 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 558;
+  }
+  if (x > 558) {
+    print("f558 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f559(a, b) {
+  let x = a * 559 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 559;
+  }
+  if (x > 559) {
+    print("f559 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f560(a, b) {
+  let x = a * 560 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 560;
+  }
+  if (x > 560) {
+    print("f560 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f561(a, b) {
+  let x = a * 561 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 561;
+  }
+  if (x > 561) {
+    print("f561 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f562(a, b) {
+  let x = a * 562 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 562;
+  }
+  if (x > 562) {
+    print("f562 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f563(a, b) {
+  let x = a * 563 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 563;
+  }
+  if (x > 563) {
+    print("f563 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f564(a, b) {
+  let x = a * 564 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 564;
+  }
+  if (x > 564) {
+    print("f564 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f565(a, b) {
+  let x = a * 565 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 565;
+  }
+  if (x > 565) {
+    print("f565 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f566(a, b) {
+  let x = a * 566 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 566;
+  }
+  if (x > 566) {
+    print("f566 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f567(a, b) {
+  let x = a * 567 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 567;
+  }
+  if (x > 567) {
+    print("f567 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f568(a, b) {
+  let x = a * 568 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 568;
+  }
+  if (x > 568) {
+    print("f568 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f569(a, b) {
+  let x = a * 569 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 569;
+  }
+  if (x > 569) {
+    print("f569 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f570(a, b) {
+  let x = a * 570 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 570;
+  }
+  if (x > 570) {
+    print("f570 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f571(a, b) {
+  let x = a * 571 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 571;
+  }
+  if (x > 571) {
+    print("f571 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f572(a, b) {
+  let x = a * 572 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 572;
+  }
+  if (x > 572) {
+    print("f572 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f573(a, b) {
+  let x = a * 573 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 573;
+  }
+  if (x > 573) {
+    print("f573 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f574(a, b) {
+  let x = a * 574 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 574;
+  }
+  if (x > 574) {
+    print("f574 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f575(a, b) {
+  let x = a * 575 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 575;
+  }
+  if (x > 575) {
+    print("f575 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f576(a, b) {
+  let x = a * 576 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 576;
+  }
+  if (x > 576) {
+    print("f576 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f577(a, b) {
+  let x = a * 577 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 577;
+  }
+  if (x > 577) {
+    print("f577 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f578(a, b) {
+  let x = a * 578 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 578;
+  }
+  if (x > 578) {
+    print("f578 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f579(a, b) {
+  let x = a * 579 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 579;
+  }
+  if (x > 579) {
+    print("f579 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f580(a, b) {
+  let x = a * 580 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 580;
+  }
+  if (x > 580) {
+    print("f580 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f581(a, b) {
+  let x = a * 581 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 581;
+  }
+  if (x > 581) {
+    print("f581 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f582(a, b) {
+  let x = a * 582 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 582;
+  }
+  if (x > 582) {
+    print("f582 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f583(a, b) {
+  let x = a * 583 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 583;
+  }
+  if (x > 583) {
+    print("f583 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f584(a, b) {
+  let x = a * 584 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 584;
+  }
+  if (x > 584) {
+    print("f584 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f585(a, b) {
+  let x = a * 585 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 585;
+  }
+  if (x > 585) {
+    print("f585 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f586(a, b) {
+  let x = a * 586 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 586;
+  }
+  if (x > 586) {
+    print("f586 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f587(a, b) {
+  let x = a * 587 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 587;
+  }
+  if (x > 587) {
+    print("f587 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f588(a, b) {
+  let x = a * 588 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 588;
+  }
+  if (x > 588) {
+    print("f588 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f589(a, b) {
+  let x = a * 589 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 589;
+  }
+  if (x > 589) {
+    print("f589 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f590(a, b) {
+  let x = a * 590 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 590;
+  }
+  if (x > 590) {
+    print("f590 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f591(a, b) {
+  let x = a * 591 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 591;
+  }
+  if (x > 591) {
+    print("f591 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f592(a, b) {
+  let x = a * 592 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 592;
+  }
+  if (x > 592) {
+    print("f592 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f593(a, b) {
+  let x = a * 593 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 593;
+  }
+  if (x > 593) {
+    print("f593 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f594(a, b) {
+  let x = a * 594 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 594;
+  }
+  if (x > 594) {
+    print("f594 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f595(a, b) {
+  let x = a * 595 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 595;
+  }
+  if (x > 595) {
+    print("f595 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f596(a, b) {
+  let x = a * 596 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 596;
+  }
+  if (x > 596) {
+    print("f596 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f597(a, b) {
+  let x = a * 597 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 597;
+  }
+  if (x > 597) {
+    print("f597 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f598(a, b) {
+  let x = a * 598 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 598;
+  }
+  if (x > 598) {
+    print("f598 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f599(a, b) {
+  let x = a * 599 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 599;
+  }
+  if (x > 599) {
+    print("f599 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f600(a, b) {
+  let x = a * 600 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 600;
+  }
+  if (x > 600) {
+    print("f600 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f601(a, b) {
+  let x = a * 601 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 601;
+  }
+  if (x > 601) {
+    print("f601 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f602(a, b) {
+  let x = a * 602 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 602;
+  }
+  if (x > 602) {
+    print("f602 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f603(a, b) {
+  let x = a * 603 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 603;
+  }
+  if (x > 603) {
+    print("f603 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f604(a, b) {
+  let x = a * 604 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 604;
+  }
+  if (x > 604) {
+    print("f604 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f605(a, b) {
+  let x = a * 605 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 605;
+  }
+  if (x > 605) {
+    print("f605 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f606(a, b) {
+  let x = a * 606 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 606;
+  }
+  if (x > 606) {
+    print("f606 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f607(a, b) {
+  let x = a * 607 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 607;
+  }
+  if (x > 607) {
+    print("f607 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f608(a, b) {
+  let x = a * 608 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 608;
+  }
+  if (x > 608) {
+    print("f608 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f609(a, b) {
+  let x = a * 609 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 609;
+  }
+  if (x > 609) {
+    print("f609 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f610(a, b) {
+  let x = a * 610 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 610;
+  }
+  if (x > 610) {
+    print("f610 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f611(a, b) {
+  let x = a * 611 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 611;
+  }
+  if (x > 611) {
+    print("f611 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f612(a, b) {
+  let x = a * 612 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 612;
+  }
+  if (x > 612) {
+    print("f612 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f613(a, b) {
+  let x = a * 613 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 613;
+  }
+  if (x > 613) {
+    print("f613 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f614(a, b) {
+  let x = a * 614 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 614;
+  }
+  if (x > 614) {
+    print("f614 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f615(a, b) {
+  let x = a * 615 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 615;
+  }
+  if (x > 615) {
+    print("f615 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f616(a, b) {
+  let x = a * 616 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 616;
+  }
+  if (x > 616) {
+    print("f616 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f617(a, b) {
+  let x = a * 617 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 617;
+  }
+  if (x > 617) {
+    print("f617 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f618(a, b) {
+  let x = a * 618 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 618;
+  }
+  if (x > 618) {
+    print("f618 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f619(a, b) {
+  let x = a * 619 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 619;
+  }
+  if (x > 619) {
+    print("f619 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f620(a, b) {
+  let x = a * 620 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 620;
+  }
+  if (x > 620) {
+    print("f620 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f621(a, b) {
+  let x = a * 621 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 621;
+  }
+  if (x > 621) {
+    print("f621 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f622(a, b) {
+  let x = a * 622 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 622;
+  }
+  if (x > 622) {
+    print("f622 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f623(a, b) {
+  let x = a * 623 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 623;
+  }
+  if (x > 623) {
+    print("f623 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f624(a, b) {
+  let x = a * 624 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 624;
+  }
+  if (x > 624) {
+    print("f624 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f625(a, b) {
+  let x = a * 625 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 625;
+  }
+  if (x > 625) {
+    print("f625 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f626(a, b) {
+  let x = a * 626 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 626;
+  }
+  if (x > 626) {
+    print("f626 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f627(a, b) {
+  let x = a * 627 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 627;
+  }
+  if (x > 627) {
+    print("f627 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f628(a, b) {
+  let x = a * 628 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 628;
+  }
+  if (x > 628) {
+    print("f628 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f629(a, b) {
+  let x = a * 629 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 629;
+  }
+  if (x > 629) {
+    print("f629 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f630(a, b) {
+  let x = a * 630 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 630;
+  }
+  if (x > 630) {
+    print("f630 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f631(a, b) {
+  let x = a * 631 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 631;
+  }
+  if (x > 631) {
+    print("f631 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f632(a, b) {
+  let x = a * 632 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 632;
+  }
+  if (x > 632) {
+    print("f632 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f633(a, b) {
+  let x = a * 633 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 633;
+  }
+  if (x > 633) {
+    print("f633 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f634(a, b) {
+  let x = a * 634 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 634;
+  }
+  if (x > 634) {
+    print("f634 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f635(a, b) {
+  let x = a * 635 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 635;
+  }
+  if (x > 635) {
+    print("f635 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f636(a, b) {
+  let x = a * 636 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 636;
+  }
+  if (x > 636) {
+    print("f636 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f637(a, b) {
+  let x = a * 637 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 637;
+  }
+  if (x > 637) {
+    print("f637 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f638(a, b) {
+  let x = a * 638 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 638;
+  }
+  if (x > 638) {
+    print("f638 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f639(a, b) {
+  let x = a * 639 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 639;
+  }
+  if (x > 639) {
+    print("f639 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f640(a, b) {
+  let x = a * 640 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 640;
+  }
+  if (x > 640) {
+    print("f640 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f641(a, b) {
+  let x = a * 641 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 641;
+  }
+  if (x > 641) {
+    print("f641 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f642(a, b) {
+  let x = a * 642 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 642;
+  }
+  if (x > 642) {
+    print("f642 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f643(a, b) {
+  let x = a * 643 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 643;
+  }
+  if (x > 643) {
+    print("f643 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f644(a, b) {
+  let x = a * 644 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 644;
+  }
+  if (x > 644) {
+    print("f644 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f645(a, b) {
+  let x = a * 645 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 645;
+  }
+  if (x > 645) {
+    print("f645 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f646(a, b) {
+  let x = a * 646 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 646;
+  }
+  if (x > 646) {
+    print("f646 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f647(a, b) {
+  let x = a * 647 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 647;
+  }
+  if (x > 647) {
+    print("f647 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f648(a, b) {
+  let x = a * 648 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 648;
+  }
+  if (x > 648) {
+    print("f648 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f649(a, b) {
+  let x = a * 649 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 649;
+  }
+  if (x > 649) {
+    print("f649 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f650(a, b) {
+  let x = a * 650 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 650;
+  }
+  if (x > 650) {
+    print("f650 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f651(a, b) {
+  let x = a * 651 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 651;
+  }
+  if (x > 651) {
+    print("f651 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f652(a, b) {
+  let x = a * 652 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 652;
+  }
+  if (x > 652) {
+    print("f652 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f653(a, b) {
+  let x = a * 653 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 653;
+  }
+  if (x > 653) {
+    print("f653 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f654(a, b) {
+  let x = a * 654 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 654;
+  }
+  if (x > 654) {
+    print("f654 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f655(a, b) {
+  let x = a * 655 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 655;
+  }
+  if (x > 655) {
+    print("f655 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f656(a, b) {
+  let x = a * 656 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 656;
+  }
+  if (x > 656) {
+    print("f656 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f657(a, b) {
+  let x = a * 657 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 657;
+  }
+  if (x > 657) {
+    print("f657 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f658(a, b) {
+  let x = a * 658 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 658;
+  }
+  if (x > 658) {
+    print("f658 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f659(a, b) {
+  let x = a * 659 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 659;
+  }
+  if (x > 659) {
+    print("f659 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f660(a, b) {
+  let x = a * 660 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 660;
+  }
+  if (x > 660) {
+    print("f660 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f661(a, b) {
+  let x = a * 661 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 661;
+  }
+  if (x > 661) {
+    print("f661 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f662(a, b) {
+  let x = a * 662 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 662;
+  }
+  if (x > 662) {
+    print("f662 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f663(a, b) {
+  let x = a * 663 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 663;
+  }
+  if (x > 663) {
+    print("f663 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f664(a, b) {
+  let x = a * 664 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 664;
+  }
+  if (x > 664) {
+    print("f664 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f665(a, b) {
+  let x = a * 665 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 665;
+  }
+  if (x > 665) {
+    print("f665 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f666(a, b) {
+  let x = a * 666 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 666;
+  }
+  if (x > 666) {
+    print("f666 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f667(a, b) {
+  let x = a * 667 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 667;
+  }
+  if (x > 667) {
+    print("f667 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f668(a, b) {
+  let x = a * 668 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 668;
+  }
+  if (x > 668) {
+    print("f668 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f669(a, b) {
+  let x = a * 669 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 669;
+  }
+  if (x > 669) {
+    print("f669 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f670(a, b) {
+  let x = a * 670 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 670;
+  }
+  if (x > 670) {
+    print("f670 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f671(a, b) {
+  let x = a * 671 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 671;
+  }
+  if (x > 671) {
+    print("f671 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f672(a, b) {
+  let x = a * 672 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 672;
+  }
+  if (x > 672) {
+    print("f672 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f673(a, b) {
+  let x = a * 673 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 673;
+  }
+  if (x > 673) {
+    print("f673 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f674(a, b) {
+  let x = a * 674 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 674;
+  }
+  if (x > 674) {
+    print("f674 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f675(a, b) {
+  let x = a * 675 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 675;
+  }
+  if (x > 675) {
+    print("f675 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f676(a, b) {
+  let x = a * 676 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 676;
+  }
+  if (x > 676) {
+    print("f676 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f677(a, b) {
+  let x = a * 677 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 677;
+  }
+  if (x > 677) {
+    print("f677 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f678(a, b) {
+  let x = a * 678 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 678;
+  }
+  if (x > 678) {
+    print("f678 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f679(a, b) {
+  let x = a * 679 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 679;
+  }
+  if (x > 679) {
+    print("f679 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f680(a, b) {
+  let x = a * 680 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 680;
+  }
+  if (x > 680) {
+    print("f680 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f681(a, b) {
+  let x = a * 681 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 681;
+  }
+  if (x > 681) {
+    print("f681 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f682(a, b) {
+  let x = a * 682 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 682;
+  }
+  if (x > 682) {
+    print("f682 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f683(a, b) {
+  let x = a * 683 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 683;
+  }
+  if (x > 683) {
+    print("f683 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f684(a, b) {
+  let x = a * 684 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 684;
+  }
+  if (x > 684) {
+    print("f684 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f685(a, b) {
+  let x = a * 685 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 685;
+  }
+  if (x > 685) {
+    print("f685 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f686(a, b) {
+  let x = a * 686 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 686;
+  }
+  if (x > 686) {
+    print("f686 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f687(a, b) {
+  let x = a * 687 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 687;
+  }
+  if (x > 687) {
+    print("f687 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f688(a, b) {
+  let x = a * 688 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 688;
+  }
+  if (x > 688) {
+    print("f688 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f689(a, b) {
+  let x = a * 689 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 689;
+  }
+  if (x > 689) {
+    print("f689 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f690(a, b) {
+  let x = a * 690 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 690;
+  }
+  if (x > 690) {
+    print("f690 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f691(a, b) {
+  let x = a * 691 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 691;
+  }
+  if (x > 691) {
+    print("f691 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f692(a, b) {
+  let x = a * 692 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 692;
+  }
+  if (x > 692) {
+    print("f692 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f693(a, b) {
+  let x = a * 693 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 693;
+  }
+  if (x > 693) {
+    print("f693 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f694(a, b) {
+  let x = a * 694 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 694;
+  }
+  if (x > 694) {
+    print("f694 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f695(a, b) {
+  let x = a * 695 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 695;
+  }
+  if (x > 695) {
+    print("f695 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f696(a, b) {
+  let x = a * 696 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 696;
+  }
+  if (x > 696) {
+    print("f696 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f697(a, b) {
+  let x = a * 697 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 697;
+  }
+  if (x > 697) {
+    print("f697 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f698(a, b) {
+  let x = a * 698 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 698;
+  }
+  if (x > 698) {
+    print("f698 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f699(a, b) {
+  let x = a * 699 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 699;
+  }
+  if (x > 699) {
+    print("f699 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f700(a, b) {
+  let x = a * 700 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 700;
+  }
+  if (x > 700) {
+    print("f700 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f701(a, b) {
+  let x = a * 701 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 701;
+  }
+  if (x > 701) {
+    print("f701 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f702(a, b) {
+  let x = a * 702 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 702;
+  }
+  if (x > 702) {
+    print("f702 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f703(a, b) {
+  let x = a * 703 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 703;
+  }
+  if (x > 703) {
+    print("f703 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f704(a, b) {
+  let x = a * 704 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 704;
+  }
+  if (x > 704) {
+    print("f704 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f705(a, b) {
+  let x = a * 705 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 705;
+  }
+  if (x > 705) {
+    print("f705 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f706(a, b) {
+  let x = a * 706 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 706;
+  }
+  if (x > 706) {
+    print("f706 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f707(a, b) {
+  let x = a * 707 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 707;
+  }
+  if (x > 707) {
+    print("f707 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f708(a, b) {
+  let x = a * 708 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 708;
+  }
+  if (x > 708) {
+    print("f708 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f709(a, b) {
+  let x = a * 709 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 709;
+  }
+  if (x > 709) {
+    print("f709 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f710(a, b) {
+  let x = a * 710 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 710;
+  }
+  if (x > 710) {
+    print("f710 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f711(a, b) {
+  let x = a * 711 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 711;
+  }
+  if (x > 711) {
+    print("f711 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f712(a, b) {
+  let x = a * 712 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 712;
+  }
+  if (x > 712) {
+    print("f712 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f713(a, b) {
+  let x = a * 713 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 713;
+  }
+  if (x > 713) {
+    print("f713 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f714(a, b) {
+  let x = a * 714 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 714;
+  }
+  if (x > 714) {
+    print("f714 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f715(a, b) {
+  let x = a * 715 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 715;
+  }
+  if (x > 715) {
+    print("f715 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f716(a, b) {
+  let x = a * 716 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 716;
+  }
+  if (x > 716) {
+    print("f716 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f717(a, b) {
+  let x = a * 717 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 717;
+  }
+  if (x > 717) {
+    print("f717 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f718(a, b) {
+  let x = a * 718 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 718;
+  }
+  if (x > 718) {
+    print("f718 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f719(a, b) {
+  let x = a * 719 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 719;
+  }
+  if (x > 719) {
+    print("f719 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f720(a, b) {
+  let x = a * 720 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 720;
+  }
+  if (x > 720) {
+    print("f720 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f721(a, b) {
+  let x = a * 721 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 721;
+  }
+  if (x > 721) {
+    print("f721 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f722(a, b) {
+  let x = a * 722 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 722;
+  }
+  if (x > 722) {
+    print("f722 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f723(a, b) {
+  let x = a * 723 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 723;
+  }
+  if (x > 723) {
+    print("f723 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f724(a, b) {
+  let x = a * 724 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 724;
+  }
+  if (x > 724) {
+    print("f724 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f725(a, b) {
+  let x = a * 725 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 725;
+  }
+  if (x > 725) {
+    print("f725 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f726(a, b) {
+  let x = a * 726 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 726;
+  }
+  if (x > 726) {
+    print("f726 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f727(a, b) {
+  let x = a * 727 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 727;
+  }
+  if (x > 727) {
+    print("f727 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f728(a, b) {
+  let x = a * 728 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 728;
+  }
+  if (x > 728) {
+    print("f728 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f729(a, b) {
+  let x = a * 729 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 729;
+  }
+  if (x > 729) {
+    print("f729 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f730(a, b) {
+  let x = a * 730 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 730;
+  }
+  if (x > 730) {
+    print("f730 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f731(a, b) {
+  let x = a * 731 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 731;
+  }
+  if (x > 731) {
+    print("f731 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f732(a, b) {
+  let x = a * 732 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 732;
+  }
+  if (x > 732) {
+    print("f732 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f733(a, b) {
+  let x = a * 733 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 733;
+  }
+  if (x > 733) {
+    print("f733 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f734(a, b) {
+  let x = a * 734 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 734;
+  }
+  if (x > 734) {
+    print("f734 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f735(a, b) {
+  let x = a * 735 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 735;
+  }
+  if (x > 735) {
+    print("f735 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f736(a, b) {
+  let x = a * 736 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 736;
+  }
+  if (x > 736) {
+    print("f736 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f737(a, b) {
+  let x = a * 737 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 737;
+  }
+  if (x > 737) {
+    print("f737 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f738(a, b) {
+  let x = a * 738 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 738;
+  }
+  if (x > 738) {
+    print("f738 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f739(a, b) {
+  let x = a * 739 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 739;
+  }
+  if (x > 739) {
+    print("f739 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f740(a, b) {
+  let x = a * 740 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 740;
+  }
+  if (x > 740) {
+    print("f740 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f741(a, b) {
+  let x = a * 741 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 741;
+  }
+  if (x > 741) {
+    print("f741 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f742(a, b) {
+  let x = a * 742 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 742;
+  }
+  if (x > 742) {
+    print("f742 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f743(a, b) {
+  let x = a * 743 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 743;
+  }
+  if (x > 743) {
+    print("f743 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f744(a, b) {
+  let x = a * 744 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 744;
+  }
+  if (x > 744) {
+    print("f744 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f745(a, b) {
+  let x = a * 745 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 745;
+  }
+  if (x > 745) {
+    print("f745 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f746(a, b) {
+  let x = a * 746 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 746;
+  }
+  if (x > 746) {
+    print("f746 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f747(a, b) {
+  let x = a * 747 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 747;
+  }
+  if (x > 747) {
+    print("f747 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f748(a, b) {
+  let x = a * 748 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 748;
+  }
+  if (x > 748) {
+    print("f748 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f749(a, b) {
+  let x = a * 749 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 749;
+  }
+  if (x > 749) {
+    print("f749 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f750(a, b) {
+  let x = a * 750 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 750;
+  }
+  if (x > 750) {
+    print("f750 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f751(a, b) {
+  let x = a * 751 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 751;
+  }
+  if (x > 751) {
+    print("f751 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f752(a, b) {
+  let x = a * 752 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 752;
+  }
+  if (x > 752) {
+    print("f752 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f753(a, b) {
+  let x = a * 753 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 753;
+  }
+  if (x > 753) {
+    print("f753 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f754(a, b) {
+  let x = a * 754 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 754;
+  }
+  if (x > 754) {
+    print("f754 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f755(a, b) {
+  let x = a * 755 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 755;
+  }
+  if (x > 755) {
+    print("f755 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f756(a, b) {
+  let x = a * 756 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 756;
+  }
+  if (x > 756) {
+    print("f756 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f757(a, b) {
+  let x = a * 757 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 757;
+  }
+  if (x > 757) {
+    print("f757 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f758(a, b) {
+  let x = a * 758 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 758;
+  }
+  if (x > 758) {
+    print("f758 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f759(a, b) {
+  let x = a * 759 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 759;
+  }
+  if (x > 759) {
+    print("f759 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f760(a, b) {
+  let x = a * 760 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 760;
+  }
+  if (x > 760) {
+    print("f760 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f761(a, b) {
+  let x = a * 761 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 761;
+  }
+  if (x > 761) {
+    print("f761 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f762(a, b) {
+  let x = a * 762 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 762;
+  }
+  if (x > 762) {
+    print("f762 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f763(a, b) {
+  let x = a * 763 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 763;
+  }
+  if (x > 763) {
+    print("f763 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f764(a, b) {
+  let x = a * 764 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 764;
+  }
+  if (x > 764) {
+    print("f764 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f765(a, b) {
+  let x = a * 765 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 765;
+  }
+  if (x > 765) {
+    print("f765 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f766(a, b) {
+  let x = a * 766 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 766;
+  }
+  if (x > 766) {
+    print("f766 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f767(a, b) {
+  let x = a * 767 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 767;
+  }
+  if (x > 767) {
+    print("f767 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f768(a, b) {
+  let x = a * 768 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 768;
+  }
+  if (x > 768) {
+    print("f768 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f769(a, b) {
+  let x = a * 769 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 769;
+  }
+  if (x > 769) {
+    print("f769 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f770(a, b) {
+  let x = a * 770 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 770;
+  }
+  if (x > 770) {
+    print("f770 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f771(a, b) {
+  let x = a * 771 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 771;
+  }
+  if (x > 771) {
+    print("f771 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f772(a, b) {
+  let x = a * 772 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 772;
+  }
+  if (x > 772) {
+    print("f772 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f773(a, b) {
+  let x = a * 773 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 773;
+  }
+  if (x > 773) {
+    print("f773 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f774(a, b) {
+  let x = a * 774 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 774;
+  }
+  if (x > 774) {
+    print("f774 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f775(a, b) {
+  let x = a * 775 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 775;
+  }
+  if (x > 775) {
+    print("f775 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f776(a, b) {
+  let x = a * 776 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 776;
+  }
+  if (x > 776) {
+    print("f776 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f777(a, b) {
+  let x = a * 777 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 777;
+  }
+  if (x > 777) {
+    print("f777 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f778(a, b) {
+  let x = a * 778 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 778;
+  }
+  if (x > 778) {
+    print("f778 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f779(a, b) {
+  let x = a * 779 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 779;
+  }
+  if (x > 779) {
+    print("f779 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f780(a, b) {
+  let x = a * 780 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 780;
+  }
+  if (x > 780) {
+    print("f780 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f781(a, b) {
+  let x = a * 781 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 781;
+  }
+  if (x > 781) {
+    print("f781 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f782(a, b) {
+  let x = a * 782 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 782;
+  }
+  if (x > 782) {
+    print("f782 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f783(a, b) {
+  let x = a * 783 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 783;
+  }
+  if (x > 783) {
+    print("f783 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f784(a, b) {
+  let x = a * 784 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 784;
+  }
+  if (x > 784) {
+    print("f784 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f785(a, b) {
+  let x = a * 785 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 785;
+  }
+  if (x > 785) {
+    print("f785 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f786(a, b) {
+  let x = a * 786 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 786;
+  }
+  if (x > 786) {
+    print("f786 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f787(a, b) {
+  let x = a * 787 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 787;
+  }
+  if (x > 787) {
+    print("f787 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f788(a, b) {
+  let x = a * 788 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 788;
+  }
+  if (x > 788) {
+    print("f788 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f789(a, b) {
+  let x = a * 789 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 789;
+  }
+  if (x > 789) {
+    print("f789 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f790(a, b) {
+  let x = a * 790 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 790;
+  }
+  if (x > 790) {
+    print("f790 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f791(a, b) {
+  let x = a * 791 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 791;
+  }
+  if (x > 791) {
+    print("f791 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f792(a, b) {
+  let x = a * 792 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 792;
+  }
+  if (x > 792) {
+    print("f792 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f793(a, b) {
+  let x = a * 793 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 793;
+  }
+  if (x > 793) {
+    print("f793 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f794(a, b) {
+  let x = a * 794 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 794;
+  }
+  if (x > 794) {
+    print("f794 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f795(a, b) {
+  let x = a * 795 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 795;
+  }
+  if (x > 795) {
+    print("f795 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f796(a, b) {
+  let x = a * 796 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 796;
+  }
+  if (x > 796) {
+    print("f796 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f797(a, b) {
+  let x = a * 797 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 797;
+  }
+  if (x > 797) {
+    print("f797 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f798(a, b) {
+  let x = a * 798 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 798;
+  }
+  if (x > 798) {
+    print("f798 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f799(a, b) {
+  let x = a * 799 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 799;
+  }
+  if (x > 799) {
+    print("f799 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f800(a, b) {
+  let x = a * 800 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 800;
+  }
+  if (x > 800) {
+    print("f800 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f801(a, b) {
+  let x = a * 801 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 801;
+  }
+  if (x > 801) {
+    print("f801 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f802(a, b) {
+  let x = a * 802 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 802;
+  }
+  if (x > 802) {
+    print("f802 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f803(a, b) {
+  let x = a * 803 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 803;
+  }
+  if (x > 803) {
+    print("f803 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f804(a, b) {
+  let x = a * 804 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 804;
+  }
+  if (x > 804) {
+    print("f804 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f805(a, b) {
+  let x = a * 805 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 805;
+  }
+  if (x > 805) {
+    print("f805 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f806(a, b) {
+  let x = a * 806 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 806;
+  }
+  if (x > 806) {
+    print("f806 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f807(a, b) {
+  let x = a * 807 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 807;
+  }
+  if (x > 807) {
+    print("f807 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f808(a, b) {
+  let x = a * 808 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 808;
+  }
+  if (x > 808) {
+    print("f808 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f809(a, b) {
+  let x = a * 809 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 809;
+  }
+  if (x > 809) {
+    print("f809 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f810(a, b) {
+  let x = a * 810 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 810;
+  }
+  if (x > 810) {
+    print("f810 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f811(a, b) {
+  let x = a * 811 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 811;
+  }
+  if (x > 811) {
+    print("f811 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f812(a, b) {
+  let x = a * 812 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 812;
+  }
+  if (x > 812) {
+    print("f812 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f813(a, b) {
+  let x = a * 813 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 813;
+  }
+  if (x > 813) {
+    print("f813 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f814(a, b) {
+  let x = a * 814 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 814;
+  }
+  if (x > 814) {
+    print("f814 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f815(a, b) {
+  let x = a * 815 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 815;
+  }
+  if (x > 815) {
+    print("f815 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f816(a, b) {
+  let x = a * 816 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 816;
+  }
+  if (x > 816) {
+    print("f816 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f817(a, b) {
+  let x = a * 817 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 817;
+  }
+  if (x > 817) {
+    print("f817 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f818(a, b) {
+  let x = a * 818 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 818;
+  }
+  if (x > 818) {
+    print("f818 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f819(a, b) {
+  let x = a * 819 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 819;
+  }
+  if (x > 819) {
+    print("f819 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f820(a, b) {
+  let x = a * 820 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 820;
+  }
+  if (x > 820) {
+    print("f820 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f821(a, b) {
+  let x = a * 821 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 821;
+  }
+  if (x > 821) {
+    print("f821 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f822(a, b) {
+  let x = a * 822 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 822;
+  }
+  if (x > 822) {
+    print("f822 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f823(a, b) {
+  let x = a * 823 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 823;
+  }
+  if (x > 823) {
+    print("f823 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f824(a, b) {
+  let x = a * 824 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 824;
+  }
+  if (x > 824) {
+    print("f824 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f825(a, b) {
+  let x = a * 825 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 825;
+  }
+  if (x > 825) {
+    print("f825 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f826(a, b) {
+  let x = a * 826 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 826;
+  }
+  if (x > 826) {
+    print("f826 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f827(a, b) {
+  let x = a * 827 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 827;
+  }
+  if (x > 827) {
+    print("f827 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f828(a, b) {
+  let x = a * 828 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 828;
+  }
+  if (x > 828) {
+    print("f828 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f829(a, b) {
+  let x = a * 829 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 829;
+  }
+  if (x > 829) {
+    print("f829 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f830(a, b) {
+  let x = a * 830 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 830;
+  }
+  if (x > 830) {
+    print("f830 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f831(a, b) {
+  let x = a * 831 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 831;
+  }
+  if (x > 831) {
+    print("f831 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f832(a, b) {
+  let x = a * 832 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 832;
+  }
+  if (x > 832) {
+    print("f832 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f833(a, b) {
+  let x = a * 833 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 833;
+  }
+  if (x > 833) {
+    print("f833 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f834(a, b) {
+  let x = a * 834 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 834;
+  }
+  if (x > 834) {
+    print("f834 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f835(a, b) {
+  let x = a * 835 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 835;
+  }
+  if (x > 835) {
+    print("f835 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f836(a, b) {
+  let x = a * 836 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 836;
+  }
+  if (x > 836) {
+    print("f836 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f837(a, b) {
+  let x = a * 837 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 837;
+  }
+  if (x > 837) {
+    print("f837 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f838(a, b) {
+  let x = a * 838 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 838;
+  }
+  if (x > 838) {
+    print("f838 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f839(a, b) {
+  let x = a * 839 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 839;
+  }
+  if (x > 839) {
+    print("f839 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f840(a, b) {
+  let x = a * 840 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 840;
+  }
+  if (x > 840) {
+    print("f840 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f841(a, b) {
+  let x = a * 841 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 841;
+  }
+  if (x > 841) {
+    print("f841 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f842(a, b) {
+  let x = a * 842 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 842;
+  }
+  if (x > 842) {
+    print("f842 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f843(a, b) {
+  let x = a * 843 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 843;
+  }
+  if (x > 843) {
+    print("f843 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f844(a, b) {
+  let x = a * 844 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 844;
+  }
+  if (x > 844) {
+    print("f844 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f845(a, b) {
+  let x = a * 845 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 845;
+  }
+  if (x > 845) {
+    print("f845 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f846(a, b) {
+  let x = a * 846 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 846;
+  }
+  if (x > 846) {
+    print("f846 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f847(a, b) {
+  let x = a * 847 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 847;
+  }
+  if (x > 847) {
+    print("f847 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f848(a, b) {
+  let x = a * 848 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 848;
+  }
+  if (x > 848) {
+    print("f848 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f849(a, b) {
+  let x = a * 849 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 849;
+  }
+  if (x > 849) {
+    print("f849 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f850(a, b) {
+  let x = a * 850 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 850;
+  }
+  if (x > 850) {
+    print("f850 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f851(a, b) {
+  let x = a * 851 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 851;
+  }
+  if (x > 851) {
+    print("f851 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f852(a, b) {
+  let x = a * 852 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 852;
+  }
+  if (x > 852) {
+    print("f852 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f853(a, b) {
+  let x = a * 853 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 853;
+  }
+  if (x > 853) {
+    print("f853 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f854(a, b) {
+  let x = a * 854 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 854;
+  }
+  if (x > 854) {
+    print("f854 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f855(a, b) {
+  let x = a * 855 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 855;
+  }
+  if (x > 855) {
+    print("f855 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f856(a, b) {
+  let x = a * 856 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 856;
+  }
+  if (x > 856) {
+    print("f856 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f857(a, b) {
+  let x = a * 857 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 857;
+  }
+  if (x > 857) {
+    print("f857 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f858(a, b) {
+  let x = a * 858 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 858;
+  }
+  if (x > 858) {
+    print("f858 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f859(a, b) {
+  let x = a * 859 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 859;
+  }
+  if (x > 859) {
+    print("f859 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f860(a, b) {
+  let x = a * 860 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 860;
+  }
+  if (x > 860) {
+    print("f860 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f861(a, b) {
+  let x = a * 861 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 861;
+  }
+  if (x > 861) {
+    print("f861 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f862(a, b) {
+  let x = a * 862 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 862;
+  }
+  if (x > 862) {
+    print("f862 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f863(a, b) {
+  let x = a * 863 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 863;
+  }
+  if (x > 863) {
+    print("f863 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f864(a, b) {
+  let x = a * 864 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 864;
+  }
+  if (x > 864) {
+    print("f864 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f865(a, b) {
+  let x = a * 865 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 865;
+  }
+  if (x > 865) {
+    print("f865 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f866(a, b) {
+  let x = a * 866 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 866;
+  }
+  if (x > 866) {
+    print("f866 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f867(a, b) {
+  let x = a * 867 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 867;
+  }
+  if (x > 867) {
+    print("f867 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f868(a, b) {
+  let x = a * 868 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 868;
+  }
+  if (x > 868) {
+    print("f868 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f869(a, b) {
+  let x = a * 869 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 869;
+  }
+  if (x > 869) {
+    print("f869 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f870(a, b) {
+  let x = a * 870 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 870;
+  }
+  if (x > 870) {
+    print("f870 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f871(a, b) {
+  let x = a * 871 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 871;
+  }
+  if (x > 871) {
+    print("f871 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f872(a, b) {
+  let x = a * 872 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 872;
+  }
+  if (x > 872) {
+    print("f872 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f873(a, b) {
+  let x = a * 873 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 873;
+  }
+  if (x > 873) {
+    print("f873 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f874(a, b) {
+  let x = a * 874 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 874;
+  }
+  if (x > 874) {
+    print("f874 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f875(a, b) {
+  let x = a * 875 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 875;
+  }
+  if (x > 875) {
+    print("f875 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f876(a, b) {
+  let x = a * 876 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 876;
+  }
+  if (x > 876) {
+    print("f876 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f877(a, b) {
+  let x = a * 877 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 877;
+  }
+  if (x > 877) {
+    print("f877 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f878(a, b) {
+  let x = a * 878 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 878;
+  }
+  if (x > 878) {
+    print("f878 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f879(a, b) {
+  let x = a * 879 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 879;
+  }
+  if (x > 879) {
+    print("f879 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f880(a, b) {
+  let x = a * 880 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 880;
+  }
+  if (x > 880) {
+    print("f880 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f881(a, b) {
+  let x = a * 881 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 881;
+  }
+  if (x > 881) {
+    print("f881 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f882(a, b) {
+  let x = a * 882 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 882;
+  }
+  if (x > 882) {
+    print("f882 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f883(a, b) {
+  let x = a * 883 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 883;
+  }
+  if (x > 883) {
+    print("f883 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f884(a, b) {
+  let x = a * 884 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 884;
+  }
+  if (x > 884) {
+    print("f884 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f885(a, b) {
+  let x = a * 885 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 885;
+  }
+  if (x > 885) {
+    print("f885 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f886(a, b) {
+  let x = a * 886 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 886;
+  }
+  if (x > 886) {
+    print("f886 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f887(a, b) {
+  let x = a * 887 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 887;
+  }
+  if (x > 887) {
+    print("f887 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f888(a, b) {
+  let x = a * 888 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 888;
+  }
+  if (x > 888) {
+    print("f888 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f889(a, b) {
+  let x = a * 889 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 889;
+  }
+  if (x > 889) {
+    print("f889 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f890(a, b) {
+  let x = a * 890 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 890;
+  }
+  if (x > 890) {
+    print("f890 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f891(a, b) {
+  let x = a * 891 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 891;
+  }
+  if (x > 891) {
+    print("f891 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f892(a, b) {
+  let x = a * 892 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 892;
+  }
+  if (x > 892) {
+    print("f892 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f893(a, b) {
+  let x = a * 893 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 893;
+  }
+  if (x > 893) {
+    print("f893 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f894(a, b) {
+  let x = a * 894 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 894;
+  }
+  if (x > 894) {
+    print("f894 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f895(a, b) {
+  let x = a * 895 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 895;
+  }
+  if (x > 895) {
+    print("f895 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f896(a, b) {
+  let x = a * 896 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 896;
+  }
+  if (x > 896) {
+    print("f896 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f897(a, b) {
+  let x = a * 897 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 897;
+  }
+  if (x > 897) {
+    print("f897 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f898(a, b) {
+  let x = a * 898 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 898;
+  }
+  if (x > 898) {
+    print("f898 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f899(a, b) {
+  let x = a * 899 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 899;
+  }
+  if (x > 899) {
+    print("f899 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f900(a, b) {
+  let x = a * 900 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 900;
+  }
+  if (x > 900) {
+    print("f900 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f901(a, b) {
+  let x = a * 901 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 901;
+  }
+  if (x > 901) {
+    print("f901 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f902(a, b) {
+  let x = a * 902 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 902;
+  }
+  if (x > 902) {
+    print("f902 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f903(a, b) {
+  let x = a * 903 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 903;
+  }
+  if (x > 903) {
+    print("f903 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f904(a, b) {
+  let x = a * 904 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 904;
+  }
+  if (x > 904) {
+    print("f904 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f905(a, b) {
+  let x = a * 905 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 905;
+  }
+  if (x > 905) {
+    print("f905 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f906(a, b) {
+  let x = a * 906 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 906;
+  }
+  if (x > 906) {
+    print("f906 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f907(a, b) {
+  let x = a * 907 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 907;
+  }
+  if (x > 907) {
+    print("f907 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f908(a, b) {
+  let x = a * 908 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 908;
+  }
+  if (x > 908) {
+    print("f908 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f909(a, b) {
+  let x = a * 909 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 909;
+  }
+  if (x > 909) {
+    print("f909 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f910(a, b) {
+  let x = a * 910 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 910;
+  }
+  if (x > 910) {
+    print("f910 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f911(a, b) {
+  let x = a * 911 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 911;
+  }
+  if (x > 911) {
+    print("f911 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f912(a, b) {
+  let x = a * 912 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 912;
+  }
+  if (x > 912) {
+    print("f912 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f913(a, b) {
+  let x = a * 913 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 913;
+  }
+  if (x > 913) {
+    print("f913 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f914(a, b) {
+  let x = a * 914 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 914;
+  }
+  if (x > 914) {
+    print("f914 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f915(a, b) {
+  let x = a * 915 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 915;
+  }
+  if (x > 915) {
+    print("f915 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f916(a, b) {
+  let x = a * 916 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 916;
+  }
+  if (x > 916) {
+    print("f916 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f917(a, b) {
+  let x = a * 917 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 917;
+  }
+  if (x > 917) {
+    print("f917 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f918(a, b) {
+  let x = a * 918 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 918;
+  }
+  if (x > 918) {
+    print("f918 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f919(a, b) {
+  let x = a * 919 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 919;
+  }
+  if (x > 919) {
+    print("f919 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f920(a, b) {
+  let x = a * 920 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 920;
+  }
+  if (x > 920) {
+    print("f920 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f921(a, b) {
+  let x = a * 921 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 921;
+  }
+  if (x > 921) {
+    print("f921 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f922(a, b) {
+  let x = a * 922 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 922;
+  }
+  if (x > 922) {
+    print("f922 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f923(a, b) {
+  let x = a * 923 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 923;
+  }
+  if (x > 923) {
+    print("f923 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f924(a, b) {
+  let x = a * 924 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 924;
+  }
+  if (x > 924) {
+    print("f924 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f925(a, b) {
+  let x = a * 925 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 925;
+  }
+  if (x > 925) {
+    print("f925 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f926(a, b) {
+  let x = a * 926 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 926;
+  }
+  if (x > 926) {
+    print("f926 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f927(a, b) {
+  let x = a * 927 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 927;
+  }
+  if (x > 927) {
+    print("f927 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f928(a, b) {
+  let x = a * 928 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 928;
+  }
+  if (x > 928) {
+    print("f928 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f929(a, b) {
+  let x = a * 929 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 929;
+  }
+  if (x > 929) {
+    print("f929 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f930(a, b) {
+  let x = a * 930 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 930;
+  }
+  if (x > 930) {
+    print("f930 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f931(a, b) {
+  let x = a * 931 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 931;
+  }
+  if (x > 931) {
+    print("f931 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f932(a, b) {
+  let x = a * 932 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 932;
+  }
+  if (x > 932) {
+    print("f932 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f933(a, b) {
+  let x = a * 933 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 933;
+  }
+  if (x > 933) {
+    print("f933 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f934(a, b) {
+  let x = a * 934 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 934;
+  }
+  if (x > 934) {
+    print("f934 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f935(a, b) {
+  let x = a * 935 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 935;
+  }
+  if (x > 935) {
+    print("f935 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f936(a, b) {
+  let x = a * 936 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 936;
+  }
+  if (x > 936) {
+    print("f936 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f937(a, b) {
+  let x = a * 937 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 937;
+  }
+  if (x > 937) {
+    print("f937 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f938(a, b) {
+  let x = a * 938 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 938;
+  }
+  if (x > 938) {
+    print("f938 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f939(a, b) {
+  let x = a * 939 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 939;
+  }
+  if (x > 939) {
+    print("f939 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f940(a, b) {
+  let x = a * 940 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 940;
+  }
+  if (x > 940) {
+    print("f940 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f941(a, b) {
+  let x = a * 941 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 941;
+  }
+  if (x > 941) {
+    print("f941 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f942(a, b) {
+  let x = a * 942 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 942;
+  }
+  if (x > 942) {
+    print("f942 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f943(a, b) {
+  let x = a * 943 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 943;
+  }
+  if (x > 943) {
+    print("f943 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f944(a, b) {
+  let x = a * 944 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 944;
+  }
+  if (x > 944) {
+    print("f944 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f945(a, b) {
+  let x = a * 945 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 945;
+  }
+  if (x > 945) {
+    print("f945 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f946(a, b) {
+  let x = a * 946 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 946;
+  }
+  if (x > 946) {
+    print("f946 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f947(a, b) {
+  let x = a * 947 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 947;
+  }
+  if (x > 947) {
+    print("f947 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f948(a, b) {
+  let x = a * 948 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 948;
+  }
+  if (x > 948) {
+    print("f948 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f949(a, b) {
+  let x = a * 949 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 949;
+  }
+  if (x > 949) {
+    print("f949 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f950(a, b) {
+  let x = a * 950 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 950;
+  }
+  if (x > 950) {
+    print("f950 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f951(a, b) {
+  let x = a * 951 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 951;
+  }
+  if (x > 951) {
+    print("f951 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f952(a, b) {
+  let x = a * 952 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 952;
+  }
+  if (x > 952) {
+    print("f952 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f953(a, b) {
+  let x = a * 953 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 953;
+  }
+  if (x > 953) {
+    print("f953 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f954(a, b) {
+  let x = a * 954 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 954;
+  }
+  if (x > 954) {
+    print("f954 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f955(a, b) {
+  let x = a * 955 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 955;
+  }
+  if (x > 955) {
+    print("f955 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f956(a, b) {
+  let x = a * 956 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 956;
+  }
+  if (x > 956) {
+    print("f956 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f957(a, b) {
+  let x = a * 957 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 957;
+  }
+  if (x > 957) {
+    print("f957 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f958(a, b) {
+  let x = a * 958 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 958;
+  }
+  if (x > 958) {
+    print("f958 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f959(a, b) {
+  let x = a * 959 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 959;
+  }
+  if (x > 959) {
+    print("f959 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f960(a, b) {
+  let x = a * 960 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 960;
+  }
+  if (x > 960) {
+    print("f960 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f961(a, b) {
+  let x = a * 961 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 961;
+  }
+  if (x > 961) {
+    print("f961 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f962(a, b) {
+  let x = a * 962 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 962;
+  }
+  if (x > 962) {
+    print("f962 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f963(a, b) {
+  let x = a * 963 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 963;
+  }
+  if (x > 963) {
+    print("f963 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f964(a, b) {
+  let x = a * 964 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 964;
+  }
+  if (x > 964) {
+    print("f964 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f965(a, b) {
+  let x = a * 965 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 965;
+  }
+  if (x > 965) {
+    print("f965 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f966(a, b) {
+  let x = a * 966 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 966;
+  }
+  if (x > 966) {
+    print("f966 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f967(a, b) {
+  let x = a * 967 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 967;
+  }
+  if (x > 967) {
+    print("f967 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f968(a, b) {
+  let x = a * 968 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 968;
+  }
+  if (x > 968) {
+    print("f968 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f969(a, b) {
+  let x = a * 969 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 969;
+  }
+  if (x > 969) {
+    print("f969 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f970(a, b) {
+  let x = a * 970 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 970;
+  }
+  if (x > 970) {
+    print("f970 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f971(a, b) {
+  let x = a * 971 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 971;
+  }
+  if (x > 971) {
+    print("f971 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f972(a, b) {
+  let x = a * 972 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 972;
+  }
+  if (x > 972) {
+    print("f972 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f973(a, b) {
+  let x = a * 973 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 973;
+  }
+  if (x > 973) {
+    print("f973 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f974(a, b) {
+  let x = a * 974 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 974;
+  }
+  if (x > 974) {
+    print("f974 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f975(a, b) {
+  let x = a * 975 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 975;
+  }
+  if (x > 975) {
+    print("f975 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f976(a, b) {
+  let x = a * 976 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 976;
+  }
+  if (x > 976) {
+    print("f976 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f977(a, b) {
+  let x = a * 977 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 977;
+  }
+  if (x > 977) {
+    print("f977 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f978(a, b) {
+  let x = a * 978 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 978;
+  }
+  if (x > 978) {
+    print("f978 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f979(a, b) {
+  let x = a * 979 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 979;
+  }
+  if (x > 979) {
+    print("f979 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f980(a, b) {
+  let x = a * 980 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 980;
+  }
+  if (x > 980) {
+    print("f980 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f981(a, b) {
+  let x = a * 981 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 981;
+  }
+  if (x > 981) {
+    print("f981 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f982(a, b) {
+  let x = a * 982 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 982;
+  }
+  if (x > 982) {
+    print("f982 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f983(a, b) {
+  let x = a * 983 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 983;
+  }
+  if (x > 983) {
+    print("f983 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f984(a, b) {
+  let x = a * 984 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 984;
+  }
+  if (x > 984) {
+    print("f984 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f985(a, b) {
+  let x = a * 985 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 985;
+  }
+  if (x > 985) {
+    print("f985 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f986(a, b) {
+  let x = a * 986 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 986;
+  }
+  if (x > 986) {
+    print("f986 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f987(a, b) {
+  let x = a * 987 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 987;
+  }
+  if (x > 987) {
+    print("f987 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f988(a, b) {
+  let x = a * 988 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 988;
+  }
+  if (x > 988) {
+    print("f988 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f989(a, b) {
+  let x = a * 989 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 989;
+  }
+  if (x > 989) {
+    print("f989 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f990(a, b) {
+  let x = a * 990 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 990;
+  }
+  if (x > 990) {
+    print("f990 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f991(a, b) {
+  let x = a * 991 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 991;
+  }
+  if (x > 991) {
+    print("f991 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f992(a, b) {
+  let x = a * 992 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 992;
+  }
+  if (x > 992) {
+    print("f992 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f993(a, b) {
+  let x = a * 993 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 993;
+  }
+  if (x > 993) {
+    print("f993 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f994(a, b) {
+  let x = a * 994 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 994;
+  }
+  if (x > 994) {
+    print("f994 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f995(a, b) {
+  let x = a * 995 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 995;
+  }
+  if (x > 995) {
+    print("f995 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f996(a, b) {
+  let x = a * 996 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 996;
+  }
+  if (x > 996) {
+    print("f996 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f997(a, b) {
+  let x = a * 997 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 997;
+  }
+  if (x > 997) {
+    print("f997 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f998(a, b) {
+  let x = a * 998 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 998;
+  }
+  if (x > 998) {
+    print("f998 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f999(a, b) {
+  let x = a * 999 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 999;
+  }
+  if (x > 999) {
+    print("f999 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1000(a, b) {
+  let x = a * 1000 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1000;
+  }
+  if (x > 1000) {
+    print("f1000 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1001(a, b) {
+  let x = a * 1001 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1001;
+  }
+  if (x > 1001) {
+    print("f1001 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1002(a, b) {
+  let x = a * 1002 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1002;
+  }
+  if (x > 1002) {
+    print("f1002 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1003(a, b) {
+  let x = a * 1003 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1003;
+  }
+  if (x > 1003) {
+    print("f1003 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1004(a, b) {
+  let x = a * 1004 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1004;
+  }
+  if (x > 1004) {
+    print("f1004 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1005(a, b) {
+  let x = a * 1005 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1005;
+  }
+  if (x > 1005) {
+    print("f1005 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1006(a, b) {
+  let x = a * 1006 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1006;
+  }
+  if (x > 1006) {
+    print("f1006 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1007(a, b) {
+  let x = a * 1007 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1007;
+  }
+  if (x > 1007) {
+    print("f1007 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1008(a, b) {
+  let x = a * 1008 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1008;
+  }
+  if (x > 1008) {
+    print("f1008 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1009(a, b) {
+  let x = a * 1009 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1009;
+  }
+  if (x > 1009) {
+    print("f1009 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1010(a, b) {
+  let x = a * 1010 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1010;
+  }
+  if (x > 1010) {
+    print("f1010 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1011(a, b) {
+  let x = a * 1011 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1011;
+  }
+  if (x > 1011) {
+    print("f1011 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1012(a, b) {
+  let x = a * 1012 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1012;
+  }
+  if (x > 1012) {
+    print("f1012 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1013(a, b) {
+  let x = a * 1013 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1013;
+  }
+  if (x > 1013) {
+    print("f1013 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1014(a, b) {
+  let x = a * 1014 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1014;
+  }
+  if (x > 1014) {
+    print("f1014 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1015(a, b) {
+  let x = a * 1015 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1015;
+  }
+  if (x > 1015) {
+    print("f1015 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1016(a, b) {
+  let x = a * 1016 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1016;
+  }
+  if (x > 1016) {
+    print("f1016 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1017(a, b) {
+  let x = a * 1017 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1017;
+  }
+  if (x > 1017) {
+    print("f1017 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1018(a, b) {
+  let x = a * 1018 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1018;
+  }
+  if (x > 1018) {
+    print("f1018 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1019(a, b) {
+  let x = a * 1019 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1019;
+  }
+  if (x > 1019) {
+    print("f1019 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1020(a, b) {
+  let x = a * 1020 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1020;
+  }
+  if (x > 1020) {
+    print("f1020 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1021(a, b) {
+  let x = a * 1021 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1021;
+  }
+  if (x > 1021) {
+    print("f1021 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1022(a, b) {
+  let x = a * 1022 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1022;
+  }
+  if (x > 1022) {
+    print("f1022 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1023(a, b) {
+  let x = a * 1023 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1023;
+  }
+  if (x > 1023) {
+    print("f1023 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1024(a, b) {
+  let x = a * 1024 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1024;
+  }
+  if (x > 1024) {
+    print("f1024 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1025(a, b) {
+  let x = a * 1025 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1025;
+  }
+  if (x > 1025) {
+    print("f1025 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1026(a, b) {
+  let x = a * 1026 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1026;
+  }
+  if (x > 1026) {
+    print("f1026 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1027(a, b) {
+  let x = a * 1027 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1027;
+  }
+  if (x > 1027) {
+    print("f1027 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1028(a, b) {
+  let x = a * 1028 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1028;
+  }
+  if (x > 1028) {
+    print("f1028 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1029(a, b) {
+  let x = a * 1029 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1029;
+  }
+  if (x > 1029) {
+    print("f1029 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1030(a, b) {
+  let x = a * 1030 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1030;
+  }
+  if (x > 1030) {
+    print("f1030 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1031(a, b) {
+  let x = a * 1031 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1031;
+  }
+  if (x > 1031) {
+    print("f1031 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1032(a, b) {
+  let x = a * 1032 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1032;
+  }
+  if (x > 1032) {
+    print("f1032 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1033(a, b) {
+  let x = a * 1033 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1033;
+  }
+  if (x > 1033) {
+    print("f1033 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1034(a, b) {
+  let x = a * 1034 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1034;
+  }
+  if (x > 1034) {
+    print("f1034 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1035(a, b) {
+  let x = a * 1035 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1035;
+  }
+  if (x > 1035) {
+    print("f1035 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1036(a, b) {
+  let x = a * 1036 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1036;
+  }
+  if (x > 1036) {
+    print("f1036 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1037(a, b) {
+  let x = a * 1037 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1037;
+  }
+  if (x > 1037) {
+    print("f1037 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1038(a, b) {
+  let x = a * 1038 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1038;
+  }
+  if (x > 1038) {
+    print("f1038 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1039(a, b) {
+  let x = a * 1039 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1039;
+  }
+  if (x > 1039) {
+    print("f1039 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1040(a, b) {
+  let x = a * 1040 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1040;
+  }
+  if (x > 1040) {
+    print("f1040 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1041(a, b) {
+  let x = a * 1041 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1041;
+  }
+  if (x > 1041) {
+    print("f1041 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1042(a, b) {
+  let x = a * 1042 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1042;
+  }
+  if (x > 1042) {
+    print("f1042 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1043(a, b) {
+  let x = a * 1043 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1043;
+  }
+  if (x > 1043) {
+    print("f1043 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1044(a, b) {
+  let x = a * 1044 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1044;
+  }
+  if (x > 1044) {
+    print("f1044 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1045(a, b) {
+  let x = a * 1045 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1045;
+  }
+  if (x > 1045) {
+    print("f1045 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1046(a, b) {
+  let x = a * 1046 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1046;
+  }
+  if (x > 1046) {
+    print("f1046 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1047(a, b) {
+  let x = a * 1047 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1047;
+  }
+  if (x > 1047) {
+    print("f1047 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1048(a, b) {
+  let x = a * 1048 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1048;
+  }
+  if (x > 1048) {
+    print("f1048 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1049(a, b) {
+  let x = a * 1049 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1049;
+  }
+  if (x > 1049) {
+    print("f1049 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1050(a, b) {
+  let x = a * 1050 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1050;
+  }
+  if (x > 1050) {
+    print("f1050 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1051(a, b) {
+  let x = a * 1051 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1051;
+  }
+  if (x > 1051) {
+    print("f1051 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1052(a, b) {
+  let x = a * 1052 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1052;
+  }
+  if (x > 1052) {
+    print("f1052 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1053(a, b) {
+  let x = a * 1053 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1053;
+  }
+  if (x > 1053) {
+    print("f1053 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1054(a, b) {
+  let x = a * 1054 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1054;
+  }
+  if (x > 1054) {
+    print("f1054 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1055(a, b) {
+  let x = a * 1055 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1055;
+  }
+  if (x > 1055) {
+    print("f1055 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1056(a, b) {
+  let x = a * 1056 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1056;
+  }
+  if (x > 1056) {
+    print("f1056 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1057(a, b) {
+  let x = a * 1057 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1057;
+  }
+  if (x > 1057) {
+    print("f1057 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1058(a, b) {
+  let x = a * 1058 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1058;
+  }
+  if (x > 1058) {
+    print("f1058 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1059(a, b) {
+  let x = a * 1059 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1059;
+  }
+  if (x > 1059) {
+    print("f1059 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1060(a, b) {
+  let x = a * 1060 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1060;
+  }
+  if (x > 1060) {
+    print("f1060 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1061(a, b) {
+  let x = a * 1061 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1061;
+  }
+  if (x > 1061) {
+    print("f1061 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1062(a, b) {
+  let x = a * 1062 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1062;
+  }
+  if (x > 1062) {
+    print("f1062 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1063(a, b) {
+  let x = a * 1063 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1063;
+  }
+  if (x > 1063) {
+    print("f1063 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1064(a, b) {
+  let x = a * 1064 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1064;
+  }
+  if (x > 1064) {
+    print("f1064 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1065(a, b) {
+  let x = a * 1065 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1065;
+  }
+  if (x > 1065) {
+    print("f1065 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1066(a, b) {
+  let x = a * 1066 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1066;
+  }
+  if (x > 1066) {
+    print("f1066 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1067(a, b) {
+  let x = a * 1067 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1067;
+  }
+  if (x > 1067) {
+    print("f1067 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1068(a, b) {
+  let x = a * 1068 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1068;
+  }
+  if (x > 1068) {
+    print("f1068 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1069(a, b) {
+  let x = a * 1069 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1069;
+  }
+  if (x > 1069) {
+    print("f1069 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1070(a, b) {
+  let x = a * 1070 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1070;
+  }
+  if (x > 1070) {
+    print("f1070 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1071(a, b) {
+  let x = a * 1071 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1071;
+  }
+  if (x > 1071) {
+    print("f1071 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1072(a, b) {
+  let x = a * 1072 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1072;
+  }
+  if (x > 1072) {
+    print("f1072 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1073(a, b) {
+  let x = a * 1073 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1073;
+  }
+  if (x > 1073) {
+    print("f1073 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1074(a, b) {
+  let x = a * 1074 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1074;
+  }
+  if (x > 1074) {
+    print("f1074 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1075(a, b) {
+  let x = a * 1075 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1075;
+  }
+  if (x > 1075) {
+    print("f1075 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1076(a, b) {
+  let x = a * 1076 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1076;
+  }
+  if (x > 1076) {
+    print("f1076 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1077(a, b) {
+  let x = a * 1077 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1077;
+  }
+  if (x > 1077) {
+    print("f1077 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1078(a, b) {
+  let x = a * 1078 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1078;
+  }
+  if (x > 1078) {
+    print("f1078 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1079(a, b) {
+  let x = a * 1079 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1079;
+  }
+  if (x > 1079) {
+    print("f1079 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1080(a, b) {
+  let x = a * 1080 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1080;
+  }
+  if (x > 1080) {
+    print("f1080 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1081(a, b) {
+  let x = a * 1081 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1081;
+  }
+  if (x > 1081) {
+    print("f1081 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1082(a, b) {
+  let x = a * 1082 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1082;
+  }
+  if (x > 1082) {
+    print("f1082 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1083(a, b) {
+  let x = a * 1083 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1083;
+  }
+  if (x > 1083) {
+    print("f1083 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1084(a, b) {
+  let x = a * 1084 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1084;
+  }
+  if (x > 1084) {
+    print("f1084 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1085(a, b) {
+  let x = a * 1085 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1085;
+  }
+  if (x > 1085) {
+    print("f1085 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1086(a, b) {
+  let x = a * 1086 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1086;
+  }
+  if (x > 1086) {
+    print("f1086 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1087(a, b) {
+  let x = a * 1087 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1087;
+  }
+  if (x > 1087) {
+    print("f1087 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1088(a, b) {
+  let x = a * 1088 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1088;
+  }
+  if (x > 1088) {
+    print("f1088 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1089(a, b) {
+  let x = a * 1089 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1089;
+  }
+  if (x > 1089) {
+    print("f1089 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1090(a, b) {
+  let x = a * 1090 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1090;
+  }
+  if (x > 1090) {
+    print("f1090 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1091(a, b) {
+  let x = a * 1091 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1091;
+  }
+  if (x > 1091) {
+    print("f1091 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1092(a, b) {
+  let x = a * 1092 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1092;
+  }
+  if (x > 1092) {
+    print("f1092 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1093(a, b) {
+  let x = a * 1093 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1093;
+  }
+  if (x > 1093) {
+    print("f1093 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1094(a, b) {
+  let x = a * 1094 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1094;
+  }
+  if (x > 1094) {
+    print("f1094 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1095(a, b) {
+  let x = a * 1095 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1095;
+  }
+  if (x > 1095) {
+    print("f1095 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1096(a, b) {
+  let x = a * 1096 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1096;
+  }
+  if (x > 1096) {
+    print("f1096 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1097(a, b) {
+  let x = a * 1097 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1097;
+  }
+  if (x > 1097) {
+    print("f1097 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1098(a, b) {
+  let x = a * 1098 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1098;
+  }
+  if (x > 1098) {
+    print("f1098 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1099(a, b) {
+  let x = a * 1099 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1099;
+  }
+  if (x > 1099) {
+    print("f1099 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1100(a, b) {
+  let x = a * 1100 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1100;
+  }
+  if (x > 1100) {
+    print("f1100 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1101(a, b) {
+  let x = a * 1101 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1101;
+  }
+  if (x > 1101) {
+    print("f1101 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1102(a, b) {
+  let x = a * 1102 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1102;
+  }
+  if (x > 1102) {
+    print("f1102 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1103(a, b) {
+  let x = a * 1103 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1103;
+  }
+  if (x > 1103) {
+    print("f1103 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1104(a, b) {
+  let x = a * 1104 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1104;
+  }
+  if (x > 1104) {
+    print("f1104 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1105(a, b) {
+  let x = a * 1105 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1105;
+  }
+  if (x > 1105) {
+    print("f1105 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1106(a, b) {
+  let x = a * 1106 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1106;
+  }
+  if (x > 1106) {
+    print("f1106 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1107(a, b) {
+  let x = a * 1107 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1107;
+  }
+  if (x > 1107) {
+    print("f1107 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1108(a, b) {
+  let x = a * 1108 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1108;
+  }
+  if (x > 1108) {
+    print("f1108 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1109(a, b) {
+  let x = a * 1109 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1109;
+  }
+  if (x > 1109) {
+    print("f1109 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1110(a, b) {
+  let x = a * 1110 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1110;
+  }
+  if (x > 1110) {
+    print("f1110 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1111(a, b) {
+  let x = a * 1111 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1111;
+  }
+  if (x > 1111) {
+    print("f1111 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1112(a, b) {
+  let x = a * 1112 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1112;
+  }
+  if (x > 1112) {
+    print("f1112 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1113(a, b) {
+  let x = a * 1113 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1113;
+  }
+  if (x > 1113) {
+    print("f1113 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1114(a, b) {
+  let x = a * 1114 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1114;
+  }
+  if (x > 1114) {
+    print("f1114 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1115(a, b) {
+  let x = a * 1115 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1115;
+  }
+  if (x > 1115) {
+    print("f1115 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1116(a, b) {
+  let x = a * 1116 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1116;
+  }
+  if (x > 1116) {
+    print("f1116 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1117(a, b) {
+  let x = a * 1117 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1117;
+  }
+  if (x > 1117) {
+    print("f1117 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1118(a, b) {
+  let x = a * 1118 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1118;
+  }
+  if (x > 1118) {
+    print("f1118 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1119(a, b) {
+  let x = a * 1119 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1119;
+  }
+  if (x > 1119) {
+    print("f1119 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1120(a, b) {
+  let x = a * 1120 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1120;
+  }
+  if (x > 1120) {
+    print("f1120 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1121(a, b) {
+  let x = a * 1121 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1121;
+  }
+  if (x > 1121) {
+    print("f1121 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1122(a, b) {
+  let x = a * 1122 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1122;
+  }
+  if (x > 1122) {
+    print("f1122 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1123(a, b) {
+  let x = a * 1123 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1123;
+  }
+  if (x > 1123) {
+    print("f1123 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1124(a, b) {
+  let x = a * 1124 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1124;
+  }
+  if (x > 1124) {
+    print("f1124 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1125(a, b) {
+  let x = a * 1125 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1125;
+  }
+  if (x > 1125) {
+    print("f1125 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1126(a, b) {
+  let x = a * 1126 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1126;
+  }
+  if (x > 1126) {
+    print("f1126 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1127(a, b) {
+  let x = a * 1127 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1127;
+  }
+  if (x > 1127) {
+    print("f1127 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1128(a, b) {
+  let x = a * 1128 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1128;
+  }
+  if (x > 1128) {
+    print("f1128 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1129(a, b) {
+  let x = a * 1129 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1129;
+  }
+  if (x > 1129) {
+    print("f1129 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1130(a, b) {
+  let x = a * 1130 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1130;
+  }
+  if (x > 1130) {
+    print("f1130 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1131(a, b) {
+  let x = a * 1131 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1131;
+  }
+  if (x > 1131) {
+    print("f1131 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1132(a, b) {
+  let x = a * 1132 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1132;
+  }
+  if (x > 1132) {
+    print("f1132 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1133(a, b) {
+  let x = a * 1133 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1133;
+  }
+  if (x > 1133) {
+    print("f1133 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1134(a, b) {
+  let x = a * 1134 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1134;
+  }
+  if (x > 1134) {
+    print("f1134 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1135(a, b) {
+  let x = a * 1135 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1135;
+  }
+  if (x > 1135) {
+    print("f1135 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1136(a, b) {
+  let x = a * 1136 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1136;
+  }
+  if (x > 1136) {
+    print("f1136 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1137(a, b) {
+  let x = a * 1137 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1137;
+  }
+  if (x > 1137) {
+    print("f1137 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1138(a, b) {
+  let x = a * 1138 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1138;
+  }
+  if (x > 1138) {
+    print("f1138 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1139(a, b) {
+  let x = a * 1139 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1139;
+  }
+  if (x > 1139) {
+    print("f1139 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1140(a, b) {
+  let x = a * 1140 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1140;
+  }
+  if (x > 1140) {
+    print("f1140 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1141(a, b) {
+  let x = a * 1141 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1141;
+  }
+  if (x > 1141) {
+    print("f1141 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1142(a, b) {
+  let x = a * 1142 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1142;
+  }
+  if (x > 1142) {
+    print("f1142 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1143(a, b) {
+  let x = a * 1143 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1143;
+  }
+  if (x > 1143) {
+    print("f1143 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1144(a, b) {
+  let x = a * 1144 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1144;
+  }
+  if (x > 1144) {
+    print("f1144 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1145(a, b) {
+  let x = a * 1145 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1145;
+  }
+  if (x > 1145) {
+    print("f1145 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1146(a, b) {
+  let x = a * 1146 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1146;
+  }
+  if (x > 1146) {
+    print("f1146 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1147(a, b) {
+  let x = a * 1147 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1147;
+  }
+  if (x > 1147) {
+    print("f1147 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1148(a, b) {
+  let x = a * 1148 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1148;
+  }
+  if (x > 1148) {
+    print("f1148 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1149(a, b) {
+  let x = a * 1149 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1149;
+  }
+  if (x > 1149) {
+    print("f1149 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1150(a, b) {
+  let x = a * 1150 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1150;
+  }
+  if (x > 1150) {
+    print("f1150 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1151(a, b) {
+  let x = a * 1151 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1151;
+  }
+  if (x > 1151) {
+    print("f1151 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1152(a, b) {
+  let x = a * 1152 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1152;
+  }
+  if (x > 1152) {
+    print("f1152 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1153(a, b) {
+  let x = a * 1153 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1153;
+  }
+  if (x > 1153) {
+    print("f1153 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1154(a, b) {
+  let x = a * 1154 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1154;
+  }
+  if (x > 1154) {
+    print("f1154 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1155(a, b) {
+  let x = a * 1155 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1155;
+  }
+  if (x > 1155) {
+    print("f1155 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1156(a, b) {
+  let x = a * 1156 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1156;
+  }
+  if (x > 1156) {
+    print("f1156 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1157(a, b) {
+  let x = a * 1157 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1157;
+  }
+  if (x > 1157) {
+    print("f1157 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1158(a, b) {
+  let x = a * 1158 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1158;
+  }
+  if (x > 1158) {
+    print("f1158 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1159(a, b) {
+  let x = a * 1159 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1159;
+  }
+  if (x > 1159) {
+    print("f1159 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1160(a, b) {
+  let x = a * 1160 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1160;
+  }
+  if (x > 1160) {
+    print("f1160 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1161(a, b) {
+  let x = a * 1161 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1161;
+  }
+  if (x > 1161) {
+    print("f1161 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1162(a, b) {
+  let x = a * 1162 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1162;
+  }
+  if (x > 1162) {
+    print("f1162 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1163(a, b) {
+  let x = a * 1163 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1163;
+  }
+  if (x > 1163) {
+    print("f1163 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1164(a, b) {
+  let x = a * 1164 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1164;
+  }
+  if (x > 1164) {
+    print("f1164 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1165(a, b) {
+  let x = a * 1165 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1165;
+  }
+  if (x > 1165) {
+    print("f1165 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1166(a, b) {
+  let x = a * 1166 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1166;
+  }
+  if (x > 1166) {
+    print("f1166 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1167(a, b) {
+  let x = a * 1167 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1167;
+  }
+  if (x > 1167) {
+    print("f1167 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1168(a, b) {
+  let x = a * 1168 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1168;
+  }
+  if (x > 1168) {
+    print("f1168 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1169(a, b) {
+  let x = a * 1169 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1169;
+  }
+  if (x > 1169) {
+    print("f1169 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1170(a, b) {
+  let x = a * 1170 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1170;
+  }
+  if (x > 1170) {
+    print("f1170 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1171(a, b) {
+  let x = a * 1171 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1171;
+  }
+  if (x > 1171) {
+    print("f1171 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1172(a, b) {
+  let x = a * 1172 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1172;
+  }
+  if (x > 1172) {
+    print("f1172 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1173(a, b) {
+  let x = a * 1173 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1173;
+  }
+  if (x > 1173) {
+    print("f1173 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1174(a, b) {
+  let x = a * 1174 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1174;
+  }
+  if (x > 1174) {
+    print("f1174 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1175(a, b) {
+  let x = a * 1175 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1175;
+  }
+  if (x > 1175) {
+    print("f1175 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1176(a, b) {
+  let x = a * 1176 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1176;
+  }
+  if (x > 1176) {
+    print("f1176 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1177(a, b) {
+  let x = a * 1177 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1177;
+  }
+  if (x > 1177) {
+    print("f1177 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1178(a, b) {
+  let x = a * 1178 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1178;
+  }
+  if (x > 1178) {
+    print("f1178 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1179(a, b) {
+  let x = a * 1179 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1179;
+  }
+  if (x > 1179) {
+    print("f1179 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1180(a, b) {
+  let x = a * 1180 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1180;
+  }
+  if (x > 1180) {
+    print("f1180 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1181(a, b) {
+  let x = a * 1181 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1181;
+  }
+  if (x > 1181) {
+    print("f1181 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1182(a, b) {
+  let x = a * 1182 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1182;
+  }
+  if (x > 1182) {
+    print("f1182 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1183(a, b) {
+  let x = a * 1183 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1183;
+  }
+  if (x > 1183) {
+    print("f1183 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1184(a, b) {
+  let x = a * 1184 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1184;
+  }
+  if (x > 1184) {
+    print("f1184 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1185(a, b) {
+  let x = a * 1185 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1185;
+  }
+  if (x > 1185) {
+    print("f1185 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1186(a, b) {
+  let x = a * 1186 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1186;
+  }
+  if (x > 1186) {
+    print("f1186 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1187(a, b) {
+  let x = a * 1187 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1187;
+  }
+  if (x > 1187) {
+    print("f1187 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1188(a, b) {
+  let x = a * 1188 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1188;
+  }
+  if (x > 1188) {
+    print("f1188 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1189(a, b) {
+  let x = a * 1189 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1189;
+  }
+  if (x > 1189) {
+    print("f1189 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1190(a, b) {
+  let x = a * 1190 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1190;
+  }
+  if (x > 1190) {
+    print("f1190 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1191(a, b) {
+  let x = a * 1191 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1191;
+  }
+  if (x > 1191) {
+    print("f1191 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1192(a, b) {
+  let x = a * 1192 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1192;
+  }
+  if (x > 1192) {
+    print("f1192 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1193(a, b) {
+  let x = a * 1193 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1193;
+  }
+  if (x > 1193) {
+    print("f1193 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1194(a, b) {
+  let x = a * 1194 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1194;
+  }
+  if (x > 1194) {
+    print("f1194 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1195(a, b) {
+  let x = a * 1195 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1195;
+  }
+  if (x > 1195) {
+    print("f1195 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1196(a, b) {
+  let x = a * 1196 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1196;
+  }
+  if (x > 1196) {
+    print("f1196 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1197(a, b) {
+  let x = a * 1197 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1197;
+  }
+  if (x > 1197) {
+    print("f1197 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1198(a, b) {
+  let x = a * 1198 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1198;
+  }
+  if (x > 1198) {
+    print("f1198 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1199(a, b) {
+  let x = a * 1199 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1199;
+  }
+  if (x > 1199) {
+    print("f1199 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1200(a, b) {
+  let x = a * 1200 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1200;
+  }
+  if (x > 1200) {
+    print("f1200 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1201(a, b) {
+  let x = a * 1201 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1201;
+  }
+  if (x > 1201) {
+    print("f1201 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1202(a, b) {
+  let x = a * 1202 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1202;
+  }
+  if (x > 1202) {
+    print("f1202 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1203(a, b) {
+  let x = a * 1203 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1203;
+  }
+  if (x > 1203) {
+    print("f1203 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1204(a, b) {
+  let x = a * 1204 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1204;
+  }
+  if (x > 1204) {
+    print("f1204 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1205(a, b) {
+  let x = a * 1205 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1205;
+  }
+  if (x > 1205) {
+    print("f1205 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1206(a, b) {
+  let x = a * 1206 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1206;
+  }
+  if (x > 1206) {
+    print("f1206 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1207(a, b) {
+  let x = a * 1207 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1207;
+  }
+  if (x > 1207) {
+    print("f1207 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1208(a, b) {
+  let x = a * 1208 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1208;
+  }
+  if (x > 1208) {
+    print("f1208 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1209(a, b) {
+  let x = a * 1209 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1209;
+  }
+  if (x > 1209) {
+    print("f1209 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1210(a, b) {
+  let x = a * 1210 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1210;
+  }
+  if (x > 1210) {
+    print("f1210 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1211(a, b) {
+  let x = a * 1211 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1211;
+  }
+  if (x > 1211) {
+    print("f1211 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1212(a, b) {
+  let x = a * 1212 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1212;
+  }
+  if (x > 1212) {
+    print("f1212 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1213(a, b) {
+  let x = a * 1213 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1213;
+  }
+  if (x > 1213) {
+    print("f1213 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1214(a, b) {
+  let x = a * 1214 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1214;
+  }
+  if (x > 1214) {
+    print("f1214 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1215(a, b) {
+  let x = a * 1215 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1215;
+  }
+  if (x > 1215) {
+    print("f1215 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1216(a, b) {
+  let x = a * 1216 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1216;
+  }
+  if (x > 1216) {
+    print("f1216 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1217(a, b) {
+  let x = a * 1217 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1217;
+  }
+  if (x > 1217) {
+    print("f1217 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1218(a, b) {
+  let x = a * 1218 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1218;
+  }
+  if (x > 1218) {
+    print("f1218 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1219(a, b) {
+  let x = a * 1219 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1219;
+  }
+  if (x > 1219) {
+    print("f1219 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1220(a, b) {
+  let x = a * 1220 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1220;
+  }
+  if (x > 1220) {
+    print("f1220 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1221(a, b) {
+  let x = a * 1221 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1221;
+  }
+  if (x > 1221) {
+    print("f1221 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1222(a, b) {
+  let x = a * 1222 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1222;
+  }
+  if (x > 1222) {
+    print("f1222 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1223(a, b) {
+  let x = a * 1223 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1223;
+  }
+  if (x > 1223) {
+    print("f1223 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1224(a, b) {
+  let x = a * 1224 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1224;
+  }
+  if (x > 1224) {
+    print("f1224 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1225(a, b) {
+  let x = a * 1225 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1225;
+  }
+  if (x > 1225) {
+    print("f1225 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1226(a, b) {
+  let x = a * 1226 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1226;
+  }
+  if (x > 1226) {
+    print("f1226 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1227(a, b) {
+  let x = a * 1227 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1227;
+  }
+  if (x > 1227) {
+    print("f1227 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1228(a, b) {
+  let x = a * 1228 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1228;
+  }
+  if (x > 1228) {
+    print("f1228 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1229(a, b) {
+  let x = a * 1229 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1229;
+  }
+  if (x > 1229) {
+    print("f1229 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1230(a, b) {
+  let x = a * 1230 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1230;
+  }
+  if (x > 1230) {
+    print("f1230 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1231(a, b) {
+  let x = a * 1231 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1231;
+  }
+  if (x > 1231) {
+    print("f1231 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1232(a, b) {
+  let x = a * 1232 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1232;
+  }
+  if (x > 1232) {
+    print("f1232 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1233(a, b) {
+  let x = a * 1233 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1233;
+  }
+  if (x > 1233) {
+    print("f1233 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1234(a, b) {
+  let x = a * 1234 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1234;
+  }
+  if (x > 1234) {
+    print("f1234 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1235(a, b) {
+  let x = a * 1235 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1235;
+  }
+  if (x > 1235) {
+    print("f1235 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1236(a, b) {
+  let x = a * 1236 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1236;
+  }
+  if (x > 1236) {
+    print("f1236 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1237(a, b) {
+  let x = a * 1237 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1237;
+  }
+  if (x > 1237) {
+    print("f1237 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1238(a, b) {
+  let x = a * 1238 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1238;
+  }
+  if (x > 1238) {
+    print("f1238 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1239(a, b) {
+  let x = a * 1239 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1239;
+  }
+  if (x > 1239) {
+    print("f1239 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1240(a, b) {
+  let x = a * 1240 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1240;
+  }
+  if (x > 1240) {
+    print("f1240 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1241(a, b) {
+  let x = a * 1241 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1241;
+  }
+  if (x > 1241) {
+    print("f1241 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1242(a, b) {
+  let x = a * 1242 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1242;
+  }
+  if (x > 1242) {
+    print("f1242 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1243(a, b) {
+  let x = a * 1243 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1243;
+  }
+  if (x > 1243) {
+    print("f1243 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1244(a, b) {
+  let x = a * 1244 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1244;
+  }
+  if (x > 1244) {
+    print("f1244 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1245(a, b) {
+  let x = a * 1245 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1245;
+  }
+  if (x > 1245) {
+    print("f1245 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1246(a, b) {
+  let x = a * 1246 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1246;
+  }
+  if (x > 1246) {
+    print("f1246 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1247(a, b) {
+  let x = a * 1247 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1247;
+  }
+  if (x > 1247) {
+    print("f1247 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1248(a, b) {
+  let x = a * 1248 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1248;
+  }
+  if (x > 1248) {
+    print("f1248 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1249(a, b) {
+  let x = a * 1249 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1249;
+  }
+  if (x > 1249) {
+    print("f1249 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1250(a, b) {
+  let x = a * 1250 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1250;
+  }
+  if (x > 1250) {
+    print("f1250 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1251(a, b) {
+  let x = a * 1251 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1251;
+  }
+  if (x > 1251) {
+    print("f1251 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1252(a, b) {
+  let x = a * 1252 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1252;
+  }
+  if (x > 1252) {
+    print("f1252 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1253(a, b) {
+  let x = a * 1253 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1253;
+  }
+  if (x > 1253) {
+    print("f1253 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1254(a, b) {
+  let x = a * 1254 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1254;
+  }
+  if (x > 1254) {
+    print("f1254 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1255(a, b) {
+  let x = a * 1255 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1255;
+  }
+  if (x > 1255) {
+    print("f1255 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1256(a, b) {
+  let x = a * 1256 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1256;
+  }
+  if (x > 1256) {
+    print("f1256 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1257(a, b) {
+  let x = a * 1257 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1257;
+  }
+  if (x > 1257) {
+    print("f1257 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1258(a, b) {
+  let x = a * 1258 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1258;
+  }
+  if (x > 1258) {
+    print("f1258 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1259(a, b) {
+  let x = a * 1259 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1259;
+  }
+  if (x > 1259) {
+    print("f1259 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1260(a, b) {
+  let x = a * 1260 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1260;
+  }
+  if (x > 1260) {
+    print("f1260 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1261(a, b) {
+  let x = a * 1261 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1261;
+  }
+  if (x > 1261) {
+    print("f1261 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1262(a, b) {
+  let x = a * 1262 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1262;
+  }
+  if (x > 1262) {
+    print("f1262 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1263(a, b) {
+  let x = a * 1263 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1263;
+  }
+  if (x > 1263) {
+    print("f1263 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1264(a, b) {
+  let x = a * 1264 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1264;
+  }
+  if (x > 1264) {
+    print("f1264 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1265(a, b) {
+  let x = a * 1265 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1265;
+  }
+  if (x > 1265) {
+    print("f1265 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1266(a, b) {
+  let x = a * 1266 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1266;
+  }
+  if (x > 1266) {
+    print("f1266 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1267(a, b) {
+  let x = a * 1267 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1267;
+  }
+  if (x > 1267) {
+    print("f1267 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1268(a, b) {
+  let x = a * 1268 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1268;
+  }
+  if (x > 1268) {
+    print("f1268 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1269(a, b) {
+  let x = a * 1269 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1269;
+  }
+  if (x > 1269) {
+    print("f1269 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1270(a, b) {
+  let x = a * 1270 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1270;
+  }
+  if (x > 1270) {
+    print("f1270 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1271(a, b) {
+  let x = a * 1271 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1271;
+  }
+  if (x > 1271) {
+    print("f1271 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1272(a, b) {
+  let x = a * 1272 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1272;
+  }
+  if (x > 1272) {
+    print("f1272 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1273(a, b) {
+  let x = a * 1273 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1273;
+  }
+  if (x > 1273) {
+    print("f1273 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1274(a, b) {
+  let x = a * 1274 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1274;
+  }
+  if (x > 1274) {
+    print("f1274 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1275(a, b) {
+  let x = a * 1275 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1275;
+  }
+  if (x > 1275) {
+    print("f1275 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1276(a, b) {
+  let x = a * 1276 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1276;
+  }
+  if (x > 1276) {
+    print("f1276 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1277(a, b) {
+  let x = a * 1277 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1277;
+  }
+  if (x > 1277) {
+    print("f1277 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1278(a, b) {
+  let x = a * 1278 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1278;
+  }
+  if (x > 1278) {
+    print("f1278 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1279(a, b) {
+  let x = a * 1279 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1279;
+  }
+  if (x > 1279) {
+    print("f1279 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1280(a, b) {
+  let x = a * 1280 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1280;
+  }
+  if (x > 1280) {
+    print("f1280 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1281(a, b) {
+  let x = a * 1281 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1281;
+  }
+  if (x > 1281) {
+    print("f1281 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1282(a, b) {
+  let x = a * 1282 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1282;
+  }
+  if (x > 1282) {
+    print("f1282 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1283(a, b) {
+  let x = a * 1283 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1283;
+  }
+  if (x > 1283) {
+    print("f1283 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1284(a, b) {
+  let x = a * 1284 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1284;
+  }
+  if (x > 1284) {
+    print("f1284 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1285(a, b) {
+  let x = a * 1285 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1285;
+  }
+  if (x > 1285) {
+    print("f1285 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1286(a, b) {
+  let x = a * 1286 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1286;
+  }
+  if (x > 1286) {
+    print("f1286 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1287(a, b) {
+  let x = a * 1287 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1287;
+  }
+  if (x > 1287) {
+    print("f1287 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1288(a, b) {
+  let x = a * 1288 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1288;
+  }
+  if (x > 1288) {
+    print("f1288 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1289(a, b) {
+  let x = a * 1289 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1289;
+  }
+  if (x > 1289) {
+    print("f1289 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1290(a, b) {
+  let x = a * 1290 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1290;
+  }
+  if (x > 1290) {
+    print("f1290 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1291(a, b) {
+  let x = a * 1291 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1291;
+  }
+  if (x > 1291) {
+    print("f1291 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1292(a, b) {
+  let x = a * 1292 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1292;
+  }
+  if (x > 1292) {
+    print("f1292 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1293(a, b) {
+  let x = a * 1293 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1293;
+  }
+  if (x > 1293) {
+    print("f1293 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1294(a, b) {
+  let x = a * 1294 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1294;
+  }
+  if (x > 1294) {
+    print("f1294 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1295(a, b) {
+  let x = a * 1295 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1295;
+  }
+  if (x > 1295) {
+    print("f1295 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1296(a, b) {
+  let x = a * 1296 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1296;
+  }
+  if (x > 1296) {
+    print("f1296 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1297(a, b) {
+  let x = a * 1297 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1297;
+  }
+  if (x > 1297) {
+    print("f1297 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1298(a, b) {
+  let x = a * 1298 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1298;
+  }
+  if (x > 1298) {
+    print("f1298 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1299(a, b) {
+  let x = a * 1299 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1299;
+  }
+  if (x > 1299) {
+    print("f1299 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1300(a, b) {
+  let x = a * 1300 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1300;
+  }
+  if (x > 1300) {
+    print("f1300 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1301(a, b) {
+  let x = a * 1301 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1301;
+  }
+  if (x > 1301) {
+    print("f1301 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1302(a, b) {
+  let x = a * 1302 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1302;
+  }
+  if (x > 1302) {
+    print("f1302 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1303(a, b) {
+  let x = a * 1303 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1303;
+  }
+  if (x > 1303) {
+    print("f1303 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1304(a, b) {
+  let x = a * 1304 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1304;
+  }
+  if (x > 1304) {
+    print("f1304 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1305(a, b) {
+  let x = a * 1305 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1305;
+  }
+  if (x > 1305) {
+    print("f1305 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1306(a, b) {
+  let x = a * 1306 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1306;
+  }
+  if (x > 1306) {
+    print("f1306 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1307(a, b) {
+  let x = a * 1307 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1307;
+  }
+  if (x > 1307) {
+    print("f1307 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1308(a, b) {
+  let x = a * 1308 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1308;
+  }
+  if (x > 1308) {
+    print("f1308 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1309(a, b) {
+  let x = a * 1309 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1309;
+  }
+  if (x > 1309) {
+    print("f1309 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1310(a, b) {
+  let x = a * 1310 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1310;
+  }
+  if (x > 1310) {
+    print("f1310 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1311(a, b) {
+  let x = a * 1311 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1311;
+  }
+  if (x > 1311) {
+    print("f1311 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1312(a, b) {
+  let x = a * 1312 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1312;
+  }
+  if (x > 1312) {
+    print("f1312 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1313(a, b) {
+  let x = a * 1313 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1313;
+  }
+  if (x > 1313) {
+    print("f1313 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1314(a, b) {
+  let x = a * 1314 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1314;
+  }
+  if (x > 1314) {
+    print("f1314 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1315(a, b) {
+  let x = a * 1315 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1315;
+  }
+  if (x > 1315) {
+    print("f1315 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1316(a, b) {
+  let x = a * 1316 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1316;
+  }
+  if (x > 1316) {
+    print("f1316 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1317(a, b) {
+  let x = a * 1317 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1317;
+  }
+  if (x > 1317) {
+    print("f1317 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1318(a, b) {
+  let x = a * 1318 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1318;
+  }
+  if (x > 1318) {
+    print("f1318 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1319(a, b) {
+  let x = a * 1319 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1319;
+  }
+  if (x > 1319) {
+    print("f1319 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1320(a, b) {
+  let x = a * 1320 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1320;
+  }
+  if (x > 1320) {
+    print("f1320 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1321(a, b) {
+  let x = a * 1321 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1321;
+  }
+  if (x > 1321) {
+    print("f1321 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1322(a, b) {
+  let x = a * 1322 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1322;
+  }
+  if (x > 1322) {
+    print("f1322 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1323(a, b) {
+  let x = a * 1323 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1323;
+  }
+  if (x > 1323) {
+    print("f1323 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1324(a, b) {
+  let x = a * 1324 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1324;
+  }
+  if (x > 1324) {
+    print("f1324 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1325(a, b) {
+  let x = a * 1325 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1325;
+  }
+  if (x > 1325) {
+    print("f1325 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1326(a, b) {
+  let x = a * 1326 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1326;
+  }
+  if (x > 1326) {
+    print("f1326 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1327(a, b) {
+  let x = a * 1327 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1327;
+  }
+  if (x > 1327) {
+    print("f1327 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1328(a, b) {
+  let x = a * 1328 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1328;
+  }
+  if (x > 1328) {
+    print("f1328 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1329(a, b) {
+  let x = a * 1329 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1329;
+  }
+  if (x > 1329) {
+    print("f1329 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1330(a, b) {
+  let x = a * 1330 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1330;
+  }
+  if (x > 1330) {
+    print("f1330 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1331(a, b) {
+  let x = a * 1331 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1331;
+  }
+  if (x > 1331) {
+    print("f1331 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1332(a, b) {
+  let x = a * 1332 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1332;
+  }
+  if (x > 1332) {
+    print("f1332 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1333(a, b) {
+  let x = a * 1333 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1333;
+  }
+  if (x > 1333) {
+    print("f1333 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1334(a, b) {
+  let x = a * 1334 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1334;
+  }
+  if (x > 1334) {
+    print("f1334 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1335(a, b) {
+  let x = a * 1335 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1335;
+  }
+  if (x > 1335) {
+    print("f1335 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1336(a, b) {
+  let x = a * 1336 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1336;
+  }
+  if (x > 1336) {
+    print("f1336 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1337(a, b) {
+  let x = a * 1337 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1337;
+  }
+  if (x > 1337) {
+    print("f1337 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1338(a, b) {
+  let x = a * 1338 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1338;
+  }
+  if (x > 1338) {
+    print("f1338 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1339(a, b) {
+  let x = a * 1339 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1339;
+  }
+  if (x > 1339) {
+    print("f1339 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1340(a, b) {
+  let x = a * 1340 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1340;
+  }
+  if (x > 1340) {
+    print("f1340 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1341(a, b) {
+  let x = a * 1341 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1341;
+  }
+  if (x > 1341) {
+    print("f1341 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1342(a, b) {
+  let x = a * 1342 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1342;
+  }
+  if (x > 1342) {
+    print("f1342 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1343(a, b) {
+  let x = a * 1343 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1343;
+  }
+  if (x > 1343) {
+    print("f1343 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1344(a, b) {
+  let x = a * 1344 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1344;
+  }
+  if (x > 1344) {
+    print("f1344 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1345(a, b) {
+  let x = a * 1345 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1345;
+  }
+  if (x > 1345) {
+    print("f1345 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1346(a, b) {
+  let x = a * 1346 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1346;
+  }
+  if (x > 1346) {
+    print("f1346 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1347(a, b) {
+  let x = a * 1347 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1347;
+  }
+  if (x > 1347) {
+    print("f1347 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1348(a, b) {
+  let x = a * 1348 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1348;
+  }
+  if (x > 1348) {
+    print("f1348 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1349(a, b) {
+  let x = a * 1349 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1349;
+  }
+  if (x > 1349) {
+    print("f1349 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1350(a, b) {
+  let x = a * 1350 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1350;
+  }
+  if (x > 1350) {
+    print("f1350 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1351(a, b) {
+  let x = a * 1351 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1351;
+  }
+  if (x > 1351) {
+    print("f1351 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1352(a, b) {
+  let x = a * 1352 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1352;
+  }
+  if (x > 1352) {
+    print("f1352 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1353(a, b) {
+  let x = a * 1353 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1353;
+  }
+  if (x > 1353) {
+    print("f1353 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1354(a, b) {
+  let x = a * 1354 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1354;
+  }
+  if (x > 1354) {
+    print("f1354 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1355(a, b) {
+  let x = a * 1355 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1355;
+  }
+  if (x > 1355) {
+    print("f1355 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1356(a, b) {
+  let x = a * 1356 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1356;
+  }
+  if (x > 1356) {
+    print("f1356 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1357(a, b) {
+  let x = a * 1357 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1357;
+  }
+  if (x > 1357) {
+    print("f1357 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1358(a, b) {
+  let x = a * 1358 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1358;
+  }
+  if (x > 1358) {
+    print("f1358 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1359(a, b) {
+  let x = a * 1359 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1359;
+  }
+  if (x > 1359) {
+    print("f1359 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1360(a, b) {
+  let x = a * 1360 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1360;
+  }
+  if (x > 1360) {
+    print("f1360 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1361(a, b) {
+  let x = a * 1361 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1361;
+  }
+  if (x > 1361) {
+    print("f1361 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1362(a, b) {
+  let x = a * 1362 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1362;
+  }
+  if (x > 1362) {
+    print("f1362 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1363(a, b) {
+  let x = a * 1363 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1363;
+  }
+  if (x > 1363) {
+    print("f1363 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1364(a, b) {
+  let x = a * 1364 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1364;
+  }
+  if (x > 1364) {
+    print("f1364 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1365(a, b) {
+  let x = a * 1365 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1365;
+  }
+  if (x > 1365) {
+    print("f1365 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1366(a, b) {
+  let x = a * 1366 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1366;
+  }
+  if (x > 1366) {
+    print("f1366 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1367(a, b) {
+  let x = a * 1367 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1367;
+  }
+  if (x > 1367) {
+    print("f1367 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1368(a, b) {
+  let x = a * 1368 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1368;
+  }
+  if (x > 1368) {
+    print("f1368 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1369(a, b) {
+  let x = a * 1369 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1369;
+  }
+  if (x > 1369) {
+    print("f1369 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1370(a, b) {
+  let x = a * 1370 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1370;
+  }
+  if (x > 1370) {
+    print("f1370 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1371(a, b) {
+  let x = a * 1371 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1371;
+  }
+  if (x > 1371) {
+    print("f1371 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1372(a, b) {
+  let x = a * 1372 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1372;
+  }
+  if (x > 1372) {
+    print("f1372 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1373(a, b) {
+  let x = a * 1373 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1373;
+  }
+  if (x > 1373) {
+    print("f1373 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1374(a, b) {
+  let x = a * 1374 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1374;
+  }
+  if (x > 1374) {
+    print("f1374 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1375(a, b) {
+  let x = a * 1375 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1375;
+  }
+  if (x > 1375) {
+    print("f1375 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1376(a, b) {
+  let x = a * 1376 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1376;
+  }
+  if (x > 1376) {
+    print("f1376 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1377(a, b) {
+  let x = a * 1377 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1377;
+  }
+  if (x > 1377) {
+    print("f1377 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1378(a, b) {
+  let x = a * 1378 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1378;
+  }
+  if (x > 1378) {
+    print("f1378 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1379(a, b) {
+  let x = a * 1379 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1379;
+  }
+  if (x > 1379) {
+    print("f1379 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1380(a, b) {
+  let x = a * 1380 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1380;
+  }
+  if (x > 1380) {
+    print("f1380 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1381(a, b) {
+  let x = a * 1381 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1381;
+  }
+  if (x > 1381) {
+    print("f1381 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1382(a, b) {
+  let x = a * 1382 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1382;
+  }
+  if (x > 1382) {
+    print("f1382 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1383(a, b) {
+  let x = a * 1383 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1383;
+  }
+  if (x > 1383) {
+    print("f1383 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1384(a, b) {
+  let x = a * 1384 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1384;
+  }
+  if (x > 1384) {
+    print("f1384 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1385(a, b) {
+  let x = a * 1385 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1385;
+  }
+  if (x > 1385) {
+    print("f1385 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1386(a, b) {
+  let x = a * 1386 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1386;
+  }
+  if (x > 1386) {
+    print("f1386 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1387(a, b) {
+  let x = a * 1387 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1387;
+  }
+  if (x > 1387) {
+    print("f1387 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1388(a, b) {
+  let x = a * 1388 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1388;
+  }
+  if (x > 1388) {
+    print("f1388 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1389(a, b) {
+  let x = a * 1389 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1389;
+  }
+  if (x > 1389) {
+    print("f1389 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1390(a, b) {
+  let x = a * 1390 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1390;
+  }
+  if (x > 1390) {
+    print("f1390 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1391(a, b) {
+  let x = a * 1391 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1391;
+  }
+  if (x > 1391) {
+    print("f1391 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1392(a, b) {
+  let x = a * 1392 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1392;
+  }
+  if (x > 1392) {
+    print("f1392 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1393(a, b) {
+  let x = a * 1393 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1393;
+  }
+  if (x > 1393) {
+    print("f1393 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1394(a, b) {
+  let x = a * 1394 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1394;
+  }
+  if (x > 1394) {
+    print("f1394 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1395(a, b) {
+  let x = a * 1395 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1395;
+  }
+  if (x > 1395) {
+    print("f1395 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1396(a, b) {
+  let x = a * 1396 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1396;
+  }
+  if (x > 1396) {
+    print("f1396 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1397(a, b) {
+  let x = a * 1397 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1397;
+  }
+  if (x > 1397) {
+    print("f1397 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1398(a, b) {
+  let x = a * 1398 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1398;
+  }
+  if (x > 1398) {
+    print("f1398 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1399(a, b) {
+  let x = a * 1399 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1399;
+  }
+  if (x > 1399) {
+    print("f1399 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1400(a, b) {
+  let x = a * 1400 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1400;
+  }
+  if (x > 1400) {
+    print("f1400 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1401(a, b) {
+  let x = a * 1401 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1401;
+  }
+  if (x > 1401) {
+    print("f1401 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1402(a, b) {
+  let x = a * 1402 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1402;
+  }
+  if (x > 1402) {
+    print("f1402 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1403(a, b) {
+  let x = a * 1403 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1403;
+  }
+  if (x > 1403) {
+    print("f1403 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1404(a, b) {
+  let x = a * 1404 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1404;
+  }
+  if (x > 1404) {
+    print("f1404 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1405(a, b) {
+  let x = a * 1405 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1405;
+  }
+  if (x > 1405) {
+    print("f1405 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1406(a, b) {
+  let x = a * 1406 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1406;
+  }
+  if (x > 1406) {
+    print("f1406 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1407(a, b) {
+  let x = a * 1407 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1407;
+  }
+  if (x > 1407) {
+    print("f1407 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1408(a, b) {
+  let x = a * 1408 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1408;
+  }
+  if (x > 1408) {
+    print("f1408 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1409(a, b) {
+  let x = a * 1409 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1409;
+  }
+  if (x > 1409) {
+    print("f1409 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1410(a, b) {
+  let x = a * 1410 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1410;
+  }
+  if (x > 1410) {
+    print("f1410 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1411(a, b) {
+  let x = a * 1411 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1411;
+  }
+  if (x > 1411) {
+    print("f1411 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1412(a, b) {
+  let x = a * 1412 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1412;
+  }
+  if (x > 1412) {
+    print("f1412 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1413(a, b) {
+  let x = a * 1413 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1413;
+  }
+  if (x > 1413) {
+    print("f1413 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1414(a, b) {
+  let x = a * 1414 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1414;
+  }
+  if (x > 1414) {
+    print("f1414 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1415(a, b) {
+  let x = a * 1415 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1415;
+  }
+  if (x > 1415) {
+    print("f1415 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1416(a, b) {
+  let x = a * 1416 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1416;
+  }
+  if (x > 1416) {
+    print("f1416 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1417(a, b) {
+  let x = a * 1417 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1417;
+  }
+  if (x > 1417) {
+    print("f1417 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1418(a, b) {
+  let x = a * 1418 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1418;
+  }
+  if (x > 1418) {
+    print("f1418 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1419(a, b) {
+  let x = a * 1419 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1419;
+  }
+  if (x > 1419) {
+    print("f1419 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1420(a, b) {
+  let x = a * 1420 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1420;
+  }
+  if (x > 1420) {
+    print("f1420 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1421(a, b) {
+  let x = a * 1421 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1421;
+  }
+  if (x > 1421) {
+    print("f1421 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1422(a, b) {
+  let x = a * 1422 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1422;
+  }
+  if (x > 1422) {
+    print("f1422 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1423(a, b) {
+  let x = a * 1423 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1423;
+  }
+  if (x > 1423) {
+    print("f1423 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1424(a, b) {
+  let x = a * 1424 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1424;
+  }
+  if (x > 1424) {
+    print("f1424 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1425(a, b) {
+  let x = a * 1425 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1425;
+  }
+  if (x > 1425) {
+    print("f1425 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1426(a, b) {
+  let x = a * 1426 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1426;
+  }
+  if (x > 1426) {
+    print("f1426 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1427(a, b) {
+  let x = a * 1427 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1427;
+  }
+  if (x > 1427) {
+    print("f1427 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1428(a, b) {
+  let x = a * 1428 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1428;
+  }
+  if (x > 1428) {
+    print("f1428 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1429(a, b) {
+  let x = a * 1429 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1429;
+  }
+  if (x > 1429) {
+    print("f1429 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1430(a, b) {
+  let x = a * 1430 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1430;
+  }
+  if (x > 1430) {
+    print("f1430 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1431(a, b) {
+  let x = a * 1431 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1431;
+  }
+  if (x > 1431) {
+    print("f1431 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1432(a, b) {
+  let x = a * 1432 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1432;
+  }
+  if (x > 1432) {
+    print("f1432 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1433(a, b) {
+  let x = a * 1433 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1433;
+  }
+  if (x > 1433) {
+    print("f1433 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1434(a, b) {
+  let x = a * 1434 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1434;
+  }
+  if (x > 1434) {
+    print("f1434 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1435(a, b) {
+  let x = a * 1435 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1435;
+  }
+  if (x > 1435) {
+    print("f1435 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1436(a, b) {
+  let x = a * 1436 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1436;
+  }
+  if (x > 1436) {
+    print("f1436 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1437(a, b) {
+  let x = a * 1437 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1437;
+  }
+  if (x > 1437) {
+    print("f1437 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1438(a, b) {
+  let x = a * 1438 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1438;
+  }
+  if (x > 1438) {
+    print("f1438 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1439(a, b) {
+  let x = a * 1439 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1439;
+  }
+  if (x > 1439) {
+    print("f1439 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1440(a, b) {
+  let x = a * 1440 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1440;
+  }
+  if (x > 1440) {
+    print("f1440 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1441(a, b) {
+  let x = a * 1441 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1441;
+  }
+  if (x > 1441) {
+    print("f1441 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1442(a, b) {
+  let x = a * 1442 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1442;
+  }
+  if (x > 1442) {
+    print("f1442 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1443(a, b) {
+  let x = a * 1443 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1443;
+  }
+  if (x > 1443) {
+    print("f1443 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1444(a, b) {
+  let x = a * 1444 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1444;
+  }
+  if (x > 1444) {
+    print("f1444 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1445(a, b) {
+  let x = a * 1445 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1445;
+  }
+  if (x > 1445) {
+    print("f1445 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1446(a, b) {
+  let x = a * 1446 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1446;
+  }
+  if (x > 1446) {
+    print("f1446 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1447(a, b) {
+  let x = a * 1447 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1447;
+  }
+  if (x > 1447) {
+    print("f1447 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1448(a, b) {
+  let x = a * 1448 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1448;
+  }
+  if (x > 1448) {
+    print("f1448 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1449(a, b) {
+  let x = a * 1449 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1449;
+  }
+  if (x > 1449) {
+    print("f1449 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1450(a, b) {
+  let x = a * 1450 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1450;
+  }
+  if (x > 1450) {
+    print("f1450 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1451(a, b) {
+  let x = a * 1451 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1451;
+  }
+  if (x > 1451) {
+    print("f1451 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1452(a, b) {
+  let x = a * 1452 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1452;
+  }
+  if (x > 1452) {
+    print("f1452 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1453(a, b) {
+  let x = a * 1453 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1453;
+  }
+  if (x > 1453) {
+    print("f1453 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1454(a, b) {
+  let x = a * 1454 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1454;
+  }
+  if (x > 1454) {
+    print("f1454 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1455(a, b) {
+  let x = a * 1455 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1455;
+  }
+  if (x > 1455) {
+    print("f1455 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1456(a, b) {
+  let x = a * 1456 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1456;
+  }
+  if (x > 1456) {
+    print("f1456 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1457(a, b) {
+  let x = a * 1457 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1457;
+  }
+  if (x > 1457) {
+    print("f1457 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1458(a, b) {
+  let x = a * 1458 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1458;
+  }
+  if (x > 1458) {
+    print("f1458 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1459(a, b) {
+  let x = a * 1459 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1459;
+  }
+  if (x > 1459) {
+    print("f1459 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1460(a, b) {
+  let x = a * 1460 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1460;
+  }
+  if (x > 1460) {
+    print("f1460 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1461(a, b) {
+  let x = a * 1461 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1461;
+  }
+  if (x > 1461) {
+    print("f1461 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1462(a, b) {
+  let x = a * 1462 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1462;
+  }
+  if (x > 1462) {
+    print("f1462 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1463(a, b) {
+  let x = a * 1463 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1463;
+  }
+  if (x > 1463) {
+    print("f1463 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1464(a, b) {
+  let x = a * 1464 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1464;
+  }
+  if (x > 1464) {
+    print("f1464 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1465(a, b) {
+  let x = a * 1465 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1465;
+  }
+  if (x > 1465) {
+    print("f1465 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1466(a, b) {
+  let x = a * 1466 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1466;
+  }
+  if (x > 1466) {
+    print("f1466 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1467(a, b) {
+  let x = a * 1467 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1467;
+  }
+  if (x > 1467) {
+    print("f1467 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1468(a, b) {
+  let x = a * 1468 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1468;
+  }
+  if (x > 1468) {
+    print("f1468 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1469(a, b) {
+  let x = a * 1469 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1469;
+  }
+  if (x > 1469) {
+    print("f1469 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1470(a, b) {
+  let x = a * 1470 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1470;
+  }
+  if (x > 1470) {
+    print("f1470 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1471(a, b) {
+  let x = a * 1471 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1471;
+  }
+  if (x > 1471) {
+    print("f1471 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1472(a, b) {
+  let x = a * 1472 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1472;
+  }
+  if (x > 1472) {
+    print("f1472 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1473(a, b) {
+  let x = a * 1473 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1473;
+  }
+  if (x > 1473) {
+    print("f1473 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1474(a, b) {
+  let x = a * 1474 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1474;
+  }
+  if (x > 1474) {
+    print("f1474 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1475(a, b) {
+  let x = a * 1475 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1475;
+  }
+  if (x > 1475) {
+    print("f1475 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1476(a, b) {
+  let x = a * 1476 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1476;
+  }
+  if (x > 1476) {
+    print("f1476 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1477(a, b) {
+  let x = a * 1477 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1477;
+  }
+  if (x > 1477) {
+    print("f1477 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1478(a, b) {
+  let x = a * 1478 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1478;
+  }
+  if (x > 1478) {
+    print("f1478 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1479(a, b) {
+  let x = a * 1479 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1479;
+  }
+  if (x > 1479) {
+    print("f1479 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1480(a, b) {
+  let x = a * 1480 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1480;
+  }
+  if (x > 1480) {
+    print("f1480 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1481(a, b) {
+  let x = a * 1481 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1481;
+  }
+  if (x > 1481) {
+    print("f1481 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1482(a, b) {
+  let x = a * 1482 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1482;
+  }
+  if (x > 1482) {
+    print("f1482 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1483(a, b) {
+  let x = a * 1483 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1483;
+  }
+  if (x > 1483) {
+    print("f1483 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1484(a, b) {
+  let x = a * 1484 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1484;
+  }
+  if (x > 1484) {
+    print("f1484 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1485(a, b) {
+  let x = a * 1485 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1485;
+  }
+  if (x > 1485) {
+    print("f1485 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1486(a, b) {
+  let x = a * 1486 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1486;
+  }
+  if (x > 1486) {
+    print("f1486 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1487(a, b) {
+  let x = a * 1487 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1487;
+  }
+  if (x > 1487) {
+    print("f1487 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1488(a, b) {
+  let x = a * 1488 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1488;
+  }
+  if (x > 1488) {
+    print("f1488 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1489(a, b) {
+  let x = a * 1489 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1489;
+  }
+  if (x > 1489) {
+    print("f1489 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1490(a, b) {
+  let x = a * 1490 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1490;
+  }
+  if (x > 1490) {
+    print("f1490 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1491(a, b) {
+  let x = a * 1491 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1491;
+  }
+  if (x > 1491) {
+    print("f1491 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1492(a, b) {
+  let x = a * 1492 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1492;
+  }
+  if (x > 1492) {
+    print("f1492 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1493(a, b) {
+  let x = a * 1493 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1493;
+  }
+  if (x > 1493) {
+    print("f1493 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1494(a, b) {
+  let x = a * 1494 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1494;
+  }
+  if (x > 1494) {
+    print("f1494 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1495(a, b) {
+  let x = a * 1495 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1495;
+  }
+  if (x > 1495) {
+    print("f1495 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1496(a, b) {
+  let x = a * 1496 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1496;
+  }
+  if (x > 1496) {
+    print("f1496 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1497(a, b) {
+  let x = a * 1497 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1497;
+  }
+  if (x > 1497) {
+    print("f1497 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1498(a, b) {
+  let x = a * 1498 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1498;
+  }
+  if (x > 1498) {
+    print("f1498 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1499(a, b) {
+  let x = a * 1499 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1499;
+  }
+  if (x > 1499) {
+    print("f1499 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1500(a, b) {
+  let x = a * 1500 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1500;
+  }
+  if (x > 1500) {
+    print("f1500 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1501(a, b) {
+  let x = a * 1501 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1501;
+  }
+  if (x > 1501) {
+    print("f1501 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1502(a, b) {
+  let x = a * 1502 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1502;
+  }
+  if (x > 1502) {
+    print("f1502 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1503(a, b) {
+  let x = a * 1503 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1503;
+  }
+  if (x > 1503) {
+    print("f1503 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1504(a, b) {
+  let x = a * 1504 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1504;
+  }
+  if (x > 1504) {
+    print("f1504 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1505(a, b) {
+  let x = a * 1505 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1505;
+  }
+  if (x > 1505) {
+    print("f1505 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1506(a, b) {
+  let x = a * 1506 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1506;
+  }
+  if (x > 1506) {
+    print("f1506 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1507(a, b) {
+  let x = a * 1507 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1507;
+  }
+  if (x > 1507) {
+    print("f1507 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1508(a, b) {
+  let x = a * 1508 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1508;
+  }
+  if (x > 1508) {
+    print("f1508 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1509(a, b) {
+  let x = a * 1509 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1509;
+  }
+  if (x > 1509) {
+    print("f1509 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1510(a, b) {
+  let x = a * 1510 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1510;
+  }
+  if (x > 1510) {
+    print("f1510 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1511(a, b) {
+  let x = a * 1511 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1511;
+  }
+  if (x > 1511) {
+    print("f1511 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1512(a, b) {
+  let x = a * 1512 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1512;
+  }
+  if (x > 1512) {
+    print("f1512 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1513(a, b) {
+  let x = a * 1513 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1513;
+  }
+  if (x > 1513) {
+    print("f1513 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1514(a, b) {
+  let x = a * 1514 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1514;
+  }
+  if (x > 1514) {
+    print("f1514 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1515(a, b) {
+  let x = a * 1515 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1515;
+  }
+  if (x > 1515) {
+    print("f1515 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1516(a, b) {
+  let x = a * 1516 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1516;
+  }
+  if (x > 1516) {
+    print("f1516 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1517(a, b) {
+  let x = a * 1517 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1517;
+  }
+  if (x > 1517) {
+    print("f1517 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1518(a, b) {
+  let x = a * 1518 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1518;
+  }
+  if (x > 1518) {
+    print("f1518 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1519(a, b) {
+  let x = a * 1519 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1519;
+  }
+  if (x > 1519) {
+    print("f1519 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1520(a, b) {
+  let x = a * 1520 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1520;
+  }
+  if (x > 1520) {
+    print("f1520 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1521(a, b) {
+  let x = a * 1521 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1521;
+  }
+  if (x > 1521) {
+    print("f1521 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1522(a, b) {
+  let x = a * 1522 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1522;
+  }
+  if (x > 1522) {
+    print("f1522 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1523(a, b) {
+  let x = a * 1523 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1523;
+  }
+  if (x > 1523) {
+    print("f1523 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1524(a, b) {
+  let x = a * 1524 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1524;
+  }
+  if (x > 1524) {
+    print("f1524 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1525(a, b) {
+  let x = a * 1525 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1525;
+  }
+  if (x > 1525) {
+    print("f1525 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1526(a, b) {
+  let x = a * 1526 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1526;
+  }
+  if (x > 1526) {
+    print("f1526 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1527(a, b) {
+  let x = a * 1527 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1527;
+  }
+  if (x > 1527) {
+    print("f1527 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1528(a, b) {
+  let x = a * 1528 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1528;
+  }
+  if (x > 1528) {
+    print("f1528 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1529(a, b) {
+  let x = a * 1529 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1529;
+  }
+  if (x > 1529) {
+    print("f1529 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1530(a, b) {
+  let x = a * 1530 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1530;
+  }
+  if (x > 1530) {
+    print("f1530 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1531(a, b) {
+  let x = a * 1531 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1531;
+  }
+  if (x > 1531) {
+    print("f1531 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1532(a, b) {
+  let x = a * 1532 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1532;
+  }
+  if (x > 1532) {
+    print("f1532 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1533(a, b) {
+  let x = a * 1533 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1533;
+  }
+  if (x > 1533) {
+    print("f1533 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1534(a, b) {
+  let x = a * 1534 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1534;
+  }
+  if (x > 1534) {
+    print("f1534 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1535(a, b) {
+  let x = a * 1535 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1535;
+  }
+  if (x > 1535) {
+    print("f1535 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1536(a, b) {
+  let x = a * 1536 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1536;
+  }
+  if (x > 1536) {
+    print("f1536 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1537(a, b) {
+  let x = a * 1537 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1537;
+  }
+  if (x > 1537) {
+    print("f1537 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1538(a, b) {
+  let x = a * 1538 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1538;
+  }
+  if (x > 1538) {
+    print("f1538 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1539(a, b) {
+  let x = a * 1539 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1539;
+  }
+  if (x > 1539) {
+    print("f1539 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1540(a, b) {
+  let x = a * 1540 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1540;
+  }
+  if (x > 1540) {
+    print("f1540 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1541(a, b) {
+  let x = a * 1541 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1541;
+  }
+  if (x > 1541) {
+    print("f1541 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1542(a, b) {
+  let x = a * 1542 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1542;
+  }
+  if (x > 1542) {
+    print("f1542 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1543(a, b) {
+  let x = a * 1543 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1543;
+  }
+  if (x > 1543) {
+    print("f1543 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1544(a, b) {
+  let x = a * 1544 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1544;
+  }
+  if (x > 1544) {
+    print("f1544 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1545(a, b) {
+  let x = a * 1545 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1545;
+  }
+  if (x > 1545) {
+    print("f1545 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1546(a, b) {
+  let x = a * 1546 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1546;
+  }
+  if (x > 1546) {
+    print("f1546 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1547(a, b) {
+  let x = a * 1547 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1547;
+  }
+  if (x > 1547) {
+    print("f1547 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1548(a, b) {
+  let x = a * 1548 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1548;
+  }
+  if (x > 1548) {
+    print("f1548 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1549(a, b) {
+  let x = a * 1549 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1549;
+  }
+  if (x > 1549) {
+    print("f1549 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1550(a, b) {
+  let x = a * 1550 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1550;
+  }
+  if (x > 1550) {
+    print("f1550 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1551(a, b) {
+  let x = a * 1551 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1551;
+  }
+  if (x > 1551) {
+    print("f1551 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1552(a, b) {
+  let x = a * 1552 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1552;
+  }
+  if (x > 1552) {
+    print("f1552 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1553(a, b) {
+  let x = a * 1553 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1553;
+  }
+  if (x > 1553) {
+    print("f1553 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1554(a, b) {
+  let x = a * 1554 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1554;
+  }
+  if (x > 1554) {
+    print("f1554 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1555(a, b) {
+  let x = a * 1555 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1555;
+  }
+  if (x > 1555) {
+    print("f1555 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1556(a, b) {
+  let x = a * 1556 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1556;
+  }
+  if (x > 1556) {
+    print("f1556 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1557(a, b) {
+  let x = a * 1557 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1557;
+  }
+  if (x > 1557) {
+    print("f1557 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1558(a, b) {
+  let x = a * 1558 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1558;
+  }
+  if (x > 1558) {
+    print("f1558 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1559(a, b) {
+  let x = a * 1559 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1559;
+  }
+  if (x > 1559) {
+    print("f1559 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1560(a, b) {
+  let x = a * 1560 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1560;
+  }
+  if (x > 1560) {
+    print("f1560 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1561(a, b) {
+  let x = a * 1561 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1561;
+  }
+  if (x > 1561) {
+    print("f1561 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1562(a, b) {
+  let x = a * 1562 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1562;
+  }
+  if (x > 1562) {
+    print("f1562 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1563(a, b) {
+  let x = a * 1563 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1563;
+  }
+  if (x > 1563) {
+    print("f1563 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1564(a, b) {
+  let x = a * 1564 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1564;
+  }
+  if (x > 1564) {
+    print("f1564 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1565(a, b) {
+  let x = a * 1565 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1565;
+  }
+  if (x > 1565) {
+    print("f1565 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1566(a, b) {
+  let x = a * 1566 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1566;
+  }
+  if (x > 1566) {
+    print("f1566 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1567(a, b) {
+  let x = a * 1567 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1567;
+  }
+  if (x > 1567) {
+    print("f1567 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1568(a, b) {
+  let x = a * 1568 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1568;
+  }
+  if (x > 1568) {
+    print("f1568 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1569(a, b) {
+  let x = a * 1569 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1569;
+  }
+  if (x > 1569) {
+    print("f1569 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1570(a, b) {
+  let x = a * 1570 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1570;
+  }
+  if (x > 1570) {
+    print("f1570 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1571(a, b) {
+  let x = a * 1571 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1571;
+  }
+  if (x > 1571) {
+    print("f1571 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1572(a, b) {
+  let x = a * 1572 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1572;
+  }
+  if (x > 1572) {
+    print("f1572 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1573(a, b) {
+  let x = a * 1573 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1573;
+  }
+  if (x > 1573) {
+    print("f1573 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1574(a, b) {
+  let x = a * 1574 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1574;
+  }
+  if (x > 1574) {
+    print("f1574 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1575(a, b) {
+  let x = a * 1575 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1575;
+  }
+  if (x > 1575) {
+    print("f1575 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1576(a, b) {
+  let x = a * 1576 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1576;
+  }
+  if (x > 1576) {
+    print("f1576 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1577(a, b) {
+  let x = a * 1577 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1577;
+  }
+  if (x > 1577) {
+    print("f1577 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1578(a, b) {
+  let x = a * 1578 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1578;
+  }
+  if (x > 1578) {
+    print("f1578 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1579(a, b) {
+  let x = a * 1579 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1579;
+  }
+  if (x > 1579) {
+    print("f1579 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1580(a, b) {
+  let x = a * 1580 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1580;
+  }
+  if (x > 1580) {
+    print("f1580 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1581(a, b) {
+  let x = a * 1581 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1581;
+  }
+  if (x > 1581) {
+    print("f1581 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1582(a, b) {
+  let x = a * 1582 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1582;
+  }
+  if (x > 1582) {
+    print("f1582 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1583(a, b) {
+  let x = a * 1583 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1583;
+  }
+  if (x > 1583) {
+    print("f1583 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1584(a, b) {
+  let x = a * 1584 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1584;
+  }
+  if (x > 1584) {
+    print("f1584 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1585(a, b) {
+  let x = a * 1585 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1585;
+  }
+  if (x > 1585) {
+    print("f1585 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1586(a, b) {
+  let x = a * 1586 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1586;
+  }
+  if (x > 1586) {
+    print("f1586 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1587(a, b) {
+  let x = a * 1587 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1587;
+  }
+  if (x > 1587) {
+    print("f1587 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1588(a, b) {
+  let x = a * 1588 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1588;
+  }
+  if (x > 1588) {
+    print("f1588 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1589(a, b) {
+  let x = a * 1589 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1589;
+  }
+  if (x > 1589) {
+    print("f1589 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1590(a, b) {
+  let x = a * 1590 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1590;
+  }
+  if (x > 1590) {
+    print("f1590 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1591(a, b) {
+  let x = a * 1591 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1591;
+  }
+  if (x > 1591) {
+    print("f1591 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1592(a, b) {
+  let x = a * 1592 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1592;
+  }
+  if (x > 1592) {
+    print("f1592 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1593(a, b) {
+  let x = a * 1593 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1593;
+  }
+  if (x > 1593) {
+    print("f1593 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1594(a, b) {
+  let x = a * 1594 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1594;
+  }
+  if (x > 1594) {
+    print("f1594 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1595(a, b) {
+  let x = a * 1595 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1595;
+  }
+  if (x > 1595) {
+    print("f1595 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1596(a, b) {
+  let x = a * 1596 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1596;
+  }
+  if (x > 1596) {
+    print("f1596 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1597(a, b) {
+  let x = a * 1597 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1597;
+  }
+  if (x > 1597) {
+    print("f1597 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1598(a, b) {
+  let x = a * 1598 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1598;
+  }
+  if (x > 1598) {
+    print("f1598 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1599(a, b) {
+  let x = a * 1599 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1599;
+  }
+  if (x > 1599) {
+    print("f1599 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1600(a, b) {
+  let x = a * 1600 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1600;
+  }
+  if (x > 1600) {
+    print("f1600 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1601(a, b) {
+  let x = a * 1601 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1601;
+  }
+  if (x > 1601) {
+    print("f1601 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1602(a, b) {
+  let x = a * 1602 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1602;
+  }
+  if (x > 1602) {
+    print("f1602 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1603(a, b) {
+  let x = a * 1603 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1603;
+  }
+  if (x > 1603) {
+    print("f1603 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1604(a, b) {
+  let x = a * 1604 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1604;
+  }
+  if (x > 1604) {
+    print("f1604 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1605(a, b) {
+  let x = a * 1605 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1605;
+  }
+  if (x > 1605) {
+    print("f1605 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1606(a, b) {
+  let x = a * 1606 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1606;
+  }
+  if (x > 1606) {
+    print("f1606 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1607(a, b) {
+  let x = a * 1607 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1607;
+  }
+  if (x > 1607) {
+    print("f1607 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1608(a, b) {
+  let x = a * 1608 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1608;
+  }
+  if (x > 1608) {
+    print("f1608 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1609(a, b) {
+  let x = a * 1609 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1609;
+  }
+  if (x > 1609) {
+    print("f1609 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1610(a, b) {
+  let x = a * 1610 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1610;
+  }
+  if (x > 1610) {
+    print("f1610 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1611(a, b) {
+  let x = a * 1611 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1611;
+  }
+  if (x > 1611) {
+    print("f1611 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1612(a, b) {
+  let x = a * 1612 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1612;
+  }
+  if (x > 1612) {
+    print("f1612 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1613(a, b) {
+  let x = a * 1613 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1613;
+  }
+  if (x > 1613) {
+    print("f1613 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1614(a, b) {
+  let x = a * 1614 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1614;
+  }
+  if (x > 1614) {
+    print("f1614 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1615(a, b) {
+  let x = a * 1615 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1615;
+  }
+  if (x > 1615) {
+    print("f1615 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1616(a, b) {
+  let x = a * 1616 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1616;
+  }
+  if (x > 1616) {
+    print("f1616 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1617(a, b) {
+  let x = a * 1617 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1617;
+  }
+  if (x > 1617) {
+    print("f1617 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1618(a, b) {
+  let x = a * 1618 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1618;
+  }
+  if (x > 1618) {
+    print("f1618 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1619(a, b) {
+  let x = a * 1619 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1619;
+  }
+  if (x > 1619) {
+    print("f1619 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1620(a, b) {
+  let x = a * 1620 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1620;
+  }
+  if (x > 1620) {
+    print("f1620 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1621(a, b) {
+  let x = a * 1621 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1621;
+  }
+  if (x > 1621) {
+    print("f1621 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1622(a, b) {
+  let x = a * 1622 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1622;
+  }
+  if (x > 1622) {
+    print("f1622 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1623(a, b) {
+  let x = a * 1623 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1623;
+  }
+  if (x > 1623) {
+    print("f1623 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1624(a, b) {
+  let x = a * 1624 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1624;
+  }
+  if (x > 1624) {
+    print("f1624 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1625(a, b) {
+  let x = a * 1625 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1625;
+  }
+  if (x > 1625) {
+    print("f1625 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1626(a, b) {
+  let x = a * 1626 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1626;
+  }
+  if (x > 1626) {
+    print("f1626 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1627(a, b) {
+  let x = a * 1627 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1627;
+  }
+  if (x > 1627) {
+    print("f1627 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1628(a, b) {
+  let x = a * 1628 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1628;
+  }
+  if (x > 1628) {
+    print("f1628 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1629(a, b) {
+  let x = a * 1629 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1629;
+  }
+  if (x > 1629) {
+    print("f1629 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1630(a, b) {
+  let x = a * 1630 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1630;
+  }
+  if (x > 1630) {
+    print("f1630 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1631(a, b) {
+  let x = a * 1631 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1631;
+  }
+  if (x > 1631) {
+    print("f1631 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1632(a, b) {
+  let x = a * 1632 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1632;
+  }
+  if (x > 1632) {
+    print("f1632 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1633(a, b) {
+  let x = a * 1633 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1633;
+  }
+  if (x > 1633) {
+    print("f1633 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1634(a, b) {
+  let x = a * 1634 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1634;
+  }
+  if (x > 1634) {
+    print("f1634 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1635(a, b) {
+  let x = a * 1635 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1635;
+  }
+  if (x > 1635) {
+    print("f1635 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1636(a, b) {
+  let x = a * 1636 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1636;
+  }
+  if (x > 1636) {
+    print("f1636 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1637(a, b) {
+  let x = a * 1637 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1637;
+  }
+  if (x > 1637) {
+    print("f1637 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1638(a, b) {
+  let x = a * 1638 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1638;
+  }
+  if (x > 1638) {
+    print("f1638 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1639(a, b) {
+  let x = a * 1639 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1639;
+  }
+  if (x > 1639) {
+    print("f1639 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1640(a, b) {
+  let x = a * 1640 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1640;
+  }
+  if (x > 1640) {
+    print("f1640 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1641(a, b) {
+  let x = a * 1641 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1641;
+  }
+  if (x > 1641) {
+    print("f1641 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1642(a, b) {
+  let x = a * 1642 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1642;
+  }
+  if (x > 1642) {
+    print("f1642 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1643(a, b) {
+  let x = a * 1643 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1643;
+  }
+  if (x > 1643) {
+    print("f1643 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1644(a, b) {
+  let x = a * 1644 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1644;
+  }
+  if (x > 1644) {
+    print("f1644 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1645(a, b) {
+  let x = a * 1645 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1645;
+  }
+  if (x > 1645) {
+    print("f1645 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1646(a, b) {
+  let x = a * 1646 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1646;
+  }
+  if (x > 1646) {
+    print("f1646 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1647(a, b) {
+  let x = a * 1647 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1647;
+  }
+  if (x > 1647) {
+    print("f1647 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1648(a, b) {
+  let x = a * 1648 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1648;
+  }
+  if (x > 1648) {
+    print("f1648 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1649(a, b) {
+  let x = a * 1649 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1649;
+  }
+  if (x > 1649) {
+    print("f1649 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1650(a, b) {
+  let x = a * 1650 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1650;
+  }
+  if (x > 1650) {
+    print("f1650 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1651(a, b) {
+  let x = a * 1651 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1651;
+  }
+  if (x > 1651) {
+    print("f1651 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1652(a, b) {
+  let x = a * 1652 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1652;
+  }
+  if (x > 1652) {
+    print("f1652 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1653(a, b) {
+  let x = a * 1653 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1653;
+  }
+  if (x > 1653) {
+    print("f1653 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1654(a, b) {
+  let x = a * 1654 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1654;
+  }
+  if (x > 1654) {
+    print("f1654 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1655(a, b) {
+  let x = a * 1655 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1655;
+  }
+  if (x > 1655) {
+    print("f1655 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1656(a, b) {
+  let x = a * 1656 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1656;
+  }
+  if (x > 1656) {
+    print("f1656 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1657(a, b) {
+  let x = a * 1657 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1657;
+  }
+  if (x > 1657) {
+    print("f1657 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1658(a, b) {
+  let x = a * 1658 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1658;
+  }
+  if (x > 1658) {
+    print("f1658 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1659(a, b) {
+  let x = a * 1659 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1659;
+  }
+  if (x > 1659) {
+    print("f1659 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1660(a, b) {
+  let x = a * 1660 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1660;
+  }
+  if (x > 1660) {
+    print("f1660 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1661(a, b) {
+  let x = a * 1661 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1661;
+  }
+  if (x > 1661) {
+    print("f1661 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1662(a, b) {
+  let x = a * 1662 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1662;
+  }
+  if (x > 1662) {
+    print("f1662 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1663(a, b) {
+  let x = a * 1663 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1663;
+  }
+  if (x > 1663) {
+    print("f1663 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1664(a, b) {
+  let x = a * 1664 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1664;
+  }
+  if (x > 1664) {
+    print("f1664 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1665(a, b) {
+  let x = a * 1665 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1665;
+  }
+  if (x > 1665) {
+    print("f1665 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1666(a, b) {
+  let x = a * 1666 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1666;
+  }
+  if (x > 1666) {
+    print("f1666 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1667(a, b) {
+  let x = a * 1667 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1667;
+  }
+  if (x > 1667) {
+    print("f1667 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1668(a, b) {
+  let x = a * 1668 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1668;
+  }
+  if (x > 1668) {
+    print("f1668 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1669(a, b) {
+  let x = a * 1669 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1669;
+  }
+  if (x > 1669) {
+    print("f1669 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1670(a, b) {
+  let x = a * 1670 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1670;
+  }
+  if (x > 1670) {
+    print("f1670 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1671(a, b) {
+  let x = a * 1671 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1671;
+  }
+  if (x > 1671) {
+    print("f1671 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1672(a, b) {
+  let x = a * 1672 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1672;
+  }
+  if (x > 1672) {
+    print("f1672 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1673(a, b) {
+  let x = a * 1673 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1673;
+  }
+  if (x > 1673) {
+    print("f1673 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1674(a, b) {
+  let x = a * 1674 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1674;
+  }
+  if (x > 1674) {
+    print("f1674 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1675(a, b) {
+  let x = a * 1675 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1675;
+  }
+  if (x > 1675) {
+    print("f1675 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1676(a, b) {
+  let x = a * 1676 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1676;
+  }
+  if (x > 1676) {
+    print("f1676 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1677(a, b) {
+  let x = a * 1677 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1677;
+  }
+  if (x > 1677) {
+    print("f1677 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1678(a, b) {
+  let x = a * 1678 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1678;
+  }
+  if (x > 1678) {
+    print("f1678 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1679(a, b) {
+  let x = a * 1679 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1679;
+  }
+  if (x > 1679) {
+    print("f1679 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1680(a, b) {
+  let x = a * 1680 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1680;
+  }
+  if (x > 1680) {
+    print("f1680 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1681(a, b) {
+  let x = a * 1681 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1681;
+  }
+  if (x > 1681) {
+    print("f1681 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1682(a, b) {
+  let x = a * 1682 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1682;
+  }
+  if (x > 1682) {
+    print("f1682 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1683(a, b) {
+  let x = a * 1683 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1683;
+  }
+  if (x > 1683) {
+    print("f1683 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1684(a, b) {
+  let x = a * 1684 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1684;
+  }
+  if (x > 1684) {
+    print("f1684 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1685(a, b) {
+  let x = a * 1685 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1685;
+  }
+  if (x > 1685) {
+    print("f1685 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1686(a, b) {
+  let x = a * 1686 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1686;
+  }
+  if (x > 1686) {
+    print("f1686 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1687(a, b) {
+  let x = a * 1687 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1687;
+  }
+  if (x > 1687) {
+    print("f1687 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1688(a, b) {
+  let x = a * 1688 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1688;
+  }
+  if (x > 1688) {
+    print("f1688 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1689(a, b) {
+  let x = a * 1689 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1689;
+  }
+  if (x > 1689) {
+    print("f1689 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1690(a, b) {
+  let x = a * 1690 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1690;
+  }
+  if (x > 1690) {
+    print("f1690 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1691(a, b) {
+  let x = a * 1691 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1691;
+  }
+  if (x > 1691) {
+    print("f1691 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1692(a, b) {
+  let x = a * 1692 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1692;
+  }
+  if (x > 1692) {
+    print("f1692 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1693(a, b) {
+  let x = a * 1693 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1693;
+  }
+  if (x > 1693) {
+    print("f1693 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1694(a, b) {
+  let x = a * 1694 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1694;
+  }
+  if (x > 1694) {
+    print("f1694 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1695(a, b) {
+  let x = a * 1695 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1695;
+  }
+  if (x > 1695) {
+    print("f1695 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1696(a, b) {
+  let x = a * 1696 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1696;
+  }
+  if (x > 1696) {
+    print("f1696 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1697(a, b) {
+  let x = a * 1697 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1697;
+  }
+  if (x > 1697) {
+    print("f1697 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1698(a, b) {
+  let x = a * 1698 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1698;
+  }
+  if (x > 1698) {
+    print("f1698 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1699(a, b) {
+  let x = a * 1699 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1699;
+  }
+  if (x > 1699) {
+    print("f1699 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1700(a, b) {
+  let x = a * 1700 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1700;
+  }
+  if (x > 1700) {
+    print("f1700 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1701(a, b) {
+  let x = a * 1701 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1701;
+  }
+  if (x > 1701) {
+    print("f1701 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1702(a, b) {
+  let x = a * 1702 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1702;
+  }
+  if (x > 1702) {
+    print("f1702 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1703(a, b) {
+  let x = a * 1703 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1703;
+  }
+  if (x > 1703) {
+    print("f1703 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1704(a, b) {
+  let x = a * 1704 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1704;
+  }
+  if (x > 1704) {
+    print("f1704 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1705(a, b) {
+  let x = a * 1705 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1705;
+  }
+  if (x > 1705) {
+    print("f1705 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1706(a, b) {
+  let x = a * 1706 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1706;
+  }
+  if (x > 1706) {
+    print("f1706 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1707(a, b) {
+  let x = a * 1707 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1707;
+  }
+  if (x > 1707) {
+    print("f1707 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1708(a, b) {
+  let x = a * 1708 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1708;
+  }
+  if (x > 1708) {
+    print("f1708 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1709(a, b) {
+  let x = a * 1709 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1709;
+  }
+  if (x > 1709) {
+    print("f1709 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1710(a, b) {
+  let x = a * 1710 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1710;
+  }
+  if (x > 1710) {
+    print("f1710 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1711(a, b) {
+  let x = a * 1711 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1711;
+  }
+  if (x > 1711) {
+    print("f1711 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1712(a, b) {
+  let x = a * 1712 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1712;
+  }
+  if (x > 1712) {
+    print("f1712 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1713(a, b) {
+  let x = a * 1713 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1713;
+  }
+  if (x > 1713) {
+    print("f1713 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1714(a, b) {
+  let x = a * 1714 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1714;
+  }
+  if (x > 1714) {
+    print("f1714 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1715(a, b) {
+  let x = a * 1715 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1715;
+  }
+  if (x > 1715) {
+    print("f1715 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1716(a, b) {
+  let x = a * 1716 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1716;
+  }
+  if (x > 1716) {
+    print("f1716 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1717(a, b) {
+  let x = a * 1717 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1717;
+  }
+  if (x > 1717) {
+    print("f1717 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1718(a, b) {
+  let x = a * 1718 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1718;
+  }
+  if (x > 1718) {
+    print("f1718 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1719(a, b) {
+  let x = a * 1719 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1719;
+  }
+  if (x > 1719) {
+    print("f1719 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1720(a, b) {
+  let x = a * 1720 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1720;
+  }
+  if (x > 1720) {
+    print("f1720 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1721(a, b) {
+  let x = a * 1721 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1721;
+  }
+  if (x > 1721) {
+    print("f1721 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1722(a, b) {
+  let x = a * 1722 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1722;
+  }
+  if (x > 1722) {
+    print("f1722 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1723(a, b) {
+  let x = a * 1723 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1723;
+  }
+  if (x > 1723) {
+    print("f1723 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1724(a, b) {
+  let x = a * 1724 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1724;
+  }
+  if (x > 1724) {
+    print("f1724 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1725(a, b) {
+  let x = a * 1725 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1725;
+  }
+  if (x > 1725) {
+    print("f1725 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1726(a, b) {
+  let x = a * 1726 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1726;
+  }
+  if (x > 1726) {
+    print("f1726 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1727(a, b) {
+  let x = a * 1727 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1727;
+  }
+  if (x > 1727) {
+    print("f1727 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1728(a, b) {
+  let x = a * 1728 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1728;
+  }
+  if (x > 1728) {
+    print("f1728 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1729(a, b) {
+  let x = a * 1729 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1729;
+  }
+  if (x > 1729) {
+    print("f1729 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1730(a, b) {
+  let x = a * 1730 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1730;
+  }
+  if (x > 1730) {
+    print("f1730 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1731(a, b) {
+  let x = a * 1731 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1731;
+  }
+  if (x > 1731) {
+    print("f1731 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1732(a, b) {
+  let x = a * 1732 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1732;
+  }
+  if (x > 1732) {
+    print("f1732 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1733(a, b) {
+  let x = a * 1733 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1733;
+  }
+  if (x > 1733) {
+    print("f1733 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1734(a, b) {
+  let x = a * 1734 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1734;
+  }
+  if (x > 1734) {
+    print("f1734 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1735(a, b) {
+  let x = a * 1735 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1735;
+  }
+  if (x > 1735) {
+    print("f1735 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1736(a, b) {
+  let x = a * 1736 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1736;
+  }
+  if (x > 1736) {
+    print("f1736 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1737(a, b) {
+  let x = a * 1737 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1737;
+  }
+  if (x > 1737) {
+    print("f1737 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1738(a, b) {
+  let x = a * 1738 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1738;
+  }
+  if (x > 1738) {
+    print("f1738 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1739(a, b) {
+  let x = a * 1739 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1739;
+  }
+  if (x > 1739) {
+    print("f1739 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1740(a, b) {
+  let x = a * 1740 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1740;
+  }
+  if (x > 1740) {
+    print("f1740 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1741(a, b) {
+  let x = a * 1741 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1741;
+  }
+  if (x > 1741) {
+    print("f1741 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1742(a, b) {
+  let x = a * 1742 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1742;
+  }
+  if (x > 1742) {
+    print("f1742 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1743(a, b) {
+  let x = a * 1743 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1743;
+  }
+  if (x > 1743) {
+    print("f1743 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1744(a, b) {
+  let x = a * 1744 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1744;
+  }
+  if (x > 1744) {
+    print("f1744 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1745(a, b) {
+  let x = a * 1745 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1745;
+  }
+  if (x > 1745) {
+    print("f1745 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1746(a, b) {
+  let x = a * 1746 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1746;
+  }
+  if (x > 1746) {
+    print("f1746 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1747(a, b) {
+  let x = a * 1747 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1747;
+  }
+  if (x > 1747) {
+    print("f1747 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1748(a, b) {
+  let x = a * 1748 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1748;
+  }
+  if (x > 1748) {
+    print("f1748 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1749(a, b) {
+  let x = a * 1749 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1749;
+  }
+  if (x > 1749) {
+    print("f1749 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1750(a, b) {
+  let x = a * 1750 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1750;
+  }
+  if (x > 1750) {
+    print("f1750 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1751(a, b) {
+  let x = a * 1751 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1751;
+  }
+  if (x > 1751) {
+    print("f1751 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1752(a, b) {
+  let x = a * 1752 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1752;
+  }
+  if (x > 1752) {
+    print("f1752 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1753(a, b) {
+  let x = a * 1753 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1753;
+  }
+  if (x > 1753) {
+    print("f1753 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1754(a, b) {
+  let x = a * 1754 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1754;
+  }
+  if (x > 1754) {
+    print("f1754 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1755(a, b) {
+  let x = a * 1755 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1755;
+  }
+  if (x > 1755) {
+    print("f1755 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1756(a, b) {
+  let x = a * 1756 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1756;
+  }
+  if (x > 1756) {
+    print("f1756 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1757(a, b) {
+  let x = a * 1757 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1757;
+  }
+  if (x > 1757) {
+    print("f1757 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1758(a, b) {
+  let x = a * 1758 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1758;
+  }
+  if (x > 1758) {
+    print("f1758 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1759(a, b) {
+  let x = a * 1759 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1759;
+  }
+  if (x > 1759) {
+    print("f1759 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1760(a, b) {
+  let x = a * 1760 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1760;
+  }
+  if (x > 1760) {
+    print("f1760 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1761(a, b) {
+  let x = a * 1761 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1761;
+  }
+  if (x > 1761) {
+    print("f1761 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1762(a, b) {
+  let x = a * 1762 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1762;
+  }
+  if (x > 1762) {
+    print("f1762 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1763(a, b) {
+  let x = a * 1763 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1763;
+  }
+  if (x > 1763) {
+    print("f1763 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1764(a, b) {
+  let x = a * 1764 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1764;
+  }
+  if (x > 1764) {
+    print("f1764 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1765(a, b) {
+  let x = a * 1765 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1765;
+  }
+  if (x > 1765) {
+    print("f1765 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1766(a, b) {
+  let x = a * 1766 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1766;
+  }
+  if (x > 1766) {
+    print("f1766 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1767(a, b) {
+  let x = a * 1767 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1767;
+  }
+  if (x > 1767) {
+    print("f1767 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1768(a, b) {
+  let x = a * 1768 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1768;
+  }
+  if (x > 1768) {
+    print("f1768 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1769(a, b) {
+  let x = a * 1769 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1769;
+  }
+  if (x > 1769) {
+    print("f1769 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1770(a, b) {
+  let x = a * 1770 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1770;
+  }
+  if (x > 1770) {
+    print("f1770 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1771(a, b) {
+  let x = a * 1771 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1771;
+  }
+  if (x > 1771) {
+    print("f1771 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1772(a, b) {
+  let x = a * 1772 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1772;
+  }
+  if (x > 1772) {
+    print("f1772 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1773(a, b) {
+  let x = a * 1773 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1773;
+  }
+  if (x > 1773) {
+    print("f1773 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1774(a, b) {
+  let x = a * 1774 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1774;
+  }
+  if (x > 1774) {
+    print("f1774 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1775(a, b) {
+  let x = a * 1775 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1775;
+  }
+  if (x > 1775) {
+    print("f1775 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1776(a, b) {
+  let x = a * 1776 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1776;
+  }
+  if (x > 1776) {
+    print("f1776 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1777(a, b) {
+  let x = a * 1777 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1777;
+  }
+  if (x > 1777) {
+    print("f1777 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1778(a, b) {
+  let x = a * 1778 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1778;
+  }
+  if (x > 1778) {
+    print("f1778 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1779(a, b) {
+  let x = a * 1779 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1779;
+  }
+  if (x > 1779) {
+    print("f1779 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1780(a, b) {
+  let x = a * 1780 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1780;
+  }
+  if (x > 1780) {
+    print("f1780 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1781(a, b) {
+  let x = a * 1781 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1781;
+  }
+  if (x > 1781) {
+    print("f1781 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1782(a, b) {
+  let x = a * 1782 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1782;
+  }
+  if (x > 1782) {
+    print("f1782 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1783(a, b) {
+  let x = a * 1783 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1783;
+  }
+  if (x > 1783) {
+    print("f1783 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1784(a, b) {
+  let x = a * 1784 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1784;
+  }
+  if (x > 1784) {
+    print("f1784 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1785(a, b) {
+  let x = a * 1785 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1785;
+  }
+  if (x > 1785) {
+    print("f1785 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1786(a, b) {
+  let x = a * 1786 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1786;
+  }
+  if (x > 1786) {
+    print("f1786 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1787(a, b) {
+  let x = a * 1787 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1787;
+  }
+  if (x > 1787) {
+    print("f1787 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1788(a, b) {
+  let x = a * 1788 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1788;
+  }
+  if (x > 1788) {
+    print("f1788 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1789(a, b) {
+  let x = a * 1789 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1789;
+  }
+  if (x > 1789) {
+    print("f1789 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1790(a, b) {
+  let x = a * 1790 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1790;
+  }
+  if (x > 1790) {
+    print("f1790 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1791(a, b) {
+  let x = a * 1791 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1791;
+  }
+  if (x > 1791) {
+    print("f1791 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1792(a, b) {
+  let x = a * 1792 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1792;
+  }
+  if (x > 1792) {
+    print("f1792 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1793(a, b) {
+  let x = a * 1793 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1793;
+  }
+  if (x > 1793) {
+    print("f1793 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1794(a, b) {
+  let x = a * 1794 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1794;
+  }
+  if (x > 1794) {
+    print("f1794 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1795(a, b) {
+  let x = a * 1795 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1795;
+  }
+  if (x > 1795) {
+    print("f1795 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1796(a, b) {
+  let x = a * 1796 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1796;
+  }
+  if (x > 1796) {
+    print("f1796 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1797(a, b) {
+  let x = a * 1797 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1797;
+  }
+  if (x > 1797) {
+    print("f1797 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1798(a, b) {
+  let x = a * 1798 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1798;
+  }
+  if (x > 1798) {
+    print("f1798 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1799(a, b) {
+  let x = a * 1799 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1799;
+  }
+  if (x > 1799) {
+    print("f1799 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1800(a, b) {
+  let x = a * 1800 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1800;
+  }
+  if (x > 1800) {
+    print("f1800 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1801(a, b) {
+  let x = a * 1801 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1801;
+  }
+  if (x > 1801) {
+    print("f1801 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1802(a, b) {
+  let x = a * 1802 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1802;
+  }
+  if (x > 1802) {
+    print("f1802 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1803(a, b) {
+  let x = a * 1803 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1803;
+  }
+  if (x > 1803) {
+    print("f1803 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1804(a, b) {
+  let x = a * 1804 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1804;
+  }
+  if (x > 1804) {
+    print("f1804 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1805(a, b) {
+  let x = a * 1805 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1805;
+  }
+  if (x > 1805) {
+    print("f1805 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1806(a, b) {
+  let x = a * 1806 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1806;
+  }
+  if (x > 1806) {
+    print("f1806 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1807(a, b) {
+  let x = a * 1807 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1807;
+  }
+  if (x > 1807) {
+    print("f1807 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1808(a, b) {
+  let x = a * 1808 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1808;
+  }
+  if (x > 1808) {
+    print("f1808 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1809(a, b) {
+  let x = a * 1809 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1809;
+  }
+  if (x > 1809) {
+    print("f1809 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1810(a, b) {
+  let x = a * 1810 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1810;
+  }
+  if (x > 1810) {
+    print("f1810 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1811(a, b) {
+  let x = a * 1811 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1811;
+  }
+  if (x > 1811) {
+    print("f1811 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1812(a, b) {
+  let x = a * 1812 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1812;
+  }
+  if (x > 1812) {
+    print("f1812 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1813(a, b) {
+  let x = a * 1813 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1813;
+  }
+  if (x > 1813) {
+    print("f1813 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1814(a, b) {
+  let x = a * 1814 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1814;
+  }
+  if (x > 1814) {
+    print("f1814 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1815(a, b) {
+  let x = a * 1815 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1815;
+  }
+  if (x > 1815) {
+    print("f1815 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1816(a, b) {
+  let x = a * 1816 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1816;
+  }
+  if (x > 1816) {
+    print("f1816 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1817(a, b) {
+  let x = a * 1817 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1817;
+  }
+  if (x > 1817) {
+    print("f1817 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1818(a, b) {
+  let x = a * 1818 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1818;
+  }
+  if (x > 1818) {
+    print("f1818 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1819(a, b) {
+  let x = a * 1819 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1819;
+  }
+  if (x > 1819) {
+    print("f1819 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1820(a, b) {
+  let x = a * 1820 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1820;
+  }
+  if (x > 1820) {
+    print("f1820 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1821(a, b) {
+  let x = a * 1821 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1821;
+  }
+  if (x > 1821) {
+    print("f1821 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1822(a, b) {
+  let x = a * 1822 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1822;
+  }
+  if (x > 1822) {
+    print("f1822 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1823(a, b) {
+  let x = a * 1823 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1823;
+  }
+  if (x > 1823) {
+    print("f1823 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1824(a, b) {
+  let x = a * 1824 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1824;
+  }
+  if (x > 1824) {
+    print("f1824 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1825(a, b) {
+  let x = a * 1825 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1825;
+  }
+  if (x > 1825) {
+    print("f1825 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1826(a, b) {
+  let x = a * 1826 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1826;
+  }
+  if (x > 1826) {
+    print("f1826 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1827(a, b) {
+  let x = a * 1827 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1827;
+  }
+  if (x > 1827) {
+    print("f1827 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1828(a, b) {
+  let x = a * 1828 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1828;
+  }
+  if (x > 1828) {
+    print("f1828 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1829(a, b) {
+  let x = a * 1829 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1829;
+  }
+  if (x > 1829) {
+    print("f1829 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1830(a, b) {
+  let x = a * 1830 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1830;
+  }
+  if (x > 1830) {
+    print("f1830 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1831(a, b) {
+  let x = a * 1831 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1831;
+  }
+  if (x > 1831) {
+    print("f1831 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1832(a, b) {
+  let x = a * 1832 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1832;
+  }
+  if (x > 1832) {
+    print("f1832 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1833(a, b) {
+  let x = a * 1833 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1833;
+  }
+  if (x > 1833) {
+    print("f1833 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1834(a, b) {
+  let x = a * 1834 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1834;
+  }
+  if (x > 1834) {
+    print("f1834 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1835(a, b) {
+  let x = a * 1835 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1835;
+  }
+  if (x > 1835) {
+    print("f1835 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1836(a, b) {
+  let x = a * 1836 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1836;
+  }
+  if (x > 1836) {
+    print("f1836 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1837(a, b) {
+  let x = a * 1837 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1837;
+  }
+  if (x > 1837) {
+    print("f1837 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1838(a, b) {
+  let x = a * 1838 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1838;
+  }
+  if (x > 1838) {
+    print("f1838 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1839(a, b) {
+  let x = a * 1839 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1839;
+  }
+  if (x > 1839) {
+    print("f1839 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1840(a, b) {
+  let x = a * 1840 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1840;
+  }
+  if (x > 1840) {
+    print("f1840 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1841(a, b) {
+  let x = a * 1841 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1841;
+  }
+  if (x > 1841) {
+    print("f1841 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1842(a, b) {
+  let x = a * 1842 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1842;
+  }
+  if (x > 1842) {
+    print("f1842 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1843(a, b) {
+  let x = a * 1843 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1843;
+  }
+  if (x > 1843) {
+    print("f1843 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1844(a, b) {
+  let x = a * 1844 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1844;
+  }
+  if (x > 1844) {
+    print("f1844 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1845(a, b) {
+  let x = a * 1845 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1845;
+  }
+  if (x > 1845) {
+    print("f1845 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1846(a, b) {
+  let x = a * 1846 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1846;
+  }
+  if (x > 1846) {
+    print("f1846 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1847(a, b) {
+  let x = a * 1847 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1847;
+  }
+  if (x > 1847) {
+    print("f1847 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1848(a, b) {
+  let x = a * 1848 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1848;
+  }
+  if (x > 1848) {
+    print("f1848 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1849(a, b) {
+  let x = a * 1849 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1849;
+  }
+  if (x > 1849) {
+    print("f1849 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1850(a, b) {
+  let x = a * 1850 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1850;
+  }
+  if (x > 1850) {
+    print("f1850 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1851(a, b) {
+  let x = a * 1851 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1851;
+  }
+  if (x > 1851) {
+    print("f1851 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1852(a, b) {
+  let x = a * 1852 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1852;
+  }
+  if (x > 1852) {
+    print("f1852 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1853(a, b) {
+  let x = a * 1853 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1853;
+  }
+  if (x > 1853) {
+    print("f1853 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1854(a, b) {
+  let x = a * 1854 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1854;
+  }
+  if (x > 1854) {
+    print("f1854 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1855(a, b) {
+  let x = a * 1855 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1855;
+  }
+  if (x > 1855) {
+    print("f1855 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1856(a, b) {
+  let x = a * 1856 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1856;
+  }
+  if (x > 1856) {
+    print("f1856 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1857(a, b) {
+  let x = a * 1857 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1857;
+  }
+  if (x > 1857) {
+    print("f1857 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1858(a, b) {
+  let x = a * 1858 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1858;
+  }
+  if (x > 1858) {
+    print("f1858 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1859(a, b) {
+  let x = a * 1859 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1859;
+  }
+  if (x > 1859) {
+    print("f1859 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1860(a, b) {
+  let x = a * 1860 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1860;
+  }
+  if (x > 1860) {
+    print("f1860 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1861(a, b) {
+  let x = a * 1861 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1861;
+  }
+  if (x > 1861) {
+    print("f1861 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1862(a, b) {
+  let x = a * 1862 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1862;
+  }
+  if (x > 1862) {
+    print("f1862 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1863(a, b) {
+  let x = a * 1863 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1863;
+  }
+  if (x > 1863) {
+    print("f1863 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1864(a, b) {
+  let x = a * 1864 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1864;
+  }
+  if (x > 1864) {
+    print("f1864 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1865(a, b) {
+  let x = a * 1865 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1865;
+  }
+  if (x > 1865) {
+    print("f1865 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1866(a, b) {
+  let x = a * 1866 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1866;
+  }
+  if (x > 1866) {
+    print("f1866 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1867(a, b) {
+  let x = a * 1867 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1867;
+  }
+  if (x > 1867) {
+    print("f1867 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1868(a, b) {
+  let x = a * 1868 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1868;
+  }
+  if (x > 1868) {
+    print("f1868 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1869(a, b) {
+  let x = a * 1869 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1869;
+  }
+  if (x > 1869) {
+    print("f1869 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1870(a, b) {
+  let x = a * 1870 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1870;
+  }
+  if (x > 1870) {
+    print("f1870 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1871(a, b) {
+  let x = a * 1871 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1871;
+  }
+  if (x > 1871) {
+    print("f1871 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1872(a, b) {
+  let x = a * 1872 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1872;
+  }
+  if (x > 1872) {
+    print("f1872 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1873(a, b) {
+  let x = a * 1873 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1873;
+  }
+  if (x > 1873) {
+    print("f1873 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1874(a, b) {
+  let x = a * 1874 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1874;
+  }
+  if (x > 1874) {
+    print("f1874 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1875(a, b) {
+  let x = a * 1875 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1875;
+  }
+  if (x > 1875) {
+    print("f1875 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1876(a, b) {
+  let x = a * 1876 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1876;
+  }
+  if (x > 1876) {
+    print("f1876 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1877(a, b) {
+  let x = a * 1877 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1877;
+  }
+  if (x > 1877) {
+    print("f1877 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1878(a, b) {
+  let x = a * 1878 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1878;
+  }
+  if (x > 1878) {
+    print("f1878 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1879(a, b) {
+  let x = a * 1879 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1879;
+  }
+  if (x > 1879) {
+    print("f1879 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1880(a, b) {
+  let x = a * 1880 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1880;
+  }
+  if (x > 1880) {
+    print("f1880 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1881(a, b) {
+  let x = a * 1881 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1881;
+  }
+  if (x > 1881) {
+    print("f1881 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1882(a, b) {
+  let x = a * 1882 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1882;
+  }
+  if (x > 1882) {
+    print("f1882 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1883(a, b) {
+  let x = a * 1883 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1883;
+  }
+  if (x > 1883) {
+    print("f1883 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1884(a, b) {
+  let x = a * 1884 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1884;
+  }
+  if (x > 1884) {
+    print("f1884 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1885(a, b) {
+  let x = a * 1885 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1885;
+  }
+  if (x > 1885) {
+    print("f1885 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1886(a, b) {
+  let x = a * 1886 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1886;
+  }
+  if (x > 1886) {
+    print("f1886 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1887(a, b) {
+  let x = a * 1887 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1887;
+  }
+  if (x > 1887) {
+    print("f1887 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1888(a, b) {
+  let x = a * 1888 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1888;
+  }
+  if (x > 1888) {
+    print("f1888 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1889(a, b) {
+  let x = a * 1889 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1889;
+  }
+  if (x > 1889) {
+    print("f1889 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1890(a, b) {
+  let x = a * 1890 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1890;
+  }
+  if (x > 1890) {
+    print("f1890 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1891(a, b) {
+  let x = a * 1891 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1891;
+  }
+  if (x > 1891) {
+    print("f1891 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1892(a, b) {
+  let x = a * 1892 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1892;
+  }
+  if (x > 1892) {
+    print("f1892 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1893(a, b) {
+  let x = a * 1893 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1893;
+  }
+  if (x > 1893) {
+    print("f1893 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1894(a, b) {
+  let x = a * 1894 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1894;
+  }
+  if (x > 1894) {
+    print("f1894 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1895(a, b) {
+  let x = a * 1895 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1895;
+  }
+  if (x > 1895) {
+    print("f1895 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1896(a, b) {
+  let x = a * 1896 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1896;
+  }
+  if (x > 1896) {
+    print("f1896 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1897(a, b) {
+  let x = a * 1897 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1897;
+  }
+  if (x > 1897) {
+    print("f1897 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1898(a, b) {
+  let x = a * 1898 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1898;
+  }
+  if (x > 1898) {
+    print("f1898 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1899(a, b) {
+  let x = a * 1899 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1899;
+  }
+  if (x > 1899) {
+    print("f1899 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1900(a, b) {
+  let x = a * 1900 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1900;
+  }
+  if (x > 1900) {
+    print("f1900 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1901(a, b) {
+  let x = a * 1901 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1901;
+  }
+  if (x > 1901) {
+    print("f1901 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1902(a, b) {
+  let x = a * 1902 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1902;
+  }
+  if (x > 1902) {
+    print("f1902 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1903(a, b) {
+  let x = a * 1903 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1903;
+  }
+  if (x > 1903) {
+    print("f1903 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1904(a, b) {
+  let x = a * 1904 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1904;
+  }
+  if (x > 1904) {
+    print("f1904 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1905(a, b) {
+  let x = a * 1905 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1905;
+  }
+  if (x > 1905) {
+    print("f1905 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1906(a, b) {
+  let x = a * 1906 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1906;
+  }
+  if (x > 1906) {
+    print("f1906 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1907(a, b) {
+  let x = a * 1907 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1907;
+  }
+  if (x > 1907) {
+    print("f1907 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1908(a, b) {
+  let x = a * 1908 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1908;
+  }
+  if (x > 1908) {
+    print("f1908 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1909(a, b) {
+  let x = a * 1909 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1909;
+  }
+  if (x > 1909) {
+    print("f1909 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1910(a, b) {
+  let x = a * 1910 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1910;
+  }
+  if (x > 1910) {
+    print("f1910 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1911(a, b) {
+  let x = a * 1911 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1911;
+  }
+  if (x > 1911) {
+    print("f1911 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1912(a, b) {
+  let x = a * 1912 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1912;
+  }
+  if (x > 1912) {
+    print("f1912 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1913(a, b) {
+  let x = a * 1913 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1913;
+  }
+  if (x > 1913) {
+    print("f1913 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1914(a, b) {
+  let x = a * 1914 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1914;
+  }
+  if (x > 1914) {
+    print("f1914 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1915(a, b) {
+  let x = a * 1915 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1915;
+  }
+  if (x > 1915) {
+    print("f1915 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1916(a, b) {
+  let x = a * 1916 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1916;
+  }
+  if (x > 1916) {
+    print("f1916 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1917(a, b) {
+  let x = a * 1917 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1917;
+  }
+  if (x > 1917) {
+    print("f1917 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1918(a, b) {
+  let x = a * 1918 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1918;
+  }
+  if (x > 1918) {
+    print("f1918 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1919(a, b) {
+  let x = a * 1919 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1919;
+  }
+  if (x > 1919) {
+    print("f1919 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1920(a, b) {
+  let x = a * 1920 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1920;
+  }
+  if (x > 1920) {
+    print("f1920 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1921(a, b) {
+  let x = a * 1921 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1921;
+  }
+  if (x > 1921) {
+    print("f1921 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1922(a, b) {
+  let x = a * 1922 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1922;
+  }
+  if (x > 1922) {
+    print("f1922 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1923(a, b) {
+  let x = a * 1923 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1923;
+  }
+  if (x > 1923) {
+    print("f1923 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1924(a, b) {
+  let x = a * 1924 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1924;
+  }
+  if (x > 1924) {
+    print("f1924 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1925(a, b) {
+  let x = a * 1925 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1925;
+  }
+  if (x > 1925) {
+    print("f1925 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1926(a, b) {
+  let x = a * 1926 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1926;
+  }
+  if (x > 1926) {
+    print("f1926 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1927(a, b) {
+  let x = a * 1927 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1927;
+  }
+  if (x > 1927) {
+    print("f1927 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1928(a, b) {
+  let x = a * 1928 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1928;
+  }
+  if (x > 1928) {
+    print("f1928 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1929(a, b) {
+  let x = a * 1929 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1929;
+  }
+  if (x > 1929) {
+    print("f1929 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1930(a, b) {
+  let x = a * 1930 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1930;
+  }
+  if (x > 1930) {
+    print("f1930 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1931(a, b) {
+  let x = a * 1931 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1931;
+  }
+  if (x > 1931) {
+    print("f1931 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1932(a, b) {
+  let x = a * 1932 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1932;
+  }
+  if (x > 1932) {
+    print("f1932 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1933(a, b) {
+  let x = a * 1933 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1933;
+  }
+  if (x > 1933) {
+    print("f1933 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1934(a, b) {
+  let x = a * 1934 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1934;
+  }
+  if (x > 1934) {
+    print("f1934 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1935(a, b) {
+  let x = a * 1935 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1935;
+  }
+  if (x > 1935) {
+    print("f1935 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1936(a, b) {
+  let x = a * 1936 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1936;
+  }
+  if (x > 1936) {
+    print("f1936 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1937(a, b) {
+  let x = a * 1937 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1937;
+  }
+  if (x > 1937) {
+    print("f1937 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1938(a, b) {
+  let x = a * 1938 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1938;
+  }
+  if (x > 1938) {
+    print("f1938 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1939(a, b) {
+  let x = a * 1939 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1939;
+  }
+  if (x > 1939) {
+    print("f1939 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1940(a, b) {
+  let x = a * 1940 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1940;
+  }
+  if (x > 1940) {
+    print("f1940 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1941(a, b) {
+  let x = a * 1941 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1941;
+  }
+  if (x > 1941) {
+    print("f1941 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1942(a, b) {
+  let x = a * 1942 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1942;
+  }
+  if (x > 1942) {
+    print("f1942 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1943(a, b) {
+  let x = a * 1943 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1943;
+  }
+  if (x > 1943) {
+    print("f1943 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1944(a, b) {
+  let x = a * 1944 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1944;
+  }
+  if (x > 1944) {
+    print("f1944 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1945(a, b) {
+  let x = a * 1945 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1945;
+  }
+  if (x > 1945) {
+    print("f1945 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1946(a, b) {
+  let x = a * 1946 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1946;
+  }
+  if (x > 1946) {
+    print("f1946 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1947(a, b) {
+  let x = a * 1947 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1947;
+  }
+  if (x > 1947) {
+    print("f1947 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1948(a, b) {
+  let x = a * 1948 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1948;
+  }
+  if (x > 1948) {
+    print("f1948 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1949(a, b) {
+  let x = a * 1949 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1949;
+  }
+  if (x > 1949) {
+    print("f1949 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1950(a, b) {
+  let x = a * 1950 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1950;
+  }
+  if (x > 1950) {
+    print("f1950 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1951(a, b) {
+  let x = a * 1951 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1951;
+  }
+  if (x > 1951) {
+    print("f1951 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1952(a, b) {
+  let x = a * 1952 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1952;
+  }
+  if (x > 1952) {
+    print("f1952 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1953(a, b) {
+  let x = a * 1953 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1953;
+  }
+  if (x > 1953) {
+    print("f1953 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1954(a, b) {
+  let x = a * 1954 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1954;
+  }
+  if (x > 1954) {
+    print("f1954 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1955(a, b) {
+  let x = a * 1955 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1955;
+  }
+  if (x > 1955) {
+    print("f1955 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1956(a, b) {
+  let x = a * 1956 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1956;
+  }
+  if (x > 1956) {
+    print("f1956 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1957(a, b) {
+  let x = a * 1957 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1957;
+  }
+  if (x > 1957) {
+    print("f1957 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1958(a, b) {
+  let x = a * 1958 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1958;
+  }
+  if (x > 1958) {
+    print("f1958 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1959(a, b) {
+  let x = a * 1959 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1959;
+  }
+  if (x > 1959) {
+    print("f1959 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1960(a, b) {
+  let x = a * 1960 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1960;
+  }
+  if (x > 1960) {
+    print("f1960 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1961(a, b) {
+  let x = a * 1961 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1961;
+  }
+  if (x > 1961) {
+    print("f1961 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1962(a, b) {
+  let x = a * 1962 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1962;
+  }
+  if (x > 1962) {
+    print("f1962 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1963(a, b) {
+  let x = a * 1963 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1963;
+  }
+  if (x > 1963) {
+    print("f1963 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1964(a, b) {
+  let x = a * 1964 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1964;
+  }
+  if (x > 1964) {
+    print("f1964 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1965(a, b) {
+  let x = a * 1965 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1965;
+  }
+  if (x > 1965) {
+    print("f1965 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1966(a, b) {
+  let x = a * 1966 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1966;
+  }
+  if (x > 1966) {
+    print("f1966 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1967(a, b) {
+  let x = a * 1967 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1967;
+  }
+  if (x > 1967) {
+    print("f1967 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1968(a, b) {
+  let x = a * 1968 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1968;
+  }
+  if (x > 1968) {
+    print("f1968 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1969(a, b) {
+  let x = a * 1969 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1969;
+  }
+  if (x > 1969) {
+    print("f1969 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1970(a, b) {
+  let x = a * 1970 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1970;
+  }
+  if (x > 1970) {
+    print("f1970 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1971(a, b) {
+  let x = a * 1971 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1971;
+  }
+  if (x > 1971) {
+    print("f1971 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1972(a, b) {
+  let x = a * 1972 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1972;
+  }
+  if (x > 1972) {
+    print("f1972 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1973(a, b) {
+  let x = a * 1973 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1973;
+  }
+  if (x > 1973) {
+    print("f1973 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1974(a, b) {
+  let x = a * 1974 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1974;
+  }
+  if (x > 1974) {
+    print("f1974 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1975(a, b) {
+  let x = a * 1975 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1975;
+  }
+  if (x > 1975) {
+    print("f1975 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1976(a, b) {
+  let x = a * 1976 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1976;
+  }
+  if (x > 1976) {
+    print("f1976 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1977(a, b) {
+  let x = a * 1977 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1977;
+  }
+  if (x > 1977) {
+    print("f1977 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1978(a, b) {
+  let x = a * 1978 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1978;
+  }
+  if (x > 1978) {
+    print("f1978 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1979(a, b) {
+  let x = a * 1979 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1979;
+  }
+  if (x > 1979) {
+    print("f1979 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1980(a, b) {
+  let x = a * 1980 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1980;
+  }
+  if (x > 1980) {
+    print("f1980 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1981(a, b) {
+  let x = a * 1981 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1981;
+  }
+  if (x > 1981) {
+    print("f1981 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1982(a, b) {
+  let x = a * 1982 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1982;
+  }
+  if (x > 1982) {
+    print("f1982 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1983(a, b) {
+  let x = a * 1983 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1983;
+  }
+  if (x > 1983) {
+    print("f1983 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1984(a, b) {
+  let x = a * 1984 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1984;
+  }
+  if (x > 1984) {
+    print("f1984 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1985(a, b) {
+  let x = a * 1985 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1985;
+  }
+  if (x > 1985) {
+    print("f1985 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1986(a, b) {
+  let x = a * 1986 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1986;
+  }
+  if (x > 1986) {
+    print("f1986 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1987(a, b) {
+  let x = a * 1987 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1987;
+  }
+  if (x > 1987) {
+    print("f1987 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1988(a, b) {
+  let x = a * 1988 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1988;
+  }
+  if (x > 1988) {
+    print("f1988 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1989(a, b) {
+  let x = a * 1989 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1989;
+  }
+  if (x > 1989) {
+    print("f1989 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1990(a, b) {
+  let x = a * 1990 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1990;
+  }
+  if (x > 1990) {
+    print("f1990 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1991(a, b) {
+  let x = a * 1991 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1991;
+  }
+  if (x > 1991) {
+    print("f1991 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1992(a, b) {
+  let x = a * 1992 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1992;
+  }
+  if (x > 1992) {
+    print("f1992 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1993(a, b) {
+  let x = a * 1993 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1993;
+  }
+  if (x > 1993) {
+    print("f1993 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1994(a, b) {
+  let x = a * 1994 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1994;
+  }
+  if (x > 1994) {
+    print("f1994 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1995(a, b) {
+  let x = a * 1995 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1995;
+  }
+  if (x > 1995) {
+    print("f1995 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1996(a, b) {
+  let x = a * 1996 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1996;
+  }
+  if (x > 1996) {
+    print("f1996 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1997(a, b) {
+  let x = a * 1997 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1997;
+  }
+  if (x > 1997) {
+    print("f1997 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1998(a, b) {
+  let x = a * 1998 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1998;
+  }
+  if (x > 1998) {
+    print("f1998 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f1999(a, b) {
+  let x = a * 1999 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 1999;
+  }
+  if (x > 1999) {
+    print("f1999 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2000(a, b) {
+  let x = a * 2000 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2000;
+  }
+  if (x > 2000) {
+    print("f2000 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2001(a, b) {
+  let x = a * 2001 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2001;
+  }
+  if (x > 2001) {
+    print("f2001 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2002(a, b) {
+  let x = a * 2002 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2002;
+  }
+  if (x > 2002) {
+    print("f2002 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2003(a, b) {
+  let x = a * 2003 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2003;
+  }
+  if (x > 2003) {
+    print("f2003 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2004(a, b) {
+  let x = a * 2004 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2004;
+  }
+  if (x > 2004) {
+    print("f2004 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2005(a, b) {
+  let x = a * 2005 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2005;
+  }
+  if (x > 2005) {
+    print("f2005 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2006(a, b) {
+  let x = a * 2006 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2006;
+  }
+  if (x > 2006) {
+    print("f2006 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2007(a, b) {
+  let x = a * 2007 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2007;
+  }
+  if (x > 2007) {
+    print("f2007 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2008(a, b) {
+  let x = a * 2008 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2008;
+  }
+  if (x > 2008) {
+    print("f2008 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2009(a, b) {
+  let x = a * 2009 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2009;
+  }
+  if (x > 2009) {
+    print("f2009 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2010(a, b) {
+  let x = a * 2010 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2010;
+  }
+  if (x > 2010) {
+    print("f2010 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2011(a, b) {
+  let x = a * 2011 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2011;
+  }
+  if (x > 2011) {
+    print("f2011 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2012(a, b) {
+  let x = a * 2012 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2012;
+  }
+  if (x > 2012) {
+    print("f2012 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2013(a, b) {
+  let x = a * 2013 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2013;
+  }
+  if (x > 2013) {
+    print("f2013 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2014(a, b) {
+  let x = a * 2014 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2014;
+  }
+  if (x > 2014) {
+    print("f2014 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2015(a, b) {
+  let x = a * 2015 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2015;
+  }
+  if (x > 2015) {
+    print("f2015 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2016(a, b) {
+  let x = a * 2016 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2016;
+  }
+  if (x > 2016) {
+    print("f2016 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2017(a, b) {
+  let x = a * 2017 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2017;
+  }
+  if (x > 2017) {
+    print("f2017 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2018(a, b) {
+  let x = a * 2018 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2018;
+  }
+  if (x > 2018) {
+    print("f2018 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2019(a, b) {
+  let x = a * 2019 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2019;
+  }
+  if (x > 2019) {
+    print("f2019 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2020(a, b) {
+  let x = a * 2020 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2020;
+  }
+  if (x > 2020) {
+    print("f2020 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2021(a, b) {
+  let x = a * 2021 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2021;
+  }
+  if (x > 2021) {
+    print("f2021 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2022(a, b) {
+  let x = a * 2022 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2022;
+  }
+  if (x > 2022) {
+    print("f2022 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2023(a, b) {
+  let x = a * 2023 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2023;
+  }
+  if (x > 2023) {
+    print("f2023 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2024(a, b) {
+  let x = a * 2024 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2024;
+  }
+  if (x > 2024) {
+    print("f2024 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2025(a, b) {
+  let x = a * 2025 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2025;
+  }
+  if (x > 2025) {
+    print("f2025 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2026(a, b) {
+  let x = a * 2026 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2026;
+  }
+  if (x > 2026) {
+    print("f2026 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2027(a, b) {
+  let x = a * 2027 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2027;
+  }
+  if (x > 2027) {
+    print("f2027 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2028(a, b) {
+  let x = a * 2028 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2028;
+  }
+  if (x > 2028) {
+    print("f2028 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2029(a, b) {
+  let x = a * 2029 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2029;
+  }
+  if (x > 2029) {
+    print("f2029 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2030(a, b) {
+  let x = a * 2030 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2030;
+  }
+  if (x > 2030) {
+    print("f2030 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2031(a, b) {
+  let x = a * 2031 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2031;
+  }
+  if (x > 2031) {
+    print("f2031 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2032(a, b) {
+  let x = a * 2032 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2032;
+  }
+  if (x > 2032) {
+    print("f2032 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2033(a, b) {
+  let x = a * 2033 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2033;
+  }
+  if (x > 2033) {
+    print("f2033 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2034(a, b) {
+  let x = a * 2034 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2034;
+  }
+  if (x > 2034) {
+    print("f2034 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2035(a, b) {
+  let x = a * 2035 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2035;
+  }
+  if (x > 2035) {
+    print("f2035 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2036(a, b) {
+  let x = a * 2036 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2036;
+  }
+  if (x > 2036) {
+    print("f2036 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2037(a, b) {
+  let x = a * 2037 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2037;
+  }
+  if (x > 2037) {
+    print("f2037 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2038(a, b) {
+  let x = a * 2038 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2038;
+  }
+  if (x > 2038) {
+    print("f2038 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2039(a, b) {
+  let x = a * 2039 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2039;
+  }
+  if (x > 2039) {
+    print("f2039 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2040(a, b) {
+  let x = a * 2040 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2040;
+  }
+  if (x > 2040) {
+    print("f2040 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2041(a, b) {
+  let x = a * 2041 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2041;
+  }
+  if (x > 2041) {
+    print("f2041 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2042(a, b) {
+  let x = a * 2042 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2042;
+  }
+  if (x > 2042) {
+    print("f2042 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2043(a, b) {
+  let x = a * 2043 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2043;
+  }
+  if (x > 2043) {
+    print("f2043 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2044(a, b) {
+  let x = a * 2044 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2044;
+  }
+  if (x > 2044) {
+    print("f2044 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2045(a, b) {
+  let x = a * 2045 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2045;
+  }
+  if (x > 2045) {
+    print("f2045 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2046(a, b) {
+  let x = a * 2046 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2046;
+  }
+  if (x > 2046) {
+    print("f2046 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2047(a, b) {
+  let x = a * 2047 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2047;
+  }
+  if (x > 2047) {
+    print("f2047 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2048(a, b) {
+  let x = a * 2048 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2048;
+  }
+  if (x > 2048) {
+    print("f2048 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2049(a, b) {
+  let x = a * 2049 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2049;
+  }
+  if (x > 2049) {
+    print("f2049 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2050(a, b) {
+  let x = a * 2050 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2050;
+  }
+  if (x > 2050) {
+    print("f2050 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2051(a, b) {
+  let x = a * 2051 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2051;
+  }
+  if (x > 2051) {
+    print("f2051 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2052(a, b) {
+  let x = a * 2052 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2052;
+  }
+  if (x > 2052) {
+    print("f2052 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2053(a, b) {
+  let x = a * 2053 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2053;
+  }
+  if (x > 2053) {
+    print("f2053 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2054(a, b) {
+  let x = a * 2054 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2054;
+  }
+  if (x > 2054) {
+    print("f2054 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2055(a, b) {
+  let x = a * 2055 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2055;
+  }
+  if (x > 2055) {
+    print("f2055 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2056(a, b) {
+  let x = a * 2056 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2056;
+  }
+  if (x > 2056) {
+    print("f2056 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2057(a, b) {
+  let x = a * 2057 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2057;
+  }
+  if (x > 2057) {
+    print("f2057 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2058(a, b) {
+  let x = a * 2058 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2058;
+  }
+  if (x > 2058) {
+    print("f2058 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2059(a, b) {
+  let x = a * 2059 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2059;
+  }
+  if (x > 2059) {
+    print("f2059 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2060(a, b) {
+  let x = a * 2060 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2060;
+  }
+  if (x > 2060) {
+    print("f2060 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2061(a, b) {
+  let x = a * 2061 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2061;
+  }
+  if (x > 2061) {
+    print("f2061 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2062(a, b) {
+  let x = a * 2062 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2062;
+  }
+  if (x > 2062) {
+    print("f2062 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2063(a, b) {
+  let x = a * 2063 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2063;
+  }
+  if (x > 2063) {
+    print("f2063 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2064(a, b) {
+  let x = a * 2064 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2064;
+  }
+  if (x > 2064) {
+    print("f2064 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2065(a, b) {
+  let x = a * 2065 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2065;
+  }
+  if (x > 2065) {
+    print("f2065 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2066(a, b) {
+  let x = a * 2066 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2066;
+  }
+  if (x > 2066) {
+    print("f2066 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2067(a, b) {
+  let x = a * 2067 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2067;
+  }
+  if (x > 2067) {
+    print("f2067 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2068(a, b) {
+  let x = a * 2068 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2068;
+  }
+  if (x > 2068) {
+    print("f2068 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2069(a, b) {
+  let x = a * 2069 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2069;
+  }
+  if (x > 2069) {
+    print("f2069 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2070(a, b) {
+  let x = a * 2070 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2070;
+  }
+  if (x > 2070) {
+    print("f2070 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2071(a, b) {
+  let x = a * 2071 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2071;
+  }
+  if (x > 2071) {
+    print("f2071 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2072(a, b) {
+  let x = a * 2072 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2072;
+  }
+  if (x > 2072) {
+    print("f2072 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2073(a, b) {
+  let x = a * 2073 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2073;
+  }
+  if (x > 2073) {
+    print("f2073 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2074(a, b) {
+  let x = a * 2074 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2074;
+  }
+  if (x > 2074) {
+    print("f2074 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2075(a, b) {
+  let x = a * 2075 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2075;
+  }
+  if (x > 2075) {
+    print("f2075 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2076(a, b) {
+  let x = a * 2076 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2076;
+  }
+  if (x > 2076) {
+    print("f2076 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2077(a, b) {
+  let x = a * 2077 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2077;
+  }
+  if (x > 2077) {
+    print("f2077 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2078(a, b) {
+  let x = a * 2078 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2078;
+  }
+  if (x > 2078) {
+    print("f2078 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2079(a, b) {
+  let x = a * 2079 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2079;
+  }
+  if (x > 2079) {
+    print("f2079 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2080(a, b) {
+  let x = a * 2080 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2080;
+  }
+  if (x > 2080) {
+    print("f2080 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2081(a, b) {
+  let x = a * 2081 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2081;
+  }
+  if (x > 2081) {
+    print("f2081 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2082(a, b) {
+  let x = a * 2082 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2082;
+  }
+  if (x > 2082) {
+    print("f2082 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2083(a, b) {
+  let x = a * 2083 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2083;
+  }
+  if (x > 2083) {
+    print("f2083 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2084(a, b) {
+  let x = a * 2084 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2084;
+  }
+  if (x > 2084) {
+    print("f2084 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2085(a, b) {
+  let x = a * 2085 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2085;
+  }
+  if (x > 2085) {
+    print("f2085 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2086(a, b) {
+  let x = a * 2086 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2086;
+  }
+  if (x > 2086) {
+    print("f2086 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2087(a, b) {
+  let x = a * 2087 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2087;
+  }
+  if (x > 2087) {
+    print("f2087 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2088(a, b) {
+  let x = a * 2088 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2088;
+  }
+  if (x > 2088) {
+    print("f2088 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2089(a, b) {
+  let x = a * 2089 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2089;
+  }
+  if (x > 2089) {
+    print("f2089 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2090(a, b) {
+  let x = a * 2090 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2090;
+  }
+  if (x > 2090) {
+    print("f2090 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2091(a, b) {
+  let x = a * 2091 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2091;
+  }
+  if (x > 2091) {
+    print("f2091 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2092(a, b) {
+  let x = a * 2092 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2092;
+  }
+  if (x > 2092) {
+    print("f2092 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2093(a, b) {
+  let x = a * 2093 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2093;
+  }
+  if (x > 2093) {
+    print("f2093 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2094(a, b) {
+  let x = a * 2094 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2094;
+  }
+  if (x > 2094) {
+    print("f2094 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2095(a, b) {
+  let x = a * 2095 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2095;
+  }
+  if (x > 2095) {
+    print("f2095 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2096(a, b) {
+  let x = a * 2096 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2096;
+  }
+  if (x > 2096) {
+    print("f2096 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2097(a, b) {
+  let x = a * 2097 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2097;
+  }
+  if (x > 2097) {
+    print("f2097 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2098(a, b) {
+  let x = a * 2098 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2098;
+  }
+  if (x > 2098) {
+    print("f2098 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2099(a, b) {
+  let x = a * 2099 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2099;
+  }
+  if (x > 2099) {
+    print("f2099 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2100(a, b) {
+  let x = a * 2100 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2100;
+  }
+  if (x > 2100) {
+    print("f2100 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2101(a, b) {
+  let x = a * 2101 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2101;
+  }
+  if (x > 2101) {
+    print("f2101 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2102(a, b) {
+  let x = a * 2102 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2102;
+  }
+  if (x > 2102) {
+    print("f2102 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2103(a, b) {
+  let x = a * 2103 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2103;
+  }
+  if (x > 2103) {
+    print("f2103 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2104(a, b) {
+  let x = a * 2104 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2104;
+  }
+  if (x > 2104) {
+    print("f2104 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2105(a, b) {
+  let x = a * 2105 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2105;
+  }
+  if (x > 2105) {
+    print("f2105 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2106(a, b) {
+  let x = a * 2106 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2106;
+  }
+  if (x > 2106) {
+    print("f2106 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2107(a, b) {
+  let x = a * 2107 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2107;
+  }
+  if (x > 2107) {
+    print("f2107 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2108(a, b) {
+  let x = a * 2108 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2108;
+  }
+  if (x > 2108) {
+    print("f2108 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2109(a, b) {
+  let x = a * 2109 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2109;
+  }
+  if (x > 2109) {
+    print("f2109 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2110(a, b) {
+  let x = a * 2110 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2110;
+  }
+  if (x > 2110) {
+    print("f2110 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2111(a, b) {
+  let x = a * 2111 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2111;
+  }
+  if (x > 2111) {
+    print("f2111 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2112(a, b) {
+  let x = a * 2112 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2112;
+  }
+  if (x > 2112) {
+    print("f2112 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2113(a, b) {
+  let x = a * 2113 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2113;
+  }
+  if (x > 2113) {
+    print("f2113 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2114(a, b) {
+  let x = a * 2114 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2114;
+  }
+  if (x > 2114) {
+    print("f2114 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2115(a, b) {
+  let x = a * 2115 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2115;
+  }
+  if (x > 2115) {
+    print("f2115 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2116(a, b) {
+  let x = a * 2116 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2116;
+  }
+  if (x > 2116) {
+    print("f2116 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2117(a, b) {
+  let x = a * 2117 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2117;
+  }
+  if (x > 2117) {
+    print("f2117 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2118(a, b) {
+  let x = a * 2118 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2118;
+  }
+  if (x > 2118) {
+    print("f2118 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2119(a, b) {
+  let x = a * 2119 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2119;
+  }
+  if (x > 2119) {
+    print("f2119 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2120(a, b) {
+  let x = a * 2120 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2120;
+  }
+  if (x > 2120) {
+    print("f2120 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2121(a, b) {
+  let x = a * 2121 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2121;
+  }
+  if (x > 2121) {
+    print("f2121 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2122(a, b) {
+  let x = a * 2122 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2122;
+  }
+  if (x > 2122) {
+    print("f2122 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2123(a, b) {
+  let x = a * 2123 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2123;
+  }
+  if (x > 2123) {
+    print("f2123 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2124(a, b) {
+  let x = a * 2124 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2124;
+  }
+  if (x > 2124) {
+    print("f2124 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2125(a, b) {
+  let x = a * 2125 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2125;
+  }
+  if (x > 2125) {
+    print("f2125 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2126(a, b) {
+  let x = a * 2126 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2126;
+  }
+  if (x > 2126) {
+    print("f2126 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2127(a, b) {
+  let x = a * 2127 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2127;
+  }
+  if (x > 2127) {
+    print("f2127 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2128(a, b) {
+  let x = a * 2128 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2128;
+  }
+  if (x > 2128) {
+    print("f2128 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2129(a, b) {
+  let x = a * 2129 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2129;
+  }
+  if (x > 2129) {
+    print("f2129 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2130(a, b) {
+  let x = a * 2130 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2130;
+  }
+  if (x > 2130) {
+    print("f2130 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2131(a, b) {
+  let x = a * 2131 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2131;
+  }
+  if (x > 2131) {
+    print("f2131 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2132(a, b) {
+  let x = a * 2132 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2132;
+  }
+  if (x > 2132) {
+    print("f2132 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2133(a, b) {
+  let x = a * 2133 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2133;
+  }
+  if (x > 2133) {
+    print("f2133 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2134(a, b) {
+  let x = a * 2134 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2134;
+  }
+  if (x > 2134) {
+    print("f2134 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2135(a, b) {
+  let x = a * 2135 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2135;
+  }
+  if (x > 2135) {
+    print("f2135 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2136(a, b) {
+  let x = a * 2136 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2136;
+  }
+  if (x > 2136) {
+    print("f2136 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2137(a, b) {
+  let x = a * 2137 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2137;
+  }
+  if (x > 2137) {
+    print("f2137 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2138(a, b) {
+  let x = a * 2138 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2138;
+  }
+  if (x > 2138) {
+    print("f2138 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2139(a, b) {
+  let x = a * 2139 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2139;
+  }
+  if (x > 2139) {
+    print("f2139 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2140(a, b) {
+  let x = a * 2140 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2140;
+  }
+  if (x > 2140) {
+    print("f2140 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2141(a, b) {
+  let x = a * 2141 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2141;
+  }
+  if (x > 2141) {
+    print("f2141 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2142(a, b) {
+  let x = a * 2142 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2142;
+  }
+  if (x > 2142) {
+    print("f2142 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2143(a, b) {
+  let x = a * 2143 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2143;
+  }
+  if (x > 2143) {
+    print("f2143 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2144(a, b) {
+  let x = a * 2144 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2144;
+  }
+  if (x > 2144) {
+    print("f2144 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2145(a, b) {
+  let x = a * 2145 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2145;
+  }
+  if (x > 2145) {
+    print("f2145 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2146(a, b) {
+  let x = a * 2146 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2146;
+  }
+  if (x > 2146) {
+    print("f2146 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2147(a, b) {
+  let x = a * 2147 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2147;
+  }
+  if (x > 2147) {
+    print("f2147 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2148(a, b) {
+  let x = a * 2148 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2148;
+  }
+  if (x > 2148) {
+    print("f2148 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2149(a, b) {
+  let x = a * 2149 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2149;
+  }
+  if (x > 2149) {
+    print("f2149 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2150(a, b) {
+  let x = a * 2150 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2150;
+  }
+  if (x > 2150) {
+    print("f2150 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2151(a, b) {
+  let x = a * 2151 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2151;
+  }
+  if (x > 2151) {
+    print("f2151 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2152(a, b) {
+  let x = a * 2152 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2152;
+  }
+  if (x > 2152) {
+    print("f2152 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2153(a, b) {
+  let x = a * 2153 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2153;
+  }
+  if (x > 2153) {
+    print("f2153 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2154(a, b) {
+  let x = a * 2154 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2154;
+  }
+  if (x > 2154) {
+    print("f2154 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2155(a, b) {
+  let x = a * 2155 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2155;
+  }
+  if (x > 2155) {
+    print("f2155 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2156(a, b) {
+  let x = a * 2156 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2156;
+  }
+  if (x > 2156) {
+    print("f2156 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2157(a, b) {
+  let x = a * 2157 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2157;
+  }
+  if (x > 2157) {
+    print("f2157 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2158(a, b) {
+  let x = a * 2158 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2158;
+  }
+  if (x > 2158) {
+    print("f2158 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2159(a, b) {
+  let x = a * 2159 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2159;
+  }
+  if (x > 2159) {
+    print("f2159 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2160(a, b) {
+  let x = a * 2160 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2160;
+  }
+  if (x > 2160) {
+    print("f2160 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2161(a, b) {
+  let x = a * 2161 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2161;
+  }
+  if (x > 2161) {
+    print("f2161 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2162(a, b) {
+  let x = a * 2162 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2162;
+  }
+  if (x > 2162) {
+    print("f2162 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2163(a, b) {
+  let x = a * 2163 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2163;
+  }
+  if (x > 2163) {
+    print("f2163 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2164(a, b) {
+  let x = a * 2164 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2164;
+  }
+  if (x > 2164) {
+    print("f2164 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2165(a, b) {
+  let x = a * 2165 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2165;
+  }
+  if (x > 2165) {
+    print("f2165 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2166(a, b) {
+  let x = a * 2166 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2166;
+  }
+  if (x > 2166) {
+    print("f2166 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2167(a, b) {
+  let x = a * 2167 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2167;
+  }
+  if (x > 2167) {
+    print("f2167 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2168(a, b) {
+  let x = a * 2168 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2168;
+  }
+  if (x > 2168) {
+    print("f2168 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2169(a, b) {
+  let x = a * 2169 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2169;
+  }
+  if (x > 2169) {
+    print("f2169 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2170(a, b) {
+  let x = a * 2170 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2170;
+  }
+  if (x > 2170) {
+    print("f2170 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2171(a, b) {
+  let x = a * 2171 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2171;
+  }
+  if (x > 2171) {
+    print("f2171 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2172(a, b) {
+  let x = a * 2172 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2172;
+  }
+  if (x > 2172) {
+    print("f2172 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2173(a, b) {
+  let x = a * 2173 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2173;
+  }
+  if (x > 2173) {
+    print("f2173 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2174(a, b) {
+  let x = a * 2174 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2174;
+  }
+  if (x > 2174) {
+    print("f2174 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2175(a, b) {
+  let x = a * 2175 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2175;
+  }
+  if (x > 2175) {
+    print("f2175 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2176(a, b) {
+  let x = a * 2176 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2176;
+  }
+  if (x > 2176) {
+    print("f2176 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2177(a, b) {
+  let x = a * 2177 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2177;
+  }
+  if (x > 2177) {
+    print("f2177 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2178(a, b) {
+  let x = a * 2178 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2178;
+  }
+  if (x > 2178) {
+    print("f2178 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2179(a, b) {
+  let x = a * 2179 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2179;
+  }
+  if (x > 2179) {
+    print("f2179 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2180(a, b) {
+  let x = a * 2180 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2180;
+  }
+  if (x > 2180) {
+    print("f2180 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2181(a, b) {
+  let x = a * 2181 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2181;
+  }
+  if (x > 2181) {
+    print("f2181 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2182(a, b) {
+  let x = a * 2182 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2182;
+  }
+  if (x > 2182) {
+    print("f2182 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2183(a, b) {
+  let x = a * 2183 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2183;
+  }
+  if (x > 2183) {
+    print("f2183 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2184(a, b) {
+  let x = a * 2184 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2184;
+  }
+  if (x > 2184) {
+    print("f2184 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2185(a, b) {
+  let x = a * 2185 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2185;
+  }
+  if (x > 2185) {
+    print("f2185 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2186(a, b) {
+  let x = a * 2186 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2186;
+  }
+  if (x > 2186) {
+    print("f2186 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2187(a, b) {
+  let x = a * 2187 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2187;
+  }
+  if (x > 2187) {
+    print("f2187 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2188(a, b) {
+  let x = a * 2188 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2188;
+  }
+  if (x > 2188) {
+    print("f2188 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2189(a, b) {
+  let x = a * 2189 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2189;
+  }
+  if (x > 2189) {
+    print("f2189 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2190(a, b) {
+  let x = a * 2190 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2190;
+  }
+  if (x > 2190) {
+    print("f2190 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2191(a, b) {
+  let x = a * 2191 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2191;
+  }
+  if (x > 2191) {
+    print("f2191 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2192(a, b) {
+  let x = a * 2192 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2192;
+  }
+  if (x > 2192) {
+    print("f2192 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2193(a, b) {
+  let x = a * 2193 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2193;
+  }
+  if (x > 2193) {
+    print("f2193 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2194(a, b) {
+  let x = a * 2194 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2194;
+  }
+  if (x > 2194) {
+    print("f2194 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2195(a, b) {
+  let x = a * 2195 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2195;
+  }
+  if (x > 2195) {
+    print("f2195 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2196(a, b) {
+  let x = a * 2196 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2196;
+  }
+  if (x > 2196) {
+    print("f2196 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2197(a, b) {
+  let x = a * 2197 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2197;
+  }
+  if (x > 2197) {
+    print("f2197 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2198(a, b) {
+  let x = a * 2198 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2198;
+  }
+  if (x > 2198) {
+    print("f2198 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2199(a, b) {
+  let x = a * 2199 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2199;
+  }
+  if (x > 2199) {
+    print("f2199 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2200(a, b) {
+  let x = a * 2200 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2200;
+  }
+  if (x > 2200) {
+    print("f2200 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2201(a, b) {
+  let x = a * 2201 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2201;
+  }
+  if (x > 2201) {
+    print("f2201 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2202(a, b) {
+  let x = a * 2202 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2202;
+  }
+  if (x > 2202) {
+    print("f2202 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2203(a, b) {
+  let x = a * 2203 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2203;
+  }
+  if (x > 2203) {
+    print("f2203 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2204(a, b) {
+  let x = a * 2204 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2204;
+  }
+  if (x > 2204) {
+    print("f2204 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2205(a, b) {
+  let x = a * 2205 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2205;
+  }
+  if (x > 2205) {
+    print("f2205 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2206(a, b) {
+  let x = a * 2206 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2206;
+  }
+  if (x > 2206) {
+    print("f2206 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2207(a, b) {
+  let x = a * 2207 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2207;
+  }
+  if (x > 2207) {
+    print("f2207 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2208(a, b) {
+  let x = a * 2208 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2208;
+  }
+  if (x > 2208) {
+    print("f2208 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2209(a, b) {
+  let x = a * 2209 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2209;
+  }
+  if (x > 2209) {
+    print("f2209 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2210(a, b) {
+  let x = a * 2210 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2210;
+  }
+  if (x > 2210) {
+    print("f2210 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2211(a, b) {
+  let x = a * 2211 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2211;
+  }
+  if (x > 2211) {
+    print("f2211 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2212(a, b) {
+  let x = a * 2212 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2212;
+  }
+  if (x > 2212) {
+    print("f2212 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2213(a, b) {
+  let x = a * 2213 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2213;
+  }
+  if (x > 2213) {
+    print("f2213 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2214(a, b) {
+  let x = a * 2214 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2214;
+  }
+  if (x > 2214) {
+    print("f2214 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2215(a, b) {
+  let x = a * 2215 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2215;
+  }
+  if (x > 2215) {
+    print("f2215 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2216(a, b) {
+  let x = a * 2216 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2216;
+  }
+  if (x > 2216) {
+    print("f2216 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2217(a, b) {
+  let x = a * 2217 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2217;
+  }
+  if (x > 2217) {
+    print("f2217 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2218(a, b) {
+  let x = a * 2218 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2218;
+  }
+  if (x > 2218) {
+    print("f2218 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2219(a, b) {
+  let x = a * 2219 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2219;
+  }
+  if (x > 2219) {
+    print("f2219 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2220(a, b) {
+  let x = a * 2220 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2220;
+  }
+  if (x > 2220) {
+    print("f2220 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2221(a, b) {
+  let x = a * 2221 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2221;
+  }
+  if (x > 2221) {
+    print("f2221 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2222(a, b) {
+  let x = a * 2222 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2222;
+  }
+  if (x > 2222) {
+    print("f2222 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2223(a, b) {
+  let x = a * 2223 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2223;
+  }
+  if (x > 2223) {
+    print("f2223 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2224(a, b) {
+  let x = a * 2224 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2224;
+  }
+  if (x > 2224) {
+    print("f2224 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2225(a, b) {
+  let x = a * 2225 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2225;
+  }
+  if (x > 2225) {
+    print("f2225 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2226(a, b) {
+  let x = a * 2226 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2226;
+  }
+  if (x > 2226) {
+    print("f2226 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2227(a, b) {
+  let x = a * 2227 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2227;
+  }
+  if (x > 2227) {
+    print("f2227 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2228(a, b) {
+  let x = a * 2228 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2228;
+  }
+  if (x > 2228) {
+    print("f2228 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2229(a, b) {
+  let x = a * 2229 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2229;
+  }
+  if (x > 2229) {
+    print("f2229 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2230(a, b) {
+  let x = a * 2230 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2230;
+  }
+  if (x > 2230) {
+    print("f2230 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2231(a, b) {
+  let x = a * 2231 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2231;
+  }
+  if (x > 2231) {
+    print("f2231 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2232(a, b) {
+  let x = a * 2232 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2232;
+  }
+  if (x > 2232) {
+    print("f2232 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2233(a, b) {
+  let x = a * 2233 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2233;
+  }
+  if (x > 2233) {
+    print("f2233 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2234(a, b) {
+  let x = a * 2234 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2234;
+  }
+  if (x > 2234) {
+    print("f2234 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2235(a, b) {
+  let x = a * 2235 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2235;
+  }
+  if (x > 2235) {
+    print("f2235 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2236(a, b) {
+  let x = a * 2236 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2236;
+  }
+  if (x > 2236) {
+    print("f2236 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2237(a, b) {
+  let x = a * 2237 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2237;
+  }
+  if (x > 2237) {
+    print("f2237 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2238(a, b) {
+  let x = a * 2238 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2238;
+  }
+  if (x > 2238) {
+    print("f2238 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2239(a, b) {
+  let x = a * 2239 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2239;
+  }
+  if (x > 2239) {
+    print("f2239 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2240(a, b) {
+  let x = a * 2240 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2240;
+  }
+  if (x > 2240) {
+    print("f2240 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2241(a, b) {
+  let x = a * 2241 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2241;
+  }
+  if (x > 2241) {
+    print("f2241 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2242(a, b) {
+  let x = a * 2242 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2242;
+  }
+  if (x > 2242) {
+    print("f2242 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2243(a, b) {
+  let x = a * 2243 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2243;
+  }
+  if (x > 2243) {
+    print("f2243 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2244(a, b) {
+  let x = a * 2244 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2244;
+  }
+  if (x > 2244) {
+    print("f2244 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2245(a, b) {
+  let x = a * 2245 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2245;
+  }
+  if (x > 2245) {
+    print("f2245 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2246(a, b) {
+  let x = a * 2246 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2246;
+  }
+  if (x > 2246) {
+    print("f2246 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2247(a, b) {
+  let x = a * 2247 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2247;
+  }
+  if (x > 2247) {
+    print("f2247 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2248(a, b) {
+  let x = a * 2248 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2248;
+  }
+  if (x > 2248) {
+    print("f2248 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2249(a, b) {
+  let x = a * 2249 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2249;
+  }
+  if (x > 2249) {
+    print("f2249 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2250(a, b) {
+  let x = a * 2250 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2250;
+  }
+  if (x > 2250) {
+    print("f2250 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2251(a, b) {
+  let x = a * 2251 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2251;
+  }
+  if (x > 2251) {
+    print("f2251 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2252(a, b) {
+  let x = a * 2252 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2252;
+  }
+  if (x > 2252) {
+    print("f2252 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2253(a, b) {
+  let x = a * 2253 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2253;
+  }
+  if (x > 2253) {
+    print("f2253 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2254(a, b) {
+  let x = a * 2254 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2254;
+  }
+  if (x > 2254) {
+    print("f2254 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2255(a, b) {
+  let x = a * 2255 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2255;
+  }
+  if (x > 2255) {
+    print("f2255 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2256(a, b) {
+  let x = a * 2256 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2256;
+  }
+  if (x > 2256) {
+    print("f2256 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2257(a, b) {
+  let x = a * 2257 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2257;
+  }
+  if (x > 2257) {
+    print("f2257 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2258(a, b) {
+  let x = a * 2258 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2258;
+  }
+  if (x > 2258) {
+    print("f2258 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2259(a, b) {
+  let x = a * 2259 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2259;
+  }
+  if (x > 2259) {
+    print("f2259 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2260(a, b) {
+  let x = a * 2260 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2260;
+  }
+  if (x > 2260) {
+    print("f2260 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2261(a, b) {
+  let x = a * 2261 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2261;
+  }
+  if (x > 2261) {
+    print("f2261 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2262(a, b) {
+  let x = a * 2262 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2262;
+  }
+  if (x > 2262) {
+    print("f2262 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2263(a, b) {
+  let x = a * 2263 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2263;
+  }
+  if (x > 2263) {
+    print("f2263 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2264(a, b) {
+  let x = a * 2264 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2264;
+  }
+  if (x > 2264) {
+    print("f2264 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2265(a, b) {
+  let x = a * 2265 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2265;
+  }
+  if (x > 2265) {
+    print("f2265 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2266(a, b) {
+  let x = a * 2266 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2266;
+  }
+  if (x > 2266) {
+    print("f2266 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2267(a, b) {
+  let x = a * 2267 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2267;
+  }
+  if (x > 2267) {
+    print("f2267 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2268(a, b) {
+  let x = a * 2268 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2268;
+  }
+  if (x > 2268) {
+    print("f2268 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2269(a, b) {
+  let x = a * 2269 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2269;
+  }
+  if (x > 2269) {
+    print("f2269 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2270(a, b) {
+  let x = a * 2270 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2270;
+  }
+  if (x > 2270) {
+    print("f2270 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2271(a, b) {
+  let x = a * 2271 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2271;
+  }
+  if (x > 2271) {
+    print("f2271 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2272(a, b) {
+  let x = a * 2272 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2272;
+  }
+  if (x > 2272) {
+    print("f2272 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2273(a, b) {
+  let x = a * 2273 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2273;
+  }
+  if (x > 2273) {
+    print("f2273 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2274(a, b) {
+  let x = a * 2274 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2274;
+  }
+  if (x > 2274) {
+    print("f2274 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2275(a, b) {
+  let x = a * 2275 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2275;
+  }
+  if (x > 2275) {
+    print("f2275 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2276(a, b) {
+  let x = a * 2276 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2276;
+  }
+  if (x > 2276) {
+    print("f2276 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2277(a, b) {
+  let x = a * 2277 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2277;
+  }
+  if (x > 2277) {
+    print("f2277 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2278(a, b) {
+  let x = a * 2278 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2278;
+  }
+  if (x > 2278) {
+    print("f2278 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2279(a, b) {
+  let x = a * 2279 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2279;
+  }
+  if (x > 2279) {
+    print("f2279 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2280(a, b) {
+  let x = a * 2280 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2280;
+  }
+  if (x > 2280) {
+    print("f2280 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2281(a, b) {
+  let x = a * 2281 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2281;
+  }
+  if (x > 2281) {
+    print("f2281 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2282(a, b) {
+  let x = a * 2282 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2282;
+  }
+  if (x > 2282) {
+    print("f2282 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2283(a, b) {
+  let x = a * 2283 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2283;
+  }
+  if (x > 2283) {
+    print("f2283 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2284(a, b) {
+  let x = a * 2284 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2284;
+  }
+  if (x > 2284) {
+    print("f2284 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2285(a, b) {
+  let x = a * 2285 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2285;
+  }
+  if (x > 2285) {
+    print("f2285 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2286(a, b) {
+  let x = a * 2286 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2286;
+  }
+  if (x > 2286) {
+    print("f2286 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2287(a, b) {
+  let x = a * 2287 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2287;
+  }
+  if (x > 2287) {
+    print("f2287 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2288(a, b) {
+  let x = a * 2288 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2288;
+  }
+  if (x > 2288) {
+    print("f2288 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2289(a, b) {
+  let x = a * 2289 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2289;
+  }
+  if (x > 2289) {
+    print("f2289 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2290(a, b) {
+  let x = a * 2290 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2290;
+  }
+  if (x > 2290) {
+    print("f2290 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2291(a, b) {
+  let x = a * 2291 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2291;
+  }
+  if (x > 2291) {
+    print("f2291 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2292(a, b) {
+  let x = a * 2292 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2292;
+  }
+  if (x > 2292) {
+    print("f2292 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2293(a, b) {
+  let x = a * 2293 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2293;
+  }
+  if (x > 2293) {
+    print("f2293 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2294(a, b) {
+  let x = a * 2294 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2294;
+  }
+  if (x > 2294) {
+    print("f2294 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2295(a, b) {
+  let x = a * 2295 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2295;
+  }
+  if (x > 2295) {
+    print("f2295 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2296(a, b) {
+  let x = a * 2296 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2296;
+  }
+  if (x > 2296) {
+    print("f2296 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2297(a, b) {
+  let x = a * 2297 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2297;
+  }
+  if (x > 2297) {
+    print("f2297 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2298(a, b) {
+  let x = a * 2298 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2298;
+  }
+  if (x > 2298) {
+    print("f2298 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2299(a, b) {
+  let x = a * 2299 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2299;
+  }
+  if (x > 2299) {
+    print("f2299 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2300(a, b) {
+  let x = a * 2300 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2300;
+  }
+  if (x > 2300) {
+    print("f2300 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2301(a, b) {
+  let x = a * 2301 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2301;
+  }
+  if (x > 2301) {
+    print("f2301 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2302(a, b) {
+  let x = a * 2302 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2302;
+  }
+  if (x > 2302) {
+    print("f2302 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2303(a, b) {
+  let x = a * 2303 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2303;
+  }
+  if (x > 2303) {
+    print("f2303 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2304(a, b) {
+  let x = a * 2304 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2304;
+  }
+  if (x > 2304) {
+    print("f2304 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2305(a, b) {
+  let x = a * 2305 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2305;
+  }
+  if (x > 2305) {
+    print("f2305 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2306(a, b) {
+  let x = a * 2306 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2306;
+  }
+  if (x > 2306) {
+    print("f2306 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2307(a, b) {
+  let x = a * 2307 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2307;
+  }
+  if (x > 2307) {
+    print("f2307 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2308(a, b) {
+  let x = a * 2308 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2308;
+  }
+  if (x > 2308) {
+    print("f2308 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2309(a, b) {
+  let x = a * 2309 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2309;
+  }
+  if (x > 2309) {
+    print("f2309 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2310(a, b) {
+  let x = a * 2310 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2310;
+  }
+  if (x > 2310) {
+    print("f2310 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2311(a, b) {
+  let x = a * 2311 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2311;
+  }
+  if (x > 2311) {
+    print("f2311 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2312(a, b) {
+  let x = a * 2312 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2312;
+  }
+  if (x > 2312) {
+    print("f2312 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2313(a, b) {
+  let x = a * 2313 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2313;
+  }
+  if (x > 2313) {
+    print("f2313 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2314(a, b) {
+  let x = a * 2314 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2314;
+  }
+  if (x > 2314) {
+    print("f2314 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2315(a, b) {
+  let x = a * 2315 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2315;
+  }
+  if (x > 2315) {
+    print("f2315 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2316(a, b) {
+  let x = a * 2316 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2316;
+  }
+  if (x > 2316) {
+    print("f2316 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2317(a, b) {
+  let x = a * 2317 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2317;
+  }
+  if (x > 2317) {
+    print("f2317 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2318(a, b) {
+  let x = a * 2318 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2318;
+  }
+  if (x > 2318) {
+    print("f2318 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2319(a, b) {
+  let x = a * 2319 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2319;
+  }
+  if (x > 2319) {
+    print("f2319 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2320(a, b) {
+  let x = a * 2320 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2320;
+  }
+  if (x > 2320) {
+    print("f2320 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2321(a, b) {
+  let x = a * 2321 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2321;
+  }
+  if (x > 2321) {
+    print("f2321 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2322(a, b) {
+  let x = a * 2322 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2322;
+  }
+  if (x > 2322) {
+    print("f2322 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2323(a, b) {
+  let x = a * 2323 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2323;
+  }
+  if (x > 2323) {
+    print("f2323 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2324(a, b) {
+  let x = a * 2324 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2324;
+  }
+  if (x > 2324) {
+    print("f2324 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2325(a, b) {
+  let x = a * 2325 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2325;
+  }
+  if (x > 2325) {
+    print("f2325 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2326(a, b) {
+  let x = a * 2326 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2326;
+  }
+  if (x > 2326) {
+    print("f2326 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2327(a, b) {
+  let x = a * 2327 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2327;
+  }
+  if (x > 2327) {
+    print("f2327 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2328(a, b) {
+  let x = a * 2328 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2328;
+  }
+  if (x > 2328) {
+    print("f2328 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2329(a, b) {
+  let x = a * 2329 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2329;
+  }
+  if (x > 2329) {
+    print("f2329 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2330(a, b) {
+  let x = a * 2330 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2330;
+  }
+  if (x > 2330) {
+    print("f2330 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2331(a, b) {
+  let x = a * 2331 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2331;
+  }
+  if (x > 2331) {
+    print("f2331 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2332(a, b) {
+  let x = a * 2332 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2332;
+  }
+  if (x > 2332) {
+    print("f2332 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2333(a, b) {
+  let x = a * 2333 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2333;
+  }
+  if (x > 2333) {
+    print("f2333 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2334(a, b) {
+  let x = a * 2334 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2334;
+  }
+  if (x > 2334) {
+    print("f2334 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2335(a, b) {
+  let x = a * 2335 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2335;
+  }
+  if (x > 2335) {
+    print("f2335 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2336(a, b) {
+  let x = a * 2336 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2336;
+  }
+  if (x > 2336) {
+    print("f2336 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2337(a, b) {
+  let x = a * 2337 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2337;
+  }
+  if (x > 2337) {
+    print("f2337 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2338(a, b) {
+  let x = a * 2338 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2338;
+  }
+  if (x > 2338) {
+    print("f2338 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2339(a, b) {
+  let x = a * 2339 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2339;
+  }
+  if (x > 2339) {
+    print("f2339 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2340(a, b) {
+  let x = a * 2340 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2340;
+  }
+  if (x > 2340) {
+    print("f2340 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2341(a, b) {
+  let x = a * 2341 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2341;
+  }
+  if (x > 2341) {
+    print("f2341 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2342(a, b) {
+  let x = a * 2342 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2342;
+  }
+  if (x > 2342) {
+    print("f2342 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2343(a, b) {
+  let x = a * 2343 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2343;
+  }
+  if (x > 2343) {
+    print("f2343 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2344(a, b) {
+  let x = a * 2344 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2344;
+  }
+  if (x > 2344) {
+    print("f2344 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2345(a, b) {
+  let x = a * 2345 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2345;
+  }
+  if (x > 2345) {
+    print("f2345 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2346(a, b) {
+  let x = a * 2346 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2346;
+  }
+  if (x > 2346) {
+    print("f2346 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2347(a, b) {
+  let x = a * 2347 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2347;
+  }
+  if (x > 2347) {
+    print("f2347 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2348(a, b) {
+  let x = a * 2348 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2348;
+  }
+  if (x > 2348) {
+    print("f2348 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2349(a, b) {
+  let x = a * 2349 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2349;
+  }
+  if (x > 2349) {
+    print("f2349 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2350(a, b) {
+  let x = a * 2350 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2350;
+  }
+  if (x > 2350) {
+    print("f2350 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2351(a, b) {
+  let x = a * 2351 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2351;
+  }
+  if (x > 2351) {
+    print("f2351 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2352(a, b) {
+  let x = a * 2352 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2352;
+  }
+  if (x > 2352) {
+    print("f2352 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2353(a, b) {
+  let x = a * 2353 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2353;
+  }
+  if (x > 2353) {
+    print("f2353 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2354(a, b) {
+  let x = a * 2354 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2354;
+  }
+  if (x > 2354) {
+    print("f2354 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2355(a, b) {
+  let x = a * 2355 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2355;
+  }
+  if (x > 2355) {
+    print("f2355 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2356(a, b) {
+  let x = a * 2356 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2356;
+  }
+  if (x > 2356) {
+    print("f2356 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2357(a, b) {
+  let x = a * 2357 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2357;
+  }
+  if (x > 2357) {
+    print("f2357 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2358(a, b) {
+  let x = a * 2358 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2358;
+  }
+  if (x > 2358) {
+    print("f2358 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2359(a, b) {
+  let x = a * 2359 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2359;
+  }
+  if (x > 2359) {
+    print("f2359 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2360(a, b) {
+  let x = a * 2360 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2360;
+  }
+  if (x > 2360) {
+    print("f2360 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2361(a, b) {
+  let x = a * 2361 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2361;
+  }
+  if (x > 2361) {
+    print("f2361 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2362(a, b) {
+  let x = a * 2362 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2362;
+  }
+  if (x > 2362) {
+    print("f2362 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2363(a, b) {
+  let x = a * 2363 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2363;
+  }
+  if (x > 2363) {
+    print("f2363 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2364(a, b) {
+  let x = a * 2364 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2364;
+  }
+  if (x > 2364) {
+    print("f2364 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2365(a, b) {
+  let x = a * 2365 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2365;
+  }
+  if (x > 2365) {
+    print("f2365 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2366(a, b) {
+  let x = a * 2366 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2366;
+  }
+  if (x > 2366) {
+    print("f2366 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2367(a, b) {
+  let x = a * 2367 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2367;
+  }
+  if (x > 2367) {
+    print("f2367 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2368(a, b) {
+  let x = a * 2368 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2368;
+  }
+  if (x > 2368) {
+    print("f2368 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2369(a, b) {
+  let x = a * 2369 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2369;
+  }
+  if (x > 2369) {
+    print("f2369 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2370(a, b) {
+  let x = a * 2370 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2370;
+  }
+  if (x > 2370) {
+    print("f2370 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2371(a, b) {
+  let x = a * 2371 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2371;
+  }
+  if (x > 2371) {
+    print("f2371 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2372(a, b) {
+  let x = a * 2372 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2372;
+  }
+  if (x > 2372) {
+    print("f2372 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2373(a, b) {
+  let x = a * 2373 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2373;
+  }
+  if (x > 2373) {
+    print("f2373 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2374(a, b) {
+  let x = a * 2374 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2374;
+  }
+  if (x > 2374) {
+    print("f2374 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2375(a, b) {
+  let x = a * 2375 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2375;
+  }
+  if (x > 2375) {
+    print("f2375 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2376(a, b) {
+  let x = a * 2376 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2376;
+  }
+  if (x > 2376) {
+    print("f2376 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2377(a, b) {
+  let x = a * 2377 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2377;
+  }
+  if (x > 2377) {
+    print("f2377 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2378(a, b) {
+  let x = a * 2378 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2378;
+  }
+  if (x > 2378) {
+    print("f2378 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2379(a, b) {
+  let x = a * 2379 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2379;
+  }
+  if (x > 2379) {
+    print("f2379 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2380(a, b) {
+  let x = a * 2380 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2380;
+  }
+  if (x > 2380) {
+    print("f2380 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2381(a, b) {
+  let x = a * 2381 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2381;
+  }
+  if (x > 2381) {
+    print("f2381 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2382(a, b) {
+  let x = a * 2382 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2382;
+  }
+  if (x > 2382) {
+    print("f2382 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2383(a, b) {
+  let x = a * 2383 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2383;
+  }
+  if (x > 2383) {
+    print("f2383 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2384(a, b) {
+  let x = a * 2384 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2384;
+  }
+  if (x > 2384) {
+    print("f2384 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2385(a, b) {
+  let x = a * 2385 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2385;
+  }
+  if (x > 2385) {
+    print("f2385 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2386(a, b) {
+  let x = a * 2386 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2386;
+  }
+  if (x > 2386) {
+    print("f2386 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2387(a, b) {
+  let x = a * 2387 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2387;
+  }
+  if (x > 2387) {
+    print("f2387 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2388(a, b) {
+  let x = a * 2388 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2388;
+  }
+  if (x > 2388) {
+    print("f2388 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2389(a, b) {
+  let x = a * 2389 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2389;
+  }
+  if (x > 2389) {
+    print("f2389 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2390(a, b) {
+  let x = a * 2390 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2390;
+  }
+  if (x > 2390) {
+    print("f2390 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2391(a, b) {
+  let x = a * 2391 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2391;
+  }
+  if (x > 2391) {
+    print("f2391 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2392(a, b) {
+  let x = a * 2392 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2392;
+  }
+  if (x > 2392) {
+    print("f2392 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2393(a, b) {
+  let x = a * 2393 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2393;
+  }
+  if (x > 2393) {
+    print("f2393 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2394(a, b) {
+  let x = a * 2394 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2394;
+  }
+  if (x > 2394) {
+    print("f2394 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2395(a, b) {
+  let x = a * 2395 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2395;
+  }
+  if (x > 2395) {
+    print("f2395 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2396(a, b) {
+  let x = a * 2396 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2396;
+  }
+  if (x > 2396) {
+    print("f2396 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2397(a, b) {
+  let x = a * 2397 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2397;
+  }
+  if (x > 2397) {
+    print("f2397 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2398(a, b) {
+  let x = a * 2398 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2398;
+  }
+  if (x > 2398) {
+    print("f2398 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2399(a, b) {
+  let x = a * 2399 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2399;
+  }
+  if (x > 2399) {
+    print("f2399 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2400(a, b) {
+  let x = a * 2400 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2400;
+  }
+  if (x > 2400) {
+    print("f2400 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2401(a, b) {
+  let x = a * 2401 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2401;
+  }
+  if (x > 2401) {
+    print("f2401 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2402(a, b) {
+  let x = a * 2402 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2402;
+  }
+  if (x > 2402) {
+    print("f2402 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2403(a, b) {
+  let x = a * 2403 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2403;
+  }
+  if (x > 2403) {
+    print("f2403 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2404(a, b) {
+  let x = a * 2404 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2404;
+  }
+  if (x > 2404) {
+    print("f2404 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2405(a, b) {
+  let x = a * 2405 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2405;
+  }
+  if (x > 2405) {
+    print("f2405 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2406(a, b) {
+  let x = a * 2406 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2406;
+  }
+  if (x > 2406) {
+    print("f2406 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2407(a, b) {
+  let x = a * 2407 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2407;
+  }
+  if (x > 2407) {
+    print("f2407 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2408(a, b) {
+  let x = a * 2408 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2408;
+  }
+  if (x > 2408) {
+    print("f2408 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2409(a, b) {
+  let x = a * 2409 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2409;
+  }
+  if (x > 2409) {
+    print("f2409 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2410(a, b) {
+  let x = a * 2410 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2410;
+  }
+  if (x > 2410) {
+    print("f2410 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2411(a, b) {
+  let x = a * 2411 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2411;
+  }
+  if (x > 2411) {
+    print("f2411 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2412(a, b) {
+  let x = a * 2412 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2412;
+  }
+  if (x > 2412) {
+    print("f2412 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2413(a, b) {
+  let x = a * 2413 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2413;
+  }
+  if (x > 2413) {
+    print("f2413 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2414(a, b) {
+  let x = a * 2414 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2414;
+  }
+  if (x > 2414) {
+    print("f2414 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2415(a, b) {
+  let x = a * 2415 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2415;
+  }
+  if (x > 2415) {
+    print("f2415 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2416(a, b) {
+  let x = a * 2416 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2416;
+  }
+  if (x > 2416) {
+    print("f2416 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2417(a, b) {
+  let x = a * 2417 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2417;
+  }
+  if (x > 2417) {
+    print("f2417 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2418(a, b) {
+  let x = a * 2418 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2418;
+  }
+  if (x > 2418) {
+    print("f2418 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2419(a, b) {
+  let x = a * 2419 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2419;
+  }
+  if (x > 2419) {
+    print("f2419 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2420(a, b) {
+  let x = a * 2420 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2420;
+  }
+  if (x > 2420) {
+    print("f2420 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2421(a, b) {
+  let x = a * 2421 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2421;
+  }
+  if (x > 2421) {
+    print("f2421 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2422(a, b) {
+  let x = a * 2422 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2422;
+  }
+  if (x > 2422) {
+    print("f2422 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2423(a, b) {
+  let x = a * 2423 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2423;
+  }
+  if (x > 2423) {
+    print("f2423 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2424(a, b) {
+  let x = a * 2424 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2424;
+  }
+  if (x > 2424) {
+    print("f2424 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2425(a, b) {
+  let x = a * 2425 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2425;
+  }
+  if (x > 2425) {
+    print("f2425 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2426(a, b) {
+  let x = a * 2426 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2426;
+  }
+  if (x > 2426) {
+    print("f2426 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2427(a, b) {
+  let x = a * 2427 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2427;
+  }
+  if (x > 2427) {
+    print("f2427 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2428(a, b) {
+  let x = a * 2428 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2428;
+  }
+  if (x > 2428) {
+    print("f2428 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2429(a, b) {
+  let x = a * 2429 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2429;
+  }
+  if (x > 2429) {
+    print("f2429 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2430(a, b) {
+  let x = a * 2430 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2430;
+  }
+  if (x > 2430) {
+    print("f2430 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2431(a, b) {
+  let x = a * 2431 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2431;
+  }
+  if (x > 2431) {
+    print("f2431 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2432(a, b) {
+  let x = a * 2432 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2432;
+  }
+  if (x > 2432) {
+    print("f2432 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2433(a, b) {
+  let x = a * 2433 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2433;
+  }
+  if (x > 2433) {
+    print("f2433 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2434(a, b) {
+  let x = a * 2434 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2434;
+  }
+  if (x > 2434) {
+    print("f2434 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2435(a, b) {
+  let x = a * 2435 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2435;
+  }
+  if (x > 2435) {
+    print("f2435 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2436(a, b) {
+  let x = a * 2436 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2436;
+  }
+  if (x > 2436) {
+    print("f2436 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2437(a, b) {
+  let x = a * 2437 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2437;
+  }
+  if (x > 2437) {
+    print("f2437 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2438(a, b) {
+  let x = a * 2438 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2438;
+  }
+  if (x > 2438) {
+    print("f2438 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2439(a, b) {
+  let x = a * 2439 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2439;
+  }
+  if (x > 2439) {
+    print("f2439 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2440(a, b) {
+  let x = a * 2440 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2440;
+  }
+  if (x > 2440) {
+    print("f2440 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2441(a, b) {
+  let x = a * 2441 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2441;
+  }
+  if (x > 2441) {
+    print("f2441 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2442(a, b) {
+  let x = a * 2442 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2442;
+  }
+  if (x > 2442) {
+    print("f2442 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2443(a, b) {
+  let x = a * 2443 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2443;
+  }
+  if (x > 2443) {
+    print("f2443 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2444(a, b) {
+  let x = a * 2444 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2444;
+  }
+  if (x > 2444) {
+    print("f2444 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2445(a, b) {
+  let x = a * 2445 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2445;
+  }
+  if (x > 2445) {
+    print("f2445 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2446(a, b) {
+  let x = a * 2446 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2446;
+  }
+  if (x > 2446) {
+    print("f2446 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2447(a, b) {
+  let x = a * 2447 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2447;
+  }
+  if (x > 2447) {
+    print("f2447 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2448(a, b) {
+  let x = a * 2448 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2448;
+  }
+  if (x > 2448) {
+    print("f2448 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2449(a, b) {
+  let x = a * 2449 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2449;
+  }
+  if (x > 2449) {
+    print("f2449 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2450(a, b) {
+  let x = a * 2450 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2450;
+  }
+  if (x > 2450) {
+    print("f2450 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2451(a, b) {
+  let x = a * 2451 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2451;
+  }
+  if (x > 2451) {
+    print("f2451 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2452(a, b) {
+  let x = a * 2452 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2452;
+  }
+  if (x > 2452) {
+    print("f2452 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2453(a, b) {
+  let x = a * 2453 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2453;
+  }
+  if (x > 2453) {
+    print("f2453 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2454(a, b) {
+  let x = a * 2454 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2454;
+  }
+  if (x > 2454) {
+    print("f2454 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2455(a, b) {
+  let x = a * 2455 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2455;
+  }
+  if (x > 2455) {
+    print("f2455 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2456(a, b) {
+  let x = a * 2456 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2456;
+  }
+  if (x > 2456) {
+    print("f2456 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2457(a, b) {
+  let x = a * 2457 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2457;
+  }
+  if (x > 2457) {
+    print("f2457 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2458(a, b) {
+  let x = a * 2458 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2458;
+  }
+  if (x > 2458) {
+    print("f2458 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2459(a, b) {
+  let x = a * 2459 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2459;
+  }
+  if (x > 2459) {
+    print("f2459 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2460(a, b) {
+  let x = a * 2460 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2460;
+  }
+  if (x > 2460) {
+    print("f2460 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2461(a, b) {
+  let x = a * 2461 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2461;
+  }
+  if (x > 2461) {
+    print("f2461 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2462(a, b) {
+  let x = a * 2462 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2462;
+  }
+  if (x > 2462) {
+    print("f2462 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2463(a, b) {
+  let x = a * 2463 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2463;
+  }
+  if (x > 2463) {
+    print("f2463 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2464(a, b) {
+  let x = a * 2464 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2464;
+  }
+  if (x > 2464) {
+    print("f2464 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2465(a, b) {
+  let x = a * 2465 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2465;
+  }
+  if (x > 2465) {
+    print("f2465 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2466(a, b) {
+  let x = a * 2466 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2466;
+  }
+  if (x > 2466) {
+    print("f2466 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2467(a, b) {
+  let x = a * 2467 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2467;
+  }
+  if (x > 2467) {
+    print("f2467 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2468(a, b) {
+  let x = a * 2468 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2468;
+  }
+  if (x > 2468) {
+    print("f2468 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2469(a, b) {
+  let x = a * 2469 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2469;
+  }
+  if (x > 2469) {
+    print("f2469 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2470(a, b) {
+  let x = a * 2470 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2470;
+  }
+  if (x > 2470) {
+    print("f2470 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2471(a, b) {
+  let x = a * 2471 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2471;
+  }
+  if (x > 2471) {
+    print("f2471 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2472(a, b) {
+  let x = a * 2472 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2472;
+  }
+  if (x > 2472) {
+    print("f2472 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2473(a, b) {
+  let x = a * 2473 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2473;
+  }
+  if (x > 2473) {
+    print("f2473 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2474(a, b) {
+  let x = a * 2474 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2474;
+  }
+  if (x > 2474) {
+    print("f2474 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2475(a, b) {
+  let x = a * 2475 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2475;
+  }
+  if (x > 2475) {
+    print("f2475 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2476(a, b) {
+  let x = a * 2476 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2476;
+  }
+  if (x > 2476) {
+    print("f2476 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2477(a, b) {
+  let x = a * 2477 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2477;
+  }
+  if (x > 2477) {
+    print("f2477 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2478(a, b) {
+  let x = a * 2478 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2478;
+  }
+  if (x > 2478) {
+    print("f2478 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2479(a, b) {
+  let x = a * 2479 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2479;
+  }
+  if (x > 2479) {
+    print("f2479 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2480(a, b) {
+  let x = a * 2480 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2480;
+  }
+  if (x > 2480) {
+    print("f2480 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2481(a, b) {
+  let x = a * 2481 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2481;
+  }
+  if (x > 2481) {
+    print("f2481 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2482(a, b) {
+  let x = a * 2482 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2482;
+  }
+  if (x > 2482) {
+    print("f2482 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2483(a, b) {
+  let x = a * 2483 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2483;
+  }
+  if (x > 2483) {
+    print("f2483 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2484(a, b) {
+  let x = a * 2484 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2484;
+  }
+  if (x > 2484) {
+    print("f2484 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2485(a, b) {
+  let x = a * 2485 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2485;
+  }
+  if (x > 2485) {
+    print("f2485 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2486(a, b) {
+  let x = a * 2486 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2486;
+  }
+  if (x > 2486) {
+    print("f2486 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2487(a, b) {
+  let x = a * 2487 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2487;
+  }
+  if (x > 2487) {
+    print("f2487 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2488(a, b) {
+  let x = a * 2488 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2488;
+  }
+  if (x > 2488) {
+    print("f2488 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2489(a, b) {
+  let x = a * 2489 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2489;
+  }
+  if (x > 2489) {
+    print("f2489 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2490(a, b) {
+  let x = a * 2490 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2490;
+  }
+  if (x > 2490) {
+    print("f2490 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2491(a, b) {
+  let x = a * 2491 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2491;
+  }
+  if (x > 2491) {
+    print("f2491 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2492(a, b) {
+  let x = a * 2492 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2492;
+  }
+  if (x > 2492) {
+    print("f2492 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2493(a, b) {
+  let x = a * 2493 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2493;
+  }
+  if (x > 2493) {
+    print("f2493 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2494(a, b) {
+  let x = a * 2494 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2494;
+  }
+  if (x > 2494) {
+    print("f2494 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2495(a, b) {
+  let x = a * 2495 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2495;
+  }
+  if (x > 2495) {
+    print("f2495 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2496(a, b) {
+  let x = a * 2496 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2496;
+  }
+  if (x > 2496) {
+    print("f2496 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2497(a, b) {
+  let x = a * 2497 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2497;
+  }
+  if (x > 2497) {
+    print("f2497 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2498(a, b) {
+  let x = a * 2498 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2498;
+  }
+  if (x > 2498) {
+    print("f2498 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2499(a, b) {
+  let x = a * 2499 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2499;
+  }
+  if (x > 2499) {
+    print("f2499 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2500(a, b) {
+  let x = a * 2500 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2500;
+  }
+  if (x > 2500) {
+    print("f2500 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2501(a, b) {
+  let x = a * 2501 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2501;
+  }
+  if (x > 2501) {
+    print("f2501 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2502(a, b) {
+  let x = a * 2502 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2502;
+  }
+  if (x > 2502) {
+    print("f2502 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2503(a, b) {
+  let x = a * 2503 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2503;
+  }
+  if (x > 2503) {
+    print("f2503 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2504(a, b) {
+  let x = a * 2504 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2504;
+  }
+  if (x > 2504) {
+    print("f2504 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2505(a, b) {
+  let x = a * 2505 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2505;
+  }
+  if (x > 2505) {
+    print("f2505 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2506(a, b) {
+  let x = a * 2506 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2506;
+  }
+  if (x > 2506) {
+    print("f2506 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2507(a, b) {
+  let x = a * 2507 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2507;
+  }
+  if (x > 2507) {
+    print("f2507 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2508(a, b) {
+  let x = a * 2508 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2508;
+  }
+  if (x > 2508) {
+    print("f2508 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2509(a, b) {
+  let x = a * 2509 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2509;
+  }
+  if (x > 2509) {
+    print("f2509 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2510(a, b) {
+  let x = a * 2510 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2510;
+  }
+  if (x > 2510) {
+    print("f2510 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2511(a, b) {
+  let x = a * 2511 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2511;
+  }
+  if (x > 2511) {
+    print("f2511 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2512(a, b) {
+  let x = a * 2512 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2512;
+  }
+  if (x > 2512) {
+    print("f2512 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2513(a, b) {
+  let x = a * 2513 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2513;
+  }
+  if (x > 2513) {
+    print("f2513 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2514(a, b) {
+  let x = a * 2514 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2514;
+  }
+  if (x > 2514) {
+    print("f2514 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2515(a, b) {
+  let x = a * 2515 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2515;
+  }
+  if (x > 2515) {
+    print("f2515 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2516(a, b) {
+  let x = a * 2516 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2516;
+  }
+  if (x > 2516) {
+    print("f2516 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2517(a, b) {
+  let x = a * 2517 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2517;
+  }
+  if (x > 2517) {
+    print("f2517 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2518(a, b) {
+  let x = a * 2518 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2518;
+  }
+  if (x > 2518) {
+    print("f2518 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2519(a, b) {
+  let x = a * 2519 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2519;
+  }
+  if (x > 2519) {
+    print("f2519 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2520(a, b) {
+  let x = a * 2520 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2520;
+  }
+  if (x > 2520) {
+    print("f2520 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2521(a, b) {
+  let x = a * 2521 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2521;
+  }
+  if (x > 2521) {
+    print("f2521 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2522(a, b) {
+  let x = a * 2522 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2522;
+  }
+  if (x > 2522) {
+    print("f2522 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2523(a, b) {
+  let x = a * 2523 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2523;
+  }
+  if (x > 2523) {
+    print("f2523 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2524(a, b) {
+  let x = a * 2524 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2524;
+  }
+  if (x > 2524) {
+    print("f2524 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2525(a, b) {
+  let x = a * 2525 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2525;
+  }
+  if (x > 2525) {
+    print("f2525 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2526(a, b) {
+  let x = a * 2526 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2526;
+  }
+  if (x > 2526) {
+    print("f2526 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2527(a, b) {
+  let x = a * 2527 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2527;
+  }
+  if (x > 2527) {
+    print("f2527 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2528(a, b) {
+  let x = a * 2528 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2528;
+  }
+  if (x > 2528) {
+    print("f2528 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2529(a, b) {
+  let x = a * 2529 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2529;
+  }
+  if (x > 2529) {
+    print("f2529 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2530(a, b) {
+  let x = a * 2530 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2530;
+  }
+  if (x > 2530) {
+    print("f2530 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2531(a, b) {
+  let x = a * 2531 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2531;
+  }
+  if (x > 2531) {
+    print("f2531 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2532(a, b) {
+  let x = a * 2532 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2532;
+  }
+  if (x > 2532) {
+    print("f2532 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2533(a, b) {
+  let x = a * 2533 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2533;
+  }
+  if (x > 2533) {
+    print("f2533 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2534(a, b) {
+  let x = a * 2534 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2534;
+  }
+  if (x > 2534) {
+    print("f2534 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2535(a, b) {
+  let x = a * 2535 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2535;
+  }
+  if (x > 2535) {
+    print("f2535 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2536(a, b) {
+  let x = a * 2536 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2536;
+  }
+  if (x > 2536) {
+    print("f2536 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2537(a, b) {
+  let x = a * 2537 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2537;
+  }
+  if (x > 2537) {
+    print("f2537 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2538(a, b) {
+  let x = a * 2538 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2538;
+  }
+  if (x > 2538) {
+    print("f2538 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2539(a, b) {
+  let x = a * 2539 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2539;
+  }
+  if (x > 2539) {
+    print("f2539 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2540(a, b) {
+  let x = a * 2540 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2540;
+  }
+  if (x > 2540) {
+    print("f2540 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2541(a, b) {
+  let x = a * 2541 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2541;
+  }
+  if (x > 2541) {
+    print("f2541 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2542(a, b) {
+  let x = a * 2542 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2542;
+  }
+  if (x > 2542) {
+    print("f2542 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2543(a, b) {
+  let x = a * 2543 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2543;
+  }
+  if (x > 2543) {
+    print("f2543 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2544(a, b) {
+  let x = a * 2544 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2544;
+  }
+  if (x > 2544) {
+    print("f2544 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2545(a, b) {
+  let x = a * 2545 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2545;
+  }
+  if (x > 2545) {
+    print("f2545 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2546(a, b) {
+  let x = a * 2546 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2546;
+  }
+  if (x > 2546) {
+    print("f2546 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2547(a, b) {
+  let x = a * 2547 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2547;
+  }
+  if (x > 2547) {
+    print("f2547 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2548(a, b) {
+  let x = a * 2548 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2548;
+  }
+  if (x > 2548) {
+    print("f2548 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2549(a, b) {
+  let x = a * 2549 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2549;
+  }
+  if (x > 2549) {
+    print("f2549 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2550(a, b) {
+  let x = a * 2550 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2550;
+  }
+  if (x > 2550) {
+    print("f2550 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2551(a, b) {
+  let x = a * 2551 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2551;
+  }
+  if (x > 2551) {
+    print("f2551 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2552(a, b) {
+  let x = a * 2552 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2552;
+  }
+  if (x > 2552) {
+    print("f2552 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2553(a, b) {
+  let x = a * 2553 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2553;
+  }
+  if (x > 2553) {
+    print("f2553 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2554(a, b) {
+  let x = a * 2554 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2554;
+  }
+  if (x > 2554) {
+    print("f2554 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2555(a, b) {
+  let x = a * 2555 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2555;
+  }
+  if (x > 2555) {
+    print("f2555 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2556(a, b) {
+  let x = a * 2556 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2556;
+  }
+  if (x > 2556) {
+    print("f2556 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2557(a, b) {
+  let x = a * 2557 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2557;
+  }
+  if (x > 2557) {
+    print("f2557 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2558(a, b) {
+  let x = a * 2558 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2558;
+  }
+  if (x > 2558) {
+    print("f2558 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2559(a, b) {
+  let x = a * 2559 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2559;
+  }
+  if (x > 2559) {
+    print("f2559 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2560(a, b) {
+  let x = a * 2560 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2560;
+  }
+  if (x > 2560) {
+    print("f2560 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2561(a, b) {
+  let x = a * 2561 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2561;
+  }
+  if (x > 2561) {
+    print("f2561 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2562(a, b) {
+  let x = a * 2562 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2562;
+  }
+  if (x > 2562) {
+    print("f2562 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2563(a, b) {
+  let x = a * 2563 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2563;
+  }
+  if (x > 2563) {
+    print("f2563 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2564(a, b) {
+  let x = a * 2564 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2564;
+  }
+  if (x > 2564) {
+    print("f2564 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2565(a, b) {
+  let x = a * 2565 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2565;
+  }
+  if (x > 2565) {
+    print("f2565 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2566(a, b) {
+  let x = a * 2566 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2566;
+  }
+  if (x > 2566) {
+    print("f2566 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2567(a, b) {
+  let x = a * 2567 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2567;
+  }
+  if (x > 2567) {
+    print("f2567 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2568(a, b) {
+  let x = a * 2568 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2568;
+  }
+  if (x > 2568) {
+    print("f2568 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2569(a, b) {
+  let x = a * 2569 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2569;
+  }
+  if (x > 2569) {
+    print("f2569 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2570(a, b) {
+  let x = a * 2570 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2570;
+  }
+  if (x > 2570) {
+    print("f2570 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2571(a, b) {
+  let x = a * 2571 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2571;
+  }
+  if (x > 2571) {
+    print("f2571 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2572(a, b) {
+  let x = a * 2572 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2572;
+  }
+  if (x > 2572) {
+    print("f2572 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2573(a, b) {
+  let x = a * 2573 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2573;
+  }
+  if (x > 2573) {
+    print("f2573 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2574(a, b) {
+  let x = a * 2574 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2574;
+  }
+  if (x > 2574) {
+    print("f2574 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2575(a, b) {
+  let x = a * 2575 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2575;
+  }
+  if (x > 2575) {
+    print("f2575 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2576(a, b) {
+  let x = a * 2576 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2576;
+  }
+  if (x > 2576) {
+    print("f2576 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2577(a, b) {
+  let x = a * 2577 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2577;
+  }
+  if (x > 2577) {
+    print("f2577 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2578(a, b) {
+  let x = a * 2578 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2578;
+  }
+  if (x > 2578) {
+    print("f2578 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2579(a, b) {
+  let x = a * 2579 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2579;
+  }
+  if (x > 2579) {
+    print("f2579 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2580(a, b) {
+  let x = a * 2580 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2580;
+  }
+  if (x > 2580) {
+    print("f2580 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2581(a, b) {
+  let x = a * 2581 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2581;
+  }
+  if (x > 2581) {
+    print("f2581 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2582(a, b) {
+  let x = a * 2582 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2582;
+  }
+  if (x > 2582) {
+    print("f2582 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2583(a, b) {
+  let x = a * 2583 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2583;
+  }
+  if (x > 2583) {
+    print("f2583 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2584(a, b) {
+  let x = a * 2584 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2584;
+  }
+  if (x > 2584) {
+    print("f2584 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2585(a, b) {
+  let x = a * 2585 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2585;
+  }
+  if (x > 2585) {
+    print("f2585 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2586(a, b) {
+  let x = a * 2586 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2586;
+  }
+  if (x > 2586) {
+    print("f2586 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2587(a, b) {
+  let x = a * 2587 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2587;
+  }
+  if (x > 2587) {
+    print("f2587 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2588(a, b) {
+  let x = a * 2588 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2588;
+  }
+  if (x > 2588) {
+    print("f2588 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2589(a, b) {
+  let x = a * 2589 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2589;
+  }
+  if (x > 2589) {
+    print("f2589 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2590(a, b) {
+  let x = a * 2590 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2590;
+  }
+  if (x > 2590) {
+    print("f2590 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2591(a, b) {
+  let x = a * 2591 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2591;
+  }
+  if (x > 2591) {
+    print("f2591 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2592(a, b) {
+  let x = a * 2592 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2592;
+  }
+  if (x > 2592) {
+    print("f2592 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2593(a, b) {
+  let x = a * 2593 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2593;
+  }
+  if (x > 2593) {
+    print("f2593 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2594(a, b) {
+  let x = a * 2594 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2594;
+  }
+  if (x > 2594) {
+    print("f2594 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2595(a, b) {
+  let x = a * 2595 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2595;
+  }
+  if (x > 2595) {
+    print("f2595 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2596(a, b) {
+  let x = a * 2596 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2596;
+  }
+  if (x > 2596) {
+    print("f2596 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2597(a, b) {
+  let x = a * 2597 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2597;
+  }
+  if (x > 2597) {
+    print("f2597 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2598(a, b) {
+  let x = a * 2598 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2598;
+  }
+  if (x > 2598) {
+    print("f2598 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2599(a, b) {
+  let x = a * 2599 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2599;
+  }
+  if (x > 2599) {
+    print("f2599 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2600(a, b) {
+  let x = a * 2600 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2600;
+  }
+  if (x > 2600) {
+    print("f2600 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2601(a, b) {
+  let x = a * 2601 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2601;
+  }
+  if (x > 2601) {
+    print("f2601 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2602(a, b) {
+  let x = a * 2602 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2602;
+  }
+  if (x > 2602) {
+    print("f2602 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2603(a, b) {
+  let x = a * 2603 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2603;
+  }
+  if (x > 2603) {
+    print("f2603 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2604(a, b) {
+  let x = a * 2604 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2604;
+  }
+  if (x > 2604) {
+    print("f2604 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2605(a, b) {
+  let x = a * 2605 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2605;
+  }
+  if (x > 2605) {
+    print("f2605 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2606(a, b) {
+  let x = a * 2606 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2606;
+  }
+  if (x > 2606) {
+    print("f2606 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2607(a, b) {
+  let x = a * 2607 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2607;
+  }
+  if (x > 2607) {
+    print("f2607 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2608(a, b) {
+  let x = a * 2608 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2608;
+  }
+  if (x > 2608) {
+    print("f2608 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2609(a, b) {
+  let x = a * 2609 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2609;
+  }
+  if (x > 2609) {
+    print("f2609 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2610(a, b) {
+  let x = a * 2610 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2610;
+  }
+  if (x > 2610) {
+    print("f2610 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2611(a, b) {
+  let x = a * 2611 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2611;
+  }
+  if (x > 2611) {
+    print("f2611 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2612(a, b) {
+  let x = a * 2612 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2612;
+  }
+  if (x > 2612) {
+    print("f2612 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2613(a, b) {
+  let x = a * 2613 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2613;
+  }
+  if (x > 2613) {
+    print("f2613 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2614(a, b) {
+  let x = a * 2614 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2614;
+  }
+  if (x > 2614) {
+    print("f2614 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2615(a, b) {
+  let x = a * 2615 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2615;
+  }
+  if (x > 2615) {
+    print("f2615 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2616(a, b) {
+  let x = a * 2616 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2616;
+  }
+  if (x > 2616) {
+    print("f2616 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2617(a, b) {
+  let x = a * 2617 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2617;
+  }
+  if (x > 2617) {
+    print("f2617 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2618(a, b) {
+  let x = a * 2618 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2618;
+  }
+  if (x > 2618) {
+    print("f2618 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2619(a, b) {
+  let x = a * 2619 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2619;
+  }
+  if (x > 2619) {
+    print("f2619 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2620(a, b) {
+  let x = a * 2620 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2620;
+  }
+  if (x > 2620) {
+    print("f2620 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2621(a, b) {
+  let x = a * 2621 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2621;
+  }
+  if (x > 2621) {
+    print("f2621 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2622(a, b) {
+  let x = a * 2622 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2622;
+  }
+  if (x > 2622) {
+    print("f2622 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2623(a, b) {
+  let x = a * 2623 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2623;
+  }
+  if (x > 2623) {
+    print("f2623 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2624(a, b) {
+  let x = a * 2624 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2624;
+  }
+  if (x > 2624) {
+    print("f2624 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2625(a, b) {
+  let x = a * 2625 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2625;
+  }
+  if (x > 2625) {
+    print("f2625 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2626(a, b) {
+  let x = a * 2626 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2626;
+  }
+  if (x > 2626) {
+    print("f2626 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2627(a, b) {
+  let x = a * 2627 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2627;
+  }
+  if (x > 2627) {
+    print("f2627 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2628(a, b) {
+  let x = a * 2628 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2628;
+  }
+  if (x > 2628) {
+    print("f2628 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2629(a, b) {
+  let x = a * 2629 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2629;
+  }
+  if (x > 2629) {
+    print("f2629 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2630(a, b) {
+  let x = a * 2630 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2630;
+  }
+  if (x > 2630) {
+    print("f2630 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2631(a, b) {
+  let x = a * 2631 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2631;
+  }
+  if (x > 2631) {
+    print("f2631 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2632(a, b) {
+  let x = a * 2632 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2632;
+  }
+  if (x > 2632) {
+    print("f2632 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2633(a, b) {
+  let x = a * 2633 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2633;
+  }
+  if (x > 2633) {
+    print("f2633 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2634(a, b) {
+  let x = a * 2634 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2634;
+  }
+  if (x > 2634) {
+    print("f2634 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2635(a, b) {
+  let x = a * 2635 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2635;
+  }
+  if (x > 2635) {
+    print("f2635 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2636(a, b) {
+  let x = a * 2636 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2636;
+  }
+  if (x > 2636) {
+    print("f2636 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2637(a, b) {
+  let x = a * 2637 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2637;
+  }
+  if (x > 2637) {
+    print("f2637 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2638(a, b) {
+  let x = a * 2638 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2638;
+  }
+  if (x > 2638) {
+    print("f2638 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2639(a, b) {
+  let x = a * 2639 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2639;
+  }
+  if (x > 2639) {
+    print("f2639 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2640(a, b) {
+  let x = a * 2640 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2640;
+  }
+  if (x > 2640) {
+    print("f2640 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2641(a, b) {
+  let x = a * 2641 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2641;
+  }
+  if (x > 2641) {
+    print("f2641 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2642(a, b) {
+  let x = a * 2642 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2642;
+  }
+  if (x > 2642) {
+    print("f2642 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2643(a, b) {
+  let x = a * 2643 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2643;
+  }
+  if (x > 2643) {
+    print("f2643 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2644(a, b) {
+  let x = a * 2644 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2644;
+  }
+  if (x > 2644) {
+    print("f2644 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2645(a, b) {
+  let x = a * 2645 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2645;
+  }
+  if (x > 2645) {
+    print("f2645 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2646(a, b) {
+  let x = a * 2646 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2646;
+  }
+  if (x > 2646) {
+    print("f2646 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2647(a, b) {
+  let x = a * 2647 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2647;
+  }
+  if (x > 2647) {
+    print("f2647 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2648(a, b) {
+  let x = a * 2648 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2648;
+  }
+  if (x > 2648) {
+    print("f2648 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2649(a, b) {
+  let x = a * 2649 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2649;
+  }
+  if (x > 2649) {
+    print("f2649 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2650(a, b) {
+  let x = a * 2650 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2650;
+  }
+  if (x > 2650) {
+    print("f2650 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2651(a, b) {
+  let x = a * 2651 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2651;
+  }
+  if (x > 2651) {
+    print("f2651 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2652(a, b) {
+  let x = a * 2652 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2652;
+  }
+  if (x > 2652) {
+    print("f2652 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2653(a, b) {
+  let x = a * 2653 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2653;
+  }
+  if (x > 2653) {
+    print("f2653 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2654(a, b) {
+  let x = a * 2654 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2654;
+  }
+  if (x > 2654) {
+    print("f2654 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2655(a, b) {
+  let x = a * 2655 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2655;
+  }
+  if (x > 2655) {
+    print("f2655 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2656(a, b) {
+  let x = a * 2656 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2656;
+  }
+  if (x > 2656) {
+    print("f2656 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2657(a, b) {
+  let x = a * 2657 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2657;
+  }
+  if (x > 2657) {
+    print("f2657 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2658(a, b) {
+  let x = a * 2658 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2658;
+  }
+  if (x > 2658) {
+    print("f2658 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2659(a, b) {
+  let x = a * 2659 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2659;
+  }
+  if (x > 2659) {
+    print("f2659 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2660(a, b) {
+  let x = a * 2660 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2660;
+  }
+  if (x > 2660) {
+    print("f2660 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2661(a, b) {
+  let x = a * 2661 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2661;
+  }
+  if (x > 2661) {
+    print("f2661 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2662(a, b) {
+  let x = a * 2662 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2662;
+  }
+  if (x > 2662) {
+    print("f2662 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2663(a, b) {
+  let x = a * 2663 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2663;
+  }
+  if (x > 2663) {
+    print("f2663 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2664(a, b) {
+  let x = a * 2664 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2664;
+  }
+  if (x > 2664) {
+    print("f2664 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2665(a, b) {
+  let x = a * 2665 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2665;
+  }
+  if (x > 2665) {
+    print("f2665 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2666(a, b) {
+  let x = a * 2666 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2666;
+  }
+  if (x > 2666) {
+    print("f2666 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2667(a, b) {
+  let x = a * 2667 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2667;
+  }
+  if (x > 2667) {
+    print("f2667 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2668(a, b) {
+  let x = a * 2668 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2668;
+  }
+  if (x > 2668) {
+    print("f2668 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2669(a, b) {
+  let x = a * 2669 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2669;
+  }
+  if (x > 2669) {
+    print("f2669 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2670(a, b) {
+  let x = a * 2670 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2670;
+  }
+  if (x > 2670) {
+    print("f2670 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2671(a, b) {
+  let x = a * 2671 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2671;
+  }
+  if (x > 2671) {
+    print("f2671 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2672(a, b) {
+  let x = a * 2672 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2672;
+  }
+  if (x > 2672) {
+    print("f2672 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2673(a, b) {
+  let x = a * 2673 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2673;
+  }
+  if (x > 2673) {
+    print("f2673 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2674(a, b) {
+  let x = a * 2674 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2674;
+  }
+  if (x > 2674) {
+    print("f2674 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2675(a, b) {
+  let x = a * 2675 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2675;
+  }
+  if (x > 2675) {
+    print("f2675 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2676(a, b) {
+  let x = a * 2676 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2676;
+  }
+  if (x > 2676) {
+    print("f2676 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2677(a, b) {
+  let x = a * 2677 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2677;
+  }
+  if (x > 2677) {
+    print("f2677 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2678(a, b) {
+  let x = a * 2678 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2678;
+  }
+  if (x > 2678) {
+    print("f2678 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2679(a, b) {
+  let x = a * 2679 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2679;
+  }
+  if (x > 2679) {
+    print("f2679 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2680(a, b) {
+  let x = a * 2680 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2680;
+  }
+  if (x > 2680) {
+    print("f2680 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2681(a, b) {
+  let x = a * 2681 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2681;
+  }
+  if (x > 2681) {
+    print("f2681 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2682(a, b) {
+  let x = a * 2682 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2682;
+  }
+  if (x > 2682) {
+    print("f2682 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2683(a, b) {
+  let x = a * 2683 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2683;
+  }
+  if (x > 2683) {
+    print("f2683 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2684(a, b) {
+  let x = a * 2684 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2684;
+  }
+  if (x > 2684) {
+    print("f2684 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2685(a, b) {
+  let x = a * 2685 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2685;
+  }
+  if (x > 2685) {
+    print("f2685 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2686(a, b) {
+  let x = a * 2686 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2686;
+  }
+  if (x > 2686) {
+    print("f2686 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2687(a, b) {
+  let x = a * 2687 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2687;
+  }
+  if (x > 2687) {
+    print("f2687 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2688(a, b) {
+  let x = a * 2688 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2688;
+  }
+  if (x > 2688) {
+    print("f2688 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2689(a, b) {
+  let x = a * 2689 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2689;
+  }
+  if (x > 2689) {
+    print("f2689 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2690(a, b) {
+  let x = a * 2690 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2690;
+  }
+  if (x > 2690) {
+    print("f2690 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2691(a, b) {
+  let x = a * 2691 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2691;
+  }
+  if (x > 2691) {
+    print("f2691 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2692(a, b) {
+  let x = a * 2692 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2692;
+  }
+  if (x > 2692) {
+    print("f2692 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2693(a, b) {
+  let x = a * 2693 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2693;
+  }
+  if (x > 2693) {
+    print("f2693 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2694(a, b) {
+  let x = a * 2694 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2694;
+  }
+  if (x > 2694) {
+    print("f2694 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2695(a, b) {
+  let x = a * 2695 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2695;
+  }
+  if (x > 2695) {
+    print("f2695 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2696(a, b) {
+  let x = a * 2696 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2696;
+  }
+  if (x > 2696) {
+    print("f2696 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2697(a, b) {
+  let x = a * 2697 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2697;
+  }
+  if (x > 2697) {
+    print("f2697 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2698(a, b) {
+  let x = a * 2698 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2698;
+  }
+  if (x > 2698) {
+    print("f2698 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2699(a, b) {
+  let x = a * 2699 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2699;
+  }
+  if (x > 2699) {
+    print("f2699 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2700(a, b) {
+  let x = a * 2700 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2700;
+  }
+  if (x > 2700) {
+    print("f2700 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2701(a, b) {
+  let x = a * 2701 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2701;
+  }
+  if (x > 2701) {
+    print("f2701 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2702(a, b) {
+  let x = a * 2702 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2702;
+  }
+  if (x > 2702) {
+    print("f2702 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2703(a, b) {
+  let x = a * 2703 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2703;
+  }
+  if (x > 2703) {
+    print("f2703 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2704(a, b) {
+  let x = a * 2704 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2704;
+  }
+  if (x > 2704) {
+    print("f2704 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2705(a, b) {
+  let x = a * 2705 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2705;
+  }
+  if (x > 2705) {
+    print("f2705 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2706(a, b) {
+  let x = a * 2706 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2706;
+  }
+  if (x > 2706) {
+    print("f2706 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2707(a, b) {
+  let x = a * 2707 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2707;
+  }
+  if (x > 2707) {
+    print("f2707 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2708(a, b) {
+  let x = a * 2708 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2708;
+  }
+  if (x > 2708) {
+    print("f2708 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2709(a, b) {
+  let x = a * 2709 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2709;
+  }
+  if (x > 2709) {
+    print("f2709 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2710(a, b) {
+  let x = a * 2710 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2710;
+  }
+  if (x > 2710) {
+    print("f2710 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2711(a, b) {
+  let x = a * 2711 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2711;
+  }
+  if (x > 2711) {
+    print("f2711 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2712(a, b) {
+  let x = a * 2712 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2712;
+  }
+  if (x > 2712) {
+    print("f2712 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2713(a, b) {
+  let x = a * 2713 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2713;
+  }
+  if (x > 2713) {
+    print("f2713 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2714(a, b) {
+  let x = a * 2714 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2714;
+  }
+  if (x > 2714) {
+    print("f2714 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2715(a, b) {
+  let x = a * 2715 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2715;
+  }
+  if (x > 2715) {
+    print("f2715 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2716(a, b) {
+  let x = a * 2716 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2716;
+  }
+  if (x > 2716) {
+    print("f2716 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2717(a, b) {
+  let x = a * 2717 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2717;
+  }
+  if (x > 2717) {
+    print("f2717 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2718(a, b) {
+  let x = a * 2718 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2718;
+  }
+  if (x > 2718) {
+    print("f2718 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2719(a, b) {
+  let x = a * 2719 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2719;
+  }
+  if (x > 2719) {
+    print("f2719 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2720(a, b) {
+  let x = a * 2720 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2720;
+  }
+  if (x > 2720) {
+    print("f2720 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2721(a, b) {
+  let x = a * 2721 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2721;
+  }
+  if (x > 2721) {
+    print("f2721 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2722(a, b) {
+  let x = a * 2722 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2722;
+  }
+  if (x > 2722) {
+    print("f2722 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2723(a, b) {
+  let x = a * 2723 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2723;
+  }
+  if (x > 2723) {
+    print("f2723 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2724(a, b) {
+  let x = a * 2724 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2724;
+  }
+  if (x > 2724) {
+    print("f2724 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2725(a, b) {
+  let x = a * 2725 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2725;
+  }
+  if (x > 2725) {
+    print("f2725 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2726(a, b) {
+  let x = a * 2726 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2726;
+  }
+  if (x > 2726) {
+    print("f2726 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2727(a, b) {
+  let x = a * 2727 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2727;
+  }
+  if (x > 2727) {
+    print("f2727 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2728(a, b) {
+  let x = a * 2728 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2728;
+  }
+  if (x > 2728) {
+    print("f2728 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2729(a, b) {
+  let x = a * 2729 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2729;
+  }
+  if (x > 2729) {
+    print("f2729 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2730(a, b) {
+  let x = a * 2730 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2730;
+  }
+  if (x > 2730) {
+    print("f2730 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2731(a, b) {
+  let x = a * 2731 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2731;
+  }
+  if (x > 2731) {
+    print("f2731 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2732(a, b) {
+  let x = a * 2732 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2732;
+  }
+  if (x > 2732) {
+    print("f2732 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2733(a, b) {
+  let x = a * 2733 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2733;
+  }
+  if (x > 2733) {
+    print("f2733 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2734(a, b) {
+  let x = a * 2734 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2734;
+  }
+  if (x > 2734) {
+    print("f2734 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2735(a, b) {
+  let x = a * 2735 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2735;
+  }
+  if (x > 2735) {
+    print("f2735 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2736(a, b) {
+  let x = a * 2736 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2736;
+  }
+  if (x > 2736) {
+    print("f2736 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2737(a, b) {
+  let x = a * 2737 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2737;
+  }
+  if (x > 2737) {
+    print("f2737 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2738(a, b) {
+  let x = a * 2738 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2738;
+  }
+  if (x > 2738) {
+    print("f2738 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2739(a, b) {
+  let x = a * 2739 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2739;
+  }
+  if (x > 2739) {
+    print("f2739 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2740(a, b) {
+  let x = a * 2740 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2740;
+  }
+  if (x > 2740) {
+    print("f2740 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2741(a, b) {
+  let x = a * 2741 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2741;
+  }
+  if (x > 2741) {
+    print("f2741 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2742(a, b) {
+  let x = a * 2742 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2742;
+  }
+  if (x > 2742) {
+    print("f2742 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2743(a, b) {
+  let x = a * 2743 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2743;
+  }
+  if (x > 2743) {
+    print("f2743 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2744(a, b) {
+  let x = a * 2744 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2744;
+  }
+  if (x > 2744) {
+    print("f2744 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2745(a, b) {
+  let x = a * 2745 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2745;
+  }
+  if (x > 2745) {
+    print("f2745 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2746(a, b) {
+  let x = a * 2746 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2746;
+  }
+  if (x > 2746) {
+    print("f2746 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2747(a, b) {
+  let x = a * 2747 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2747;
+  }
+  if (x > 2747) {
+    print("f2747 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2748(a, b) {
+  let x = a * 2748 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2748;
+  }
+  if (x > 2748) {
+    print("f2748 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2749(a, b) {
+  let x = a * 2749 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2749;
+  }
+  if (x > 2749) {
+    print("f2749 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2750(a, b) {
+  let x = a * 2750 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2750;
+  }
+  if (x > 2750) {
+    print("f2750 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2751(a, b) {
+  let x = a * 2751 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2751;
+  }
+  if (x > 2751) {
+    print("f2751 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2752(a, b) {
+  let x = a * 2752 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2752;
+  }
+  if (x > 2752) {
+    print("f2752 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2753(a, b) {
+  let x = a * 2753 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2753;
+  }
+  if (x > 2753) {
+    print("f2753 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2754(a, b) {
+  let x = a * 2754 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2754;
+  }
+  if (x > 2754) {
+    print("f2754 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2755(a, b) {
+  let x = a * 2755 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2755;
+  }
+  if (x > 2755) {
+    print("f2755 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2756(a, b) {
+  let x = a * 2756 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2756;
+  }
+  if (x > 2756) {
+    print("f2756 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2757(a, b) {
+  let x = a * 2757 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2757;
+  }
+  if (x > 2757) {
+    print("f2757 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2758(a, b) {
+  let x = a * 2758 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2758;
+  }
+  if (x > 2758) {
+    print("f2758 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2759(a, b) {
+  let x = a * 2759 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2759;
+  }
+  if (x > 2759) {
+    print("f2759 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2760(a, b) {
+  let x = a * 2760 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2760;
+  }
+  if (x > 2760) {
+    print("f2760 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2761(a, b) {
+  let x = a * 2761 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2761;
+  }
+  if (x > 2761) {
+    print("f2761 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2762(a, b) {
+  let x = a * 2762 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2762;
+  }
+  if (x > 2762) {
+    print("f2762 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2763(a, b) {
+  let x = a * 2763 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2763;
+  }
+  if (x > 2763) {
+    print("f2763 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2764(a, b) {
+  let x = a * 2764 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2764;
+  }
+  if (x > 2764) {
+    print("f2764 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2765(a, b) {
+  let x = a * 2765 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2765;
+  }
+  if (x > 2765) {
+    print("f2765 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2766(a, b) {
+  let x = a * 2766 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2766;
+  }
+  if (x > 2766) {
+    print("f2766 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2767(a, b) {
+  let x = a * 2767 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2767;
+  }
+  if (x > 2767) {
+    print("f2767 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2768(a, b) {
+  let x = a * 2768 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2768;
+  }
+  if (x > 2768) {
+    print("f2768 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2769(a, b) {
+  let x = a * 2769 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2769;
+  }
+  if (x > 2769) {
+    print("f2769 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2770(a, b) {
+  let x = a * 2770 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2770;
+  }
+  if (x > 2770) {
+    print("f2770 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2771(a, b) {
+  let x = a * 2771 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2771;
+  }
+  if (x > 2771) {
+    print("f2771 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2772(a, b) {
+  let x = a * 2772 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2772;
+  }
+  if (x > 2772) {
+    print("f2772 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2773(a, b) {
+  let x = a * 2773 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2773;
+  }
+  if (x > 2773) {
+    print("f2773 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2774(a, b) {
+  let x = a * 2774 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2774;
+  }
+  if (x > 2774) {
+    print("f2774 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2775(a, b) {
+  let x = a * 2775 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2775;
+  }
+  if (x > 2775) {
+    print("f2775 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2776(a, b) {
+  let x = a * 2776 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2776;
+  }
+  if (x > 2776) {
+    print("f2776 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2777(a, b) {
+  let x = a * 2777 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2777;
+  }
+  if (x > 2777) {
+    print("f2777 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2778(a, b) {
+  let x = a * 2778 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2778;
+  }
+  if (x > 2778) {
+    print("f2778 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2779(a, b) {
+  let x = a * 2779 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2779;
+  }
+  if (x > 2779) {
+    print("f2779 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2780(a, b) {
+  let x = a * 2780 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2780;
+  }
+  if (x > 2780) {
+    print("f2780 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2781(a, b) {
+  let x = a * 2781 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2781;
+  }
+  if (x > 2781) {
+    print("f2781 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2782(a, b) {
+  let x = a * 2782 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2782;
+  }
+  if (x > 2782) {
+    print("f2782 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2783(a, b) {
+  let x = a * 2783 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2783;
+  }
+  if (x > 2783) {
+    print("f2783 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2784(a, b) {
+  let x = a * 2784 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2784;
+  }
+  if (x > 2784) {
+    print("f2784 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2785(a, b) {
+  let x = a * 2785 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2785;
+  }
+  if (x > 2785) {
+    print("f2785 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2786(a, b) {
+  let x = a * 2786 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2786;
+  }
+  if (x > 2786) {
+    print("f2786 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2787(a, b) {
+  let x = a * 2787 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2787;
+  }
+  if (x > 2787) {
+    print("f2787 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2788(a, b) {
+  let x = a * 2788 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2788;
+  }
+  if (x > 2788) {
+    print("f2788 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2789(a, b) {
+  let x = a * 2789 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2789;
+  }
+  if (x > 2789) {
+    print("f2789 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2790(a, b) {
+  let x = a * 2790 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2790;
+  }
+  if (x > 2790) {
+    print("f2790 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2791(a, b) {
+  let x = a * 2791 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2791;
+  }
+  if (x > 2791) {
+    print("f2791 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2792(a, b) {
+  let x = a * 2792 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2792;
+  }
+  if (x > 2792) {
+    print("f2792 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2793(a, b) {
+  let x = a * 2793 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2793;
+  }
+  if (x > 2793) {
+    print("f2793 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2794(a, b) {
+  let x = a * 2794 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2794;
+  }
+  if (x > 2794) {
+    print("f2794 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2795(a, b) {
+  let x = a * 2795 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2795;
+  }
+  if (x > 2795) {
+    print("f2795 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2796(a, b) {
+  let x = a * 2796 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2796;
+  }
+  if (x > 2796) {
+    print("f2796 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2797(a, b) {
+  let x = a * 2797 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2797;
+  }
+  if (x > 2797) {
+    print("f2797 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2798(a, b) {
+  let x = a * 2798 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2798;
+  }
+  if (x > 2798) {
+    print("f2798 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2799(a, b) {
+  let x = a * 2799 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2799;
+  }
+  if (x > 2799) {
+    print("f2799 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2800(a, b) {
+  let x = a * 2800 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2800;
+  }
+  if (x > 2800) {
+    print("f2800 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2801(a, b) {
+  let x = a * 2801 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2801;
+  }
+  if (x > 2801) {
+    print("f2801 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2802(a, b) {
+  let x = a * 2802 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2802;
+  }
+  if (x > 2802) {
+    print("f2802 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2803(a, b) {
+  let x = a * 2803 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2803;
+  }
+  if (x > 2803) {
+    print("f2803 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2804(a, b) {
+  let x = a * 2804 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2804;
+  }
+  if (x > 2804) {
+    print("f2804 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2805(a, b) {
+  let x = a * 2805 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2805;
+  }
+  if (x > 2805) {
+    print("f2805 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2806(a, b) {
+  let x = a * 2806 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2806;
+  }
+  if (x > 2806) {
+    print("f2806 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2807(a, b) {
+  let x = a * 2807 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2807;
+  }
+  if (x > 2807) {
+    print("f2807 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2808(a, b) {
+  let x = a * 2808 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2808;
+  }
+  if (x > 2808) {
+    print("f2808 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2809(a, b) {
+  let x = a * 2809 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2809;
+  }
+  if (x > 2809) {
+    print("f2809 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2810(a, b) {
+  let x = a * 2810 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2810;
+  }
+  if (x > 2810) {
+    print("f2810 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2811(a, b) {
+  let x = a * 2811 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2811;
+  }
+  if (x > 2811) {
+    print("f2811 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2812(a, b) {
+  let x = a * 2812 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2812;
+  }
+  if (x > 2812) {
+    print("f2812 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2813(a, b) {
+  let x = a * 2813 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2813;
+  }
+  if (x > 2813) {
+    print("f2813 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2814(a, b) {
+  let x = a * 2814 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2814;
+  }
+  if (x > 2814) {
+    print("f2814 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2815(a, b) {
+  let x = a * 2815 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2815;
+  }
+  if (x > 2815) {
+    print("f2815 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2816(a, b) {
+  let x = a * 2816 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2816;
+  }
+  if (x > 2816) {
+    print("f2816 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2817(a, b) {
+  let x = a * 2817 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2817;
+  }
+  if (x > 2817) {
+    print("f2817 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2818(a, b) {
+  let x = a * 2818 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2818;
+  }
+  if (x > 2818) {
+    print("f2818 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2819(a, b) {
+  let x = a * 2819 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2819;
+  }
+  if (x > 2819) {
+    print("f2819 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2820(a, b) {
+  let x = a * 2820 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2820;
+  }
+  if (x > 2820) {
+    print("f2820 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2821(a, b) {
+  let x = a * 2821 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2821;
+  }
+  if (x > 2821) {
+    print("f2821 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2822(a, b) {
+  let x = a * 2822 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2822;
+  }
+  if (x > 2822) {
+    print("f2822 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2823(a, b) {
+  let x = a * 2823 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2823;
+  }
+  if (x > 2823) {
+    print("f2823 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2824(a, b) {
+  let x = a * 2824 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2824;
+  }
+  if (x > 2824) {
+    print("f2824 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2825(a, b) {
+  let x = a * 2825 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2825;
+  }
+  if (x > 2825) {
+    print("f2825 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2826(a, b) {
+  let x = a * 2826 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2826;
+  }
+  if (x > 2826) {
+    print("f2826 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2827(a, b) {
+  let x = a * 2827 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2827;
+  }
+  if (x > 2827) {
+    print("f2827 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2828(a, b) {
+  let x = a * 2828 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2828;
+  }
+  if (x > 2828) {
+    print("f2828 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2829(a, b) {
+  let x = a * 2829 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2829;
+  }
+  if (x > 2829) {
+    print("f2829 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2830(a, b) {
+  let x = a * 2830 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2830;
+  }
+  if (x > 2830) {
+    print("f2830 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2831(a, b) {
+  let x = a * 2831 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2831;
+  }
+  if (x > 2831) {
+    print("f2831 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2832(a, b) {
+  let x = a * 2832 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2832;
+  }
+  if (x > 2832) {
+    print("f2832 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2833(a, b) {
+  let x = a * 2833 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2833;
+  }
+  if (x > 2833) {
+    print("f2833 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2834(a, b) {
+  let x = a * 2834 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2834;
+  }
+  if (x > 2834) {
+    print("f2834 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2835(a, b) {
+  let x = a * 2835 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2835;
+  }
+  if (x > 2835) {
+    print("f2835 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2836(a, b) {
+  let x = a * 2836 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2836;
+  }
+  if (x > 2836) {
+    print("f2836 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2837(a, b) {
+  let x = a * 2837 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2837;
+  }
+  if (x > 2837) {
+    print("f2837 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2838(a, b) {
+  let x = a * 2838 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2838;
+  }
+  if (x > 2838) {
+    print("f2838 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2839(a, b) {
+  let x = a * 2839 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2839;
+  }
+  if (x > 2839) {
+    print("f2839 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2840(a, b) {
+  let x = a * 2840 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2840;
+  }
+  if (x > 2840) {
+    print("f2840 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2841(a, b) {
+  let x = a * 2841 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2841;
+  }
+  if (x > 2841) {
+    print("f2841 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2842(a, b) {
+  let x = a * 2842 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2842;
+  }
+  if (x > 2842) {
+    print("f2842 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2843(a, b) {
+  let x = a * 2843 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2843;
+  }
+  if (x > 2843) {
+    print("f2843 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2844(a, b) {
+  let x = a * 2844 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2844;
+  }
+  if (x > 2844) {
+    print("f2844 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2845(a, b) {
+  let x = a * 2845 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2845;
+  }
+  if (x > 2845) {
+    print("f2845 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2846(a, b) {
+  let x = a * 2846 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2846;
+  }
+  if (x > 2846) {
+    print("f2846 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2847(a, b) {
+  let x = a * 2847 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2847;
+  }
+  if (x > 2847) {
+    print("f2847 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2848(a, b) {
+  let x = a * 2848 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2848;
+  }
+  if (x > 2848) {
+    print("f2848 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2849(a, b) {
+  let x = a * 2849 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2849;
+  }
+  if (x > 2849) {
+    print("f2849 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2850(a, b) {
+  let x = a * 2850 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2850;
+  }
+  if (x > 2850) {
+    print("f2850 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2851(a, b) {
+  let x = a * 2851 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2851;
+  }
+  if (x > 2851) {
+    print("f2851 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2852(a, b) {
+  let x = a * 2852 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2852;
+  }
+  if (x > 2852) {
+    print("f2852 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2853(a, b) {
+  let x = a * 2853 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2853;
+  }
+  if (x > 2853) {
+    print("f2853 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2854(a, b) {
+  let x = a * 2854 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2854;
+  }
+  if (x > 2854) {
+    print("f2854 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2855(a, b) {
+  let x = a * 2855 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2855;
+  }
+  if (x > 2855) {
+    print("f2855 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2856(a, b) {
+  let x = a * 2856 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2856;
+  }
+  if (x > 2856) {
+    print("f2856 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2857(a, b) {
+  let x = a * 2857 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2857;
+  }
+  if (x > 2857) {
+    print("f2857 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2858(a, b) {
+  let x = a * 2858 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2858;
+  }
+  if (x > 2858) {
+    print("f2858 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2859(a, b) {
+  let x = a * 2859 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2859;
+  }
+  if (x > 2859) {
+    print("f2859 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2860(a, b) {
+  let x = a * 2860 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2860;
+  }
+  if (x > 2860) {
+    print("f2860 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2861(a, b) {
+  let x = a * 2861 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2861;
+  }
+  if (x > 2861) {
+    print("f2861 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2862(a, b) {
+  let x = a * 2862 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2862;
+  }
+  if (x > 2862) {
+    print("f2862 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2863(a, b) {
+  let x = a * 2863 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2863;
+  }
+  if (x > 2863) {
+    print("f2863 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2864(a, b) {
+  let x = a * 2864 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2864;
+  }
+  if (x > 2864) {
+    print("f2864 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2865(a, b) {
+  let x = a * 2865 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2865;
+  }
+  if (x > 2865) {
+    print("f2865 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2866(a, b) {
+  let x = a * 2866 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2866;
+  }
+  if (x > 2866) {
+    print("f2866 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2867(a, b) {
+  let x = a * 2867 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2867;
+  }
+  if (x > 2867) {
+    print("f2867 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2868(a, b) {
+  let x = a * 2868 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2868;
+  }
+  if (x > 2868) {
+    print("f2868 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2869(a, b) {
+  let x = a * 2869 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2869;
+  }
+  if (x > 2869) {
+    print("f2869 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2870(a, b) {
+  let x = a * 2870 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2870;
+  }
+  if (x > 2870) {
+    print("f2870 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2871(a, b) {
+  let x = a * 2871 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2871;
+  }
+  if (x > 2871) {
+    print("f2871 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2872(a, b) {
+  let x = a * 2872 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2872;
+  }
+  if (x > 2872) {
+    print("f2872 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2873(a, b) {
+  let x = a * 2873 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2873;
+  }
+  if (x > 2873) {
+    print("f2873 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2874(a, b) {
+  let x = a * 2874 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2874;
+  }
+  if (x > 2874) {
+    print("f2874 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2875(a, b) {
+  let x = a * 2875 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2875;
+  }
+  if (x > 2875) {
+    print("f2875 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2876(a, b) {
+  let x = a * 2876 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2876;
+  }
+  if (x > 2876) {
+    print("f2876 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2877(a, b) {
+  let x = a * 2877 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2877;
+  }
+  if (x > 2877) {
+    print("f2877 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2878(a, b) {
+  let x = a * 2878 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2878;
+  }
+  if (x > 2878) {
+    print("f2878 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2879(a, b) {
+  let x = a * 2879 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2879;
+  }
+  if (x > 2879) {
+    print("f2879 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2880(a, b) {
+  let x = a * 2880 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2880;
+  }
+  if (x > 2880) {
+    print("f2880 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2881(a, b) {
+  let x = a * 2881 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2881;
+  }
+  if (x > 2881) {
+    print("f2881 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2882(a, b) {
+  let x = a * 2882 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2882;
+  }
+  if (x > 2882) {
+    print("f2882 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2883(a, b) {
+  let x = a * 2883 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2883;
+  }
+  if (x > 2883) {
+    print("f2883 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2884(a, b) {
+  let x = a * 2884 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2884;
+  }
+  if (x > 2884) {
+    print("f2884 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2885(a, b) {
+  let x = a * 2885 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2885;
+  }
+  if (x > 2885) {
+    print("f2885 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2886(a, b) {
+  let x = a * 2886 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2886;
+  }
+  if (x > 2886) {
+    print("f2886 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2887(a, b) {
+  let x = a * 2887 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2887;
+  }
+  if (x > 2887) {
+    print("f2887 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2888(a, b) {
+  let x = a * 2888 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2888;
+  }
+  if (x > 2888) {
+    print("f2888 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2889(a, b) {
+  let x = a * 2889 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2889;
+  }
+  if (x > 2889) {
+    print("f2889 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2890(a, b) {
+  let x = a * 2890 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2890;
+  }
+  if (x > 2890) {
+    print("f2890 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2891(a, b) {
+  let x = a * 2891 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2891;
+  }
+  if (x > 2891) {
+    print("f2891 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2892(a, b) {
+  let x = a * 2892 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2892;
+  }
+  if (x > 2892) {
+    print("f2892 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2893(a, b) {
+  let x = a * 2893 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2893;
+  }
+  if (x > 2893) {
+    print("f2893 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2894(a, b) {
+  let x = a * 2894 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2894;
+  }
+  if (x > 2894) {
+    print("f2894 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2895(a, b) {
+  let x = a * 2895 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2895;
+  }
+  if (x > 2895) {
+    print("f2895 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2896(a, b) {
+  let x = a * 2896 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2896;
+  }
+  if (x > 2896) {
+    print("f2896 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2897(a, b) {
+  let x = a * 2897 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2897;
+  }
+  if (x > 2897) {
+    print("f2897 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2898(a, b) {
+  let x = a * 2898 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2898;
+  }
+  if (x > 2898) {
+    print("f2898 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2899(a, b) {
+  let x = a * 2899 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2899;
+  }
+  if (x > 2899) {
+    print("f2899 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2900(a, b) {
+  let x = a * 2900 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2900;
+  }
+  if (x > 2900) {
+    print("f2900 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2901(a, b) {
+  let x = a * 2901 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2901;
+  }
+  if (x > 2901) {
+    print("f2901 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2902(a, b) {
+  let x = a * 2902 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2902;
+  }
+  if (x > 2902) {
+    print("f2902 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2903(a, b) {
+  let x = a * 2903 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2903;
+  }
+  if (x > 2903) {
+    print("f2903 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2904(a, b) {
+  let x = a * 2904 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2904;
+  }
+  if (x > 2904) {
+    print("f2904 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2905(a, b) {
+  let x = a * 2905 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2905;
+  }
+  if (x > 2905) {
+    print("f2905 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2906(a, b) {
+  let x = a * 2906 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2906;
+  }
+  if (x > 2906) {
+    print("f2906 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2907(a, b) {
+  let x = a * 2907 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2907;
+  }
+  if (x > 2907) {
+    print("f2907 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2908(a, b) {
+  let x = a * 2908 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2908;
+  }
+  if (x > 2908) {
+    print("f2908 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2909(a, b) {
+  let x = a * 2909 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2909;
+  }
+  if (x > 2909) {
+    print("f2909 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2910(a, b) {
+  let x = a * 2910 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2910;
+  }
+  if (x > 2910) {
+    print("f2910 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2911(a, b) {
+  let x = a * 2911 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2911;
+  }
+  if (x > 2911) {
+    print("f2911 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2912(a, b) {
+  let x = a * 2912 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2912;
+  }
+  if (x > 2912) {
+    print("f2912 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2913(a, b) {
+  let x = a * 2913 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2913;
+  }
+  if (x > 2913) {
+    print("f2913 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2914(a, b) {
+  let x = a * 2914 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2914;
+  }
+  if (x > 2914) {
+    print("f2914 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2915(a, b) {
+  let x = a * 2915 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2915;
+  }
+  if (x > 2915) {
+    print("f2915 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2916(a, b) {
+  let x = a * 2916 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2916;
+  }
+  if (x > 2916) {
+    print("f2916 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2917(a, b) {
+  let x = a * 2917 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2917;
+  }
+  if (x > 2917) {
+    print("f2917 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2918(a, b) {
+  let x = a * 2918 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2918;
+  }
+  if (x > 2918) {
+    print("f2918 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2919(a, b) {
+  let x = a * 2919 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2919;
+  }
+  if (x > 2919) {
+    print("f2919 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2920(a, b) {
+  let x = a * 2920 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2920;
+  }
+  if (x > 2920) {
+    print("f2920 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2921(a, b) {
+  let x = a * 2921 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2921;
+  }
+  if (x > 2921) {
+    print("f2921 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2922(a, b) {
+  let x = a * 2922 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2922;
+  }
+  if (x > 2922) {
+    print("f2922 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2923(a, b) {
+  let x = a * 2923 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2923;
+  }
+  if (x > 2923) {
+    print("f2923 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2924(a, b) {
+  let x = a * 2924 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2924;
+  }
+  if (x > 2924) {
+    print("f2924 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2925(a, b) {
+  let x = a * 2925 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2925;
+  }
+  if (x > 2925) {
+    print("f2925 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2926(a, b) {
+  let x = a * 2926 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2926;
+  }
+  if (x > 2926) {
+    print("f2926 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2927(a, b) {
+  let x = a * 2927 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2927;
+  }
+  if (x > 2927) {
+    print("f2927 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2928(a, b) {
+  let x = a * 2928 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2928;
+  }
+  if (x > 2928) {
+    print("f2928 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2929(a, b) {
+  let x = a * 2929 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2929;
+  }
+  if (x > 2929) {
+    print("f2929 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2930(a, b) {
+  let x = a * 2930 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2930;
+  }
+  if (x > 2930) {
+    print("f2930 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2931(a, b) {
+  let x = a * 2931 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2931;
+  }
+  if (x > 2931) {
+    print("f2931 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2932(a, b) {
+  let x = a * 2932 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2932;
+  }
+  if (x > 2932) {
+    print("f2932 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2933(a, b) {
+  let x = a * 2933 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2933;
+  }
+  if (x > 2933) {
+    print("f2933 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2934(a, b) {
+  let x = a * 2934 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2934;
+  }
+  if (x > 2934) {
+    print("f2934 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2935(a, b) {
+  let x = a * 2935 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2935;
+  }
+  if (x > 2935) {
+    print("f2935 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2936(a, b) {
+  let x = a * 2936 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2936;
+  }
+  if (x > 2936) {
+    print("f2936 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2937(a, b) {
+  let x = a * 2937 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2937;
+  }
+  if (x > 2937) {
+    print("f2937 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2938(a, b) {
+  let x = a * 2938 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2938;
+  }
+  if (x > 2938) {
+    print("f2938 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2939(a, b) {
+  let x = a * 2939 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2939;
+  }
+  if (x > 2939) {
+    print("f2939 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2940(a, b) {
+  let x = a * 2940 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2940;
+  }
+  if (x > 2940) {
+    print("f2940 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2941(a, b) {
+  let x = a * 2941 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2941;
+  }
+  if (x > 2941) {
+    print("f2941 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2942(a, b) {
+  let x = a * 2942 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2942;
+  }
+  if (x > 2942) {
+    print("f2942 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2943(a, b) {
+  let x = a * 2943 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2943;
+  }
+  if (x > 2943) {
+    print("f2943 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2944(a, b) {
+  let x = a * 2944 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2944;
+  }
+  if (x > 2944) {
+    print("f2944 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2945(a, b) {
+  let x = a * 2945 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2945;
+  }
+  if (x > 2945) {
+    print("f2945 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2946(a, b) {
+  let x = a * 2946 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2946;
+  }
+  if (x > 2946) {
+    print("f2946 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2947(a, b) {
+  let x = a * 2947 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2947;
+  }
+  if (x > 2947) {
+    print("f2947 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2948(a, b) {
+  let x = a * 2948 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2948;
+  }
+  if (x > 2948) {
+    print("f2948 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2949(a, b) {
+  let x = a * 2949 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2949;
+  }
+  if (x > 2949) {
+    print("f2949 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2950(a, b) {
+  let x = a * 2950 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2950;
+  }
+  if (x > 2950) {
+    print("f2950 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2951(a, b) {
+  let x = a * 2951 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2951;
+  }
+  if (x > 2951) {
+    print("f2951 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2952(a, b) {
+  let x = a * 2952 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2952;
+  }
+  if (x > 2952) {
+    print("f2952 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2953(a, b) {
+  let x = a * 2953 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2953;
+  }
+  if (x > 2953) {
+    print("f2953 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2954(a, b) {
+  let x = a * 2954 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2954;
+  }
+  if (x > 2954) {
+    print("f2954 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2955(a, b) {
+  let x = a * 2955 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2955;
+  }
+  if (x > 2955) {
+    print("f2955 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2956(a, b) {
+  let x = a * 2956 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2956;
+  }
+  if (x > 2956) {
+    print("f2956 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2957(a, b) {
+  let x = a * 2957 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2957;
+  }
+  if (x > 2957) {
+    print("f2957 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2958(a, b) {
+  let x = a * 2958 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2958;
+  }
+  if (x > 2958) {
+    print("f2958 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2959(a, b) {
+  let x = a * 2959 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2959;
+  }
+  if (x > 2959) {
+    print("f2959 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2960(a, b) {
+  let x = a * 2960 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2960;
+  }
+  if (x > 2960) {
+    print("f2960 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2961(a, b) {
+  let x = a * 2961 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2961;
+  }
+  if (x > 2961) {
+    print("f2961 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2962(a, b) {
+  let x = a * 2962 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2962;
+  }
+  if (x > 2962) {
+    print("f2962 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2963(a, b) {
+  let x = a * 2963 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2963;
+  }
+  if (x > 2963) {
+    print("f2963 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2964(a, b) {
+  let x = a * 2964 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2964;
+  }
+  if (x > 2964) {
+    print("f2964 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2965(a, b) {
+  let x = a * 2965 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2965;
+  }
+  if (x > 2965) {
+    print("f2965 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2966(a, b) {
+  let x = a * 2966 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2966;
+  }
+  if (x > 2966) {
+    print("f2966 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2967(a, b) {
+  let x = a * 2967 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2967;
+  }
+  if (x > 2967) {
+    print("f2967 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2968(a, b) {
+  let x = a * 2968 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2968;
+  }
+  if (x > 2968) {
+    print("f2968 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2969(a, b) {
+  let x = a * 2969 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2969;
+  }
+  if (x > 2969) {
+    print("f2969 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2970(a, b) {
+  let x = a * 2970 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2970;
+  }
+  if (x > 2970) {
+    print("f2970 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2971(a, b) {
+  let x = a * 2971 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2971;
+  }
+  if (x > 2971) {
+    print("f2971 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2972(a, b) {
+  let x = a * 2972 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2972;
+  }
+  if (x > 2972) {
+    print("f2972 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2973(a, b) {
+  let x = a * 2973 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2973;
+  }
+  if (x > 2973) {
+    print("f2973 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2974(a, b) {
+  let x = a * 2974 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2974;
+  }
+  if (x > 2974) {
+    print("f2974 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2975(a, b) {
+  let x = a * 2975 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2975;
+  }
+  if (x > 2975) {
+    print("f2975 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2976(a, b) {
+  let x = a * 2976 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2976;
+  }
+  if (x > 2976) {
+    print("f2976 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2977(a, b) {
+  let x = a * 2977 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2977;
+  }
+  if (x > 2977) {
+    print("f2977 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2978(a, b) {
+  let x = a * 2978 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2978;
+  }
+  if (x > 2978) {
+    print("f2978 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2979(a, b) {
+  let x = a * 2979 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2979;
+  }
+  if (x > 2979) {
+    print("f2979 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2980(a, b) {
+  let x = a * 2980 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2980;
+  }
+  if (x > 2980) {
+    print("f2980 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2981(a, b) {
+  let x = a * 2981 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2981;
+  }
+  if (x > 2981) {
+    print("f2981 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2982(a, b) {
+  let x = a * 2982 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2982;
+  }
+  if (x > 2982) {
+    print("f2982 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2983(a, b) {
+  let x = a * 2983 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2983;
+  }
+  if (x > 2983) {
+    print("f2983 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2984(a, b) {
+  let x = a * 2984 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2984;
+  }
+  if (x > 2984) {
+    print("f2984 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2985(a, b) {
+  let x = a * 2985 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2985;
+  }
+  if (x > 2985) {
+    print("f2985 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2986(a, b) {
+  let x = a * 2986 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2986;
+  }
+  if (x > 2986) {
+    print("f2986 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2987(a, b) {
+  let x = a * 2987 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2987;
+  }
+  if (x > 2987) {
+    print("f2987 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2988(a, b) {
+  let x = a * 2988 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2988;
+  }
+  if (x > 2988) {
+    print("f2988 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2989(a, b) {
+  let x = a * 2989 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2989;
+  }
+  if (x > 2989) {
+    print("f2989 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2990(a, b) {
+  let x = a * 2990 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2990;
+  }
+  if (x > 2990) {
+    print("f2990 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2991(a, b) {
+  let x = a * 2991 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2991;
+  }
+  if (x > 2991) {
+    print("f2991 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2992(a, b) {
+  let x = a * 2992 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2992;
+  }
+  if (x > 2992) {
+    print("f2992 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2993(a, b) {
+  let x = a * 2993 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2993;
+  }
+  if (x > 2993) {
+    print("f2993 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2994(a, b) {
+  let x = a * 2994 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2994;
+  }
+  if (x > 2994) {
+    print("f2994 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2995(a, b) {
+  let x = a * 2995 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2995;
+  }
+  if (x > 2995) {
+    print("f2995 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2996(a, b) {
+  let x = a * 2996 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2996;
+  }
+  if (x > 2996) {
+    print("f2996 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2997(a, b) {
+  let x = a * 2997 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2997;
+  }
+  if (x > 2997) {
+    print("f2997 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2998(a, b) {
+  let x = a * 2998 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2998;
+  }
+  if (x > 2998) {
+    print("f2998 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f2999(a, b) {
+  let x = a * 2999 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 2999;
+  }
+  if (x > 2999) {
+    print("f2999 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3000(a, b) {
+  let x = a * 3000 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3000;
+  }
+  if (x > 3000) {
+    print("f3000 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3001(a, b) {
+  let x = a * 3001 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3001;
+  }
+  if (x > 3001) {
+    print("f3001 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3002(a, b) {
+  let x = a * 3002 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3002;
+  }
+  if (x > 3002) {
+    print("f3002 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3003(a, b) {
+  let x = a * 3003 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3003;
+  }
+  if (x > 3003) {
+    print("f3003 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3004(a, b) {
+  let x = a * 3004 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3004;
+  }
+  if (x > 3004) {
+    print("f3004 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3005(a, b) {
+  let x = a * 3005 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3005;
+  }
+  if (x > 3005) {
+    print("f3005 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3006(a, b) {
+  let x = a * 3006 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3006;
+  }
+  if (x > 3006) {
+    print("f3006 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3007(a, b) {
+  let x = a * 3007 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3007;
+  }
+  if (x > 3007) {
+    print("f3007 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3008(a, b) {
+  let x = a * 3008 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3008;
+  }
+  if (x > 3008) {
+    print("f3008 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3009(a, b) {
+  let x = a * 3009 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3009;
+  }
+  if (x > 3009) {
+    print("f3009 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3010(a, b) {
+  let x = a * 3010 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3010;
+  }
+  if (x > 3010) {
+    print("f3010 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3011(a, b) {
+  let x = a * 3011 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3011;
+  }
+  if (x > 3011) {
+    print("f3011 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3012(a, b) {
+  let x = a * 3012 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3012;
+  }
+  if (x > 3012) {
+    print("f3012 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3013(a, b) {
+  let x = a * 3013 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3013;
+  }
+  if (x > 3013) {
+    print("f3013 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3014(a, b) {
+  let x = a * 3014 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3014;
+  }
+  if (x > 3014) {
+    print("f3014 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3015(a, b) {
+  let x = a * 3015 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3015;
+  }
+  if (x > 3015) {
+    print("f3015 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3016(a, b) {
+  let x = a * 3016 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3016;
+  }
+  if (x > 3016) {
+    print("f3016 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3017(a, b) {
+  let x = a * 3017 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3017;
+  }
+  if (x > 3017) {
+    print("f3017 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3018(a, b) {
+  let x = a * 3018 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3018;
+  }
+  if (x > 3018) {
+    print("f3018 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3019(a, b) {
+  let x = a * 3019 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3019;
+  }
+  if (x > 3019) {
+    print("f3019 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3020(a, b) {
+  let x = a * 3020 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3020;
+  }
+  if (x > 3020) {
+    print("f3020 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3021(a, b) {
+  let x = a * 3021 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3021;
+  }
+  if (x > 3021) {
+    print("f3021 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3022(a, b) {
+  let x = a * 3022 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3022;
+  }
+  if (x > 3022) {
+    print("f3022 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3023(a, b) {
+  let x = a * 3023 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3023;
+  }
+  if (x > 3023) {
+    print("f3023 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3024(a, b) {
+  let x = a * 3024 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3024;
+  }
+  if (x > 3024) {
+    print("f3024 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3025(a, b) {
+  let x = a * 3025 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3025;
+  }
+  if (x > 3025) {
+    print("f3025 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3026(a, b) {
+  let x = a * 3026 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3026;
+  }
+  if (x > 3026) {
+    print("f3026 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3027(a, b) {
+  let x = a * 3027 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3027;
+  }
+  if (x > 3027) {
+    print("f3027 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3028(a, b) {
+  let x = a * 3028 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3028;
+  }
+  if (x > 3028) {
+    print("f3028 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3029(a, b) {
+  let x = a * 3029 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3029;
+  }
+  if (x > 3029) {
+    print("f3029 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3030(a, b) {
+  let x = a * 3030 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3030;
+  }
+  if (x > 3030) {
+    print("f3030 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3031(a, b) {
+  let x = a * 3031 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3031;
+  }
+  if (x > 3031) {
+    print("f3031 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3032(a, b) {
+  let x = a * 3032 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3032;
+  }
+  if (x > 3032) {
+    print("f3032 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3033(a, b) {
+  let x = a * 3033 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3033;
+  }
+  if (x > 3033) {
+    print("f3033 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3034(a, b) {
+  let x = a * 3034 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3034;
+  }
+  if (x > 3034) {
+    print("f3034 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3035(a, b) {
+  let x = a * 3035 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3035;
+  }
+  if (x > 3035) {
+    print("f3035 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3036(a, b) {
+  let x = a * 3036 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3036;
+  }
+  if (x > 3036) {
+    print("f3036 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3037(a, b) {
+  let x = a * 3037 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3037;
+  }
+  if (x > 3037) {
+    print("f3037 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3038(a, b) {
+  let x = a * 3038 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3038;
+  }
+  if (x > 3038) {
+    print("f3038 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3039(a, b) {
+  let x = a * 3039 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3039;
+  }
+  if (x > 3039) {
+    print("f3039 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3040(a, b) {
+  let x = a * 3040 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3040;
+  }
+  if (x > 3040) {
+    print("f3040 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3041(a, b) {
+  let x = a * 3041 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3041;
+  }
+  if (x > 3041) {
+    print("f3041 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3042(a, b) {
+  let x = a * 3042 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3042;
+  }
+  if (x > 3042) {
+    print("f3042 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3043(a, b) {
+  let x = a * 3043 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3043;
+  }
+  if (x > 3043) {
+    print("f3043 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3044(a, b) {
+  let x = a * 3044 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3044;
+  }
+  if (x > 3044) {
+    print("f3044 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3045(a, b) {
+  let x = a * 3045 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3045;
+  }
+  if (x > 3045) {
+    print("f3045 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3046(a, b) {
+  let x = a * 3046 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3046;
+  }
+  if (x > 3046) {
+    print("f3046 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3047(a, b) {
+  let x = a * 3047 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3047;
+  }
+  if (x > 3047) {
+    print("f3047 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3048(a, b) {
+  let x = a * 3048 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3048;
+  }
+  if (x > 3048) {
+    print("f3048 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3049(a, b) {
+  let x = a * 3049 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3049;
+  }
+  if (x > 3049) {
+    print("f3049 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3050(a, b) {
+  let x = a * 3050 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3050;
+  }
+  if (x > 3050) {
+    print("f3050 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3051(a, b) {
+  let x = a * 3051 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3051;
+  }
+  if (x > 3051) {
+    print("f3051 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3052(a, b) {
+  let x = a * 3052 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3052;
+  }
+  if (x > 3052) {
+    print("f3052 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3053(a, b) {
+  let x = a * 3053 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3053;
+  }
+  if (x > 3053) {
+    print("f3053 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3054(a, b) {
+  let x = a * 3054 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3054;
+  }
+  if (x > 3054) {
+    print("f3054 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3055(a, b) {
+  let x = a * 3055 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3055;
+  }
+  if (x > 3055) {
+    print("f3055 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3056(a, b) {
+  let x = a * 3056 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3056;
+  }
+  if (x > 3056) {
+    print("f3056 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3057(a, b) {
+  let x = a * 3057 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3057;
+  }
+  if (x > 3057) {
+    print("f3057 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3058(a, b) {
+  let x = a * 3058 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3058;
+  }
+  if (x > 3058) {
+    print("f3058 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3059(a, b) {
+  let x = a * 3059 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3059;
+  }
+  if (x > 3059) {
+    print("f3059 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3060(a, b) {
+  let x = a * 3060 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3060;
+  }
+  if (x > 3060) {
+    print("f3060 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3061(a, b) {
+  let x = a * 3061 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3061;
+  }
+  if (x > 3061) {
+    print("f3061 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3062(a, b) {
+  let x = a * 3062 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3062;
+  }
+  if (x > 3062) {
+    print("f3062 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3063(a, b) {
+  let x = a * 3063 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3063;
+  }
+  if (x > 3063) {
+    print("f3063 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3064(a, b) {
+  let x = a * 3064 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3064;
+  }
+  if (x > 3064) {
+    print("f3064 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3065(a, b) {
+  let x = a * 3065 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3065;
+  }
+  if (x > 3065) {
+    print("f3065 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3066(a, b) {
+  let x = a * 3066 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3066;
+  }
+  if (x > 3066) {
+    print("f3066 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3067(a, b) {
+  let x = a * 3067 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3067;
+  }
+  if (x > 3067) {
+    print("f3067 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3068(a, b) {
+  let x = a * 3068 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3068;
+  }
+  if (x > 3068) {
+    print("f3068 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3069(a, b) {
+  let x = a * 3069 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3069;
+  }
+  if (x > 3069) {
+    print("f3069 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3070(a, b) {
+  let x = a * 3070 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3070;
+  }
+  if (x > 3070) {
+    print("f3070 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3071(a, b) {
+  let x = a * 3071 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3071;
+  }
+  if (x > 3071) {
+    print("f3071 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3072(a, b) {
+  let x = a * 3072 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3072;
+  }
+  if (x > 3072) {
+    print("f3072 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3073(a, b) {
+  let x = a * 3073 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3073;
+  }
+  if (x > 3073) {
+    print("f3073 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3074(a, b) {
+  let x = a * 3074 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3074;
+  }
+  if (x > 3074) {
+    print("f3074 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3075(a, b) {
+  let x = a * 3075 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3075;
+  }
+  if (x > 3075) {
+    print("f3075 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3076(a, b) {
+  let x = a * 3076 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3076;
+  }
+  if (x > 3076) {
+    print("f3076 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3077(a, b) {
+  let x = a * 3077 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3077;
+  }
+  if (x > 3077) {
+    print("f3077 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3078(a, b) {
+  let x = a * 3078 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3078;
+  }
+  if (x > 3078) {
+    print("f3078 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3079(a, b) {
+  let x = a * 3079 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3079;
+  }
+  if (x > 3079) {
+    print("f3079 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3080(a, b) {
+  let x = a * 3080 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3080;
+  }
+  if (x > 3080) {
+    print("f3080 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3081(a, b) {
+  let x = a * 3081 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3081;
+  }
+  if (x > 3081) {
+    print("f3081 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3082(a, b) {
+  let x = a * 3082 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3082;
+  }
+  if (x > 3082) {
+    print("f3082 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3083(a, b) {
+  let x = a * 3083 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3083;
+  }
+  if (x > 3083) {
+    print("f3083 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3084(a, b) {
+  let x = a * 3084 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3084;
+  }
+  if (x > 3084) {
+    print("f3084 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3085(a, b) {
+  let x = a * 3085 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3085;
+  }
+  if (x > 3085) {
+    print("f3085 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3086(a, b) {
+  let x = a * 3086 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3086;
+  }
+  if (x > 3086) {
+    print("f3086 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3087(a, b) {
+  let x = a * 3087 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3087;
+  }
+  if (x > 3087) {
+    print("f3087 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3088(a, b) {
+  let x = a * 3088 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3088;
+  }
+  if (x > 3088) {
+    print("f3088 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3089(a, b) {
+  let x = a * 3089 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3089;
+  }
+  if (x > 3089) {
+    print("f3089 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3090(a, b) {
+  let x = a * 3090 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3090;
+  }
+  if (x > 3090) {
+    print("f3090 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3091(a, b) {
+  let x = a * 3091 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3091;
+  }
+  if (x > 3091) {
+    print("f3091 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3092(a, b) {
+  let x = a * 3092 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3092;
+  }
+  if (x > 3092) {
+    print("f3092 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3093(a, b) {
+  let x = a * 3093 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3093;
+  }
+  if (x > 3093) {
+    print("f3093 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3094(a, b) {
+  let x = a * 3094 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3094;
+  }
+  if (x > 3094) {
+    print("f3094 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3095(a, b) {
+  let x = a * 3095 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3095;
+  }
+  if (x > 3095) {
+    print("f3095 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3096(a, b) {
+  let x = a * 3096 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3096;
+  }
+  if (x > 3096) {
+    print("f3096 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3097(a, b) {
+  let x = a * 3097 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3097;
+  }
+  if (x > 3097) {
+    print("f3097 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3098(a, b) {
+  let x = a * 3098 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3098;
+  }
+  if (x > 3098) {
+    print("f3098 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3099(a, b) {
+  let x = a * 3099 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3099;
+  }
+  if (x > 3099) {
+    print("f3099 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3100(a, b) {
+  let x = a * 3100 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3100;
+  }
+  if (x > 3100) {
+    print("f3100 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3101(a, b) {
+  let x = a * 3101 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3101;
+  }
+  if (x > 3101) {
+    print("f3101 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3102(a, b) {
+  let x = a * 3102 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3102;
+  }
+  if (x > 3102) {
+    print("f3102 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3103(a, b) {
+  let x = a * 3103 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3103;
+  }
+  if (x > 3103) {
+    print("f3103 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3104(a, b) {
+  let x = a * 3104 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3104;
+  }
+  if (x > 3104) {
+    print("f3104 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3105(a, b) {
+  let x = a * 3105 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3105;
+  }
+  if (x > 3105) {
+    print("f3105 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3106(a, b) {
+  let x = a * 3106 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3106;
+  }
+  if (x > 3106) {
+    print("f3106 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3107(a, b) {
+  let x = a * 3107 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3107;
+  }
+  if (x > 3107) {
+    print("f3107 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3108(a, b) {
+  let x = a * 3108 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3108;
+  }
+  if (x > 3108) {
+    print("f3108 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3109(a, b) {
+  let x = a * 3109 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3109;
+  }
+  if (x > 3109) {
+    print("f3109 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3110(a, b) {
+  let x = a * 3110 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3110;
+  }
+  if (x > 3110) {
+    print("f3110 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3111(a, b) {
+  let x = a * 3111 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3111;
+  }
+  if (x > 3111) {
+    print("f3111 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3112(a, b) {
+  let x = a * 3112 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3112;
+  }
+  if (x > 3112) {
+    print("f3112 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3113(a, b) {
+  let x = a * 3113 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3113;
+  }
+  if (x > 3113) {
+    print("f3113 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3114(a, b) {
+  let x = a * 3114 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3114;
+  }
+  if (x > 3114) {
+    print("f3114 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3115(a, b) {
+  let x = a * 3115 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3115;
+  }
+  if (x > 3115) {
+    print("f3115 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3116(a, b) {
+  let x = a * 3116 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3116;
+  }
+  if (x > 3116) {
+    print("f3116 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3117(a, b) {
+  let x = a * 3117 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3117;
+  }
+  if (x > 3117) {
+    print("f3117 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3118(a, b) {
+  let x = a * 3118 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3118;
+  }
+  if (x > 3118) {
+    print("f3118 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3119(a, b) {
+  let x = a * 3119 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3119;
+  }
+  if (x > 3119) {
+    print("f3119 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3120(a, b) {
+  let x = a * 3120 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3120;
+  }
+  if (x > 3120) {
+    print("f3120 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3121(a, b) {
+  let x = a * 3121 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3121;
+  }
+  if (x > 3121) {
+    print("f3121 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3122(a, b) {
+  let x = a * 3122 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3122;
+  }
+  if (x > 3122) {
+    print("f3122 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3123(a, b) {
+  let x = a * 3123 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3123;
+  }
+  if (x > 3123) {
+    print("f3123 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3124(a, b) {
+  let x = a * 3124 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3124;
+  }
+  if (x > 3124) {
+    print("f3124 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3125(a, b) {
+  let x = a * 3125 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3125;
+  }
+  if (x > 3125) {
+    print("f3125 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3126(a, b) {
+  let x = a * 3126 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3126;
+  }
+  if (x > 3126) {
+    print("f3126 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3127(a, b) {
+  let x = a * 3127 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3127;
+  }
+  if (x > 3127) {
+    print("f3127 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3128(a, b) {
+  let x = a * 3128 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3128;
+  }
+  if (x > 3128) {
+    print("f3128 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3129(a, b) {
+  let x = a * 3129 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3129;
+  }
+  if (x > 3129) {
+    print("f3129 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3130(a, b) {
+  let x = a * 3130 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3130;
+  }
+  if (x > 3130) {
+    print("f3130 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3131(a, b) {
+  let x = a * 3131 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3131;
+  }
+  if (x > 3131) {
+    print("f3131 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3132(a, b) {
+  let x = a * 3132 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3132;
+  }
+  if (x > 3132) {
+    print("f3132 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3133(a, b) {
+  let x = a * 3133 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3133;
+  }
+  if (x > 3133) {
+    print("f3133 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3134(a, b) {
+  let x = a * 3134 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3134;
+  }
+  if (x > 3134) {
+    print("f3134 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3135(a, b) {
+  let x = a * 3135 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3135;
+  }
+  if (x > 3135) {
+    print("f3135 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3136(a, b) {
+  let x = a * 3136 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3136;
+  }
+  if (x > 3136) {
+    print("f3136 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3137(a, b) {
+  let x = a * 3137 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3137;
+  }
+  if (x > 3137) {
+    print("f3137 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3138(a, b) {
+  let x = a * 3138 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3138;
+  }
+  if (x > 3138) {
+    print("f3138 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3139(a, b) {
+  let x = a * 3139 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3139;
+  }
+  if (x > 3139) {
+    print("f3139 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3140(a, b) {
+  let x = a * 3140 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3140;
+  }
+  if (x > 3140) {
+    print("f3140 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3141(a, b) {
+  let x = a * 3141 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3141;
+  }
+  if (x > 3141) {
+    print("f3141 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3142(a, b) {
+  let x = a * 3142 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3142;
+  }
+  if (x > 3142) {
+    print("f3142 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3143(a, b) {
+  let x = a * 3143 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3143;
+  }
+  if (x > 3143) {
+    print("f3143 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3144(a, b) {
+  let x = a * 3144 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3144;
+  }
+  if (x > 3144) {
+    print("f3144 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3145(a, b) {
+  let x = a * 3145 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3145;
+  }
+  if (x > 3145) {
+    print("f3145 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3146(a, b) {
+  let x = a * 3146 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3146;
+  }
+  if (x > 3146) {
+    print("f3146 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3147(a, b) {
+  let x = a * 3147 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3147;
+  }
+  if (x > 3147) {
+    print("f3147 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3148(a, b) {
+  let x = a * 3148 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3148;
+  }
+  if (x > 3148) {
+    print("f3148 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3149(a, b) {
+  let x = a * 3149 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3149;
+  }
+  if (x > 3149) {
+    print("f3149 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3150(a, b) {
+  let x = a * 3150 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3150;
+  }
+  if (x > 3150) {
+    print("f3150 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3151(a, b) {
+  let x = a * 3151 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3151;
+  }
+  if (x > 3151) {
+    print("f3151 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3152(a, b) {
+  let x = a * 3152 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3152;
+  }
+  if (x > 3152) {
+    print("f3152 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3153(a, b) {
+  let x = a * 3153 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3153;
+  }
+  if (x > 3153) {
+    print("f3153 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3154(a, b) {
+  let x = a * 3154 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3154;
+  }
+  if (x > 3154) {
+    print("f3154 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3155(a, b) {
+  let x = a * 3155 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3155;
+  }
+  if (x > 3155) {
+    print("f3155 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3156(a, b) {
+  let x = a * 3156 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3156;
+  }
+  if (x > 3156) {
+    print("f3156 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3157(a, b) {
+  let x = a * 3157 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3157;
+  }
+  if (x > 3157) {
+    print("f3157 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3158(a, b) {
+  let x = a * 3158 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3158;
+  }
+  if (x > 3158) {
+    print("f3158 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3159(a, b) {
+  let x = a * 3159 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3159;
+  }
+  if (x > 3159) {
+    print("f3159 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3160(a, b) {
+  let x = a * 3160 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3160;
+  }
+  if (x > 3160) {
+    print("f3160 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3161(a, b) {
+  let x = a * 3161 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3161;
+  }
+  if (x > 3161) {
+    print("f3161 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3162(a, b) {
+  let x = a * 3162 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3162;
+  }
+  if (x > 3162) {
+    print("f3162 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3163(a, b) {
+  let x = a * 3163 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3163;
+  }
+  if (x > 3163) {
+    print("f3163 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3164(a, b) {
+  let x = a * 3164 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3164;
+  }
+  if (x > 3164) {
+    print("f3164 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3165(a, b) {
+  let x = a * 3165 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3165;
+  }
+  if (x > 3165) {
+    print("f3165 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3166(a, b) {
+  let x = a * 3166 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3166;
+  }
+  if (x > 3166) {
+    print("f3166 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3167(a, b) {
+  let x = a * 3167 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3167;
+  }
+  if (x > 3167) {
+    print("f3167 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3168(a, b) {
+  let x = a * 3168 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3168;
+  }
+  if (x > 3168) {
+    print("f3168 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3169(a, b) {
+  let x = a * 3169 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3169;
+  }
+  if (x > 3169) {
+    print("f3169 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3170(a, b) {
+  let x = a * 3170 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3170;
+  }
+  if (x > 3170) {
+    print("f3170 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3171(a, b) {
+  let x = a * 3171 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3171;
+  }
+  if (x > 3171) {
+    print("f3171 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3172(a, b) {
+  let x = a * 3172 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3172;
+  }
+  if (x > 3172) {
+    print("f3172 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3173(a, b) {
+  let x = a * 3173 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3173;
+  }
+  if (x > 3173) {
+    print("f3173 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3174(a, b) {
+  let x = a * 3174 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3174;
+  }
+  if (x > 3174) {
+    print("f3174 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3175(a, b) {
+  let x = a * 3175 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3175;
+  }
+  if (x > 3175) {
+    print("f3175 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3176(a, b) {
+  let x = a * 3176 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3176;
+  }
+  if (x > 3176) {
+    print("f3176 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3177(a, b) {
+  let x = a * 3177 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3177;
+  }
+  if (x > 3177) {
+    print("f3177 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3178(a, b) {
+  let x = a * 3178 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3178;
+  }
+  if (x > 3178) {
+    print("f3178 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3179(a, b) {
+  let x = a * 3179 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3179;
+  }
+  if (x > 3179) {
+    print("f3179 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3180(a, b) {
+  let x = a * 3180 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3180;
+  }
+  if (x > 3180) {
+    print("f3180 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3181(a, b) {
+  let x = a * 3181 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3181;
+  }
+  if (x > 3181) {
+    print("f3181 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3182(a, b) {
+  let x = a * 3182 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3182;
+  }
+  if (x > 3182) {
+    print("f3182 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3183(a, b) {
+  let x = a * 3183 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3183;
+  }
+  if (x > 3183) {
+    print("f3183 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3184(a, b) {
+  let x = a * 3184 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3184;
+  }
+  if (x > 3184) {
+    print("f3184 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3185(a, b) {
+  let x = a * 3185 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3185;
+  }
+  if (x > 3185) {
+    print("f3185 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3186(a, b) {
+  let x = a * 3186 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3186;
+  }
+  if (x > 3186) {
+    print("f3186 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3187(a, b) {
+  let x = a * 3187 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3187;
+  }
+  if (x > 3187) {
+    print("f3187 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3188(a, b) {
+  let x = a * 3188 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3188;
+  }
+  if (x > 3188) {
+    print("f3188 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3189(a, b) {
+  let x = a * 3189 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3189;
+  }
+  if (x > 3189) {
+    print("f3189 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3190(a, b) {
+  let x = a * 3190 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3190;
+  }
+  if (x > 3190) {
+    print("f3190 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3191(a, b) {
+  let x = a * 3191 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3191;
+  }
+  if (x > 3191) {
+    print("f3191 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3192(a, b) {
+  let x = a * 3192 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3192;
+  }
+  if (x > 3192) {
+    print("f3192 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3193(a, b) {
+  let x = a * 3193 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3193;
+  }
+  if (x > 3193) {
+    print("f3193 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3194(a, b) {
+  let x = a * 3194 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3194;
+  }
+  if (x > 3194) {
+    print("f3194 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3195(a, b) {
+  let x = a * 3195 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3195;
+  }
+  if (x > 3195) {
+    print("f3195 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3196(a, b) {
+  let x = a * 3196 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3196;
+  }
+  if (x > 3196) {
+    print("f3196 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3197(a, b) {
+  let x = a * 3197 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3197;
+  }
+  if (x > 3197) {
+    print("f3197 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3198(a, b) {
+  let x = a * 3198 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3198;
+  }
+  if (x > 3198) {
+    print("f3198 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3199(a, b) {
+  let x = a * 3199 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3199;
+  }
+  if (x > 3199) {
+    print("f3199 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3200(a, b) {
+  let x = a * 3200 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3200;
+  }
+  if (x > 3200) {
+    print("f3200 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3201(a, b) {
+  let x = a * 3201 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3201;
+  }
+  if (x > 3201) {
+    print("f3201 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3202(a, b) {
+  let x = a * 3202 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3202;
+  }
+  if (x > 3202) {
+    print("f3202 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3203(a, b) {
+  let x = a * 3203 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3203;
+  }
+  if (x > 3203) {
+    print("f3203 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3204(a, b) {
+  let x = a * 3204 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3204;
+  }
+  if (x > 3204) {
+    print("f3204 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3205(a, b) {
+  let x = a * 3205 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3205;
+  }
+  if (x > 3205) {
+    print("f3205 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3206(a, b) {
+  let x = a * 3206 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3206;
+  }
+  if (x > 3206) {
+    print("f3206 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3207(a, b) {
+  let x = a * 3207 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3207;
+  }
+  if (x > 3207) {
+    print("f3207 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3208(a, b) {
+  let x = a * 3208 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3208;
+  }
+  if (x > 3208) {
+    print("f3208 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3209(a, b) {
+  let x = a * 3209 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3209;
+  }
+  if (x > 3209) {
+    print("f3209 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3210(a, b) {
+  let x = a * 3210 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3210;
+  }
+  if (x > 3210) {
+    print("f3210 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3211(a, b) {
+  let x = a * 3211 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3211;
+  }
+  if (x > 3211) {
+    print("f3211 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3212(a, b) {
+  let x = a * 3212 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3212;
+  }
+  if (x > 3212) {
+    print("f3212 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3213(a, b) {
+  let x = a * 3213 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3213;
+  }
+  if (x > 3213) {
+    print("f3213 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3214(a, b) {
+  let x = a * 3214 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3214;
+  }
+  if (x > 3214) {
+    print("f3214 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3215(a, b) {
+  let x = a * 3215 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3215;
+  }
+  if (x > 3215) {
+    print("f3215 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3216(a, b) {
+  let x = a * 3216 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3216;
+  }
+  if (x > 3216) {
+    print("f3216 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3217(a, b) {
+  let x = a * 3217 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3217;
+  }
+  if (x > 3217) {
+    print("f3217 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3218(a, b) {
+  let x = a * 3218 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3218;
+  }
+  if (x > 3218) {
+    print("f3218 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3219(a, b) {
+  let x = a * 3219 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3219;
+  }
+  if (x > 3219) {
+    print("f3219 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3220(a, b) {
+  let x = a * 3220 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3220;
+  }
+  if (x > 3220) {
+    print("f3220 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3221(a, b) {
+  let x = a * 3221 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3221;
+  }
+  if (x > 3221) {
+    print("f3221 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3222(a, b) {
+  let x = a * 3222 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3222;
+  }
+  if (x > 3222) {
+    print("f3222 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3223(a, b) {
+  let x = a * 3223 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3223;
+  }
+  if (x > 3223) {
+    print("f3223 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3224(a, b) {
+  let x = a * 3224 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3224;
+  }
+  if (x > 3224) {
+    print("f3224 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3225(a, b) {
+  let x = a * 3225 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3225;
+  }
+  if (x > 3225) {
+    print("f3225 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3226(a, b) {
+  let x = a * 3226 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3226;
+  }
+  if (x > 3226) {
+    print("f3226 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3227(a, b) {
+  let x = a * 3227 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3227;
+  }
+  if (x > 3227) {
+    print("f3227 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3228(a, b) {
+  let x = a * 3228 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3228;
+  }
+  if (x > 3228) {
+    print("f3228 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3229(a, b) {
+  let x = a * 3229 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3229;
+  }
+  if (x > 3229) {
+    print("f3229 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3230(a, b) {
+  let x = a * 3230 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3230;
+  }
+  if (x > 3230) {
+    print("f3230 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3231(a, b) {
+  let x = a * 3231 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3231;
+  }
+  if (x > 3231) {
+    print("f3231 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3232(a, b) {
+  let x = a * 3232 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3232;
+  }
+  if (x > 3232) {
+    print("f3232 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3233(a, b) {
+  let x = a * 3233 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3233;
+  }
+  if (x > 3233) {
+    print("f3233 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3234(a, b) {
+  let x = a * 3234 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3234;
+  }
+  if (x > 3234) {
+    print("f3234 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3235(a, b) {
+  let x = a * 3235 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3235;
+  }
+  if (x > 3235) {
+    print("f3235 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3236(a, b) {
+  let x = a * 3236 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3236;
+  }
+  if (x > 3236) {
+    print("f3236 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3237(a, b) {
+  let x = a * 3237 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3237;
+  }
+  if (x > 3237) {
+    print("f3237 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3238(a, b) {
+  let x = a * 3238 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3238;
+  }
+  if (x > 3238) {
+    print("f3238 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3239(a, b) {
+  let x = a * 3239 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3239;
+  }
+  if (x > 3239) {
+    print("f3239 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3240(a, b) {
+  let x = a * 3240 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3240;
+  }
+  if (x > 3240) {
+    print("f3240 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3241(a, b) {
+  let x = a * 3241 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3241;
+  }
+  if (x > 3241) {
+    print("f3241 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3242(a, b) {
+  let x = a * 3242 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3242;
+  }
+  if (x > 3242) {
+    print("f3242 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3243(a, b) {
+  let x = a * 3243 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3243;
+  }
+  if (x > 3243) {
+    print("f3243 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3244(a, b) {
+  let x = a * 3244 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3244;
+  }
+  if (x > 3244) {
+    print("f3244 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3245(a, b) {
+  let x = a * 3245 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3245;
+  }
+  if (x > 3245) {
+    print("f3245 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3246(a, b) {
+  let x = a * 3246 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3246;
+  }
+  if (x > 3246) {
+    print("f3246 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3247(a, b) {
+  let x = a * 3247 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3247;
+  }
+  if (x > 3247) {
+    print("f3247 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3248(a, b) {
+  let x = a * 3248 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3248;
+  }
+  if (x > 3248) {
+    print("f3248 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3249(a, b) {
+  let x = a * 3249 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3249;
+  }
+  if (x > 3249) {
+    print("f3249 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3250(a, b) {
+  let x = a * 3250 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3250;
+  }
+  if (x > 3250) {
+    print("f3250 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3251(a, b) {
+  let x = a * 3251 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3251;
+  }
+  if (x > 3251) {
+    print("f3251 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3252(a, b) {
+  let x = a * 3252 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3252;
+  }
+  if (x > 3252) {
+    print("f3252 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3253(a, b) {
+  let x = a * 3253 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3253;
+  }
+  if (x > 3253) {
+    print("f3253 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3254(a, b) {
+  let x = a * 3254 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3254;
+  }
+  if (x > 3254) {
+    print("f3254 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3255(a, b) {
+  let x = a * 3255 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3255;
+  }
+  if (x > 3255) {
+    print("f3255 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3256(a, b) {
+  let x = a * 3256 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3256;
+  }
+  if (x > 3256) {
+    print("f3256 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3257(a, b) {
+  let x = a * 3257 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3257;
+  }
+  if (x > 3257) {
+    print("f3257 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3258(a, b) {
+  let x = a * 3258 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3258;
+  }
+  if (x > 3258) {
+    print("f3258 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3259(a, b) {
+  let x = a * 3259 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3259;
+  }
+  if (x > 3259) {
+    print("f3259 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3260(a, b) {
+  let x = a * 3260 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3260;
+  }
+  if (x > 3260) {
+    print("f3260 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3261(a, b) {
+  let x = a * 3261 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3261;
+  }
+  if (x > 3261) {
+    print("f3261 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3262(a, b) {
+  let x = a * 3262 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3262;
+  }
+  if (x > 3262) {
+    print("f3262 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3263(a, b) {
+  let x = a * 3263 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3263;
+  }
+  if (x > 3263) {
+    print("f3263 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3264(a, b) {
+  let x = a * 3264 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3264;
+  }
+  if (x > 3264) {
+    print("f3264 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3265(a, b) {
+  let x = a * 3265 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3265;
+  }
+  if (x > 3265) {
+    print("f3265 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3266(a, b) {
+  let x = a * 3266 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3266;
+  }
+  if (x > 3266) {
+    print("f3266 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3267(a, b) {
+  let x = a * 3267 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3267;
+  }
+  if (x > 3267) {
+    print("f3267 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3268(a, b) {
+  let x = a * 3268 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3268;
+  }
+  if (x > 3268) {
+    print("f3268 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3269(a, b) {
+  let x = a * 3269 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3269;
+  }
+  if (x > 3269) {
+    print("f3269 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3270(a, b) {
+  let x = a * 3270 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3270;
+  }
+  if (x > 3270) {
+    print("f3270 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3271(a, b) {
+  let x = a * 3271 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3271;
+  }
+  if (x > 3271) {
+    print("f3271 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3272(a, b) {
+  let x = a * 3272 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3272;
+  }
+  if (x > 3272) {
+    print("f3272 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3273(a, b) {
+  let x = a * 3273 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3273;
+  }
+  if (x > 3273) {
+    print("f3273 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3274(a, b) {
+  let x = a * 3274 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3274;
+  }
+  if (x > 3274) {
+    print("f3274 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3275(a, b) {
+  let x = a * 3275 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3275;
+  }
+  if (x > 3275) {
+    print("f3275 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3276(a, b) {
+  let x = a * 3276 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3276;
+  }
+  if (x > 3276) {
+    print("f3276 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3277(a, b) {
+  let x = a * 3277 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3277;
+  }
+  if (x > 3277) {
+    print("f3277 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3278(a, b) {
+  let x = a * 3278 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3278;
+  }
+  if (x > 3278) {
+    print("f3278 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3279(a, b) {
+  let x = a * 3279 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3279;
+  }
+  if (x > 3279) {
+    print("f3279 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3280(a, b) {
+  let x = a * 3280 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3280;
+  }
+  if (x > 3280) {
+    print("f3280 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3281(a, b) {
+  let x = a * 3281 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3281;
+  }
+  if (x > 3281) {
+    print("f3281 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3282(a, b) {
+  let x = a * 3282 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3282;
+  }
+  if (x > 3282) {
+    print("f3282 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3283(a, b) {
+  let x = a * 3283 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3283;
+  }
+  if (x > 3283) {
+    print("f3283 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3284(a, b) {
+  let x = a * 3284 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3284;
+  }
+  if (x > 3284) {
+    print("f3284 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3285(a, b) {
+  let x = a * 3285 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3285;
+  }
+  if (x > 3285) {
+    print("f3285 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3286(a, b) {
+  let x = a * 3286 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3286;
+  }
+  if (x > 3286) {
+    print("f3286 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3287(a, b) {
+  let x = a * 3287 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3287;
+  }
+  if (x > 3287) {
+    print("f3287 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3288(a, b) {
+  let x = a * 3288 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3288;
+  }
+  if (x > 3288) {
+    print("f3288 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3289(a, b) {
+  let x = a * 3289 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3289;
+  }
+  if (x > 3289) {
+    print("f3289 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3290(a, b) {
+  let x = a * 3290 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3290;
+  }
+  if (x > 3290) {
+    print("f3290 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3291(a, b) {
+  let x = a * 3291 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3291;
+  }
+  if (x > 3291) {
+    print("f3291 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3292(a, b) {
+  let x = a * 3292 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3292;
+  }
+  if (x > 3292) {
+    print("f3292 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3293(a, b) {
+  let x = a * 3293 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3293;
+  }
+  if (x > 3293) {
+    print("f3293 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3294(a, b) {
+  let x = a * 3294 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3294;
+  }
+  if (x > 3294) {
+    print("f3294 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3295(a, b) {
+  let x = a * 3295 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3295;
+  }
+  if (x > 3295) {
+    print("f3295 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3296(a, b) {
+  let x = a * 3296 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3296;
+  }
+  if (x > 3296) {
+    print("f3296 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3297(a, b) {
+  let x = a * 3297 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3297;
+  }
+  if (x > 3297) {
+    print("f3297 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3298(a, b) {
+  let x = a * 3298 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3298;
+  }
+  if (x > 3298) {
+    print("f3298 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3299(a, b) {
+  let x = a * 3299 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3299;
+  }
+  if (x > 3299) {
+    print("f3299 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3300(a, b) {
+  let x = a * 3300 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3300;
+  }
+  if (x > 3300) {
+    print("f3300 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3301(a, b) {
+  let x = a * 3301 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3301;
+  }
+  if (x > 3301) {
+    print("f3301 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3302(a, b) {
+  let x = a * 3302 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3302;
+  }
+  if (x > 3302) {
+    print("f3302 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3303(a, b) {
+  let x = a * 3303 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3303;
+  }
+  if (x > 3303) {
+    print("f3303 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3304(a, b) {
+  let x = a * 3304 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3304;
+  }
+  if (x > 3304) {
+    print("f3304 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3305(a, b) {
+  let x = a * 3305 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3305;
+  }
+  if (x > 3305) {
+    print("f3305 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3306(a, b) {
+  let x = a * 3306 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3306;
+  }
+  if (x > 3306) {
+    print("f3306 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3307(a, b) {
+  let x = a * 3307 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3307;
+  }
+  if (x > 3307) {
+    print("f3307 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3308(a, b) {
+  let x = a * 3308 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3308;
+  }
+  if (x > 3308) {
+    print("f3308 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3309(a, b) {
+  let x = a * 3309 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3309;
+  }
+  if (x > 3309) {
+    print("f3309 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3310(a, b) {
+  let x = a * 3310 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3310;
+  }
+  if (x > 3310) {
+    print("f3310 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3311(a, b) {
+  let x = a * 3311 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3311;
+  }
+  if (x > 3311) {
+    print("f3311 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3312(a, b) {
+  let x = a * 3312 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3312;
+  }
+  if (x > 3312) {
+    print("f3312 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3313(a, b) {
+  let x = a * 3313 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3313;
+  }
+  if (x > 3313) {
+    print("f3313 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3314(a, b) {
+  let x = a * 3314 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3314;
+  }
+  if (x > 3314) {
+    print("f3314 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3315(a, b) {
+  let x = a * 3315 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3315;
+  }
+  if (x > 3315) {
+    print("f3315 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3316(a, b) {
+  let x = a * 3316 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3316;
+  }
+  if (x > 3316) {
+    print("f3316 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3317(a, b) {
+  let x = a * 3317 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3317;
+  }
+  if (x > 3317) {
+    print("f3317 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3318(a, b) {
+  let x = a * 3318 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3318;
+  }
+  if (x > 3318) {
+    print("f3318 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3319(a, b) {
+  let x = a * 3319 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3319;
+  }
+  if (x > 3319) {
+    print("f3319 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3320(a, b) {
+  let x = a * 3320 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3320;
+  }
+  if (x > 3320) {
+    print("f3320 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3321(a, b) {
+  let x = a * 3321 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3321;
+  }
+  if (x > 3321) {
+    print("f3321 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3322(a, b) {
+  let x = a * 3322 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3322;
+  }
+  if (x > 3322) {
+    print("f3322 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3323(a, b) {
+  let x = a * 3323 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3323;
+  }
+  if (x > 3323) {
+    print("f3323 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3324(a, b) {
+  let x = a * 3324 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3324;
+  }
+  if (x > 3324) {
+    print("f3324 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3325(a, b) {
+  let x = a * 3325 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3325;
+  }
+  if (x > 3325) {
+    print("f3325 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3326(a, b) {
+  let x = a * 3326 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3326;
+  }
+  if (x > 3326) {
+    print("f3326 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3327(a, b) {
+  let x = a * 3327 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3327;
+  }
+  if (x > 3327) {
+    print("f3327 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3328(a, b) {
+  let x = a * 3328 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3328;
+  }
+  if (x > 3328) {
+    print("f3328 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3329(a, b) {
+  let x = a * 3329 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3329;
+  }
+  if (x > 3329) {
+    print("f3329 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3330(a, b) {
+  let x = a * 3330 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3330;
+  }
+  if (x > 3330) {
+    print("f3330 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3331(a, b) {
+  let x = a * 3331 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3331;
+  }
+  if (x > 3331) {
+    print("f3331 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3332(a, b) {
+  let x = a * 3332 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3332;
+  }
+  if (x > 3332) {
+    print("f3332 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3333(a, b) {
+  let x = a * 3333 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3333;
+  }
+  if (x > 3333) {
+    print("f3333 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3334(a, b) {
+  let x = a * 3334 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3334;
+  }
+  if (x > 3334) {
+    print("f3334 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3335(a, b) {
+  let x = a * 3335 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3335;
+  }
+  if (x > 3335) {
+    print("f3335 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3336(a, b) {
+  let x = a * 3336 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3336;
+  }
+  if (x > 3336) {
+    print("f3336 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3337(a, b) {
+  let x = a * 3337 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3337;
+  }
+  if (x > 3337) {
+    print("f3337 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3338(a, b) {
+  let x = a * 3338 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3338;
+  }
+  if (x > 3338) {
+    print("f3338 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3339(a, b) {
+  let x = a * 3339 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3339;
+  }
+  if (x > 3339) {
+    print("f3339 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3340(a, b) {
+  let x = a * 3340 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3340;
+  }
+  if (x > 3340) {
+    print("f3340 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3341(a, b) {
+  let x = a * 3341 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3341;
+  }
+  if (x > 3341) {
+    print("f3341 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3342(a, b) {
+  let x = a * 3342 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3342;
+  }
+  if (x > 3342) {
+    print("f3342 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3343(a, b) {
+  let x = a * 3343 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3343;
+  }
+  if (x > 3343) {
+    print("f3343 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3344(a, b) {
+  let x = a * 3344 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3344;
+  }
+  if (x > 3344) {
+    print("f3344 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3345(a, b) {
+  let x = a * 3345 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3345;
+  }
+  if (x > 3345) {
+    print("f3345 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3346(a, b) {
+  let x = a * 3346 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3346;
+  }
+  if (x > 3346) {
+    print("f3346 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3347(a, b) {
+  let x = a * 3347 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3347;
+  }
+  if (x > 3347) {
+    print("f3347 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3348(a, b) {
+  let x = a * 3348 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3348;
+  }
+  if (x > 3348) {
+    print("f3348 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3349(a, b) {
+  let x = a * 3349 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3349;
+  }
+  if (x > 3349) {
+    print("f3349 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3350(a, b) {
+  let x = a * 3350 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3350;
+  }
+  if (x > 3350) {
+    print("f3350 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3351(a, b) {
+  let x = a * 3351 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3351;
+  }
+  if (x > 3351) {
+    print("f3351 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3352(a, b) {
+  let x = a * 3352 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3352;
+  }
+  if (x > 3352) {
+    print("f3352 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3353(a, b) {
+  let x = a * 3353 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3353;
+  }
+  if (x > 3353) {
+    print("f3353 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3354(a, b) {
+  let x = a * 3354 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3354;
+  }
+  if (x > 3354) {
+    print("f3354 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3355(a, b) {
+  let x = a * 3355 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3355;
+  }
+  if (x > 3355) {
+    print("f3355 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3356(a, b) {
+  let x = a * 3356 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3356;
+  }
+  if (x > 3356) {
+    print("f3356 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3357(a, b) {
+  let x = a * 3357 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3357;
+  }
+  if (x > 3357) {
+    print("f3357 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3358(a, b) {
+  let x = a * 3358 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3358;
+  }
+  if (x > 3358) {
+    print("f3358 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3359(a, b) {
+  let x = a * 3359 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3359;
+  }
+  if (x > 3359) {
+    print("f3359 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3360(a, b) {
+  let x = a * 3360 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3360;
+  }
+  if (x > 3360) {
+    print("f3360 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3361(a, b) {
+  let x = a * 3361 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3361;
+  }
+  if (x > 3361) {
+    print("f3361 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3362(a, b) {
+  let x = a * 3362 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3362;
+  }
+  if (x > 3362) {
+    print("f3362 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3363(a, b) {
+  let x = a * 3363 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3363;
+  }
+  if (x > 3363) {
+    print("f3363 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3364(a, b) {
+  let x = a * 3364 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3364;
+  }
+  if (x > 3364) {
+    print("f3364 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3365(a, b) {
+  let x = a * 3365 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3365;
+  }
+  if (x > 3365) {
+    print("f3365 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3366(a, b) {
+  let x = a * 3366 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3366;
+  }
+  if (x > 3366) {
+    print("f3366 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3367(a, b) {
+  let x = a * 3367 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3367;
+  }
+  if (x > 3367) {
+    print("f3367 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3368(a, b) {
+  let x = a * 3368 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3368;
+  }
+  if (x > 3368) {
+    print("f3368 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3369(a, b) {
+  let x = a * 3369 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3369;
+  }
+  if (x > 3369) {
+    print("f3369 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3370(a, b) {
+  let x = a * 3370 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3370;
+  }
+  if (x > 3370) {
+    print("f3370 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3371(a, b) {
+  let x = a * 3371 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3371;
+  }
+  if (x > 3371) {
+    print("f3371 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3372(a, b) {
+  let x = a * 3372 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3372;
+  }
+  if (x > 3372) {
+    print("f3372 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3373(a, b) {
+  let x = a * 3373 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3373;
+  }
+  if (x > 3373) {
+    print("f3373 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3374(a, b) {
+  let x = a * 3374 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3374;
+  }
+  if (x > 3374) {
+    print("f3374 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3375(a, b) {
+  let x = a * 3375 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3375;
+  }
+  if (x > 3375) {
+    print("f3375 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3376(a, b) {
+  let x = a * 3376 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3376;
+  }
+  if (x > 3376) {
+    print("f3376 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3377(a, b) {
+  let x = a * 3377 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3377;
+  }
+  if (x > 3377) {
+    print("f3377 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3378(a, b) {
+  let x = a * 3378 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3378;
+  }
+  if (x > 3378) {
+    print("f3378 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3379(a, b) {
+  let x = a * 3379 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3379;
+  }
+  if (x > 3379) {
+    print("f3379 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3380(a, b) {
+  let x = a * 3380 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3380;
+  }
+  if (x > 3380) {
+    print("f3380 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3381(a, b) {
+  let x = a * 3381 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3381;
+  }
+  if (x > 3381) {
+    print("f3381 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3382(a, b) {
+  let x = a * 3382 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3382;
+  }
+  if (x > 3382) {
+    print("f3382 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3383(a, b) {
+  let x = a * 3383 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3383;
+  }
+  if (x > 3383) {
+    print("f3383 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3384(a, b) {
+  let x = a * 3384 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3384;
+  }
+  if (x > 3384) {
+    print("f3384 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3385(a, b) {
+  let x = a * 3385 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3385;
+  }
+  if (x > 3385) {
+    print("f3385 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3386(a, b) {
+  let x = a * 3386 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3386;
+  }
+  if (x > 3386) {
+    print("f3386 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3387(a, b) {
+  let x = a * 3387 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3387;
+  }
+  if (x > 3387) {
+    print("f3387 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3388(a, b) {
+  let x = a * 3388 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3388;
+  }
+  if (x > 3388) {
+    print("f3388 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3389(a, b) {
+  let x = a * 3389 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3389;
+  }
+  if (x > 3389) {
+    print("f3389 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3390(a, b) {
+  let x = a * 3390 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3390;
+  }
+  if (x > 3390) {
+    print("f3390 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3391(a, b) {
+  let x = a * 3391 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3391;
+  }
+  if (x > 3391) {
+    print("f3391 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3392(a, b) {
+  let x = a * 3392 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3392;
+  }
+  if (x > 3392) {
+    print("f3392 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3393(a, b) {
+  let x = a * 3393 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3393;
+  }
+  if (x > 3393) {
+    print("f3393 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3394(a, b) {
+  let x = a * 3394 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3394;
+  }
+  if (x > 3394) {
+    print("f3394 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3395(a, b) {
+  let x = a * 3395 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3395;
+  }
+  if (x > 3395) {
+    print("f3395 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3396(a, b) {
+  let x = a * 3396 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3396;
+  }
+  if (x > 3396) {
+    print("f3396 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3397(a, b) {
+  let x = a * 3397 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3397;
+  }
+  if (x > 3397) {
+    print("f3397 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3398(a, b) {
+  let x = a * 3398 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3398;
+  }
+  if (x > 3398) {
+    print("f3398 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3399(a, b) {
+  let x = a * 3399 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3399;
+  }
+  if (x > 3399) {
+    print("f3399 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3400(a, b) {
+  let x = a * 3400 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3400;
+  }
+  if (x > 3400) {
+    print("f3400 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3401(a, b) {
+  let x = a * 3401 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3401;
+  }
+  if (x > 3401) {
+    print("f3401 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3402(a, b) {
+  let x = a * 3402 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3402;
+  }
+  if (x > 3402) {
+    print("f3402 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3403(a, b) {
+  let x = a * 3403 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3403;
+  }
+  if (x > 3403) {
+    print("f3403 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3404(a, b) {
+  let x = a * 3404 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3404;
+  }
+  if (x > 3404) {
+    print("f3404 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3405(a, b) {
+  let x = a * 3405 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3405;
+  }
+  if (x > 3405) {
+    print("f3405 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3406(a, b) {
+  let x = a * 3406 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3406;
+  }
+  if (x > 3406) {
+    print("f3406 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3407(a, b) {
+  let x = a * 3407 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3407;
+  }
+  if (x > 3407) {
+    print("f3407 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3408(a, b) {
+  let x = a * 3408 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3408;
+  }
+  if (x > 3408) {
+    print("f3408 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3409(a, b) {
+  let x = a * 3409 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3409;
+  }
+  if (x > 3409) {
+    print("f3409 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3410(a, b) {
+  let x = a * 3410 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3410;
+  }
+  if (x > 3410) {
+    print("f3410 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3411(a, b) {
+  let x = a * 3411 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3411;
+  }
+  if (x > 3411) {
+    print("f3411 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3412(a, b) {
+  let x = a * 3412 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3412;
+  }
+  if (x > 3412) {
+    print("f3412 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3413(a, b) {
+  let x = a * 3413 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3413;
+  }
+  if (x > 3413) {
+    print("f3413 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3414(a, b) {
+  let x = a * 3414 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3414;
+  }
+  if (x > 3414) {
+    print("f3414 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3415(a, b) {
+  let x = a * 3415 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3415;
+  }
+  if (x > 3415) {
+    print("f3415 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3416(a, b) {
+  let x = a * 3416 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3416;
+  }
+  if (x > 3416) {
+    print("f3416 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3417(a, b) {
+  let x = a * 3417 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3417;
+  }
+  if (x > 3417) {
+    print("f3417 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3418(a, b) {
+  let x = a * 3418 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3418;
+  }
+  if (x > 3418) {
+    print("f3418 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3419(a, b) {
+  let x = a * 3419 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3419;
+  }
+  if (x > 3419) {
+    print("f3419 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3420(a, b) {
+  let x = a * 3420 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3420;
+  }
+  if (x > 3420) {
+    print("f3420 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3421(a, b) {
+  let x = a * 3421 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3421;
+  }
+  if (x > 3421) {
+    print("f3421 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3422(a, b) {
+  let x = a * 3422 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3422;
+  }
+  if (x > 3422) {
+    print("f3422 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3423(a, b) {
+  let x = a * 3423 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3423;
+  }
+  if (x > 3423) {
+    print("f3423 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3424(a, b) {
+  let x = a * 3424 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3424;
+  }
+  if (x > 3424) {
+    print("f3424 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3425(a, b) {
+  let x = a * 3425 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3425;
+  }
+  if (x > 3425) {
+    print("f3425 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3426(a, b) {
+  let x = a * 3426 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3426;
+  }
+  if (x > 3426) {
+    print("f3426 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3427(a, b) {
+  let x = a * 3427 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3427;
+  }
+  if (x > 3427) {
+    print("f3427 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3428(a, b) {
+  let x = a * 3428 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3428;
+  }
+  if (x > 3428) {
+    print("f3428 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3429(a, b) {
+  let x = a * 3429 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3429;
+  }
+  if (x > 3429) {
+    print("f3429 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3430(a, b) {
+  let x = a * 3430 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3430;
+  }
+  if (x > 3430) {
+    print("f3430 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3431(a, b) {
+  let x = a * 3431 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3431;
+  }
+  if (x > 3431) {
+    print("f3431 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3432(a, b) {
+  let x = a * 3432 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3432;
+  }
+  if (x > 3432) {
+    print("f3432 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3433(a, b) {
+  let x = a * 3433 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3433;
+  }
+  if (x > 3433) {
+    print("f3433 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3434(a, b) {
+  let x = a * 3434 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3434;
+  }
+  if (x > 3434) {
+    print("f3434 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3435(a, b) {
+  let x = a * 3435 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3435;
+  }
+  if (x > 3435) {
+    print("f3435 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3436(a, b) {
+  let x = a * 3436 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3436;
+  }
+  if (x > 3436) {
+    print("f3436 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3437(a, b) {
+  let x = a * 3437 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3437;
+  }
+  if (x > 3437) {
+    print("f3437 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3438(a, b) {
+  let x = a * 3438 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3438;
+  }
+  if (x > 3438) {
+    print("f3438 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3439(a, b) {
+  let x = a * 3439 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3439;
+  }
+  if (x > 3439) {
+    print("f3439 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3440(a, b) {
+  let x = a * 3440 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3440;
+  }
+  if (x > 3440) {
+    print("f3440 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3441(a, b) {
+  let x = a * 3441 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3441;
+  }
+  if (x > 3441) {
+    print("f3441 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3442(a, b) {
+  let x = a * 3442 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3442;
+  }
+  if (x > 3442) {
+    print("f3442 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3443(a, b) {
+  let x = a * 3443 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3443;
+  }
+  if (x > 3443) {
+    print("f3443 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3444(a, b) {
+  let x = a * 3444 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3444;
+  }
+  if (x > 3444) {
+    print("f3444 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3445(a, b) {
+  let x = a * 3445 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3445;
+  }
+  if (x > 3445) {
+    print("f3445 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3446(a, b) {
+  let x = a * 3446 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3446;
+  }
+  if (x > 3446) {
+    print("f3446 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3447(a, b) {
+  let x = a * 3447 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3447;
+  }
+  if (x > 3447) {
+    print("f3447 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3448(a, b) {
+  let x = a * 3448 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3448;
+  }
+  if (x > 3448) {
+    print("f3448 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3449(a, b) {
+  let x = a * 3449 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3449;
+  }
+  if (x > 3449) {
+    print("f3449 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3450(a, b) {
+  let x = a * 3450 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3450;
+  }
+  if (x > 3450) {
+    print("f3450 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3451(a, b) {
+  let x = a * 3451 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3451;
+  }
+  if (x > 3451) {
+    print("f3451 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3452(a, b) {
+  let x = a * 3452 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3452;
+  }
+  if (x > 3452) {
+    print("f3452 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3453(a, b) {
+  let x = a * 3453 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3453;
+  }
+  if (x > 3453) {
+    print("f3453 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3454(a, b) {
+  let x = a * 3454 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3454;
+  }
+  if (x > 3454) {
+    print("f3454 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3455(a, b) {
+  let x = a * 3455 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3455;
+  }
+  if (x > 3455) {
+    print("f3455 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3456(a, b) {
+  let x = a * 3456 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3456;
+  }
+  if (x > 3456) {
+    print("f3456 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3457(a, b) {
+  let x = a * 3457 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3457;
+  }
+  if (x > 3457) {
+    print("f3457 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3458(a, b) {
+  let x = a * 3458 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3458;
+  }
+  if (x > 3458) {
+    print("f3458 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3459(a, b) {
+  let x = a * 3459 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3459;
+  }
+  if (x > 3459) {
+    print("f3459 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3460(a, b) {
+  let x = a * 3460 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3460;
+  }
+  if (x > 3460) {
+    print("f3460 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3461(a, b) {
+  let x = a * 3461 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3461;
+  }
+  if (x > 3461) {
+    print("f3461 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3462(a, b) {
+  let x = a * 3462 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3462;
+  }
+  if (x > 3462) {
+    print("f3462 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3463(a, b) {
+  let x = a * 3463 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3463;
+  }
+  if (x > 3463) {
+    print("f3463 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3464(a, b) {
+  let x = a * 3464 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3464;
+  }
+  if (x > 3464) {
+    print("f3464 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3465(a, b) {
+  let x = a * 3465 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3465;
+  }
+  if (x > 3465) {
+    print("f3465 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3466(a, b) {
+  let x = a * 3466 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3466;
+  }
+  if (x > 3466) {
+    print("f3466 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3467(a, b) {
+  let x = a * 3467 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3467;
+  }
+  if (x > 3467) {
+    print("f3467 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3468(a, b) {
+  let x = a * 3468 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3468;
+  }
+  if (x > 3468) {
+    print("f3468 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3469(a, b) {
+  let x = a * 3469 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3469;
+  }
+  if (x > 3469) {
+    print("f3469 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3470(a, b) {
+  let x = a * 3470 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3470;
+  }
+  if (x > 3470) {
+    print("f3470 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3471(a, b) {
+  let x = a * 3471 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3471;
+  }
+  if (x > 3471) {
+    print("f3471 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3472(a, b) {
+  let x = a * 3472 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3472;
+  }
+  if (x > 3472) {
+    print("f3472 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3473(a, b) {
+  let x = a * 3473 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3473;
+  }
+  if (x > 3473) {
+    print("f3473 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3474(a, b) {
+  let x = a * 3474 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3474;
+  }
+  if (x > 3474) {
+    print("f3474 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3475(a, b) {
+  let x = a * 3475 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3475;
+  }
+  if (x > 3475) {
+    print("f3475 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3476(a, b) {
+  let x = a * 3476 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3476;
+  }
+  if (x > 3476) {
+    print("f3476 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3477(a, b) {
+  let x = a * 3477 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3477;
+  }
+  if (x > 3477) {
+    print("f3477 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3478(a, b) {
+  let x = a * 3478 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3478;
+  }
+  if (x > 3478) {
+    print("f3478 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3479(a, b) {
+  let x = a * 3479 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3479;
+  }
+  if (x > 3479) {
+    print("f3479 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3480(a, b) {
+  let x = a * 3480 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3480;
+  }
+  if (x > 3480) {
+    print("f3480 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3481(a, b) {
+  let x = a * 3481 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3481;
+  }
+  if (x > 3481) {
+    print("f3481 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3482(a, b) {
+  let x = a * 3482 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3482;
+  }
+  if (x > 3482) {
+    print("f3482 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3483(a, b) {
+  let x = a * 3483 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3483;
+  }
+  if (x > 3483) {
+    print("f3483 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3484(a, b) {
+  let x = a * 3484 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3484;
+  }
+  if (x > 3484) {
+    print("f3484 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3485(a, b) {
+  let x = a * 3485 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3485;
+  }
+  if (x > 3485) {
+    print("f3485 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3486(a, b) {
+  let x = a * 3486 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3486;
+  }
+  if (x > 3486) {
+    print("f3486 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3487(a, b) {
+  let x = a * 3487 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3487;
+  }
+  if (x > 3487) {
+    print("f3487 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3488(a, b) {
+  let x = a * 3488 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3488;
+  }
+  if (x > 3488) {
+    print("f3488 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3489(a, b) {
+  let x = a * 3489 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3489;
+  }
+  if (x > 3489) {
+    print("f3489 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3490(a, b) {
+  let x = a * 3490 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3490;
+  }
+  if (x > 3490) {
+    print("f3490 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3491(a, b) {
+  let x = a * 3491 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3491;
+  }
+  if (x > 3491) {
+    print("f3491 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3492(a, b) {
+  let x = a * 3492 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3492;
+  }
+  if (x > 3492) {
+    print("f3492 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3493(a, b) {
+  let x = a * 3493 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3493;
+  }
+  if (x > 3493) {
+    print("f3493 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3494(a, b) {
+  let x = a * 3494 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3494;
+  }
+  if (x > 3494) {
+    print("f3494 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3495(a, b) {
+  let x = a * 3495 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3495;
+  }
+  if (x > 3495) {
+    print("f3495 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3496(a, b) {
+  let x = a * 3496 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3496;
+  }
+  if (x > 3496) {
+    print("f3496 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3497(a, b) {
+  let x = a * 3497 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3497;
+  }
+  if (x > 3497) {
+    print("f3497 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3498(a, b) {
+  let x = a * 3498 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3498;
+  }
+  if (x > 3498) {
+    print("f3498 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3499(a, b) {
+  let x = a * 3499 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3499;
+  }
+  if (x > 3499) {
+    print("f3499 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3500(a, b) {
+  let x = a * 3500 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3500;
+  }
+  if (x > 3500) {
+    print("f3500 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3501(a, b) {
+  let x = a * 3501 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3501;
+  }
+  if (x > 3501) {
+    print("f3501 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3502(a, b) {
+  let x = a * 3502 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3502;
+  }
+  if (x > 3502) {
+    print("f3502 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3503(a, b) {
+  let x = a * 3503 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3503;
+  }
+  if (x > 3503) {
+    print("f3503 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3504(a, b) {
+  let x = a * 3504 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3504;
+  }
+  if (x > 3504) {
+    print("f3504 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3505(a, b) {
+  let x = a * 3505 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3505;
+  }
+  if (x > 3505) {
+    print("f3505 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3506(a, b) {
+  let x = a * 3506 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3506;
+  }
+  if (x > 3506) {
+    print("f3506 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3507(a, b) {
+  let x = a * 3507 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3507;
+  }
+  if (x > 3507) {
+    print("f3507 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3508(a, b) {
+  let x = a * 3508 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3508;
+  }
+  if (x > 3508) {
+    print("f3508 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3509(a, b) {
+  let x = a * 3509 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3509;
+  }
+  if (x > 3509) {
+    print("f3509 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3510(a, b) {
+  let x = a * 3510 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3510;
+  }
+  if (x > 3510) {
+    print("f3510 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3511(a, b) {
+  let x = a * 3511 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3511;
+  }
+  if (x > 3511) {
+    print("f3511 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3512(a, b) {
+  let x = a * 3512 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3512;
+  }
+  if (x > 3512) {
+    print("f3512 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3513(a, b) {
+  let x = a * 3513 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3513;
+  }
+  if (x > 3513) {
+    print("f3513 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3514(a, b) {
+  let x = a * 3514 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3514;
+  }
+  if (x > 3514) {
+    print("f3514 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3515(a, b) {
+  let x = a * 3515 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3515;
+  }
+  if (x > 3515) {
+    print("f3515 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3516(a, b) {
+  let x = a * 3516 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3516;
+  }
+  if (x > 3516) {
+    print("f3516 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3517(a, b) {
+  let x = a * 3517 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3517;
+  }
+  if (x > 3517) {
+    print("f3517 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3518(a, b) {
+  let x = a * 3518 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3518;
+  }
+  if (x > 3518) {
+    print("f3518 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3519(a, b) {
+  let x = a * 3519 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3519;
+  }
+  if (x > 3519) {
+    print("f3519 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3520(a, b) {
+  let x = a * 3520 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3520;
+  }
+  if (x > 3520) {
+    print("f3520 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3521(a, b) {
+  let x = a * 3521 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3521;
+  }
+  if (x > 3521) {
+    print("f3521 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3522(a, b) {
+  let x = a * 3522 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3522;
+  }
+  if (x > 3522) {
+    print("f3522 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3523(a, b) {
+  let x = a * 3523 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3523;
+  }
+  if (x > 3523) {
+    print("f3523 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3524(a, b) {
+  let x = a * 3524 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3524;
+  }
+  if (x > 3524) {
+    print("f3524 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3525(a, b) {
+  let x = a * 3525 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3525;
+  }
+  if (x > 3525) {
+    print("f3525 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3526(a, b) {
+  let x = a * 3526 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3526;
+  }
+  if (x > 3526) {
+    print("f3526 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3527(a, b) {
+  let x = a * 3527 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3527;
+  }
+  if (x > 3527) {
+    print("f3527 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3528(a, b) {
+  let x = a * 3528 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3528;
+  }
+  if (x > 3528) {
+    print("f3528 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3529(a, b) {
+  let x = a * 3529 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3529;
+  }
+  if (x > 3529) {
+    print("f3529 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3530(a, b) {
+  let x = a * 3530 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3530;
+  }
+  if (x > 3530) {
+    print("f3530 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3531(a, b) {
+  let x = a * 3531 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3531;
+  }
+  if (x > 3531) {
+    print("f3531 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3532(a, b) {
+  let x = a * 3532 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3532;
+  }
+  if (x > 3532) {
+    print("f3532 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3533(a, b) {
+  let x = a * 3533 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3533;
+  }
+  if (x > 3533) {
+    print("f3533 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3534(a, b) {
+  let x = a * 3534 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3534;
+  }
+  if (x > 3534) {
+    print("f3534 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3535(a, b) {
+  let x = a * 3535 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3535;
+  }
+  if (x > 3535) {
+    print("f3535 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3536(a, b) {
+  let x = a * 3536 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3536;
+  }
+  if (x > 3536) {
+    print("f3536 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3537(a, b) {
+  let x = a * 3537 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3537;
+  }
+  if (x > 3537) {
+    print("f3537 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3538(a, b) {
+  let x = a * 3538 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3538;
+  }
+  if (x > 3538) {
+    print("f3538 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3539(a, b) {
+  let x = a * 3539 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3539;
+  }
+  if (x > 3539) {
+    print("f3539 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3540(a, b) {
+  let x = a * 3540 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3540;
+  }
+  if (x > 3540) {
+    print("f3540 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3541(a, b) {
+  let x = a * 3541 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3541;
+  }
+  if (x > 3541) {
+    print("f3541 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3542(a, b) {
+  let x = a * 3542 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3542;
+  }
+  if (x > 3542) {
+    print("f3542 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3543(a, b) {
+  let x = a * 3543 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3543;
+  }
+  if (x > 3543) {
+    print("f3543 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3544(a, b) {
+  let x = a * 3544 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3544;
+  }
+  if (x > 3544) {
+    print("f3544 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3545(a, b) {
+  let x = a * 3545 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3545;
+  }
+  if (x > 3545) {
+    print("f3545 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3546(a, b) {
+  let x = a * 3546 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3546;
+  }
+  if (x > 3546) {
+    print("f3546 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3547(a, b) {
+  let x = a * 3547 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3547;
+  }
+  if (x > 3547) {
+    print("f3547 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3548(a, b) {
+  let x = a * 3548 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3548;
+  }
+  if (x > 3548) {
+    print("f3548 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3549(a, b) {
+  let x = a * 3549 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3549;
+  }
+  if (x > 3549) {
+    print("f3549 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3550(a, b) {
+  let x = a * 3550 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3550;
+  }
+  if (x > 3550) {
+    print("f3550 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3551(a, b) {
+  let x = a * 3551 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3551;
+  }
+  if (x > 3551) {
+    print("f3551 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3552(a, b) {
+  let x = a * 3552 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3552;
+  }
+  if (x > 3552) {
+    print("f3552 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3553(a, b) {
+  let x = a * 3553 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3553;
+  }
+  if (x > 3553) {
+    print("f3553 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3554(a, b) {
+  let x = a * 3554 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3554;
+  }
+  if (x > 3554) {
+    print("f3554 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3555(a, b) {
+  let x = a * 3555 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3555;
+  }
+  if (x > 3555) {
+    print("f3555 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3556(a, b) {
+  let x = a * 3556 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3556;
+  }
+  if (x > 3556) {
+    print("f3556 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3557(a, b) {
+  let x = a * 3557 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3557;
+  }
+  if (x > 3557) {
+    print("f3557 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3558(a, b) {
+  let x = a * 3558 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3558;
+  }
+  if (x > 3558) {
+    print("f3558 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3559(a, b) {
+  let x = a * 3559 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3559;
+  }
+  if (x > 3559) {
+    print("f3559 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3560(a, b) {
+  let x = a * 3560 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3560;
+  }
+  if (x > 3560) {
+    print("f3560 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3561(a, b) {
+  let x = a * 3561 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3561;
+  }
+  if (x > 3561) {
+    print("f3561 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3562(a, b) {
+  let x = a * 3562 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3562;
+  }
+  if (x > 3562) {
+    print("f3562 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3563(a, b) {
+  let x = a * 3563 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3563;
+  }
+  if (x > 3563) {
+    print("f3563 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3564(a, b) {
+  let x = a * 3564 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3564;
+  }
+  if (x > 3564) {
+    print("f3564 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3565(a, b) {
+  let x = a * 3565 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3565;
+  }
+  if (x > 3565) {
+    print("f3565 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3566(a, b) {
+  let x = a * 3566 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3566;
+  }
+  if (x > 3566) {
+    print("f3566 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3567(a, b) {
+  let x = a * 3567 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3567;
+  }
+  if (x > 3567) {
+    print("f3567 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3568(a, b) {
+  let x = a * 3568 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3568;
+  }
+  if (x > 3568) {
+    print("f3568 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3569(a, b) {
+  let x = a * 3569 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3569;
+  }
+  if (x > 3569) {
+    print("f3569 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3570(a, b) {
+  let x = a * 3570 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3570;
+  }
+  if (x > 3570) {
+    print("f3570 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3571(a, b) {
+  let x = a * 3571 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3571;
+  }
+  if (x > 3571) {
+    print("f3571 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3572(a, b) {
+  let x = a * 3572 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3572;
+  }
+  if (x > 3572) {
+    print("f3572 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3573(a, b) {
+  let x = a * 3573 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3573;
+  }
+  if (x > 3573) {
+    print("f3573 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3574(a, b) {
+  let x = a * 3574 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3574;
+  }
+  if (x > 3574) {
+    print("f3574 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3575(a, b) {
+  let x = a * 3575 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3575;
+  }
+  if (x > 3575) {
+    print("f3575 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3576(a, b) {
+  let x = a * 3576 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3576;
+  }
+  if (x > 3576) {
+    print("f3576 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3577(a, b) {
+  let x = a * 3577 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3577;
+  }
+  if (x > 3577) {
+    print("f3577 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3578(a, b) {
+  let x = a * 3578 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3578;
+  }
+  if (x > 3578) {
+    print("f3578 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3579(a, b) {
+  let x = a * 3579 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3579;
+  }
+  if (x > 3579) {
+    print("f3579 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3580(a, b) {
+  let x = a * 3580 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3580;
+  }
+  if (x > 3580) {
+    print("f3580 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3581(a, b) {
+  let x = a * 3581 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3581;
+  }
+  if (x > 3581) {
+    print("f3581 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3582(a, b) {
+  let x = a * 3582 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3582;
+  }
+  if (x > 3582) {
+    print("f3582 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3583(a, b) {
+  let x = a * 3583 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3583;
+  }
+  if (x > 3583) {
+    print("f3583 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3584(a, b) {
+  let x = a * 3584 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3584;
+  }
+  if (x > 3584) {
+    print("f3584 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3585(a, b) {
+  let x = a * 3585 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3585;
+  }
+  if (x > 3585) {
+    print("f3585 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3586(a, b) {
+  let x = a * 3586 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3586;
+  }
+  if (x > 3586) {
+    print("f3586 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3587(a, b) {
+  let x = a * 3587 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3587;
+  }
+  if (x > 3587) {
+    print("f3587 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3588(a, b) {
+  let x = a * 3588 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3588;
+  }
+  if (x > 3588) {
+    print("f3588 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3589(a, b) {
+  let x = a * 3589 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3589;
+  }
+  if (x > 3589) {
+    print("f3589 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3590(a, b) {
+  let x = a * 3590 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3590;
+  }
+  if (x > 3590) {
+    print("f3590 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3591(a, b) {
+  let x = a * 3591 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3591;
+  }
+  if (x > 3591) {
+    print("f3591 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3592(a, b) {
+  let x = a * 3592 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3592;
+  }
+  if (x > 3592) {
+    print("f3592 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3593(a, b) {
+  let x = a * 3593 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3593;
+  }
+  if (x > 3593) {
+    print("f3593 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3594(a, b) {
+  let x = a * 3594 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3594;
+  }
+  if (x > 3594) {
+    print("f3594 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3595(a, b) {
+  let x = a * 3595 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3595;
+  }
+  if (x > 3595) {
+    print("f3595 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3596(a, b) {
+  let x = a * 3596 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3596;
+  }
+  if (x > 3596) {
+    print("f3596 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3597(a, b) {
+  let x = a * 3597 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3597;
+  }
+  if (x > 3597) {
+    print("f3597 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3598(a, b) {
+  let x = a * 3598 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3598;
+  }
+  if (x > 3598) {
+    print("f3598 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3599(a, b) {
+  let x = a * 3599 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3599;
+  }
+  if (x > 3599) {
+    print("f3599 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3600(a, b) {
+  let x = a * 3600 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3600;
+  }
+  if (x > 3600) {
+    print("f3600 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3601(a, b) {
+  let x = a * 3601 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3601;
+  }
+  if (x > 3601) {
+    print("f3601 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3602(a, b) {
+  let x = a * 3602 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3602;
+  }
+  if (x > 3602) {
+    print("f3602 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3603(a, b) {
+  let x = a * 3603 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3603;
+  }
+  if (x > 3603) {
+    print("f3603 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3604(a, b) {
+  let x = a * 3604 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3604;
+  }
+  if (x > 3604) {
+    print("f3604 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3605(a, b) {
+  let x = a * 3605 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3605;
+  }
+  if (x > 3605) {
+    print("f3605 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3606(a, b) {
+  let x = a * 3606 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3606;
+  }
+  if (x > 3606) {
+    print("f3606 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3607(a, b) {
+  let x = a * 3607 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3607;
+  }
+  if (x > 3607) {
+    print("f3607 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3608(a, b) {
+  let x = a * 3608 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3608;
+  }
+  if (x > 3608) {
+    print("f3608 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3609(a, b) {
+  let x = a * 3609 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3609;
+  }
+  if (x > 3609) {
+    print("f3609 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3610(a, b) {
+  let x = a * 3610 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3610;
+  }
+  if (x > 3610) {
+    print("f3610 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3611(a, b) {
+  let x = a * 3611 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3611;
+  }
+  if (x > 3611) {
+    print("f3611 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3612(a, b) {
+  let x = a * 3612 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3612;
+  }
+  if (x > 3612) {
+    print("f3612 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3613(a, b) {
+  let x = a * 3613 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3613;
+  }
+  if (x > 3613) {
+    print("f3613 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3614(a, b) {
+  let x = a * 3614 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3614;
+  }
+  if (x > 3614) {
+    print("f3614 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3615(a, b) {
+  let x = a * 3615 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3615;
+  }
+  if (x > 3615) {
+    print("f3615 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3616(a, b) {
+  let x = a * 3616 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3616;
+  }
+  if (x > 3616) {
+    print("f3616 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3617(a, b) {
+  let x = a * 3617 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3617;
+  }
+  if (x > 3617) {
+    print("f3617 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3618(a, b) {
+  let x = a * 3618 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3618;
+  }
+  if (x > 3618) {
+    print("f3618 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3619(a, b) {
+  let x = a * 3619 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3619;
+  }
+  if (x > 3619) {
+    print("f3619 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3620(a, b) {
+  let x = a * 3620 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3620;
+  }
+  if (x > 3620) {
+    print("f3620 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3621(a, b) {
+  let x = a * 3621 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3621;
+  }
+  if (x > 3621) {
+    print("f3621 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3622(a, b) {
+  let x = a * 3622 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3622;
+  }
+  if (x > 3622) {
+    print("f3622 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3623(a, b) {
+  let x = a * 3623 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3623;
+  }
+  if (x > 3623) {
+    print("f3623 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3624(a, b) {
+  let x = a * 3624 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3624;
+  }
+  if (x > 3624) {
+    print("f3624 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3625(a, b) {
+  let x = a * 3625 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3625;
+  }
+  if (x > 3625) {
+    print("f3625 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3626(a, b) {
+  let x = a * 3626 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3626;
+  }
+  if (x > 3626) {
+    print("f3626 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3627(a, b) {
+  let x = a * 3627 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3627;
+  }
+  if (x > 3627) {
+    print("f3627 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3628(a, b) {
+  let x = a * 3628 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3628;
+  }
+  if (x > 3628) {
+    print("f3628 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3629(a, b) {
+  let x = a * 3629 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3629;
+  }
+  if (x > 3629) {
+    print("f3629 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3630(a, b) {
+  let x = a * 3630 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3630;
+  }
+  if (x > 3630) {
+    print("f3630 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3631(a, b) {
+  let x = a * 3631 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3631;
+  }
+  if (x > 3631) {
+    print("f3631 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3632(a, b) {
+  let x = a * 3632 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3632;
+  }
+  if (x > 3632) {
+    print("f3632 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3633(a, b) {
+  let x = a * 3633 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3633;
+  }
+  if (x > 3633) {
+    print("f3633 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3634(a, b) {
+  let x = a * 3634 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3634;
+  }
+  if (x > 3634) {
+    print("f3634 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3635(a, b) {
+  let x = a * 3635 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3635;
+  }
+  if (x > 3635) {
+    print("f3635 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3636(a, b) {
+  let x = a * 3636 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3636;
+  }
+  if (x > 3636) {
+    print("f3636 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3637(a, b) {
+  let x = a * 3637 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3637;
+  }
+  if (x > 3637) {
+    print("f3637 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3638(a, b) {
+  let x = a * 3638 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3638;
+  }
+  if (x > 3638) {
+    print("f3638 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3639(a, b) {
+  let x = a * 3639 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3639;
+  }
+  if (x > 3639) {
+    print("f3639 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3640(a, b) {
+  let x = a * 3640 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3640;
+  }
+  if (x > 3640) {
+    print("f3640 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3641(a, b) {
+  let x = a * 3641 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3641;
+  }
+  if (x > 3641) {
+    print("f3641 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3642(a, b) {
+  let x = a * 3642 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3642;
+  }
+  if (x > 3642) {
+    print("f3642 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3643(a, b) {
+  let x = a * 3643 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3643;
+  }
+  if (x > 3643) {
+    print("f3643 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3644(a, b) {
+  let x = a * 3644 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3644;
+  }
+  if (x > 3644) {
+    print("f3644 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3645(a, b) {
+  let x = a * 3645 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3645;
+  }
+  if (x > 3645) {
+    print("f3645 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3646(a, b) {
+  let x = a * 3646 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3646;
+  }
+  if (x > 3646) {
+    print("f3646 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3647(a, b) {
+  let x = a * 3647 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3647;
+  }
+  if (x > 3647) {
+    print("f3647 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3648(a, b) {
+  let x = a * 3648 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3648;
+  }
+  if (x > 3648) {
+    print("f3648 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3649(a, b) {
+  let x = a * 3649 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3649;
+  }
+  if (x > 3649) {
+    print("f3649 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3650(a, b) {
+  let x = a * 3650 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3650;
+  }
+  if (x > 3650) {
+    print("f3650 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3651(a, b) {
+  let x = a * 3651 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3651;
+  }
+  if (x > 3651) {
+    print("f3651 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3652(a, b) {
+  let x = a * 3652 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3652;
+  }
+  if (x > 3652) {
+    print("f3652 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3653(a, b) {
+  let x = a * 3653 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3653;
+  }
+  if (x > 3653) {
+    print("f3653 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3654(a, b) {
+  let x = a * 3654 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3654;
+  }
+  if (x > 3654) {
+    print("f3654 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3655(a, b) {
+  let x = a * 3655 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3655;
+  }
+  if (x > 3655) {
+    print("f3655 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3656(a, b) {
+  let x = a * 3656 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3656;
+  }
+  if (x > 3656) {
+    print("f3656 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3657(a, b) {
+  let x = a * 3657 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3657;
+  }
+  if (x > 3657) {
+    print("f3657 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3658(a, b) {
+  let x = a * 3658 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3658;
+  }
+  if (x > 3658) {
+    print("f3658 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3659(a, b) {
+  let x = a * 3659 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3659;
+  }
+  if (x > 3659) {
+    print("f3659 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3660(a, b) {
+  let x = a * 3660 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3660;
+  }
+  if (x > 3660) {
+    print("f3660 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3661(a, b) {
+  let x = a * 3661 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3661;
+  }
+  if (x > 3661) {
+    print("f3661 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3662(a, b) {
+  let x = a * 3662 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3662;
+  }
+  if (x > 3662) {
+    print("f3662 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3663(a, b) {
+  let x = a * 3663 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3663;
+  }
+  if (x > 3663) {
+    print("f3663 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3664(a, b) {
+  let x = a * 3664 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3664;
+  }
+  if (x > 3664) {
+    print("f3664 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3665(a, b) {
+  let x = a * 3665 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3665;
+  }
+  if (x > 3665) {
+    print("f3665 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3666(a, b) {
+  let x = a * 3666 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3666;
+  }
+  if (x > 3666) {
+    print("f3666 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3667(a, b) {
+  let x = a * 3667 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3667;
+  }
+  if (x > 3667) {
+    print("f3667 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3668(a, b) {
+  let x = a * 3668 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3668;
+  }
+  if (x > 3668) {
+    print("f3668 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3669(a, b) {
+  let x = a * 3669 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3669;
+  }
+  if (x > 3669) {
+    print("f3669 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3670(a, b) {
+  let x = a * 3670 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3670;
+  }
+  if (x > 3670) {
+    print("f3670 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3671(a, b) {
+  let x = a * 3671 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3671;
+  }
+  if (x > 3671) {
+    print("f3671 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3672(a, b) {
+  let x = a * 3672 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3672;
+  }
+  if (x > 3672) {
+    print("f3672 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3673(a, b) {
+  let x = a * 3673 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3673;
+  }
+  if (x > 3673) {
+    print("f3673 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3674(a, b) {
+  let x = a * 3674 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3674;
+  }
+  if (x > 3674) {
+    print("f3674 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3675(a, b) {
+  let x = a * 3675 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3675;
+  }
+  if (x > 3675) {
+    print("f3675 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3676(a, b) {
+  let x = a * 3676 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3676;
+  }
+  if (x > 3676) {
+    print("f3676 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3677(a, b) {
+  let x = a * 3677 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3677;
+  }
+  if (x > 3677) {
+    print("f3677 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3678(a, b) {
+  let x = a * 3678 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3678;
+  }
+  if (x > 3678) {
+    print("f3678 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3679(a, b) {
+  let x = a * 3679 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3679;
+  }
+  if (x > 3679) {
+    print("f3679 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3680(a, b) {
+  let x = a * 3680 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3680;
+  }
+  if (x > 3680) {
+    print("f3680 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3681(a, b) {
+  let x = a * 3681 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3681;
+  }
+  if (x > 3681) {
+    print("f3681 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3682(a, b) {
+  let x = a * 3682 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3682;
+  }
+  if (x > 3682) {
+    print("f3682 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3683(a, b) {
+  let x = a * 3683 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3683;
+  }
+  if (x > 3683) {
+    print("f3683 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3684(a, b) {
+  let x = a * 3684 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3684;
+  }
+  if (x > 3684) {
+    print("f3684 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3685(a, b) {
+  let x = a * 3685 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3685;
+  }
+  if (x > 3685) {
+    print("f3685 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3686(a, b) {
+  let x = a * 3686 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3686;
+  }
+  if (x > 3686) {
+    print("f3686 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3687(a, b) {
+  let x = a * 3687 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3687;
+  }
+  if (x > 3687) {
+    print("f3687 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3688(a, b) {
+  let x = a * 3688 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3688;
+  }
+  if (x > 3688) {
+    print("f3688 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3689(a, b) {
+  let x = a * 3689 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3689;
+  }
+  if (x > 3689) {
+    print("f3689 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3690(a, b) {
+  let x = a * 3690 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3690;
+  }
+  if (x > 3690) {
+    print("f3690 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3691(a, b) {
+  let x = a * 3691 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3691;
+  }
+  if (x > 3691) {
+    print("f3691 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3692(a, b) {
+  let x = a * 3692 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3692;
+  }
+  if (x > 3692) {
+    print("f3692 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3693(a, b) {
+  let x = a * 3693 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3693;
+  }
+  if (x > 3693) {
+    print("f3693 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3694(a, b) {
+  let x = a * 3694 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3694;
+  }
+  if (x > 3694) {
+    print("f3694 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3695(a, b) {
+  let x = a * 3695 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3695;
+  }
+  if (x > 3695) {
+    print("f3695 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3696(a, b) {
+  let x = a * 3696 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3696;
+  }
+  if (x > 3696) {
+    print("f3696 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3697(a, b) {
+  let x = a * 3697 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3697;
+  }
+  if (x > 3697) {
+    print("f3697 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3698(a, b) {
+  let x = a * 3698 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3698;
+  }
+  if (x > 3698) {
+    print("f3698 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3699(a, b) {
+  let x = a * 3699 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3699;
+  }
+  if (x > 3699) {
+    print("f3699 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3700(a, b) {
+  let x = a * 3700 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3700;
+  }
+  if (x > 3700) {
+    print("f3700 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3701(a, b) {
+  let x = a * 3701 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3701;
+  }
+  if (x > 3701) {
+    print("f3701 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3702(a, b) {
+  let x = a * 3702 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3702;
+  }
+  if (x > 3702) {
+    print("f3702 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3703(a, b) {
+  let x = a * 3703 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3703;
+  }
+  if (x > 3703) {
+    print("f3703 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3704(a, b) {
+  let x = a * 3704 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3704;
+  }
+  if (x > 3704) {
+    print("f3704 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3705(a, b) {
+  let x = a * 3705 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3705;
+  }
+  if (x > 3705) {
+    print("f3705 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3706(a, b) {
+  let x = a * 3706 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3706;
+  }
+  if (x > 3706) {
+    print("f3706 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3707(a, b) {
+  let x = a * 3707 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3707;
+  }
+  if (x > 3707) {
+    print("f3707 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3708(a, b) {
+  let x = a * 3708 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3708;
+  }
+  if (x > 3708) {
+    print("f3708 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3709(a, b) {
+  let x = a * 3709 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3709;
+  }
+  if (x > 3709) {
+    print("f3709 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3710(a, b) {
+  let x = a * 3710 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3710;
+  }
+  if (x > 3710) {
+    print("f3710 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3711(a, b) {
+  let x = a * 3711 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3711;
+  }
+  if (x > 3711) {
+    print("f3711 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3712(a, b) {
+  let x = a * 3712 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3712;
+  }
+  if (x > 3712) {
+    print("f3712 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3713(a, b) {
+  let x = a * 3713 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3713;
+  }
+  if (x > 3713) {
+    print("f3713 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3714(a, b) {
+  let x = a * 3714 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3714;
+  }
+  if (x > 3714) {
+    print("f3714 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3715(a, b) {
+  let x = a * 3715 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3715;
+  }
+  if (x > 3715) {
+    print("f3715 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3716(a, b) {
+  let x = a * 3716 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3716;
+  }
+  if (x > 3716) {
+    print("f3716 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3717(a, b) {
+  let x = a * 3717 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3717;
+  }
+  if (x > 3717) {
+    print("f3717 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3718(a, b) {
+  let x = a * 3718 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3718;
+  }
+  if (x > 3718) {
+    print("f3718 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3719(a, b) {
+  let x = a * 3719 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3719;
+  }
+  if (x > 3719) {
+    print("f3719 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3720(a, b) {
+  let x = a * 3720 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3720;
+  }
+  if (x > 3720) {
+    print("f3720 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3721(a, b) {
+  let x = a * 3721 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3721;
+  }
+  if (x > 3721) {
+    print("f3721 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3722(a, b) {
+  let x = a * 3722 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3722;
+  }
+  if (x > 3722) {
+    print("f3722 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3723(a, b) {
+  let x = a * 3723 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3723;
+  }
+  if (x > 3723) {
+    print("f3723 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3724(a, b) {
+  let x = a * 3724 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3724;
+  }
+  if (x > 3724) {
+    print("f3724 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3725(a, b) {
+  let x = a * 3725 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3725;
+  }
+  if (x > 3725) {
+    print("f3725 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3726(a, b) {
+  let x = a * 3726 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3726;
+  }
+  if (x > 3726) {
+    print("f3726 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3727(a, b) {
+  let x = a * 3727 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3727;
+  }
+  if (x > 3727) {
+    print("f3727 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3728(a, b) {
+  let x = a * 3728 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3728;
+  }
+  if (x > 3728) {
+    print("f3728 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3729(a, b) {
+  let x = a * 3729 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3729;
+  }
+  if (x > 3729) {
+    print("f3729 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3730(a, b) {
+  let x = a * 3730 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3730;
+  }
+  if (x > 3730) {
+    print("f3730 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3731(a, b) {
+  let x = a * 3731 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3731;
+  }
+  if (x > 3731) {
+    print("f3731 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3732(a, b) {
+  let x = a * 3732 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3732;
+  }
+  if (x > 3732) {
+    print("f3732 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3733(a, b) {
+  let x = a * 3733 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3733;
+  }
+  if (x > 3733) {
+    print("f3733 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3734(a, b) {
+  let x = a * 3734 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3734;
+  }
+  if (x > 3734) {
+    print("f3734 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3735(a, b) {
+  let x = a * 3735 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3735;
+  }
+  if (x > 3735) {
+    print("f3735 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3736(a, b) {
+  let x = a * 3736 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3736;
+  }
+  if (x > 3736) {
+    print("f3736 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3737(a, b) {
+  let x = a * 3737 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3737;
+  }
+  if (x > 3737) {
+    print("f3737 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3738(a, b) {
+  let x = a * 3738 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3738;
+  }
+  if (x > 3738) {
+    print("f3738 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3739(a, b) {
+  let x = a * 3739 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3739;
+  }
+  if (x > 3739) {
+    print("f3739 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3740(a, b) {
+  let x = a * 3740 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3740;
+  }
+  if (x > 3740) {
+    print("f3740 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3741(a, b) {
+  let x = a * 3741 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3741;
+  }
+  if (x > 3741) {
+    print("f3741 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3742(a, b) {
+  let x = a * 3742 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3742;
+  }
+  if (x > 3742) {
+    print("f3742 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3743(a, b) {
+  let x = a * 3743 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3743;
+  }
+  if (x > 3743) {
+    print("f3743 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3744(a, b) {
+  let x = a * 3744 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3744;
+  }
+  if (x > 3744) {
+    print("f3744 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3745(a, b) {
+  let x = a * 3745 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3745;
+  }
+  if (x > 3745) {
+    print("f3745 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3746(a, b) {
+  let x = a * 3746 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3746;
+  }
+  if (x > 3746) {
+    print("f3746 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3747(a, b) {
+  let x = a * 3747 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3747;
+  }
+  if (x > 3747) {
+    print("f3747 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3748(a, b) {
+  let x = a * 3748 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3748;
+  }
+  if (x > 3748) {
+    print("f3748 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3749(a, b) {
+  let x = a * 3749 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3749;
+  }
+  if (x > 3749) {
+    print("f3749 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3750(a, b) {
+  let x = a * 3750 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3750;
+  }
+  if (x > 3750) {
+    print("f3750 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3751(a, b) {
+  let x = a * 3751 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3751;
+  }
+  if (x > 3751) {
+    print("f3751 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3752(a, b) {
+  let x = a * 3752 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3752;
+  }
+  if (x > 3752) {
+    print("f3752 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3753(a, b) {
+  let x = a * 3753 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3753;
+  }
+  if (x > 3753) {
+    print("f3753 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3754(a, b) {
+  let x = a * 3754 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3754;
+  }
+  if (x > 3754) {
+    print("f3754 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3755(a, b) {
+  let x = a * 3755 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3755;
+  }
+  if (x > 3755) {
+    print("f3755 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3756(a, b) {
+  let x = a * 3756 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3756;
+  }
+  if (x > 3756) {
+    print("f3756 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3757(a, b) {
+  let x = a * 3757 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3757;
+  }
+  if (x > 3757) {
+    print("f3757 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3758(a, b) {
+  let x = a * 3758 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3758;
+  }
+  if (x > 3758) {
+    print("f3758 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3759(a, b) {
+  let x = a * 3759 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3759;
+  }
+  if (x > 3759) {
+    print("f3759 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3760(a, b) {
+  let x = a * 3760 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3760;
+  }
+  if (x > 3760) {
+    print("f3760 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3761(a, b) {
+  let x = a * 3761 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3761;
+  }
+  if (x > 3761) {
+    print("f3761 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3762(a, b) {
+  let x = a * 3762 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3762;
+  }
+  if (x > 3762) {
+    print("f3762 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3763(a, b) {
+  let x = a * 3763 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3763;
+  }
+  if (x > 3763) {
+    print("f3763 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3764(a, b) {
+  let x = a * 3764 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3764;
+  }
+  if (x > 3764) {
+    print("f3764 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3765(a, b) {
+  let x = a * 3765 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3765;
+  }
+  if (x > 3765) {
+    print("f3765 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3766(a, b) {
+  let x = a * 3766 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3766;
+  }
+  if (x > 3766) {
+    print("f3766 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3767(a, b) {
+  let x = a * 3767 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3767;
+  }
+  if (x > 3767) {
+    print("f3767 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3768(a, b) {
+  let x = a * 3768 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3768;
+  }
+  if (x > 3768) {
+    print("f3768 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3769(a, b) {
+  let x = a * 3769 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3769;
+  }
+  if (x > 3769) {
+    print("f3769 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3770(a, b) {
+  let x = a * 3770 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3770;
+  }
+  if (x > 3770) {
+    print("f3770 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3771(a, b) {
+  let x = a * 3771 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3771;
+  }
+  if (x > 3771) {
+    print("f3771 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3772(a, b) {
+  let x = a * 3772 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3772;
+  }
+  if (x > 3772) {
+    print("f3772 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3773(a, b) {
+  let x = a * 3773 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3773;
+  }
+  if (x > 3773) {
+    print("f3773 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3774(a, b) {
+  let x = a * 3774 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3774;
+  }
+  if (x > 3774) {
+    print("f3774 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3775(a, b) {
+  let x = a * 3775 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3775;
+  }
+  if (x > 3775) {
+    print("f3775 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3776(a, b) {
+  let x = a * 3776 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3776;
+  }
+  if (x > 3776) {
+    print("f3776 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3777(a, b) {
+  let x = a * 3777 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3777;
+  }
+  if (x > 3777) {
+    print("f3777 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3778(a, b) {
+  let x = a * 3778 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3778;
+  }
+  if (x > 3778) {
+    print("f3778 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3779(a, b) {
+  let x = a * 3779 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3779;
+  }
+  if (x > 3779) {
+    print("f3779 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3780(a, b) {
+  let x = a * 3780 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3780;
+  }
+  if (x > 3780) {
+    print("f3780 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3781(a, b) {
+  let x = a * 3781 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3781;
+  }
+  if (x > 3781) {
+    print("f3781 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3782(a, b) {
+  let x = a * 3782 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3782;
+  }
+  if (x > 3782) {
+    print("f3782 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3783(a, b) {
+  let x = a * 3783 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3783;
+  }
+  if (x > 3783) {
+    print("f3783 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3784(a, b) {
+  let x = a * 3784 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3784;
+  }
+  if (x > 3784) {
+    print("f3784 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3785(a, b) {
+  let x = a * 3785 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3785;
+  }
+  if (x > 3785) {
+    print("f3785 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3786(a, b) {
+  let x = a * 3786 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3786;
+  }
+  if (x > 3786) {
+    print("f3786 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3787(a, b) {
+  let x = a * 3787 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3787;
+  }
+  if (x > 3787) {
+    print("f3787 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3788(a, b) {
+  let x = a * 3788 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3788;
+  }
+  if (x > 3788) {
+    print("f3788 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3789(a, b) {
+  let x = a * 3789 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3789;
+  }
+  if (x > 3789) {
+    print("f3789 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3790(a, b) {
+  let x = a * 3790 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3790;
+  }
+  if (x > 3790) {
+    print("f3790 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3791(a, b) {
+  let x = a * 3791 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3791;
+  }
+  if (x > 3791) {
+    print("f3791 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3792(a, b) {
+  let x = a * 3792 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3792;
+  }
+  if (x > 3792) {
+    print("f3792 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3793(a, b) {
+  let x = a * 3793 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3793;
+  }
+  if (x > 3793) {
+    print("f3793 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3794(a, b) {
+  let x = a * 3794 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3794;
+  }
+  if (x > 3794) {
+    print("f3794 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3795(a, b) {
+  let x = a * 3795 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3795;
+  }
+  if (x > 3795) {
+    print("f3795 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3796(a, b) {
+  let x = a * 3796 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3796;
+  }
+  if (x > 3796) {
+    print("f3796 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3797(a, b) {
+  let x = a * 3797 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3797;
+  }
+  if (x > 3797) {
+    print("f3797 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3798(a, b) {
+  let x = a * 3798 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3798;
+  }
+  if (x > 3798) {
+    print("f3798 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3799(a, b) {
+  let x = a * 3799 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3799;
+  }
+  if (x > 3799) {
+    print("f3799 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3800(a, b) {
+  let x = a * 3800 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3800;
+  }
+  if (x > 3800) {
+    print("f3800 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3801(a, b) {
+  let x = a * 3801 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3801;
+  }
+  if (x > 3801) {
+    print("f3801 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3802(a, b) {
+  let x = a * 3802 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3802;
+  }
+  if (x > 3802) {
+    print("f3802 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3803(a, b) {
+  let x = a * 3803 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3803;
+  }
+  if (x > 3803) {
+    print("f3803 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3804(a, b) {
+  let x = a * 3804 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3804;
+  }
+  if (x > 3804) {
+    print("f3804 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3805(a, b) {
+  let x = a * 3805 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3805;
+  }
+  if (x > 3805) {
+    print("f3805 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3806(a, b) {
+  let x = a * 3806 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3806;
+  }
+  if (x > 3806) {
+    print("f3806 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3807(a, b) {
+  let x = a * 3807 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3807;
+  }
+  if (x > 3807) {
+    print("f3807 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3808(a, b) {
+  let x = a * 3808 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3808;
+  }
+  if (x > 3808) {
+    print("f3808 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3809(a, b) {
+  let x = a * 3809 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3809;
+  }
+  if (x > 3809) {
+    print("f3809 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3810(a, b) {
+  let x = a * 3810 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3810;
+  }
+  if (x > 3810) {
+    print("f3810 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3811(a, b) {
+  let x = a * 3811 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3811;
+  }
+  if (x > 3811) {
+    print("f3811 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3812(a, b) {
+  let x = a * 3812 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3812;
+  }
+  if (x > 3812) {
+    print("f3812 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3813(a, b) {
+  let x = a * 3813 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3813;
+  }
+  if (x > 3813) {
+    print("f3813 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3814(a, b) {
+  let x = a * 3814 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3814;
+  }
+  if (x > 3814) {
+    print("f3814 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3815(a, b) {
+  let x = a * 3815 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3815;
+  }
+  if (x > 3815) {
+    print("f3815 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3816(a, b) {
+  let x = a * 3816 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3816;
+  }
+  if (x > 3816) {
+    print("f3816 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3817(a, b) {
+  let x = a * 3817 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3817;
+  }
+  if (x > 3817) {
+    print("f3817 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3818(a, b) {
+  let x = a * 3818 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3818;
+  }
+  if (x > 3818) {
+    print("f3818 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3819(a, b) {
+  let x = a * 3819 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3819;
+  }
+  if (x > 3819) {
+    print("f3819 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3820(a, b) {
+  let x = a * 3820 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3820;
+  }
+  if (x > 3820) {
+    print("f3820 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3821(a, b) {
+  let x = a * 3821 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3821;
+  }
+  if (x > 3821) {
+    print("f3821 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3822(a, b) {
+  let x = a * 3822 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3822;
+  }
+  if (x > 3822) {
+    print("f3822 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3823(a, b) {
+  let x = a * 3823 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3823;
+  }
+  if (x > 3823) {
+    print("f3823 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3824(a, b) {
+  let x = a * 3824 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3824;
+  }
+  if (x > 3824) {
+    print("f3824 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3825(a, b) {
+  let x = a * 3825 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3825;
+  }
+  if (x > 3825) {
+    print("f3825 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3826(a, b) {
+  let x = a * 3826 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3826;
+  }
+  if (x > 3826) {
+    print("f3826 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3827(a, b) {
+  let x = a * 3827 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3827;
+  }
+  if (x > 3827) {
+    print("f3827 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3828(a, b) {
+  let x = a * 3828 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3828;
+  }
+  if (x > 3828) {
+    print("f3828 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3829(a, b) {
+  let x = a * 3829 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3829;
+  }
+  if (x > 3829) {
+    print("f3829 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3830(a, b) {
+  let x = a * 3830 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3830;
+  }
+  if (x > 3830) {
+    print("f3830 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3831(a, b) {
+  let x = a * 3831 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3831;
+  }
+  if (x > 3831) {
+    print("f3831 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3832(a, b) {
+  let x = a * 3832 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3832;
+  }
+  if (x > 3832) {
+    print("f3832 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3833(a, b) {
+  let x = a * 3833 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3833;
+  }
+  if (x > 3833) {
+    print("f3833 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3834(a, b) {
+  let x = a * 3834 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3834;
+  }
+  if (x > 3834) {
+    print("f3834 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3835(a, b) {
+  let x = a * 3835 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3835;
+  }
+  if (x > 3835) {
+    print("f3835 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3836(a, b) {
+  let x = a * 3836 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3836;
+  }
+  if (x > 3836) {
+    print("f3836 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3837(a, b) {
+  let x = a * 3837 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3837;
+  }
+  if (x > 3837) {
+    print("f3837 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3838(a, b) {
+  let x = a * 3838 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3838;
+  }
+  if (x > 3838) {
+    print("f3838 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3839(a, b) {
+  let x = a * 3839 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3839;
+  }
+  if (x > 3839) {
+    print("f3839 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3840(a, b) {
+  let x = a * 3840 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3840;
+  }
+  if (x > 3840) {
+    print("f3840 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3841(a, b) {
+  let x = a * 3841 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3841;
+  }
+  if (x > 3841) {
+    print("f3841 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3842(a, b) {
+  let x = a * 3842 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3842;
+  }
+  if (x > 3842) {
+    print("f3842 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3843(a, b) {
+  let x = a * 3843 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3843;
+  }
+  if (x > 3843) {
+    print("f3843 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3844(a, b) {
+  let x = a * 3844 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3844;
+  }
+  if (x > 3844) {
+    print("f3844 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3845(a, b) {
+  let x = a * 3845 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3845;
+  }
+  if (x > 3845) {
+    print("f3845 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3846(a, b) {
+  let x = a * 3846 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3846;
+  }
+  if (x > 3846) {
+    print("f3846 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3847(a, b) {
+  let x = a * 3847 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3847;
+  }
+  if (x > 3847) {
+    print("f3847 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3848(a, b) {
+  let x = a * 3848 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3848;
+  }
+  if (x > 3848) {
+    print("f3848 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3849(a, b) {
+  let x = a * 3849 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3849;
+  }
+  if (x > 3849) {
+    print("f3849 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3850(a, b) {
+  let x = a * 3850 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3850;
+  }
+  if (x > 3850) {
+    print("f3850 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3851(a, b) {
+  let x = a * 3851 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3851;
+  }
+  if (x > 3851) {
+    print("f3851 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3852(a, b) {
+  let x = a * 3852 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3852;
+  }
+  if (x > 3852) {
+    print("f3852 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3853(a, b) {
+  let x = a * 3853 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3853;
+  }
+  if (x > 3853) {
+    print("f3853 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3854(a, b) {
+  let x = a * 3854 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3854;
+  }
+  if (x > 3854) {
+    print("f3854 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3855(a, b) {
+  let x = a * 3855 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3855;
+  }
+  if (x > 3855) {
+    print("f3855 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3856(a, b) {
+  let x = a * 3856 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3856;
+  }
+  if (x > 3856) {
+    print("f3856 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3857(a, b) {
+  let x = a * 3857 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3857;
+  }
+  if (x > 3857) {
+    print("f3857 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3858(a, b) {
+  let x = a * 3858 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3858;
+  }
+  if (x > 3858) {
+    print("f3858 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3859(a, b) {
+  let x = a * 3859 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3859;
+  }
+  if (x > 3859) {
+    print("f3859 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3860(a, b) {
+  let x = a * 3860 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3860;
+  }
+  if (x > 3860) {
+    print("f3860 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3861(a, b) {
+  let x = a * 3861 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3861;
+  }
+  if (x > 3861) {
+    print("f3861 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3862(a, b) {
+  let x = a * 3862 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3862;
+  }
+  if (x > 3862) {
+    print("f3862 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3863(a, b) {
+  let x = a * 3863 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3863;
+  }
+  if (x > 3863) {
+    print("f3863 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3864(a, b) {
+  let x = a * 3864 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3864;
+  }
+  if (x > 3864) {
+    print("f3864 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3865(a, b) {
+  let x = a * 3865 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3865;
+  }
+  if (x > 3865) {
+    print("f3865 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3866(a, b) {
+  let x = a * 3866 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3866;
+  }
+  if (x > 3866) {
+    print("f3866 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3867(a, b) {
+  let x = a * 3867 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3867;
+  }
+  if (x > 3867) {
+    print("f3867 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3868(a, b) {
+  let x = a * 3868 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3868;
+  }
+  if (x > 3868) {
+    print("f3868 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3869(a, b) {
+  let x = a * 3869 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3869;
+  }
+  if (x > 3869) {
+    print("f3869 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3870(a, b) {
+  let x = a * 3870 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3870;
+  }
+  if (x > 3870) {
+    print("f3870 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3871(a, b) {
+  let x = a * 3871 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3871;
+  }
+  if (x > 3871) {
+    print("f3871 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3872(a, b) {
+  let x = a * 3872 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3872;
+  }
+  if (x > 3872) {
+    print("f3872 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3873(a, b) {
+  let x = a * 3873 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3873;
+  }
+  if (x > 3873) {
+    print("f3873 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3874(a, b) {
+  let x = a * 3874 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3874;
+  }
+  if (x > 3874) {
+    print("f3874 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3875(a, b) {
+  let x = a * 3875 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3875;
+  }
+  if (x > 3875) {
+    print("f3875 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3876(a, b) {
+  let x = a * 3876 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3876;
+  }
+  if (x > 3876) {
+    print("f3876 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3877(a, b) {
+  let x = a * 3877 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3877;
+  }
+  if (x > 3877) {
+    print("f3877 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3878(a, b) {
+  let x = a * 3878 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3878;
+  }
+  if (x > 3878) {
+    print("f3878 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3879(a, b) {
+  let x = a * 3879 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3879;
+  }
+  if (x > 3879) {
+    print("f3879 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3880(a, b) {
+  let x = a * 3880 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3880;
+  }
+  if (x > 3880) {
+    print("f3880 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3881(a, b) {
+  let x = a * 3881 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3881;
+  }
+  if (x > 3881) {
+    print("f3881 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3882(a, b) {
+  let x = a * 3882 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3882;
+  }
+  if (x > 3882) {
+    print("f3882 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3883(a, b) {
+  let x = a * 3883 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3883;
+  }
+  if (x > 3883) {
+    print("f3883 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3884(a, b) {
+  let x = a * 3884 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3884;
+  }
+  if (x > 3884) {
+    print("f3884 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3885(a, b) {
+  let x = a * 3885 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3885;
+  }
+  if (x > 3885) {
+    print("f3885 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3886(a, b) {
+  let x = a * 3886 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3886;
+  }
+  if (x > 3886) {
+    print("f3886 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3887(a, b) {
+  let x = a * 3887 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3887;
+  }
+  if (x > 3887) {
+    print("f3887 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3888(a, b) {
+  let x = a * 3888 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3888;
+  }
+  if (x > 3888) {
+    print("f3888 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3889(a, b) {
+  let x = a * 3889 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3889;
+  }
+  if (x > 3889) {
+    print("f3889 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3890(a, b) {
+  let x = a * 3890 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3890;
+  }
+  if (x > 3890) {
+    print("f3890 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3891(a, b) {
+  let x = a * 3891 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3891;
+  }
+  if (x > 3891) {
+    print("f3891 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3892(a, b) {
+  let x = a * 3892 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3892;
+  }
+  if (x > 3892) {
+    print("f3892 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3893(a, b) {
+  let x = a * 3893 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3893;
+  }
+  if (x > 3893) {
+    print("f3893 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3894(a, b) {
+  let x = a * 3894 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3894;
+  }
+  if (x > 3894) {
+    print("f3894 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3895(a, b) {
+  let x = a * 3895 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3895;
+  }
+  if (x > 3895) {
+    print("f3895 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3896(a, b) {
+  let x = a * 3896 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3896;
+  }
+  if (x > 3896) {
+    print("f3896 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3897(a, b) {
+  let x = a * 3897 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3897;
+  }
+  if (x > 3897) {
+    print("f3897 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3898(a, b) {
+  let x = a * 3898 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3898;
+  }
+  if (x > 3898) {
+    print("f3898 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3899(a, b) {
+  let x = a * 3899 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3899;
+  }
+  if (x > 3899) {
+    print("f3899 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3900(a, b) {
+  let x = a * 3900 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3900;
+  }
+  if (x > 3900) {
+    print("f3900 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3901(a, b) {
+  let x = a * 3901 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3901;
+  }
+  if (x > 3901) {
+    print("f3901 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3902(a, b) {
+  let x = a * 3902 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3902;
+  }
+  if (x > 3902) {
+    print("f3902 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3903(a, b) {
+  let x = a * 3903 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3903;
+  }
+  if (x > 3903) {
+    print("f3903 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3904(a, b) {
+  let x = a * 3904 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3904;
+  }
+  if (x > 3904) {
+    print("f3904 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3905(a, b) {
+  let x = a * 3905 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3905;
+  }
+  if (x > 3905) {
+    print("f3905 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3906(a, b) {
+  let x = a * 3906 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3906;
+  }
+  if (x > 3906) {
+    print("f3906 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3907(a, b) {
+  let x = a * 3907 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3907;
+  }
+  if (x > 3907) {
+    print("f3907 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3908(a, b) {
+  let x = a * 3908 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3908;
+  }
+  if (x > 3908) {
+    print("f3908 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3909(a, b) {
+  let x = a * 3909 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3909;
+  }
+  if (x > 3909) {
+    print("f3909 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3910(a, b) {
+  let x = a * 3910 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3910;
+  }
+  if (x > 3910) {
+    print("f3910 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3911(a, b) {
+  let x = a * 3911 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3911;
+  }
+  if (x > 3911) {
+    print("f3911 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3912(a, b) {
+  let x = a * 3912 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3912;
+  }
+  if (x > 3912) {
+    print("f3912 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3913(a, b) {
+  let x = a * 3913 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3913;
+  }
+  if (x > 3913) {
+    print("f3913 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3914(a, b) {
+  let x = a * 3914 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3914;
+  }
+  if (x > 3914) {
+    print("f3914 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3915(a, b) {
+  let x = a * 3915 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3915;
+  }
+  if (x > 3915) {
+    print("f3915 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3916(a, b) {
+  let x = a * 3916 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3916;
+  }
+  if (x > 3916) {
+    print("f3916 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3917(a, b) {
+  let x = a * 3917 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3917;
+  }
+  if (x > 3917) {
+    print("f3917 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3918(a, b) {
+  let x = a * 3918 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3918;
+  }
+  if (x > 3918) {
+    print("f3918 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3919(a, b) {
+  let x = a * 3919 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3919;
+  }
+  if (x > 3919) {
+    print("f3919 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3920(a, b) {
+  let x = a * 3920 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3920;
+  }
+  if (x > 3920) {
+    print("f3920 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3921(a, b) {
+  let x = a * 3921 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3921;
+  }
+  if (x > 3921) {
+    print("f3921 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3922(a, b) {
+  let x = a * 3922 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3922;
+  }
+  if (x > 3922) {
+    print("f3922 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3923(a, b) {
+  let x = a * 3923 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3923;
+  }
+  if (x > 3923) {
+    print("f3923 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3924(a, b) {
+  let x = a * 3924 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3924;
+  }
+  if (x > 3924) {
+    print("f3924 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3925(a, b) {
+  let x = a * 3925 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3925;
+  }
+  if (x > 3925) {
+    print("f3925 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3926(a, b) {
+  let x = a * 3926 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3926;
+  }
+  if (x > 3926) {
+    print("f3926 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3927(a, b) {
+  let x = a * 3927 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3927;
+  }
+  if (x > 3927) {
+    print("f3927 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3928(a, b) {
+  let x = a * 3928 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3928;
+  }
+  if (x > 3928) {
+    print("f3928 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3929(a, b) {
+  let x = a * 3929 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3929;
+  }
+  if (x > 3929) {
+    print("f3929 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3930(a, b) {
+  let x = a * 3930 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3930;
+  }
+  if (x > 3930) {
+    print("f3930 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3931(a, b) {
+  let x = a * 3931 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3931;
+  }
+  if (x > 3931) {
+    print("f3931 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3932(a, b) {
+  let x = a * 3932 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3932;
+  }
+  if (x > 3932) {
+    print("f3932 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3933(a, b) {
+  let x = a * 3933 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3933;
+  }
+  if (x > 3933) {
+    print("f3933 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3934(a, b) {
+  let x = a * 3934 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3934;
+  }
+  if (x > 3934) {
+    print("f3934 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3935(a, b) {
+  let x = a * 3935 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3935;
+  }
+  if (x > 3935) {
+    print("f3935 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3936(a, b) {
+  let x = a * 3936 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3936;
+  }
+  if (x > 3936) {
+    print("f3936 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3937(a, b) {
+  let x = a * 3937 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3937;
+  }
+  if (x > 3937) {
+    print("f3937 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3938(a, b) {
+  let x = a * 3938 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3938;
+  }
+  if (x > 3938) {
+    print("f3938 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3939(a, b) {
+  let x = a * 3939 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3939;
+  }
+  if (x > 3939) {
+    print("f3939 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3940(a, b) {
+  let x = a * 3940 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3940;
+  }
+  if (x > 3940) {
+    print("f3940 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3941(a, b) {
+  let x = a * 3941 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3941;
+  }
+  if (x > 3941) {
+    print("f3941 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3942(a, b) {
+  let x = a * 3942 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3942;
+  }
+  if (x > 3942) {
+    print("f3942 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3943(a, b) {
+  let x = a * 3943 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3943;
+  }
+  if (x > 3943) {
+    print("f3943 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3944(a, b) {
+  let x = a * 3944 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3944;
+  }
+  if (x > 3944) {
+    print("f3944 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3945(a, b) {
+  let x = a * 3945 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3945;
+  }
+  if (x > 3945) {
+    print("f3945 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3946(a, b) {
+  let x = a * 3946 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3946;
+  }
+  if (x > 3946) {
+    print("f3946 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3947(a, b) {
+  let x = a * 3947 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3947;
+  }
+  if (x > 3947) {
+    print("f3947 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3948(a, b) {
+  let x = a * 3948 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3948;
+  }
+  if (x > 3948) {
+    print("f3948 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3949(a, b) {
+  let x = a * 3949 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3949;
+  }
+  if (x > 3949) {
+    print("f3949 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3950(a, b) {
+  let x = a * 3950 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3950;
+  }
+  if (x > 3950) {
+    print("f3950 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3951(a, b) {
+  let x = a * 3951 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3951;
+  }
+  if (x > 3951) {
+    print("f3951 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3952(a, b) {
+  let x = a * 3952 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3952;
+  }
+  if (x > 3952) {
+    print("f3952 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3953(a, b) {
+  let x = a * 3953 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3953;
+  }
+  if (x > 3953) {
+    print("f3953 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3954(a, b) {
+  let x = a * 3954 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3954;
+  }
+  if (x > 3954) {
+    print("f3954 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3955(a, b) {
+  let x = a * 3955 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3955;
+  }
+  if (x > 3955) {
+    print("f3955 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3956(a, b) {
+  let x = a * 3956 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3956;
+  }
+  if (x > 3956) {
+    print("f3956 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3957(a, b) {
+  let x = a * 3957 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3957;
+  }
+  if (x > 3957) {
+    print("f3957 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3958(a, b) {
+  let x = a * 3958 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3958;
+  }
+  if (x > 3958) {
+    print("f3958 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3959(a, b) {
+  let x = a * 3959 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3959;
+  }
+  if (x > 3959) {
+    print("f3959 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3960(a, b) {
+  let x = a * 3960 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3960;
+  }
+  if (x > 3960) {
+    print("f3960 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3961(a, b) {
+  let x = a * 3961 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3961;
+  }
+  if (x > 3961) {
+    print("f3961 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3962(a, b) {
+  let x = a * 3962 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3962;
+  }
+  if (x > 3962) {
+    print("f3962 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3963(a, b) {
+  let x = a * 3963 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3963;
+  }
+  if (x > 3963) {
+    print("f3963 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3964(a, b) {
+  let x = a * 3964 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3964;
+  }
+  if (x > 3964) {
+    print("f3964 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3965(a, b) {
+  let x = a * 3965 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3965;
+  }
+  if (x > 3965) {
+    print("f3965 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3966(a, b) {
+  let x = a * 3966 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3966;
+  }
+  if (x > 3966) {
+    print("f3966 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3967(a, b) {
+  let x = a * 3967 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3967;
+  }
+  if (x > 3967) {
+    print("f3967 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3968(a, b) {
+  let x = a * 3968 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3968;
+  }
+  if (x > 3968) {
+    print("f3968 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3969(a, b) {
+  let x = a * 3969 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3969;
+  }
+  if (x > 3969) {
+    print("f3969 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3970(a, b) {
+  let x = a * 3970 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3970;
+  }
+  if (x > 3970) {
+    print("f3970 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3971(a, b) {
+  let x = a * 3971 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3971;
+  }
+  if (x > 3971) {
+    print("f3971 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3972(a, b) {
+  let x = a * 3972 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3972;
+  }
+  if (x > 3972) {
+    print("f3972 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3973(a, b) {
+  let x = a * 3973 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3973;
+  }
+  if (x > 3973) {
+    print("f3973 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3974(a, b) {
+  let x = a * 3974 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3974;
+  }
+  if (x > 3974) {
+    print("f3974 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3975(a, b) {
+  let x = a * 3975 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3975;
+  }
+  if (x > 3975) {
+    print("f3975 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3976(a, b) {
+  let x = a * 3976 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3976;
+  }
+  if (x > 3976) {
+    print("f3976 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3977(a, b) {
+  let x = a * 3977 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3977;
+  }
+  if (x > 3977) {
+    print("f3977 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3978(a, b) {
+  let x = a * 3978 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3978;
+  }
+  if (x > 3978) {
+    print("f3978 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3979(a, b) {
+  let x = a * 3979 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3979;
+  }
+  if (x > 3979) {
+    print("f3979 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3980(a, b) {
+  let x = a * 3980 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3980;
+  }
+  if (x > 3980) {
+    print("f3980 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3981(a, b) {
+  let x = a * 3981 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3981;
+  }
+  if (x > 3981) {
+    print("f3981 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3982(a, b) {
+  let x = a * 3982 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3982;
+  }
+  if (x > 3982) {
+    print("f3982 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3983(a, b) {
+  let x = a * 3983 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3983;
+  }
+  if (x > 3983) {
+    print("f3983 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3984(a, b) {
+  let x = a * 3984 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3984;
+  }
+  if (x > 3984) {
+    print("f3984 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3985(a, b) {
+  let x = a * 3985 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3985;
+  }
+  if (x > 3985) {
+    print("f3985 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3986(a, b) {
+  let x = a * 3986 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3986;
+  }
+  if (x > 3986) {
+    print("f3986 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3987(a, b) {
+  let x = a * 3987 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3987;
+  }
+  if (x > 3987) {
+    print("f3987 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3988(a, b) {
+  let x = a * 3988 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3988;
+  }
+  if (x > 3988) {
+    print("f3988 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3989(a, b) {
+  let x = a * 3989 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3989;
+  }
+  if (x > 3989) {
+    print("f3989 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3990(a, b) {
+  let x = a * 3990 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3990;
+  }
+  if (x > 3990) {
+    print("f3990 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3991(a, b) {
+  let x = a * 3991 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3991;
+  }
+  if (x > 3991) {
+    print("f3991 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3992(a, b) {
+  let x = a * 3992 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3992;
+  }
+  if (x > 3992) {
+    print("f3992 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3993(a, b) {
+  let x = a * 3993 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3993;
+  }
+  if (x > 3993) {
+    print("f3993 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3994(a, b) {
+  let x = a * 3994 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3994;
+  }
+  if (x > 3994) {
+    print("f3994 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3995(a, b) {
+  let x = a * 3995 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3995;
+  }
+  if (x > 3995) {
+    print("f3995 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3996(a, b) {
+  let x = a * 3996 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3996;
+  }
+  if (x > 3996) {
+    print("f3996 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3997(a, b) {
+  let x = a * 3997 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3997;
+  }
+  if (x > 3997) {
+    print("f3997 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3998(a, b) {
+  let x = a * 3998 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3998;
+  }
+  if (x > 3998) {
+    print("f3998 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function f3999(a, b) {
+  let x = a * 3999 + b;
+  for (let j = 0; j < 10; j = j + 1) {
+    x = x + j * 3999;
+  }
+  if (x > 3999) {
+    print("f3999 big");
+  } else {
+    print(x);
+  }
+  return x;
+}
+function main() {
+  print(f0(1, 2));
+  print(f100(1, 2));
+  print(f200(1, 2));
+  print(f300(1, 2));
+  print(f400(1, 2));
+  print(f500(1, 2));
+  print(f600(1, 2));
+  print(f700(1, 2));
+  print(f800(1, 2));
+  print(f900(1, 2));
+  print(f1000(1, 2));
+  print(f1100(1, 2));
+  print(f1200(1, 2));
+  print(f1300(1, 2));
+  print(f1400(1, 2));
+  print(f1500(1, 2));
+  print(f1600(1, 2));
+  print(f1700(1, 2));
+  print(f1800(1, 2));
+  print(f1900(1, 2));
+  print(f2000(1, 2));
+  print(f2100(1, 2));
+  print(f2200(1, 2));
+  print(f2300(1, 2));
+  print(f2400(1, 2));
+  print(f2500(1, 2));
+  print(f2600(1, 2));
+  print(f2700(1, 2));
+  print(f2800(1, 2));
+  print(f2900(1, 2));
+  print(f3000(1, 2));
+  print(f3100(1, 2));
+  print(f3200(1, 2));
+  print(f3300(1, 2));
+  print(f3400(1, 2));
+  print(f3500(1, 2));
+  print(f3600(1, 2));
+  print(f3700(1, 2));
+  print(f3800(1, 2));
+  print(f3900(1, 2));
+  return 0;
+}
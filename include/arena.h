@@ -24,7 +24,9 @@ Arena* arena_create(size_t block_size);
 void* arena_alloc(Arena* arena, size_t size);
 void* arena_alloc_aligned(Arena* arena, size_t size, size_t alignment);
 void arena_reset(Arena* arena);
+void arena_rewind(Arena* arena);
 void arena_destroy(Arena* arena);
+char* arena_strdup(Arena* arena, const char* str);
 
 // Convenience macros for common allocations
 #define arena_alloc_type(arena, type) ((type*)arena_alloc(arena, sizeof(type)))
@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "arena.h"
+#include "token.h"
 
 //=============================================================================
 // Type Definitions
@@ -372,6 +373,27 @@ ASTProgram *ast_parse(Arena *arena, const char *source);
 // Free AST (not needed when using arena - just call arena_reset)
 void ast_free(ASTProgram *prog);
 
+// Incremental parser: tokens are read one top-level declaration at a time,
+// so only the declaration being parsed is ever tokenized
+typedef struct ASTStream {
+    Lexer lexer;
+    Token *tokens;           // Tokens of the current declaration
+    size_t capacity;
+    Arena *statement_arena;  // Where top-level statements are kept (may be NULL)
+    ASTNode **statements;    // Top-level statements seen so far, in order
+    size_t statement_count;
+} ASTStream;
+
+void ast_stream_init(ASTStream *stream, const char *source, Arena *statement_arena);
+
+// Parse the next top-level declarations into `arena`; returns NULL at end
+// of input. Top-level statements (which belong to main) are not returned:
+// they are parsed into statement_arena and appended to stream->statements,
+// or dropped when statement_arena is NULL.
+ASTProgram *ast_stream_next(ASTStream *stream, Arena *arena);
+
+void ast_stream_free(ASTStream *stream);
+
 //=============================================================================
 // Debug / Printing
 //=============================================================================
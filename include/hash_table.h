@@ -9,9 +9,10 @@ typedef struct Entry {
     struct Entry* next;
 } Entry;
 
-// Hashtable
+// Hashtable (buckets double once entries outnumber them)
 typedef struct Hashtable {
     int size;
+    int count;
     Entry** table;
 } Hashtable;
 
@@ -53,21 +53,51 @@ typedef enum {
     IR_VALUE_GLOBAL,
 } IRValueKind;
 
+// A use of a value is the operand slot that reads it (see IROperand).
+// An instruction reading the same value through several operands has one
+// use per operand.
+typedef union IROperand IROperand;
+typedef union IROperand IRUse;
+
+// Common header of every IR value. Like AST nodes, concrete values embed
+// these fields first and are told apart by `kind`:
+//   IR_VALUE_INST    IRInstruction (the instruction is its own result)
+//   IR_VALUE_CONST   IRConstant
+//   IR_VALUE_ARG     IRValue, id is the argument index
+//   IR_VALUE_GLOBAL  IRGlobalRef
+// `uses` lists the operand slots reading the value. Only instructions and
+// arguments are tracked; constants and global refs keep an empty list, so
+// a constant may be shared by several uses.
+#define IR_VALUE_FIELDS   \
+    IRType *type;         \
+    IRUse *uses;          \
+    uint32_t id;          \
+    uint8_t kind
+
 // IR Value (used in instructions)
 typedef struct IRValue {
-    IRValueKind kind;
-    IRType *type;
-    size_t id;  // Unique ID for temp names
-    union {
-        struct IRInstruction *inst;
-        int64_t const_int;
-        double const_float;
-        char *const_string;
-        size_t arg_index;
-        char *global_name;
-    } data;
+    IR_VALUE_FIELDS;
 } IRValue;
 
+typedef struct IRConstant {
+    IR_VALUE_FIELDS;
+    union {
+        int64_t int_value;
+        double float_value;
+    };
+} IRConstant;
+
+// Reference to a module global. String literals are lowered before the
+// module pool assigns names, so `global` replaces `string` when the
+// function's strings are merged.
+typedef struct IRGlobalRef {
+    IR_VALUE_FIELDS;
+    union {
+        const char *string;
+        struct IRGlobal *global;
+    };
+} IRGlobalRef;
+
 //=============================================================================
 // IR Instructions
 //=============================================================================
@@ -85,6 +115,8 @@ typedef enum {
     IR_MUL,
     IR_DIV,
     IR_MOD,
+    IR_UDIV,    // Unsigned
+    IR_UREM,
     
     // Comparison
     IR_CMP,
@@ -96,7 +128,8 @@ typedef enum {
     
     // Bitwise
     IR_SHL,
-    IR_SHR,
+    IR_SHR,     // Logical
+    IR_SAR,     // Arithmetic
     
     // Cast
     IR_ZEXT,    // Zero extend
@@ -132,61 +165,122 @@ typedef enum {
     IR_CMP_SGE,  // Signed greater or equal
 } IRCmpKind;
 
-// IR Instruction
-typedef struct IRInstruction {
-    IROpcode opcode;
-    IRType *type;
-    IRValue *result;       // Result value (can be NULL for void)
-    
-    // For binary operations
-    IRValue *arg1;
-    IRValue *arg2;
-    
-    // For unary operations
-    IRValue *arg;
-    
-    // For comparisons
-    IRCmpKind cmp_kind;
-    
-    // For branch/call targets
-    struct IRBasicBlock *target;
-    struct IRBasicBlock *true_target;
-    struct IRBasicBlock *false_target;
-    
-    // For calls
-    char *callee_name;
-    IRValue **args;
-    size_t arg_count;
-    
-    // For phi
-    struct IRPhiArg {
+// What a function is known to do, inferred by the funcattrs pass. Memory
+// means memory the caller could see; a function's own stack slots don't
+// count.
+typedef enum IRFuncAttr {
+    IR_ATTR_READNONE = 1 << 0,   // Reads and writes no memory (implies readonly)
+    IR_ATTR_READONLY = 1 << 1,   // Writes no memory
+    IR_ATTR_WILLRETURN = 1 << 2, // Always returns: every loop is counted, no recursion, no trap
+    IR_ATTR_NORETURN = 1 << 3,   // Never returns
+    IR_ATTR_NOCAPTURE = 1 << 4,  // Keeps no pointer it is passed past the call
+} IRFuncAttr;
+
+// A call with these can be deleted when its result is unused...
+#define IR_ATTRS_NO_SIDE_EFFECTS (IR_ATTR_READONLY | IR_ATTR_WILLRETURN)
+// ...and with these also run anywhere its arguments are available
+#define IR_ATTRS_PURE (IR_ATTR_READNONE | IR_ATTR_WILLRETURN)
+
+// One operand slot. Which member is live depends on the opcode. Value
+// operands must be written through ir_set_operand() so use lists stay
+// current:
+//   binary ops, IR_CMP   ops[0], ops[1] values
+//   casts, IR_LOAD       ops[0] value (IR_LOAD: address)
+//   IR_STORE             ops[0] value, ops[1] address
+//   IR_GETPTR            ops[0] base, ops[1] index, ops[2].imm element size
+//   IR_ALLOC             ops[0].imm slot size in bytes
+//   IR_RET               ops[0] value (NULL for void)
+//   IR_BR                ops[0].block target
+//   IR_CBR               ops[0] condition, ops[1].block true, ops[2].block false
+//   IR_CALL              ops[0].call
+//   IR_PHI               ops[0].phi
+// A value slot is also the value's use record: `use_link` chains the slots
+// reading the same value, so tracking uses allocates nothing. Slots are
+// 8-byte aligned, which leaves the low bits of the link free to hold the
+// slot's own operand index; that finds the user (see ir_use_user()).
+union IROperand {
+    struct {
         IRValue *value;
-        struct IRBasicBlock *block;
-    } *phi_args;
-    size_t phi_arg_count;
-    
-    // For alloc
-    IRValue *alloc_size;
-    
-    // For load/store
-    IRValue *mem_addr;
-    
-    // For getptr
-    IRValue *index;
-    size_t element_size;
-    
-    // Linked list
-    struct IRInstruction *next;
+        uintptr_t use_link; // Next use of `value` | IR_USE_INDEX bits
+    };
+    struct IRBasicBlock *block;
+    struct IRCallData *call;
+    struct IRPhiData *phi;
+    int64_t imm;
+};
+
+#define IR_MAX_OPERANDS 3
+#define IR_USE_INDEX 3          // Mask of the operand index in use_link...
+#define IR_USE_OUT_OF_LINE 3    // ...or this, for call and phi arguments
+
+// Out-of-line operands for calls and phis. Their slots are uses as well and
+// name the user themselves, right after the slot.
+typedef struct IRCallArg {
+    IROperand use;
+    struct IRInstruction *user;
+} IRCallArg;
+
+typedef struct IRCallData {
+    const char *callee_name; // Static or owned by the AST, never copied
+    uint32_t callee_attrs;  // IRFuncAttr of the callee, 0 for external or unknown
+    uint32_t arg_count;
+    IRCallArg args[];
+} IRCallData;
+
+typedef struct IRPhiArg {
+    IROperand use;
+    struct IRInstruction *user;
+    struct IRBasicBlock *block;
+} IRPhiArg;
+
+typedef struct IRPhiData {
+    IRPhiArg *args;
+    uint32_t arg_count;
+    uint32_t capacity;
+} IRPhiData;
+
+// IR Instruction. The header doubles as the result value; instructions
+// without a result have type void. Instructions are allocated with only
+// the operand storage their opcode uses, a trailing block, immediate or
+// data slot cut to its first word (IR_NOP keeps what it had), so an opcode
+// may only be changed in place to one that needs no more.
+typedef struct IRInstruction {
+    IR_VALUE_FIELDS;
+    uint8_t opcode;        // IROpcode
+    uint8_t cmp_kind;      // IRCmpKind, for IR_CMP
+    struct IRBasicBlock *block; // Containing block, NULL once removed
+    IROperand ops[IR_MAX_OPERANDS];
 } IRInstruction;
 
+// Walking a value's use list
+static inline IRUse *ir_use_next(IRUse *use) {
+    return (IRUse*)(use->use_link & ~(uintptr_t)IR_USE_INDEX);
+}
+
+// The instruction `use` is an operand of
+static inline IRInstruction *ir_use_user(IRUse *use) {
+    size_t index = use->use_link & IR_USE_INDEX;
+    if (index == IR_USE_OUT_OF_LINE) return *(IRInstruction**)(use + 1); // IRCallArg/IRPhiArg.user
+    return (IRInstruction*)((char*)(use - index) - offsetof(IRInstruction, ops));
+}
+
+_Static_assert(offsetof(IRCallArg, user) == sizeof(IROperand), "user must follow the slot");
+_Static_assert(offsetof(IRPhiArg, user) == sizeof(IROperand), "user must follow the slot");
+
 //=============================================================================
 // Basic Blocks
 //=============================================================================
 
+// Labels are formatted at emission as "<name>.<id>"; `name` is a hint
+// with static lifetime (e.g. "for.cond"), never copied. Instructions are
+// kept in program order in an arena-backed array.
 typedef struct IRBasicBlock {
-    char name[64];
-    IRInstruction *instructions;
-    IRInstruction *last_instruction;
+    uint32_t id;
+    uint32_t inst_count;
+    uint32_t inst_capacity;
+    const char *name;
+    struct IRFunction *function;
+    IRInstruction **instructions;
     struct IRBasicBlock *next;
 } IRBasicBlock;
 
@@ -194,6 +288,8 @@ typedef struct IRBasicBlock {
 // Functions
 //=============================================================================
 
+#define IR_SPARE_ARRAY_CLASSES 16
+
 typedef struct IRFunction {
     char *name;
     IRType *return_type;
@@ -204,6 +300,24 @@ typedef struct IRFunction {
     IRBasicBlock *blocks;
     IRBasicBlock *last_block;
     IRBasicBlock *entry_block;
+    Arena *arena;          // Arena owning this function's IR
+    uint32_t temp_counter; // For generating unique temp names
+    uint32_t block_counter; // For generating unique labels
+    struct IRGlobalRef **strings; // String constants referenced by this function
+    size_t string_count;
+    size_t string_capacity;
+    // Instruction arrays blocks outgrew, by log2 of their capacity, for
+    // other blocks to grow into
+    IRInstruction **spare_arrays[IR_SPARE_ARRAY_CLASSES];
+    // Set while the function is generated: block arrays are malloc'd
+    // until then and copied into the arena exactly sized at the end, and
+    // constants are shared through a malloc'd open-addressed table
+    bool building;
+    struct IRConstant **constants;
+    uint32_t constant_count;
+    uint32_t constant_capacity;
+    struct IRCFG *cfg;     // Cached analysis, see ir_analysis.h
+    uint32_t attrs;        // IRFuncAttr
 } IRFunction;
 
 //=============================================================================
@@ -222,6 +336,9 @@ typedef struct IRGlobal {
     IRType *type;
     IRValue *init_value;
     char *string_value;  // For string constants
+    size_t length;       // strlen(string_value)
+    struct IRGlobal *tail_of; // Set when stored as the tail of another string
+    size_t tail_offset;       // Byte offset into tail_of
     struct IRGlobal *next;
 } IRGlobal;
 
@@ -231,13 +348,26 @@ typedef struct IRGlobal {
 
 typedef struct IRModule {
     char *name;
+    Arena *arena;          // Arena for module-level data
     IRFunction **functions;
     size_t function_count;
     IRGlobal **globals;
     size_t global_count;
-    size_t temp_counter;  // For generating unique temp names
+    size_t global_capacity;
     size_t global_counter; // For generating unique global names
-    size_t label_counter; // For generating unique labels
+    struct Hashtable *string_table; // String value -> IRGlobal
+    bool merge_strings;    // Store strings that end another one as its tail
+    size_t thread_count;   // Worker threads for generation/emission (0 = one per CPU)
+    Arena **worker_arenas; // One arena per worker thread
+    size_t worker_count;
+    struct Hashtable *function_table; // Function name -> IRFunction
+    struct IRPassManager *pass_manager; // Optimization pipeline, NULL at -O0
+
+    // Streaming statistics; function IR is dropped once emitted
+    bool streamed;
+    size_t streamed_blocks;
+    size_t streamed_instructions;
+    size_t peak_function_bytes;
 } IRModule;
 
 //=============================================================================
@@ -253,32 +383,120 @@ IRFunction *ir_function_create(IRModule *mod, const char *name, IRType *return_t
 // Add a basic block to a function
 IRBasicBlock *ir_basic_block_create(IRFunction *func, const char *name);
 
-// Add an instruction to a basic block
-IRInstruction *ir_inst_create(IRBasicBlock *block, IROpcode opcode);
+// Move a block to just after `after` in emission order. The entry block
+// stays first and cannot be moved.
+void ir_block_move_after(IRBasicBlock *block, IRBasicBlock *after);
+
+// Move the instructions of `block` from `index` on into a new block placed
+// after it. The new block takes over the successors, whose phis are
+// updated; `block` is left without a terminator.
+IRBasicBlock *ir_block_split(IRBasicBlock *block, size_t index, const char *name);
+
+// Move all instructions of `succ` to the end of `block`, which must have
+// no terminator, and update the phis of the successors. `succ` is left
+// empty and unreachable.
+void ir_block_merge(IRBasicBlock *block, IRBasicBlock *succ);
+
+// Add an instruction to a basic block. Instructions with a non-void type
+// get a fresh temp ID and can be used directly as an IRValue.
+IRInstruction *ir_inst_create(IRBasicBlock *block, IROpcode opcode, IRType *type);
+
+// Like ir_inst_create(), but insert at position `index` of the block
+IRInstruction *ir_inst_insert(IRBasicBlock *block, size_t index, IROpcode opcode, IRType *type);
+
+// Insert a copy of `inst` at position `index` of `block`: same opcode and
+// operands, but a fresh temp and its own call or phi data. Callers remap
+// the operands afterwards.
+IRInstruction *ir_inst_clone(IRBasicBlock *block, size_t index, IRInstruction *inst);
+
+// Move an instruction to position `index` of `block`, keeping its operands
+// and uses
+void ir_inst_move(IRInstruction *inst, IRBasicBlock *block, size_t index);
+
+// Unlink an instruction from its block and drop the uses it holds. The
+// instruction's own result must no longer be used.
+void ir_inst_remove(IRInstruction *inst);
+
+// Drop an instruction's operands and turn it into an IR_NOP in place. Passes
+// that delete many instructions erase them and then compact each block
+// once instead of paying for ir_inst_remove() per instruction.
+void ir_inst_erase(IRInstruction *inst);
+
+// Remove the IR_NOPs from a block
+void ir_block_compact(IRBasicBlock *block);
+
+// Last instruction of a block if it is a terminator, else NULL
+IRInstruction *ir_block_terminator(IRBasicBlock *block);
 
 // Helper functions for creating instructions
-IRValue *ir_const_int(IRType *type, int64_t value);
-IRValue *ir_const_float(IRType *type, double value);
-IRValue *ir_const_string(IRModule *mod, IRType *type, const char *value);
-IRValue *ir_arg(IRType *type, size_t index);
-IRValue *ir_temp(IRModule *mod, IRType *type);
+IRValue *ir_const_int(IRFunction *func, IRType *type, int64_t value);
+IRValue *ir_const_float(IRFunction *func, IRType *type, double value);
+IRValue *ir_const_string(IRFunction *func, IRType *type, const char *value);
+IRValue *ir_arg(IRFunction *func, IRType *type, size_t index);
+
+// Out-of-line operand helpers
+IRCallData *ir_call_data_create(IRFunction *func, const char *callee_name, size_t arg_count);
+void ir_phi_add_incoming(IRFunction *func, IRInstruction *phi, IRValue *value, IRBasicBlock *block);
+void ir_phi_remove_incoming(IRInstruction *phi, IRBasicBlock *block);
 
-// Add global string constant
+//=============================================================================
+// Def-Use Chains
+//=============================================================================
+
+// Number of value operands of an instruction. Operand `index` is ops[index]
+// for fixed-arity opcodes and the index-th argument for IR_CALL and IR_PHI.
+size_t ir_operand_count(IRInstruction *inst);
+IRUse *ir_operand_use(IRInstruction *inst, size_t index);
+IRValue *ir_get_operand(IRInstruction *inst, size_t index);
+
+// Write a value operand, moving the use from the old value to the new one
+void ir_set_operand(IRInstruction *inst, size_t index, IRValue *value);
+
+// Point every use of `value` at `replacement` (O(uses))
+void ir_replace_all_uses(IRValue *value, IRValue *replacement);
+
+size_t ir_use_count(IRValue *value);
+
+// True for instructions that must be kept even when their result is unused
+bool ir_inst_has_side_effects(IRInstruction *inst);
+
+// True if the instruction's result is unused and it has no side effects
+bool ir_inst_is_dead(IRInstruction *inst);
+
+// Add global string constant, reusing an existing one with the same value
 IRGlobal *ir_add_string(IRModule *mod, const char *value);
 
+// Point every string that is a suffix of another at the longer one's
+// storage ("bar" becomes $foobar + 3). Run by ir_generate() when
+// mod->merge_strings is set.
+void ir_merge_string_tails(IRModule *mod);
+
 //=============================================================================
 // Code Generation
 //=============================================================================
 
-// Generate QBE IR from AST
+// Generate QBE IR from AST (functions are lowered in parallel, see
+// IRModule.thread_count; string IDs are assigned in source order) and run
+// the module's pass pipeline over it
 int ir_generate(IRModule *mod, ASTProgram *ast);
 
 // Emit QBE IR to file
 int ir_emit(IRModule *mod, const char *filename);
 
+// Streaming pipeline: parse, lower and emit one function at a time into
+// `filename`, rewinding a per-function arena in between. Only signatures,
+// top-level statements and the string pool stay resident. String data is
+// emitted after the functions, and tail merging is not applied. Function
+// passes run on each function before it is emitted; module passes, which
+// need the whole module, are skipped.
+int ir_compile_stream(IRModule *mod, const char *source, const char *filename);
+
 // Print QBE IR to file (FILE*)
 void ir_print(IRModule *mod, FILE *fp);
 
+// Print IR size statistics (instruction count, bytes per instruction)
+void ir_print_stats(IRModule *mod, FILE *fp);
+
 //=============================================================================
 // Cleanup
 //=============================================================================
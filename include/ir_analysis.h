@@ -0,0 +1,262 @@
+#ifndef EMERALD_IR_ANALYSIS_H
+#define EMERALD_IR_ANALYSIS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ir.h"
+
+//=============================================================================
+// Control-Flow Graph Analysis
+//=============================================================================
+
+// Position of unreachable blocks in IRCFG.rpo_index
+#define IR_CFG_UNREACHABLE UINT32_MAX
+
+typedef struct IRBlockList {
+    IRBasicBlock **items;
+    uint32_t count;
+} IRBlockList;
+
+// Natural loop: all blocks that reach a back edge to `header` without
+// passing through it
+typedef struct IRLoop {
+    IRBasicBlock *header;
+    struct IRLoop *parent;   // Enclosing loop, NULL if outermost
+    uint32_t depth;          // 1 for outermost loops
+    IRBasicBlock **blocks;   // Header first, including nested loops
+    uint32_t block_count;
+    IRBasicBlock **latches;  // Sources of back edges to the header
+    uint32_t latch_count;
+} IRLoop;
+
+// CFG facts for one function. Per-block arrays are indexed by block id.
+// Everything is allocated from `arena` and dropped by ir_cfg_invalidate().
+typedef struct IRCFG {
+    IRFunction *function;
+    Arena *arena;
+    uint32_t capacity;          // Size of the per-block arrays
+    IRBlockList *preds;
+    IRBlockList *succs;
+    IRBasicBlock **rpo;         // Reachable blocks in reverse postorder
+    uint32_t rpo_count;
+    uint32_t *rpo_index;        // IR_CFG_UNREACHABLE if not reachable
+    IRBasicBlock **idom;        // Immediate dominator, NULL for entry
+    IRBlockList *dom_children;  // Dominator tree
+    uint32_t *dom_pre;          // Dominator tree pre/post numbers for
+    uint32_t *dom_post;         // constant-time dominance queries
+
+    // Computed on first request
+    IRBlockList *frontiers;
+    IRLoop **loops;             // Outer loops before the loops they contain
+    uint32_t loop_count;
+    IRLoop **loop_of;           // Innermost loop containing each block
+} IRCFG;
+
+// Successors of a block, read from its terminator (no analysis needed)
+size_t ir_block_succ_count(IRBasicBlock *block);
+IRBasicBlock *ir_block_succ(IRBasicBlock *block, size_t index);
+
+// Retarget successor `index` of a branch and invalidate the cached CFG
+void ir_branch_set_target(IRInstruction *branch, size_t index, IRBasicBlock *target);
+
+// Turn a conditional branch into a jump to successor `taken` (0 or 1),
+// dropping the block from the phis of the other successor
+void ir_branch_fold(IRInstruction *branch, size_t taken);
+
+// Get the function's CFG, building it if the cache was invalidated
+IRCFG *ir_cfg_get(IRFunction *func);
+
+// Drop the cached analysis. Done automatically when blocks are created or
+// terminators inserted, removed or retargeted through the IR API; passes
+// that rewrite branch operands directly must call it themselves.
+void ir_cfg_invalidate(IRFunction *func);
+
+bool ir_block_reachable(IRCFG *cfg, IRBasicBlock *block);
+
+// True if every path from entry to `b` passes through `a` (a dominates b)
+bool ir_dominates(IRCFG *cfg, IRBasicBlock *a, IRBasicBlock *b);
+
+// True if `def` is available at `use` (same block: def comes first)
+bool ir_inst_dominates(IRCFG *cfg, IRInstruction *def, IRInstruction *use);
+
+// Dominance frontier of each block (Cooper-Harvey-Kennedy)
+IRBlockList *ir_cfg_frontiers(IRCFG *cfg);
+
+// Natural loops, computed together with their nesting
+void ir_cfg_compute_loops(IRCFG *cfg);
+IRLoop *ir_cfg_loop_of(IRCFG *cfg, IRBasicBlock *block);
+bool ir_loop_contains(IRCFG *cfg, IRLoop *loop, IRBasicBlock *block);
+
+// The block outside `loop` that enters it, if there is only one and it
+// jumps nowhere else
+IRBasicBlock *ir_loop_preheader(IRCFG *cfg, IRLoop *loop);
+
+// Give every loop not headed by the entry block a preheader. Returns true
+// if blocks were added, which drops the cached CFG.
+bool ir_loops_insert_preheaders(IRFunction *func);
+
+//=============================================================================
+// Scalar Evolution
+//=============================================================================
+
+// Integer values in a loop described as functions of the iteration number
+// k (0 the first time the header runs). A value is the add-recurrence
+// {c0,+,c1,+,c2}: c0 + c1*k + c2*k*(k-1)/2, wrapped at `bits`. The
+// coefficients are loop-invariant: a constant plus multiples of values
+// defined outside the loop, each read sign-extended to 64 bits.
+
+#define IR_SCEV_MAX_TERMS 4
+#define IR_SCEV_MAX_DEGREE 2
+
+typedef struct IRSCEVTerm {
+    IRValue *value;
+    int64_t scale;
+} IRSCEVTerm;
+
+typedef struct IRSCEVCoef {
+    int64_t constant;
+    uint32_t term_count;
+    IRSCEVTerm terms[IR_SCEV_MAX_TERMS];
+} IRSCEVCoef;
+
+typedef struct IRSCEV {
+    IRSCEVCoef coef[IR_SCEV_MAX_DEGREE + 1];
+    uint32_t degree;  // 0 for loop-invariant values
+    uint32_t bits;    // The formula gives the value modulo 2^bits
+} IRSCEV;
+
+// How often a loop runs: it stays in the loop while `iv` < `bound` (step
+// > 0) or `iv` > `bound` (step < 0), tested in the header before the body.
+// The analysis has proven that `iv` does not wrap on the way.
+typedef struct IRTripCount {
+    IRInstruction *iv;    // 32-bit header phi
+    IRInstruction *test;  // Compare the header branches on
+    IRValue *start;       // Value of iv on entry
+    IRValue *bound;       // Exclusive, a 32-bit value or constant
+    int64_t step;
+    bool is_constant;
+    int64_t count;        // Times the body runs, if constant
+} IRTripCount;
+
+// Per-loop analysis state. NULL if the loop lacks a preheader or has more
+// than one latch.
+typedef struct IRLoopSCEV IRLoopSCEV;
+
+IRLoopSCEV *ir_scev_create(IRCFG *cfg, IRLoop *loop);
+void ir_scev_free(IRLoopSCEV *se);
+
+IRBasicBlock *ir_scev_preheader(IRLoopSCEV *se);
+IRBasicBlock *ir_scev_latch(IRLoopSCEV *se);
+
+// out = a + b * scale; false if there are too many distinct terms
+bool ir_scev_coef_add(IRSCEVCoef *out, const IRSCEVCoef *a, const IRSCEVCoef *b, int64_t scale);
+
+// False if the value is not an integer recurrence of degree 2 or less
+bool ir_scev_get(IRLoopSCEV *se, IRValue *value, IRSCEV *out);
+
+// NULL unless the loop leaves only from the header on a counted test
+const IRTripCount *ir_scev_trip_count(IRLoopSCEV *se);
+
+// Emit code at position *index of `block` and advance *index past it.
+// Operands must be available there (the preheader is always fine).
+IRValue *ir_scev_expand_coef(IRFunction *func, const IRSCEVCoef *coef, IRType *type,
+                             IRBasicBlock *block, size_t *index);
+// Value of `scev` at iteration `k`, a 64-bit value
+IRValue *ir_scev_expand_at(IRFunction *func, const IRSCEV *scev, IRValue *k, IRType *type,
+                           IRBasicBlock *block, size_t *index);
+// The trip count as a 64-bit value
+IRValue *ir_scev_expand_trip_count(IRLoopSCEV *se, IRBasicBlock *block, size_t *index);
+
+//=============================================================================
+// Branch Probabilities
+//=============================================================================
+
+// Static estimates in the style of Ball and Larus: the first heuristic
+// that applies decides, in this order:
+//   - loop: staying in the innermost loop is likely
+//   - return: a successor that only returns is unlikely
+//   - call: a successor that makes a call is unlikely
+//   - compare: equality with a constant and values below zero are unlikely
+// The return and call heuristics only look at successors entered from
+// nowhere else, which cannot be the join of both paths.
+
+#define IR_PROB_SCALE 1024
+#define IR_PROB_EVEN (IR_PROB_SCALE / 2)
+
+// Probability, out of IR_PROB_SCALE, that the conditional branch ending
+// `block` goes to its true successor. IR_PROB_EVEN if nothing applies.
+uint32_t ir_branch_probability(IRCFG *cfg, IRBasicBlock *block);
+
+//=============================================================================
+// Alias Analysis
+//=============================================================================
+
+// Whether two accesses can touch the same bytes. An address is split into
+// the object it points into and a byte offset, looking through GETPTRs
+// with constant indices. Distinct allocs and globals never overlap, and an
+// alloc whose address never escapes cannot be reached through any other
+// pointer. Accesses into one object are told apart by their offsets.
+
+typedef enum IRAliasResult {
+    IR_NO_ALIAS,
+    IR_MAY_ALIAS,
+    IR_MUST_ALIAS,           // Same bytes
+} IRAliasResult;
+
+typedef struct IRMemLoc {
+    IRValue *base;           // Alloc, global, argument or other pointer
+    int64_t offset;          // Bytes from base, if offset_known
+    bool offset_known;
+} IRMemLoc;
+
+IRMemLoc ir_mem_loc(IRValue *address);
+
+// Address a load or store goes through, NULL for other instructions
+IRValue *ir_mem_address(IRInstruction *inst);
+
+// Bytes a load or store touches; a store's width follows its slot's type
+uint32_t ir_mem_access_size(IRInstruction *inst);
+
+// Whether the alloc's address is used other than to load and store
+// through, or to pass to a callee that keeps no pointer
+bool ir_alloc_escapes(IRInstruction *alloc);
+
+IRAliasResult ir_alias(IRValue *a, uint32_t a_size, IRValue *b, uint32_t b_size);
+
+// Whether a call may read or write memory at `address`
+bool ir_call_may_access(IRInstruction *call, IRValue *address);
+
+//=============================================================================
+// Call Graph
+//=============================================================================
+
+// Calls between the functions of a module; calls to functions defined
+// elsewhere (libc) are not edges. Nodes are in module order. Components
+// are the strongly connected ones: a function is in the same component as
+// the functions it is mutually recursive with.
+
+typedef struct IRCallGraphNode {
+    IRFunction *function;
+    uint32_t *callees;       // Node index per call site naming a module function
+    uint32_t callee_count;
+    uint32_t caller_count;   // Call sites naming this function
+    uint32_t scc;            // Component, numbered callees first
+} IRCallGraphNode;
+
+typedef struct IRCallGraph {
+    IRModule *module;
+    IRCallGraphNode *nodes;
+    uint32_t node_count;
+    uint32_t *bottom_up;     // Node indices, each component after those it calls
+    uint32_t scc_count;
+    struct Hashtable *by_name;
+} IRCallGraph;
+
+IRCallGraph *ir_call_graph_build(IRModule *mod);
+void ir_call_graph_free(IRCallGraph *graph);
+
+// Node of the module function a call names, NULL for external functions
+IRCallGraphNode *ir_call_graph_callee(IRCallGraph *graph, IRInstruction *call);
+
+#endif // EMERALD_IR_ANALYSIS_H
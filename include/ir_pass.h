@@ -0,0 +1,141 @@
+#ifndef EMERALD_IR_PASS_H
+#define EMERALD_IR_PASS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "ir.h"
+
+//=============================================================================
+// Optimization Passes
+//=============================================================================
+
+// Analyses a pass leaves valid when it changes the IR
+#define IR_PRESERVES_NONE 0
+#define IR_PRESERVES_CFG  (1u << 0) // Blocks, branches and loops untouched
+
+// A pass works either on one function at a time (`run`, may run in
+// parallel with other functions) or on the whole module (`run_module`,
+// a barrier between function passes). Both return true if the IR changed.
+typedef struct IRPass {
+    const char *name;
+    const char *description;
+    bool (*run)(IRFunction *func);
+    bool (*run_module)(IRModule *mod);
+    uint32_t preserves;
+} IRPass;
+
+// Totals for one pipeline slot over every function it ran on
+typedef struct IRPassStats {
+    double seconds;
+    size_t runs;
+    size_t changed;
+    int64_t inst_delta; // Instructions after minus before
+} IRPassStats;
+
+typedef struct IRPassManager {
+    const IRPass **passes;
+    size_t pass_count;
+    size_t pass_capacity;
+    IRPassStats *stats;    // One entry per pipeline slot
+    pthread_mutex_t lock;  // Guards stats when functions run in parallel
+    bool verify_each;      // Verify the IR after every pass (-verify-each)
+} IRPassManager;
+
+// Registered pass by name, NULL if unknown
+const IRPass *ir_pass_lookup(const char *name);
+
+// Print the registered passes and the -O pipelines
+void ir_pass_list(FILE *fp);
+
+// Empty pipeline (-O0)
+void ir_pass_manager_init(IRPassManager *pm);
+void ir_pass_manager_free(IRPassManager *pm);
+
+// Append the pipeline for -O<level>; levels above 3 are treated as 3
+void ir_pass_manager_add_level(IRPassManager *pm, int level);
+
+// Append passes from a comma-separated list ("mem2reg,sccp,dce"). Returns
+// false and names the offending pass on stderr if one is unknown.
+bool ir_pass_manager_add_list(IRPassManager *pm, const char *list);
+
+// Run pipeline slots [begin, end) over one function. The slots must all be
+// function passes. The function's cached CFG is dropped afterwards.
+void ir_pass_manager_run_function(IRPassManager *pm, IRFunction *func, size_t begin, size_t end);
+
+// Run the module pass in slot `index`
+void ir_pass_manager_run_module(IRPassManager *pm, IRModule *mod, size_t index);
+
+// Per-pass wall time and instruction deltas
+void ir_pass_manager_print_stats(IRPassManager *pm, FILE *fp);
+
+//=============================================================================
+// Passes
+//=============================================================================
+
+extern const IRPass ir_pass_mem2reg;
+extern const IRPass ir_pass_tailrec;
+extern const IRPass ir_pass_sccp;
+extern const IRPass ir_pass_instcombine;
+extern const IRPass ir_pass_gvn;
+extern const IRPass ir_pass_memopt;
+extern const IRPass ir_pass_licm;
+extern const IRPass ir_pass_indvars;
+extern const IRPass ir_pass_unroll;
+extern const IRPass ir_pass_rotate;
+extern const IRPass ir_pass_vrp;
+extern const IRPass ir_pass_funcattrs;
+extern const IRPass ir_pass_inline;
+extern const IRPass ir_pass_simplifycfg;
+extern const IRPass ir_pass_dce;
+extern const IRPass ir_pass_layout;
+extern const IRPass ir_pass_stackcolor;
+
+//=============================================================================
+// Utilities for passes
+//=============================================================================
+
+size_t ir_function_inst_count(IRFunction *func);
+
+// Send jumps through blocks that only jump straight to the destination
+bool ir_bypass_empty_blocks(IRFunction *func);
+
+// Delete blocks not reachable from entry, with their phi entries elsewhere
+bool ir_remove_unreachable_blocks(IRFunction *func);
+
+// Compile-time value of an operand. Integers are sign-extended from the
+// width of their QBE class (32 bits for w, 64 for l).
+typedef union IRFoldValue {
+    int64_t i;
+    double f;
+} IRFoldValue;
+
+bool ir_type_is_float(IRType *type);
+int ir_type_bits(IRType *type);
+int64_t ir_fold_normalize(int64_t value, int bits);
+
+// Read a constant operand; false for anything else
+bool ir_fold_operand(IRValue *value, IRFoldValue *out);
+IRValue *ir_fold_constant(IRFunction *func, IRType *type, IRFoldValue value);
+
+// Evaluate an arithmetic, compare or cast instruction on known operands
+// with QBE's semantics. False if the result is not a constant: the
+// instruction traps, the conversion is undefined, or it is not foldable.
+bool ir_fold_instruction(IRInstruction *inst, const IRFoldValue *operands, IRFoldValue *out);
+bool ir_fold_compare(IRCmpKind kind, IRType *operand_type, IRFoldValue a, IRFoldValue b, bool *out);
+
+// Comparison with its operands swapped: a < b is b > a
+IRCmpKind ir_cmp_swap(IRCmpKind kind);
+// Comparison that is true exactly when `kind` is false. Integers only: an
+// unordered float compare is false both ways.
+IRCmpKind ir_cmp_invert(IRCmpKind kind);
+
+// Check structural invariants: one terminator per block, in last position;
+// operands defined in the function and dominating their uses; phis with
+// one entry per predecessor; use lists in sync with operands. Prints the
+// first problem and returns false.
+bool ir_verify_function(IRFunction *func, FILE *fp);
+
+#endif // EMERALD_IR_PASS_H
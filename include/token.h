@@ -2,6 +2,7 @@
 #define TOKEN_H
 
 #include <stddef.h>
+#include <stdbool.h>
 
 typedef enum {
     TOKEN_EOF,          // End of file
@@ -78,7 +79,18 @@ typedef struct Token {
     int column;
 } Token;
 
+// Incremental lexer state
+typedef struct Lexer {
+    const char* input;
+    int pos;
+    int line;
+    int column;
+} Lexer;
+
 // Tokenizer functions
+void lexer_init(Lexer* lexer, const char* input);
+// Scan the next token; returns false once it stores the EOF token
+bool lexer_next(Lexer* lexer, Token* token);
 Token* tokenize(const char* input);
 void free_tokens(Token* tokens);
 void print_tokens(const Token* tokens);
@@ -133,6 +133,24 @@ void arena_reset(Arena* arena) {
     arena->current_block = NULL;
 }
 
+// Rewind the arena to empty but keep its oldest block for reuse, so a
+// loop that fills and rewinds the arena does not go back to malloc
+void arena_rewind(Arena* arena) {
+    if (!arena || !arena->current_block) {
+        return;
+    }
+    
+    ArenaBlock* current = arena->current_block;
+    while (current->next) {
+        ArenaBlock* next = current->next;
+        free(current);
+        current = next;
+    }
+    
+    current->used = 0;
+    arena->current_block = current;
+}
+
 // Destroy the arena and free all memory
 void arena_destroy(Arena* arena) {
     if (!arena) {
@@ -143,6 +161,20 @@ void arena_destroy(Arena* arena) {
     free(arena);
 }
 
+// Copy a NUL-terminated string into the arena
+char* arena_strdup(Arena* arena, const char* str) {
+    if (!str) {
+        return NULL;
+    }
+    
+    size_t len = strlen(str) + 1;
+    char* copy = arena_alloc(arena, len);
+    if (copy) {
+        memcpy(copy, str, len);
+    }
+    return copy;
+}
+
 // Get the total used memory across all blocks
 size_t arena_get_used_memory(Arena* arena) {
     if (!arena) {
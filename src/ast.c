@@ -92,6 +92,21 @@ static Type *parse_type(Parser *parser);
 // AST Node Creation
 //=============================================================================
 
+// Append to a node list allocated in the arena. The capacity is implied by
+// the count: the array doubles whenever the count reaches a power of two.
+static ASTNode **ast_list_append(Arena *arena, ASTNode **list, size_t count, ASTNode *item) {
+    if (count == 0 || (count >= 4 && (count & (count - 1)) == 0)) {
+        size_t capacity = count ? count * 2 : 4;
+        ASTNode **grown = arena_alloc_array(arena, ASTNode*, capacity);
+        if (count) {
+            memcpy(grown, list, sizeof(ASTNode*) * count);
+        }
+        list = grown;
+    }
+    list[count] = item;
+    return list;
+}
+
 //=============================================================================
 // Parsing Functions
 //=============================================================================
@@ -123,7 +138,7 @@ static ASTIdentifier *parse_identifier(Parser *parser) {
     node->type = NULL;
     node->line = parser_current(parser)->line;
     node->column = parser_current(parser)->column;
-    node->name = strdup(tok->value);
+    node->name = arena_strdup(parser->arena, tok->value);
     return node;
 }
 
@@ -167,7 +182,7 @@ static ASTNode *parse_literal(Parser *parser) {
     node->type = NULL;
     node->line = parser_current(parser)->line;
     node->column = parser_current(parser)->column;
-        node->value = strdup(tok->value);
+        node->value = arena_strdup(parser->arena, tok->value);
         node->type = &g_type_string;
         parser_advance(parser);
         return (ASTNode*)node;
@@ -225,8 +240,8 @@ static ASTNode *parse_primary(Parser *parser) {
             if (!parser_check(parser, TOKEN_RIGHT_PAREN)) {
                 do {
                     ASTNode *arg = parse_expression(parser);
-                    node->args = realloc(node->args, sizeof(ASTNode*) * (node->arg_count + 1));
-                    node->args[node->arg_count++] = arg;
+                    node->args = ast_list_append(parser->arena, node->args, node->arg_count, arg);
+                    node->arg_count++;
                 } while (parser_match(parser, TOKEN_COMMA));
             }
             
@@ -453,8 +468,8 @@ static ASTBlock *parse_block(Parser *parser) {
     while (!parser_check(parser, TOKEN_RIGHT_BRACE) && !parser_check(parser, TOKEN_EOF)) {
         ASTNode *stmt = parse_statement(parser);
         if (stmt) {
-            node->statements = realloc(node->statements, sizeof(ASTNode*) * (node->statement_count + 1));
-            node->statements[node->statement_count++] = stmt;
+            node->statements = ast_list_append(parser->arena, node->statements, node->statement_count, stmt);
+            node->statement_count++;
         }
     }
     
@@ -479,8 +494,8 @@ static ASTPrintStmt *parse_print(Parser *parser, bool is_println) {
     if (!parser_check(parser, TOKEN_RIGHT_PAREN)) {
         do {
             ASTNode *arg = parse_expression(parser);
-            node->args = realloc(node->args, sizeof(ASTNode*) * (node->arg_count + 1));
-            node->args[node->arg_count++] = arg;
+            node->args = ast_list_append(parser->arena, node->args, node->arg_count, arg);
+            node->arg_count++;
         } while (parser_match(parser, TOKEN_COMMA));
     }
     
@@ -547,20 +562,21 @@ static ASTForStmt *parse_for(Parser *parser) {
             }
             parser_advance(parser);
             
-            ASTVariableDecl *node = ast_new(parser->arena, ASTVariableDecl);
-    node->kind = AST_VARIABLE_DECL;
-    node->type = NULL;
-    node->line = parser_current(parser)->line;
-    node->column = parser_current(parser)->column;
-            node->name = strdup(name_tok->value);
-            node->is_mutable = false;
-            node->var_type = &g_type_i32;
+            ASTVariableDecl *decl = ast_new(parser->arena, ASTVariableDecl);
+            decl->kind = AST_VARIABLE_DECL;
+            decl->type = NULL;
+            decl->line = name_tok->line;
+            decl->column = name_tok->column;
+            decl->name = arena_strdup(parser->arena, name_tok->value);
+            decl->is_mutable = false;
+            decl->var_type = &g_type_i32;
 
             if (parser_match(parser, TOKEN_ASSIGN)) {
-                node->init = parse_expression(parser);
+                decl->init = parse_expression(parser);
             } else {
-                node->init = NULL;
+                decl->init = NULL;
             }
+            node->init = (ASTNode*)decl;
         } else {
             node->init = parse_expression(parser);
         }
@@ -617,7 +633,7 @@ static ASTVariableDecl *parse_variable_decl(Parser *parser) {
     node->type = NULL;
     node->line = parser_current(parser)->line;
     node->column = parser_current(parser)->column;
-    node->name = strdup(name_tok->value);
+    node->name = arena_strdup(parser->arena, name_tok->value);
     node->is_mutable = false;
     node->var_type = &g_type_i32;
     node->init = NULL;
@@ -650,10 +666,11 @@ static ASTFunction *parse_function(Parser *parser) {
     node->type = NULL;
     node->line = parser_current(parser)->line;
     node->column = parser_current(parser)->column;
-    node->name = strdup(name_tok->value);
+    node->name = arena_strdup(parser->arena, name_tok->value);
     node->params = NULL;
     node->param_count = 0;
     node->is_exported = false;
+    node->is_extern = false;
     node->body = NULL;
     
     // Parse parameters
@@ -672,7 +689,7 @@ static ASTFunction *parse_function(Parser *parser) {
     param->type = NULL;
     param->line = parser_current(parser)->line;
     param->column = parser_current(parser)->column;
-            param->name = strdup(param_name->value);
+            param->name = arena_strdup(parser->arena, param_name->value);
             param->param_type = &g_type_i32;
 
             // Check for type annotation
@@ -680,8 +697,8 @@ static ASTFunction *parse_function(Parser *parser) {
                 param->param_type = parse_type(parser);
             }
 
-            node->params = realloc(node->params, sizeof(ASTNode*) * (node->param_count + 1));
-            node->params[node->param_count++] = (ASTNode*)param;
+            node->params = ast_list_append(parser->arena, node->params, node->param_count, (ASTNode*)param);
+            node->param_count++;
         } while (parser_match(parser, TOKEN_COMMA));
     }
     
@@ -802,10 +819,10 @@ static ASTProgram *parse_program(Parser *parser) {
                 parser_error(parser, "Expected module name string after 'import'");
                 return NULL;
             }
-            imp->module_name = strdup(string_tok->value);
+            imp->module_name = arena_strdup(parser->arena, string_tok->value);
             parser_expect(parser, TOKEN_SEMICOLON, "Expected ';' after import statement");
-            node->imports = realloc(node->imports, sizeof(ASTNode*) * (node->import_count + 1));
-            node->imports[node->import_count++] = (ASTNode*)imp;
+            node->imports = ast_list_append(parser->arena, node->imports, node->import_count, (ASTNode*)imp);
+            node->import_count++;
             continue;
         }
 
@@ -823,11 +840,11 @@ static ASTProgram *parse_program(Parser *parser) {
             }
             ASTIdentifier *ident = ast_new(parser->arena, ASTIdentifier);
             ident->kind = AST_IDENTIFIER;
-            ident->name = strdup(ident_tok->value);
+            ident->name = arena_strdup(parser->arena, ident_tok->value);
             exp->target = (ASTNode*)ident;
             parser_expect(parser, TOKEN_SEMICOLON, "Expected ';' after export statement");
-            node->exports = realloc(node->exports, sizeof(ASTNode*) * (node->export_count + 1));
-            node->exports[node->export_count++] = (ASTNode*)exp;
+            node->exports = ast_list_append(parser->arena, node->exports, node->export_count, (ASTNode*)exp);
+            node->export_count++;
             continue;
         }
 
@@ -839,16 +856,16 @@ static ASTProgram *parse_program(Parser *parser) {
             }
             ASTNode *func = (ASTNode*)parse_function(parser);
             ((ASTFunction*)func)->is_extern = true;
-            node->functions = realloc(node->functions, sizeof(ASTNode*) * (node->function_count + 1));
-            node->functions[node->function_count++] = func;
+            node->functions = ast_list_append(parser->arena, node->functions, node->function_count, func);
+            node->function_count++;
             continue;
         }
 
         // Function
         if (parser_match(parser, TOKEN_FUNCTION)) {
             ASTNode *func = (ASTNode*)parse_function(parser);
-            node->functions = realloc(node->functions, sizeof(ASTNode*) * (node->function_count + 1));
-            node->functions[node->function_count++] = func;
+            node->functions = ast_list_append(parser->arena, node->functions, node->function_count, func);
+            node->function_count++;
             continue;
         }
 
@@ -869,26 +886,25 @@ static ASTProgram *parse_program(Parser *parser) {
             if (!main_func) {
                 main_func = ast_new(parser->arena, ASTFunction);
                 main_func->kind = AST_FUNCTION;
-                main_func->name = strdup("main");
+                main_func->name = arena_strdup(parser->arena, "main");
                 main_func->param_count = 0;
                 main_func->params = NULL;
                 main_func->body = NULL;
                 main_func->func_type = NULL;
                 main_func->is_exported = false;
                 main_func->is_extern = false;
-                node->functions = realloc(node->functions, sizeof(ASTNode*) * (node->function_count + 1));
-                node->functions[node->function_count++] = (ASTNode*)main_func;
+                node->functions = ast_list_append(parser->arena, node->functions, node->function_count, (ASTNode*)main_func);
+                node->function_count++;
             }
             // Add variable to main function's block
             if (main_func->body) {
                 ASTBlock *block = (ASTBlock*)main_func->body;
-                block->statements = realloc(block->statements, sizeof(ASTNode*) * (block->statement_count + 1));
-                block->statements[block->statement_count++] = var_decl;
+                block->statements = ast_list_append(parser->arena, block->statements, block->statement_count, var_decl);
+                block->statement_count++;
             } else {
                 ASTBlock *block = ast_new(parser->arena, ASTBlock);
                 block->kind = AST_BLOCK;
-                block->statements = malloc(sizeof(ASTNode*));
-                block->statements[0] = var_decl;
+                block->statements = ast_list_append(parser->arena, NULL, 0, var_decl);
                 block->statement_count = 1;
                 main_func->body = (ASTNode*)block;
             }
@@ -910,25 +926,24 @@ static ASTProgram *parse_program(Parser *parser) {
             if (!main_func) {
                 main_func = ast_new(parser->arena, ASTFunction);
                 main_func->kind = AST_FUNCTION;
-                main_func->name = strdup("main");
+                main_func->name = arena_strdup(parser->arena, "main");
                 main_func->param_count = 0;
                 main_func->params = NULL;
                 main_func->body = NULL;
                 main_func->func_type = NULL;
                 main_func->is_exported = false;
                 main_func->is_extern = false;
-                node->functions = realloc(node->functions, sizeof(ASTNode*) * (node->function_count + 1));
-                node->functions[node->function_count++] = (ASTNode*)main_func;
+                node->functions = ast_list_append(parser->arena, node->functions, node->function_count, (ASTNode*)main_func);
+                node->function_count++;
             }
             if (main_func->body) {
                 ASTBlock *block = (ASTBlock*)main_func->body;
-                block->statements = realloc(block->statements, sizeof(ASTNode*) * (block->statement_count + 1));
-                block->statements[block->statement_count++] = print_stmt;
+                block->statements = ast_list_append(parser->arena, block->statements, block->statement_count, print_stmt);
+                block->statement_count++;
             } else {
                 ASTBlock *block = ast_new(parser->arena, ASTBlock);
                 block->kind = AST_BLOCK;
-                block->statements = malloc(sizeof(ASTNode*));
-                block->statements[0] = print_stmt;
+                block->statements = ast_list_append(parser->arena, NULL, 0, print_stmt);
                 block->statement_count = 1;
                 main_func->body = (ASTNode*)block;
             }
@@ -990,6 +1005,101 @@ void ast_free(ASTProgram *prog) {
     (void)prog;
 }
 
+void ast_stream_init(ASTStream *stream, const char *source, Arena *statement_arena) {
+    lexer_init(&stream->lexer, source);
+    stream->capacity = 256;
+    stream->tokens = malloc(sizeof(Token) * stream->capacity);
+    stream->statement_arena = statement_arena;
+    stream->statements = NULL;
+    stream->statement_count = 0;
+}
+
+// Read the tokens of one top-level item: everything up to a ';' or a
+// closing '}' at brace depth zero. Returns the token count including the
+// EOF token appended after them.
+static size_t stream_read_item(ASTStream *stream) {
+    size_t count = 0;
+    int depth = 0;
+    while (true) {
+        if (count + 1 >= stream->capacity) {
+            stream->capacity *= 2;
+            stream->tokens = realloc(stream->tokens, sizeof(Token) * stream->capacity);
+        }
+        Token *tok = &stream->tokens[count];
+        if (!lexer_next(&stream->lexer, tok)) {
+            return count + 1;
+        }
+        count++;
+        if (tok->type == TOKEN_LEFT_BRACE) {
+            depth++;
+        } else if (tok->type == TOKEN_RIGHT_BRACE) {
+            if (--depth <= 0) break;
+        } else if (tok->type == TOKEN_SEMICOLON && depth == 0) {
+            break;
+        }
+    }
+
+    Token *eof = &stream->tokens[count];
+    eof->type = TOKEN_EOF;
+    eof->value = NULL;
+    eof->length = 0;
+    eof->line = stream->lexer.line;
+    eof->column = stream->lexer.column;
+    return count + 1;
+}
+
+ASTProgram *ast_stream_next(ASTStream *stream, Arena *arena) {
+    while (true) {
+        size_t count = stream_read_item(stream);
+        if (count == 1) return NULL; // Only EOF left
+
+        // Statements outlive the declaration being streamed
+        Token_Type first = stream->tokens[0].type;
+        bool is_declaration = first == TOKEN_FUNCTION || first == TOKEN_EXTERN ||
+                              first == TOKEN_IMPORT || first == TOKEN_EXPORT ||
+                              first == TOKEN_SEMICOLON;
+        Parser parser = {
+            .source = stream->lexer.input,
+            .tokens = stream->tokens,
+            .pos = 0,
+            .token_count = count,
+            .arena = (!is_declaration && stream->statement_arena) ? stream->statement_arena : arena,
+            .current_line = 1,
+            .current_column = 1
+        };
+        ASTProgram *prog = parse_program(&parser);
+        for (size_t i = 0; i + 1 < count; i++) {
+            free(stream->tokens[i].value);
+        }
+        if (!prog) return NULL;
+
+        // Move the statements of a synthesized main out of the result
+        size_t kept = 0;
+        for (size_t i = 0; i < prog->function_count; i++) {
+            ASTFunction *func = (ASTFunction*)prog->functions[i];
+            if (func->func_type != NULL) {
+                prog->functions[kept++] = (ASTNode*)func;
+                continue;
+            }
+            ASTBlock *body = (ASTBlock*)func->body;
+            for (size_t j = 0; body && stream->statement_arena && j < body->statement_count; j++) {
+                stream->statements = ast_list_append(stream->statement_arena, stream->statements,
+                    stream->statement_count, body->statements[j]);
+                stream->statement_count++;
+            }
+        }
+        prog->function_count = kept;
+
+        if (prog->function_count > 0) return prog;
+    }
+}
+
+void ast_stream_free(ASTStream *stream) {
+    free(stream->tokens);
+    stream->tokens = NULL;
+    stream->capacity = 0;
+}
+
 //=============================================================================
 // Visitor Pattern Implementation
 //=============================================================================
@@ -29,6 +29,7 @@ Hashtable* createHashtable(int size) {
     }
 
     hashtable->size = size;
+    hashtable->count = 0;
     hashtable->table = (Entry**)calloc(size, sizeof(Entry*));
     
     if (hashtable->table == NULL) {
@@ -39,12 +40,41 @@ Hashtable* createHashtable(int size) {
     return hashtable;
 }
 
+// Rehash all entries into twice as many buckets
+static void growHashtable(Hashtable* hashtable) {
+    int size = hashtable->size * 2 + 1;
+    Entry** table = (Entry**)calloc(size, sizeof(Entry*));
+    if (table == NULL) {
+        return;  // Keep the old table, just with longer chains
+    }
+
+    for (int i = 0; i < hashtable->size; i++) {
+        Entry* current = hashtable->table[i];
+        while (current != NULL) {
+            Entry* next = current->next;
+            unsigned int h = hash(current->key);
+            int index = h % size;
+            current->next = table[index];
+            table[index] = current;
+            current = next;
+        }
+    }
+
+    free(hashtable->table);
+    hashtable->table = table;
+    hashtable->size = size;
+}
+
 // Function to insert a key-value pair into the hashtable
 void insertEntry(Hashtable* hashtable, char* key, void* data, int is_string) {
     if (hashtable == NULL || hashtable->table == NULL || key == NULL) {
         return;  // Invalid parameters
     }
 
+    if (hashtable->count >= hashtable->size) {
+        growHashtable(hashtable);
+    }
+
     // Calculate hash and ensure it's within table bounds
     unsigned int h = hash(key);
     int index = h % hashtable->size;
@@ -66,6 +96,7 @@ void insertEntry(Hashtable* hashtable, char* key, void* data, int is_string) {
 
     newEntry->next = hashtable->table[index];
     hashtable->table[index] = newEntry;
+    hashtable->count++;
 }
 
 // Function to search for a value by key in the hashtable
@@ -129,6 +160,7 @@ void deleteEntry(Hashtable* hashtable, char* data) {
         free(current->data);
     }
     free(current);
+    hashtable->count--;
 }
 
 // Function to free the entire hashtable
@@ -1,4 +1,6 @@
 #include "ir.h"
+#include "ir_analysis.h"
+#include "ir_pass.h"
 #include "ast.h"
 #include "hash_table.h"
 #include <stdio.h>
@@ -7,6 +9,8 @@
 #include <inttypes.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 //=============================================================================
 // Global Types
@@ -23,12 +27,15 @@ IRType g_ir_type_string = { .kind = IR_TYPE_STRING };
 // Helper Functions
 //=============================================================================
 
-static IRModule *current_module;
-static IRFunction *current_function;
-static IRBasicBlock *current_block;
-static Arena *current_arena;
-static Hashtable *string_table;
-static Hashtable *variable_table;
+// Per-function lowering state. Each worker thread owns one builder, so
+// nothing below touches shared mutable state except the function being built.
+typedef struct IRBuilder {
+    IRModule *module;
+    IRFunction *function;
+    IRBasicBlock *block;        // Insertion point
+    Hashtable *variable_table;
+    uint32_t slot_count;        // Allocs at the start of the entry block
+} IRBuilder;
 
 IRType *ir_type_from_ast(Type *ast_type) {
     if (!ast_type) return &g_ir_type_i32;
@@ -44,51 +51,195 @@ IRType *ir_type_from_ast(Type *ast_type) {
     }
 }
 
-IRValue *ir_const_int(IRType *type, int64_t value) {
-    IRValue *val = arena_alloc_type(current_arena, IRValue);
-    val->kind = IR_VALUE_CONST;
-    val->type = type;
-    val->data.const_int = value;
-    return val;
+// Get QBE instruction suffix for type
+static const char *get_type_suffix(IRType *type) {
+    switch (type->kind) {
+        case IR_TYPE_I8:
+        case IR_TYPE_I16:
+        case IR_TYPE_I32:
+            return "w";
+        case IR_TYPE_I64:
+        case IR_TYPE_I128:
+        case IR_TYPE_PTR:
+        case IR_TYPE_STRING:
+            return "l";
+        case IR_TYPE_F32:
+            return "s";
+        case IR_TYPE_F64:
+            return "d";
+        default:
+            return "w";
+    }
 }
 
-IRValue *ir_const_float(IRType *type, double value) {
-    IRValue *val = arena_alloc_type(current_arena, IRValue);
+// Get QBE comparison suffix
+static const char *get_cmp_suffix(IRCmpKind kind, IRType *operand_type) {
+    bool is_float = operand_type->kind == IR_TYPE_F32 || operand_type->kind == IR_TYPE_F64;
+    switch (kind) {
+        case IR_CMP_EQ: return "eq";
+        case IR_CMP_NE: return "ne";
+        case IR_CMP_ULT: return "ult";
+        case IR_CMP_ULE: return "ule";
+        case IR_CMP_UGT: return "ugt";
+        case IR_CMP_UGE: return "uge";
+        case IR_CMP_SLT: return is_float ? "lt" : "slt";
+        case IR_CMP_SLE: return is_float ? "le" : "sle";
+        case IR_CMP_SGT: return is_float ? "gt" : "sgt";
+        case IR_CMP_SGE: return is_float ? "ge" : "sge";
+        default: return "eq";
+    }
+}
+
+// Get size of IR type in bytes
+static size_t ir_type_size(IRType *type) {
+    switch (type->kind) {
+        case IR_TYPE_I8: return 1;
+        case IR_TYPE_I16: return 2;
+        case IR_TYPE_I32: return 4;
+        case IR_TYPE_I64:
+        case IR_TYPE_I128:
+        case IR_TYPE_PTR: return 8;
+        case IR_TYPE_F32: return 4;
+        case IR_TYPE_F64: return 8;
+        default: return 8;
+    }
+}
+
+static IRConstant *constant_create(IRFunction *func, IRType *type, int64_t bits) {
+    IRConstant *val = arena_alloc_type(func->arena, IRConstant);
     val->kind = IR_VALUE_CONST;
     val->type = type;
-    val->data.const_float = value;
+    val->uses = NULL;
+    val->id = 0;
+    val->int_value = bits;
     return val;
 }
 
-IRValue *ir_const_string(IRModule *mod, IRType *type, const char *value) {
-    IRGlobal *global = ir_add_string(mod, value);
-    IRValue *val = arena_alloc_type(current_arena, IRValue);
+// Slot of the constant with this type and bits in the open-addressed
+// table, or the empty slot where it belongs
+static IRConstant **constant_slot(IRConstant **table, uint32_t capacity, IRType *type, int64_t bits) {
+    uint64_t hash = ((uint64_t)bits ^ (uint64_t)type->kind) * 0x9e3779b97f4a7c15ull;
+    for (size_t i = (size_t)(hash >> 32);; i++) {
+        IRConstant **slot = &table[i & (capacity - 1)];
+        if (!*slot || ((*slot)->type == type && (*slot)->int_value == bits)) return slot;
+    }
+}
+
+// While the function is generated a constant is made once per type and
+// value; later every call makes a new one
+static IRConstant *constant_get(IRFunction *func, IRType *type, int64_t bits) {
+    if (!func->building) return constant_create(func, type, bits);
+
+    if (2 * (func->constant_count + 1) > func->constant_capacity) {
+        uint32_t capacity = func->constant_capacity ? func->constant_capacity * 2 : 16;
+        IRConstant **table = calloc(capacity, sizeof(IRConstant*));
+        for (uint32_t i = 0; i < func->constant_capacity; i++) {
+            IRConstant *val = func->constants[i];
+            if (val) *constant_slot(table, capacity, val->type, val->int_value) = val;
+        }
+        free(func->constants);
+        func->constants = table;
+        func->constant_capacity = capacity;
+    }
+    IRConstant **slot = constant_slot(func->constants, func->constant_capacity, type, bits);
+    if (!*slot) {
+        *slot = constant_create(func, type, bits);
+        func->constant_count++;
+    }
+    return *slot;
+}
+
+IRValue *ir_const_int(IRFunction *func, IRType *type, int64_t value) {
+    return (IRValue*)constant_get(func, type, value);
+}
+
+IRValue *ir_const_float(IRFunction *func, IRType *type, double value) {
+    int64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (IRValue*)constant_get(func, type, bits);
+}
+
+// Record a string literal reference. Module-wide names are assigned later,
+// in source order, by merge_function_strings(); `value` must stay alive
+// until then.
+IRValue *ir_const_string(IRFunction *func, IRType *type, const char *value) {
+    IRGlobalRef *val = arena_alloc_type(func->arena, IRGlobalRef);
     val->kind = IR_VALUE_GLOBAL;
     val->type = type;
+    val->uses = NULL;
     val->id = 0; // Not used for globals
-    val->data.global_name = global->name;
-    return val;
+    val->string = value;
+
+    if (func->string_count == func->string_capacity) {
+        func->string_capacity = func->string_capacity ? func->string_capacity * 2 : 4;
+        func->strings = realloc(func->strings, sizeof(IRGlobalRef*) * func->string_capacity);
+    }
+    func->strings[func->string_count++] = val;
+    return (IRValue*)val;
 }
 
-IRValue *ir_arg(IRType *type, size_t index) {
-    IRValue *val = arena_alloc_type(current_arena, IRValue);
+IRValue *ir_arg(IRFunction *func, IRType *type, size_t index) {
+    IRValue *val = arena_alloc_type(func->arena, IRValue);
     val->kind = IR_VALUE_ARG;
     val->type = type;
-    val->data.arg_index = index;
+    val->uses = NULL;
+    val->id = (uint32_t)index;
     return val;
 }
 
-IRValue *ir_temp(IRModule *mod, IRType *type) {
-    IRValue *val = arena_alloc_type(current_arena, IRValue);
-    val->kind = IR_VALUE_INST;
-    val->type = type;
-    val->id = mod->temp_counter++;
-    val->data.inst = NULL; // Will be set when instruction is created
-    return val;
+static void phi_arg_move(IRPhiArg *to, IRPhiArg *from);
+
+IRCallData *ir_call_data_create(IRFunction *func, const char *callee_name, size_t arg_count) {
+    IRCallData *data = arena_alloc(func->arena, sizeof(IRCallData) + sizeof(IRCallArg) * arg_count);
+    data->callee_name = callee_name;
+    data->callee_attrs = 0;
+    data->arg_count = arg_count;
+    for (size_t i = 0; i < arg_count; i++) {
+        data->args[i].use.value = NULL;
+        data->args[i].use.use_link = 0;
+        data->args[i].user = NULL;
+    }
+    return data;
+}
+
+void ir_phi_add_incoming(IRFunction *func, IRInstruction *phi, IRValue *value, IRBasicBlock *block) {
+    IRPhiData *data = phi->ops[0].phi;
+    if (!data) {
+        data = arena_alloc_type(func->arena, IRPhiData);
+        data->args = NULL;
+        data->arg_count = 0;
+        data->capacity = 0;
+        phi->ops[0].phi = data;
+    }
+    if (data->arg_count == data->capacity) {
+        uint32_t capacity = data->capacity ? data->capacity * 2 : 2;
+        IRPhiArg *args = arena_alloc_array(func->arena, IRPhiArg, capacity);
+        for (uint32_t i = 0; i < data->arg_count; i++) {
+            phi_arg_move(&args[i], &data->args[i]);
+        }
+        data->args = args;
+        data->capacity = capacity;
+    }
+    data->args[data->arg_count].use.value = NULL;
+    data->args[data->arg_count].use.use_link = 0;
+    data->args[data->arg_count].user = NULL;
+    data->args[data->arg_count].block = block;
+    data->arg_count++;
+    ir_set_operand(phi, data->arg_count - 1, value);
+}
+
+void ir_phi_remove_incoming(IRInstruction *phi, IRBasicBlock *block) {
+    IRPhiData *data = phi->ops[0].phi;
+    for (uint32_t i = 0; data && i < data->arg_count; i++) {
+        if (data->args[i].block != block) continue;
+        ir_set_operand(phi, i, NULL);
+        if (i != --data->arg_count) phi_arg_move(&data->args[i], &data->args[data->arg_count]);
+        return;
+    }
 }
 
 // Generate cast if needed
-static IRValue *generate_cast(IRValue *value, IRType *target_type) {
+static IRValue *generate_cast(IRBuilder *b, IRValue *value, IRType *target_type) {
     if (value->type == target_type) return value;
 
     IROpcode opcode = IR_BITCAST; // Default
@@ -108,18 +259,16 @@ static IRValue *generate_cast(IRValue *value, IRType *target_type) {
         opcode = IR_SEXT;
     } else if (value->type->kind == IR_TYPE_I32 && target_type->kind == IR_TYPE_I64) {
         opcode = IR_SEXT;
+    } else if (value->type->kind == IR_TYPE_I64 && target_type->kind == IR_TYPE_I32) {
+        opcode = IR_TRUNC;
     } else {
         // For other cases, use bitcast (e.g., pointer casts, same size types)
         opcode = IR_BITCAST;
     }
 
-    IRInstruction *cast = ir_inst_create(current_block, opcode);
-    cast->arg = value;
-    cast->type = target_type;
-    IRValue *result = ir_temp(current_module, target_type);
-    cast->result = result;
-    result->data.inst = cast;
-    return result;
+    IRInstruction *cast = ir_inst_create(b->block, opcode, target_type);
+    ir_set_operand(cast, 0, value);
+    return (IRValue*)cast;
 }
 
 //=============================================================================
@@ -129,20 +278,29 @@ static IRValue *generate_cast(IRValue *value, IRType *target_type) {
 IRModule *ir_module_create(Arena *arena, const char *name) {
     IRModule *mod = arena_alloc_type(arena, IRModule);
     mod->name = strdup(name);
+    mod->arena = arena;
     mod->functions = NULL;
     mod->function_count = 0;
     mod->globals = NULL;
     mod->global_count = 0;
-    mod->temp_counter = 0;
+    mod->global_capacity = 0;
     mod->global_counter = 0;
-    mod->label_counter = 0;
-    current_module = mod;
-    current_arena = arena;
+    mod->string_table = NULL;
+    mod->merge_strings = false;
+    mod->thread_count = 0;
+    mod->worker_arenas = NULL;
+    mod->worker_count = 0;
+    mod->function_table = NULL;
+    mod->streamed = false;
+    mod->streamed_blocks = 0;
+    mod->streamed_instructions = 0;
+    mod->peak_function_bytes = 0;
+    mod->pass_manager = NULL;
     return mod;
 }
 
 IRFunction *ir_function_create(IRModule *mod, const char *name, IRType *return_type) {
-    IRFunction *func = arena_alloc_type(current_arena, IRFunction);
+    IRFunction *func = arena_alloc_type(mod->arena, IRFunction);
     func->name = strdup(name);
     func->return_type = return_type;
     func->param_types = NULL;
@@ -152,20 +310,37 @@ IRFunction *ir_function_create(IRModule *mod, const char *name, IRType *return_t
     func->blocks = NULL;
     func->last_block = NULL;
     func->entry_block = NULL;
+    func->arena = mod->arena;
+    func->temp_counter = 0;
+    func->block_counter = 0;
+    func->strings = NULL;
+    func->string_capacity = 0;
+    func->string_count = 0;
+    memset(func->spare_arrays, 0, sizeof(func->spare_arrays));
+    func->building = false;
+    func->constants = NULL;
+    func->constant_count = 0;
+    func->constant_capacity = 0;
+    func->cfg = NULL;
+    func->attrs = 0;
     
     mod->functions = realloc(mod->functions, sizeof(IRFunction*) * (mod->function_count + 1));
     mod->functions[mod->function_count++] = func;
     
-    current_function = func;
     return func;
 }
 
+
 IRBasicBlock *ir_basic_block_create(IRFunction *func, const char *name) {
-    IRBasicBlock *block = arena_alloc_type(current_arena, IRBasicBlock);
-    snprintf(block->name, sizeof(block->name), "%s", name);
+    IRBasicBlock *block = arena_alloc_type(func->arena, IRBasicBlock);
+    block->id = func->block_counter++;
+    block->name = name;
+    block->function = func;
     block->instructions = NULL;
-    block->last_instruction = NULL;
+    block->inst_count = 0;
+    block->inst_capacity = 0;
     block->next = NULL;
+    ir_cfg_invalidate(func);
     
     if (func->blocks == NULL) {
         func->blocks = block;
@@ -174,51 +349,444 @@ IRBasicBlock *ir_basic_block_create(IRFunction *func, const char *name) {
         func->last_block->next = block;
     }
     func->last_block = block;
-    current_block = block;
     return block;
 }
 
-IRInstruction *ir_inst_create(IRBasicBlock *block, IROpcode opcode) {
-    IRInstruction *inst = arena_alloc_type(current_arena, IRInstruction);
-    inst->opcode = opcode;
-    inst->type = &g_ir_type_i32;
-    inst->result = NULL;
-    inst->arg1 = NULL;
-    inst->arg2 = NULL;
-    inst->arg = NULL;
-    inst->target = NULL;
-    inst->true_target = NULL;
-    inst->false_target = NULL;
-    inst->callee_name = NULL;
-    inst->args = NULL;
-    inst->arg_count = 0;
-    inst->phi_args = NULL;
-    inst->phi_arg_count = 0;
-    inst->alloc_size = NULL;
-    inst->mem_addr = NULL;
-    inst->index = NULL;
-    inst->element_size = 0;
-    inst->next = NULL;
-    
-    if (block->instructions == NULL) {
-        block->instructions = inst;
+void ir_block_move_after(IRBasicBlock *block, IRBasicBlock *after) {
+    IRFunction *func = block->function;
+    if (block == after || after->next == block) return;
+
+    IRBasicBlock *prev = NULL;
+    for (IRBasicBlock *b = func->blocks; b != block; b = b->next) {
+        prev = b;
+    }
+    prev->next = block->next;
+    if (func->last_block == block) func->last_block = prev;
+
+    block->next = after->next;
+    after->next = block;
+    if (func->last_block == after) func->last_block = block;
+}
+
+// Spare instruction arrays are chained through their first element and
+// filed under the largest power of two they hold. Only power-of-two
+// capacities are taken.
+static IRInstruction **spare_array_take(IRFunction *func, uint32_t capacity) {
+    unsigned size_class = (unsigned)__builtin_ctz(capacity);
+    IRInstruction **insts = size_class < IR_SPARE_ARRAY_CLASSES ? func->spare_arrays[size_class] : NULL;
+    if (!insts) return arena_alloc_array(func->arena, IRInstruction*, capacity);
+    func->spare_arrays[size_class] = (IRInstruction**)insts[0];
+    return insts;
+}
+
+static void spare_array_give(IRFunction *func, IRInstruction **insts, uint32_t capacity) {
+    unsigned size_class = 31 - (unsigned)__builtin_clz(capacity);
+    if (size_class >= IR_SPARE_ARRAY_CLASSES) return;
+    insts[0] = (IRInstruction*)func->spare_arrays[size_class];
+    func->spare_arrays[size_class] = insts;
+}
+
+static void block_insert(IRBasicBlock *block, size_t index, IRInstruction *inst) {
+    IRFunction *func = block->function;
+    inst->block = block;
+
+    // Grow the instruction array to the next power of two. Once built, a
+    // block grows into an array another block outgrew if there is one, and
+    // leaves the old array to the next block that grows.
+    if (block->inst_count == block->inst_capacity) {
+        uint32_t capacity = block->inst_capacity ? 1u << (32 - __builtin_clz(block->inst_capacity)) : 2;
+        if (func->building) {
+            block->instructions = realloc(block->instructions, sizeof(IRInstruction*) * capacity);
+        } else {
+            IRInstruction **insts = spare_array_take(func, capacity);
+            if (block->inst_count) {
+                memcpy(insts, block->instructions, sizeof(IRInstruction*) * block->inst_count);
+                spare_array_give(func, block->instructions, block->inst_capacity);
+            }
+            block->instructions = insts;
+        }
+        block->inst_capacity = capacity;
+    }
+    if (index < block->inst_count) {
+        memmove(&block->instructions[index + 1], &block->instructions[index],
+            sizeof(IRInstruction*) * (block->inst_count - index));
     } else {
-        block->last_instruction->next = inst;
+        index = block->inst_count;
+    }
+    block->instructions[index] = inst;
+    block->inst_count++;
+}
+
+// Operand storage an instruction of `opcode` is allocated with. A slot
+// holding a block, immediate or out-of-line data only needs its first
+// word, so the last slot is cut to that when it holds one.
+static size_t opcode_operand_size(IROpcode opcode) {
+    switch (opcode) {
+        case IR_ALLOC:
+        case IR_BR:
+        case IR_NOP:
+        case IR_CALL:
+        case IR_PHI:
+            return sizeof(void*);
+        case IR_LOAD:
+        case IR_ZEXT:
+        case IR_SEXT:
+        case IR_TRUNC:
+        case IR_BITCAST:
+        case IR_SITOFPD:
+        case IR_FPTOSI:
+        case IR_RET:
+        case IR_COPY:
+            return sizeof(IROperand);
+        case IR_CBR:
+        case IR_GETPTR:
+            return 2 * sizeof(IROperand) + sizeof(void*);
+        default:
+            return 2 * sizeof(IROperand); // Binary ops, IR_CMP, IR_STORE
+    }
+}
+
+IRInstruction *ir_inst_insert(IRBasicBlock *block, size_t index, IROpcode opcode, IRType *type) {
+    IRFunction *func = block->function;
+    size_t size = opcode_operand_size(opcode);
+    IRInstruction *inst = arena_alloc(func->arena, offsetof(IRInstruction, ops) + size);
+    inst->kind = IR_VALUE_INST;
+    inst->type = type ? type : &g_ir_type_void;
+    inst->uses = NULL;
+    inst->id = inst->type->kind != IR_TYPE_VOID ? func->temp_counter++ : 0;
+    inst->opcode = (uint8_t)opcode;
+    inst->cmp_kind = IR_CMP_EQ;
+    memset(inst->ops, 0, size);
+    block_insert(block, index, inst);
+    if (opcode == IR_BR || opcode == IR_CBR || opcode == IR_RET) {
+        ir_cfg_invalidate(func);
     }
-    block->last_instruction = inst;
     return inst;
 }
 
+IRInstruction *ir_inst_create(IRBasicBlock *block, IROpcode opcode, IRType *type) {
+    return ir_inst_insert(block, block->inst_count, opcode, type);
+}
+
+IRInstruction *ir_inst_clone(IRBasicBlock *block, size_t index, IRInstruction *inst) {
+    IRFunction *func = block->function;
+    IRInstruction *copy = ir_inst_insert(block, index, (IROpcode)inst->opcode, inst->type);
+    copy->cmp_kind = inst->cmp_kind;
+    switch (inst->opcode) {
+        case IR_CALL: {
+            IRCallData *data = inst->ops[0].call;
+            copy->ops[0].call = ir_call_data_create(func, data->callee_name, data->arg_count);
+            copy->ops[0].call->callee_attrs = data->callee_attrs;
+            break;
+        }
+        case IR_PHI: {
+            IRPhiData *data = inst->ops[0].phi;
+            for (uint32_t i = 0; data && i < data->arg_count; i++) {
+                ir_phi_add_incoming(func, copy, NULL, data->args[i].block);
+            }
+            break;
+        }
+        default: {
+            // Block targets and immediates; value slots are filled below
+            size_t skip = sizeof(IROperand) * ir_operand_count(inst);
+            memcpy((char*)copy->ops + skip, (char*)inst->ops + skip,
+                opcode_operand_size((IROpcode)inst->opcode) - skip);
+            break;
+        }
+    }
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        ir_set_operand(copy, i, ir_get_operand(inst, i));
+    }
+    return copy;
+}
+
+// Drop an instruction from its block's array without touching its operands
+static void block_unlink(IRInstruction *inst) {
+    IRBasicBlock *block = inst->block;
+    // Search from the end; passes mostly remove near the terminator
+    for (size_t i = block->inst_count; i-- > 0;) {
+        if (block->instructions[i] == inst) {
+            memmove(&block->instructions[i], &block->instructions[i + 1],
+                sizeof(IRInstruction*) * (block->inst_count - i - 1));
+            block->inst_count--;
+            break;
+        }
+    }
+    inst->block = NULL;
+}
+
+void ir_inst_move(IRInstruction *inst, IRBasicBlock *block, size_t index) {
+    block_unlink(inst);
+    block_insert(block, index, inst);
+}
+
+IRBasicBlock *ir_block_split(IRBasicBlock *block, size_t index, const char *name) {
+    IRBasicBlock *tail = ir_basic_block_create(block->function, name);
+    ir_block_move_after(tail, block);
+    for (size_t i = index; i < block->inst_count; i++) {
+        block_insert(tail, tail->inst_count, block->instructions[i]);
+    }
+    if (index < block->inst_count) block->inst_count = (uint32_t)index;
+
+    // Successors are now entered from the tail
+    IRInstruction *term = ir_block_terminator(tail);
+    if (!term || term->opcode == IR_RET) return tail;
+    IRBasicBlock *targets[2] = { term->ops[0].block, NULL };
+    if (term->opcode == IR_CBR) {
+        targets[0] = term->ops[1].block;
+        targets[1] = term->ops[2].block != targets[0] ? term->ops[2].block : NULL;
+    }
+    for (size_t t = 0; t < 2 && targets[t]; t++) {
+        IRBasicBlock *succ = targets[t];
+        for (uint32_t i = 0; i < succ->inst_count && succ->instructions[i]->opcode == IR_PHI; i++) {
+            IRPhiData *data = succ->instructions[i]->ops[0].phi;
+            for (uint32_t j = 0; data && j < data->arg_count; j++) {
+                if (data->args[j].block == block) data->args[j].block = tail;
+            }
+        }
+    }
+    return tail;
+}
+
+void ir_block_merge(IRBasicBlock *block, IRBasicBlock *succ) {
+    for (uint32_t i = 0; i < succ->inst_count; i++) {
+        block_insert(block, block->inst_count, succ->instructions[i]);
+    }
+    succ->inst_count = 0;
+    ir_cfg_invalidate(block->function);
+
+    IRInstruction *term = ir_block_terminator(block);
+    size_t count = term ? ir_block_succ_count(block) : 0;
+    for (size_t t = 0; t < count; t++) {
+        IRBasicBlock *target = ir_block_succ(block, t);
+        if (t == 1 && target == ir_block_succ(block, 0)) break;
+        for (uint32_t i = 0; i < target->inst_count && target->instructions[i]->opcode == IR_PHI; i++) {
+            IRPhiData *data = target->instructions[i]->ops[0].phi;
+            for (uint32_t j = 0; data && j < data->arg_count; j++) {
+                if (data->args[j].block == succ) data->args[j].block = block;
+            }
+        }
+    }
+}
+
+void ir_inst_remove(IRInstruction *inst) {
+    IRBasicBlock *block = inst->block;
+    if (!block) return;
+
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        ir_set_operand(inst, i, NULL);
+    }
+
+    block_unlink(inst);
+    if (inst->opcode == IR_BR || inst->opcode == IR_CBR || inst->opcode == IR_RET) {
+        ir_cfg_invalidate(block->function);
+    }
+}
+
+void ir_inst_erase(IRInstruction *inst) {
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        ir_set_operand(inst, i, NULL);
+    }
+    if (inst->opcode == IR_BR || inst->opcode == IR_CBR || inst->opcode == IR_RET) {
+        ir_cfg_invalidate(inst->block->function);
+    }
+    inst->opcode = IR_NOP;
+}
+
+void ir_block_compact(IRBasicBlock *block) {
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        IRInstruction *inst = block->instructions[i];
+        if (inst->opcode == IR_NOP) {
+            inst->block = NULL;
+        } else {
+            block->instructions[kept++] = inst;
+        }
+    }
+    block->inst_count = kept;
+}
+
+IRInstruction *ir_block_terminator(IRBasicBlock *block) {
+    if (block->inst_count == 0) return NULL;
+    IRInstruction *last = block->instructions[block->inst_count - 1];
+    switch (last->opcode) {
+        case IR_BR:
+        case IR_CBR:
+        case IR_RET:
+            return last;
+        default:
+            return NULL;
+    }
+}
+
+//=============================================================================
+// Def-Use Chains
+//=============================================================================
+
+static bool value_tracks_uses(IRValue *value) {
+    return value && (value->kind == IR_VALUE_INST || value->kind == IR_VALUE_ARG);
+}
+
+// Push `use`, which now holds its value, onto the value's list. `tag` is
+// the slot's operand index or IR_USE_OUT_OF_LINE.
+static void use_add(IRUse *use, uintptr_t tag) {
+    use->use_link = (uintptr_t)use->value->uses | tag;
+    use->value->uses = use;
+}
+
+static void use_remove(IRUse *use) {
+    IRValue *value = use->value;
+    if (value->uses == use) {
+        value->uses = ir_use_next(use);
+        return;
+    }
+    for (IRUse *prev = value->uses; prev; prev = ir_use_next(prev)) {
+        if (ir_use_next(prev) == use) {
+            prev->use_link = (uintptr_t)ir_use_next(use) | (prev->use_link & IR_USE_INDEX);
+            return;
+        }
+    }
+}
+
+// Move a phi argument to another slot, taking its use along
+static void phi_arg_move(IRPhiArg *to, IRPhiArg *from) {
+    bool track = value_tracks_uses(from->use.value);
+    if (track) use_remove(&from->use);
+    *to = *from;
+    if (track) use_add(&to->use, IR_USE_OUT_OF_LINE);
+}
+
+size_t ir_operand_count(IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_ALLOC:
+        case IR_BR:
+        case IR_NOP:
+            return 0;
+        case IR_LOAD:
+        case IR_ZEXT:
+        case IR_SEXT:
+        case IR_TRUNC:
+        case IR_BITCAST:
+        case IR_SITOFPD:
+        case IR_FPTOSI:
+        case IR_CBR:
+        case IR_RET:
+        case IR_COPY:
+            return 1;
+        case IR_CALL:
+            return inst->ops[0].call ? inst->ops[0].call->arg_count : 0;
+        case IR_PHI:
+            return inst->ops[0].phi ? inst->ops[0].phi->arg_count : 0;
+        default:
+            return 2; // Binary ops, IR_CMP, IR_STORE, IR_GETPTR
+    }
+}
+
+IRUse *ir_operand_use(IRInstruction *inst, size_t index) {
+    switch (inst->opcode) {
+        case IR_CALL:
+            return &inst->ops[0].call->args[index].use;
+        case IR_PHI:
+            return &inst->ops[0].phi->args[index].use;
+        default:
+            return &inst->ops[index];
+    }
+}
+
+IRValue *ir_get_operand(IRInstruction *inst, size_t index) {
+    return ir_operand_use(inst, index)->value;
+}
+
+void ir_set_operand(IRInstruction *inst, size_t index, IRValue *value) {
+    IRUse *use = ir_operand_use(inst, index);
+    if (use->value == value) return;
+
+    if (value_tracks_uses(use->value)) {
+        use_remove(use);
+    }
+    use->value = value;
+    if (!value_tracks_uses(value)) return;
+    if (inst->opcode == IR_CALL) {
+        inst->ops[0].call->args[index].user = inst;
+        use_add(use, IR_USE_OUT_OF_LINE);
+    } else if (inst->opcode == IR_PHI) {
+        inst->ops[0].phi->args[index].user = inst;
+        use_add(use, IR_USE_OUT_OF_LINE);
+    } else {
+        use_add(use, index);
+    }
+}
+
+void ir_replace_all_uses(IRValue *value, IRValue *replacement) {
+    if (value == replacement) return;
+
+    bool track = value_tracks_uses(replacement);
+    IRUse *use = value->uses;
+    while (use) {
+        IRUse *next = ir_use_next(use);
+        use->value = replacement;
+        if (track) use_add(use, use->use_link & IR_USE_INDEX);
+        use = next;
+    }
+    value->uses = NULL;
+}
+
+size_t ir_use_count(IRValue *value) {
+    size_t count = 0;
+    for (IRUse *use = value->uses; use; use = ir_use_next(use)) {
+        count++;
+    }
+    return count;
+}
+
+bool ir_inst_has_side_effects(IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_STORE:
+        case IR_BR:
+        case IR_CBR:
+        case IR_RET:
+            return true;
+        case IR_CALL: {
+            // Unless the callee is known to write nothing and to come back
+            IRCallData *data = inst->ops[0].call;
+            return !data || (data->callee_attrs & IR_ATTRS_NO_SIDE_EFFECTS) != IR_ATTRS_NO_SIDE_EFFECTS;
+        }
+        case IR_DIV:
+        case IR_MOD:
+        case IR_UDIV:
+        case IR_UREM: {
+            // Integer division traps on zero unless the divisor is known
+            IRValue *divisor = inst->ops[1].value;
+            if (inst->type->kind == IR_TYPE_F32 || inst->type->kind == IR_TYPE_F64) {
+                return false;
+            }
+            return !(divisor && divisor->kind == IR_VALUE_CONST &&
+                     ((IRConstant*)divisor)->int_value != 0);
+        }
+        default:
+            return false;
+    }
+}
+
+bool ir_inst_is_dead(IRInstruction *inst) {
+    return inst->uses == NULL && !ir_inst_has_side_effects(inst);
+}
+
 IRGlobal *ir_add_string(IRModule *mod, const char *value) {
+    if (!mod->string_table) {
+        mod->string_table = createHashtable(256);
+    }
+
     // Check if string already exists
-    for (size_t i = 0; i < mod->global_count; i++) {
-        if (mod->globals[i]->kind == IR_GLOBAL_STRING &&
-            strcmp(mod->globals[i]->string_value, value) == 0) {
-            return mod->globals[i];
-        }
+    IRGlobal *existing = (IRGlobal*)findEntry(mod->string_table, (char*)value);
+    if (existing) {
+        return existing;
     }
     
-    IRGlobal *global = arena_alloc_type(current_arena, IRGlobal);
+    IRGlobal *global = arena_alloc_type(mod->arena, IRGlobal);
     global->kind = IR_GLOBAL_STRING;
     global->id = mod->global_counter++;
     char name[32];
@@ -227,117 +795,116 @@ IRGlobal *ir_add_string(IRModule *mod, const char *value) {
     global->type = &g_ir_type_string;
     global->init_value = NULL;
     global->string_value = strdup(value);
+    global->length = strlen(value);
+    global->tail_of = NULL;
+    global->tail_offset = 0;
     global->next = NULL;
     
-    mod->globals = realloc(mod->globals, sizeof(IRGlobal*) * (mod->global_count + 1));
+    if (mod->global_count == mod->global_capacity) {
+        mod->global_capacity = mod->global_capacity ? mod->global_capacity * 2 : 16;
+        mod->globals = realloc(mod->globals, sizeof(IRGlobal*) * mod->global_capacity);
+    }
     mod->globals[mod->global_count++] = global;
+    insertEntry(mod->string_table, global->string_value, global, 0);
     
     return global;
 }
 
+// Order strings by their reversed bytes, longest first among equal tails
+static int compare_string_tails(const void *a, const void *b) {
+    const IRGlobal *x = *(IRGlobal * const *)a;
+    const IRGlobal *y = *(IRGlobal * const *)b;
+    size_t i = x->length, j = y->length;
+    while (i > 0 && j > 0) {
+        unsigned char cx = (unsigned char)x->string_value[--i];
+        unsigned char cy = (unsigned char)y->string_value[--j];
+        if (cx != cy) return cx < cy ? 1 : -1;
+    }
+    if (i == j) return 0;
+    return i > 0 ? -1 : 1;
+}
+
+void ir_merge_string_tails(IRModule *mod) {
+    size_t count = 0;
+    IRGlobal **strings = malloc(sizeof(IRGlobal*) * (mod->global_count ? mod->global_count : 1));
+    for (size_t i = 0; i < mod->global_count; i++) {
+        IRGlobal *global = mod->globals[i];
+        if (global->kind == IR_GLOBAL_STRING) {
+            global->tail_of = NULL;
+            global->tail_offset = 0;
+            strings[count++] = global;
+        }
+    }
+    qsort(strings, count, sizeof(IRGlobal*), compare_string_tails);
+
+    // After sorting, every string that ends another one directly follows
+    // a string it is a suffix of, so comparing with the last kept string
+    // finds all merges
+    IRGlobal *root = NULL;
+    for (size_t i = 0; i < count; i++) {
+        IRGlobal *global = strings[i];
+        if (root && root->length >= global->length &&
+            memcmp(root->string_value + root->length - global->length,
+                   global->string_value, global->length) == 0) {
+            global->tail_of = root;
+            global->tail_offset = root->length - global->length;
+        } else {
+            root = global;
+        }
+    }
+    free(strings);
+}
+
+
 //=============================================================================
 // Code Generation - AST to IR
 //=============================================================================
 
-static void generate_statement(ASTNode *node);
-static IRValue *generate_expression(ASTNode *node);
+static void generate_statement(IRBuilder *b, ASTNode *node);
+static IRValue *generate_expression(IRBuilder *b, ASTNode *node);
+static void generate_condition(IRBuilder *b, ASTNode *node, IRBasicBlock *on_true, IRBasicBlock *on_false);
+static IRValue *generate_logical_expr(IRBuilder *b, ASTNode *node);
 
 // Generate a literal
-static IRValue *generate_literal(ASTNode *node) {
+static IRValue *generate_literal(IRBuilder *b, ASTNode *node) {
     switch (node->kind) {
         case AST_LITERAL_INT: {
             ASTLiteralInt *lit = (ASTLiteralInt*)node;
-            return ir_const_int(ir_type_from_ast(node->type), lit->value);
+            return ir_const_int(b->function, ir_type_from_ast(node->type), lit->value);
         }
         case AST_LITERAL_FLOAT: {
             ASTLiteralFloat *lit = (ASTLiteralFloat*)node;
-            return ir_const_float(ir_type_from_ast(node->type), lit->value);
+            return ir_const_float(b->function, ir_type_from_ast(node->type), lit->value);
         }
         case AST_LITERAL_STRING: {
             ASTLiteralString *lit = (ASTLiteralString*)node;
-            return ir_const_string(current_module, &g_ir_type_string, lit->value);
+            return ir_const_string(b->function, &g_ir_type_string, lit->value);
         }
         case AST_LITERAL_BOOL: {
             ASTLiteralBool *lit = (ASTLiteralBool*)node;
-            return ir_const_int(&g_ir_type_i32, lit->value ? 1 : 0);
+            return ir_const_int(b->function, &g_ir_type_i32, lit->value ? 1 : 0);
         }
-        default:
-            return NULL;
-    }
-}
-
-// Generate identifier (variable lookup)
-static IRValue *generate_identifier(ASTNode *node) {
-    ASTIdentifier *ident = (ASTIdentifier*)node;
-    IRValue *addr = (IRValue*)findEntry(variable_table, ident->name);
-    if (addr) {
-        IRInstruction *load = ir_inst_create(current_block, IR_LOAD);
-        load->mem_addr = addr;
-        load->type = addr->type;
-        IRValue *result = ir_temp(current_module, load->type);
-        load->result = result;
-        result->data.inst = load;
-        return result;
-    } else {
-        // Function or undefined, for now temp
-        return ir_temp(current_module, &g_ir_type_i64);
-    }
-}
-
-// Get QBE instruction suffix for type
-static const char *get_type_suffix(IRType *type) {
-    switch (type->kind) {
-        case IR_TYPE_I8:
-        case IR_TYPE_I16:
-        case IR_TYPE_I32:
-            return "w";
-        case IR_TYPE_I64:
-        case IR_TYPE_I128:
-        case IR_TYPE_PTR:
-            return "l";
-        case IR_TYPE_F32:
-            return "s";
-        case IR_TYPE_F64:
-            return "d";
-        default:
-            return "w";
-    }
-}
-
-// Get QBE comparison suffix
-static const char *get_cmp_suffix(IRCmpKind kind) {
-    switch (kind) {
-        case IR_CMP_EQ: return "eq";
-        case IR_CMP_NE: return "ne";
-        case IR_CMP_ULT: return "ult";
-        case IR_CMP_ULE: return "ule";
-        case IR_CMP_UGT: return "ugt";
-        case IR_CMP_UGE: return "uge";
-        case IR_CMP_SLT: return "lt";
-        case IR_CMP_SLE: return "le";
-        case IR_CMP_SGT: return "gt";
-        case IR_CMP_SGE: return "ge";
-        default: return "eq";
+        default:
+            return NULL;
     }
 }
 
-// Get size of IR type in bytes
-static size_t ir_type_size(IRType *type) {
-    switch (type->kind) {
-        case IR_TYPE_I8: return 1;
-        case IR_TYPE_I16: return 2;
-        case IR_TYPE_I32: return 4;
-        case IR_TYPE_I64:
-        case IR_TYPE_I128:
-        case IR_TYPE_PTR: return 8;
-        case IR_TYPE_F32: return 4;
-        case IR_TYPE_F64: return 8;
-        default: return 8;
+// Generate identifier (variable lookup)
+static IRValue *generate_identifier(IRBuilder *b, ASTNode *node) {
+    ASTIdentifier *ident = (ASTIdentifier*)node;
+    IRInstruction *addr = (IRInstruction*)findEntry(b->variable_table, ident->name);
+    if (addr) {
+        IRInstruction *load = ir_inst_create(b->block, IR_LOAD, addr->type);
+        ir_set_operand(load, 0, (IRValue*)addr);
+        return (IRValue*)load;
+    } else {
+        // Function or undefined, for now zero
+        return ir_const_int(b->function, &g_ir_type_i64, 0);
     }
 }
 
 // Generate binary expression
-static IRValue *generate_binary_expr(ASTNode *node) {
+static IRValue *generate_binary_expr(IRBuilder *b, ASTNode *node) {
     ASTBinaryExpr *bin = (ASTBinaryExpr*)node;
 
     // Handle assignment separately
@@ -345,22 +912,27 @@ static IRValue *generate_binary_expr(ASTNode *node) {
         // Assume left is identifier
         if (bin->left->kind == AST_IDENTIFIER) {
             ASTIdentifier *ident = (ASTIdentifier*)bin->left;
-            IRValue *addr = (IRValue*)findEntry(variable_table, ident->name);
+            IRInstruction *addr = (IRInstruction*)findEntry(b->variable_table, ident->name);
             if (addr) {
-                IRValue *value = generate_expression(bin->right);
-                value = generate_cast(value, addr->type); // Cast to variable type
-                IRInstruction *store = ir_inst_create(current_block, IR_STORE);
-                store->mem_addr = addr;
-                store->arg = value;
+                IRValue *value = generate_expression(b, bin->right);
+                value = generate_cast(b, value, addr->type); // Cast to variable type
+                IRInstruction *store = ir_inst_create(b->block, IR_STORE, NULL);
+                ir_set_operand(store, 0, value);
+                ir_set_operand(store, 1, (IRValue*)addr);
                 return value; // Assignment returns the value
             }
         }
         // Error case
-        return ir_const_int(&g_ir_type_i32, 0);
+        return ir_const_int(b->function, &g_ir_type_i32, 0);
+    }
+
+    // && and || only evaluate their right side when it decides the result
+    if (bin->op == OP_AND || bin->op == OP_OR) {
+        return generate_logical_expr(b, node);
     }
 
-    IRValue *left = generate_expression(bin->left);
-    IRValue *right = generate_expression(bin->right);
+    IRValue *left = generate_expression(b, bin->left);
+    IRValue *right = generate_expression(b, bin->right);
 
     // Type coercion: promote to common type
     IRType *result_type = left->type;
@@ -373,106 +945,125 @@ static IRValue *generate_binary_expr(ASTNode *node) {
     }
 
     // Cast operands if needed
-    left = generate_cast(left, result_type);
-    right = generate_cast(right, result_type);
+    left = generate_cast(b, left, result_type);
+    right = generate_cast(b, right, result_type);
 
-    IRInstruction *inst = ir_inst_create(current_block, IR_ADD);
-    inst->arg1 = left;
-    inst->arg2 = right;
-    inst->type = result_type;
-
-    // Create result value
-    IRValue *result = ir_temp(current_module, result_type);
-    inst->result = result;
-    result->data.inst = inst;
-
-    // Set opcode based on operator
+    // Select opcode based on operator
+    IROpcode opcode;
+    IRCmpKind cmp_kind = IR_CMP_EQ;
     switch (bin->op) {
-        case OP_ADD: inst->opcode = IR_ADD; break;
-        case OP_SUB: inst->opcode = IR_SUB; break;
-        case OP_MUL: inst->opcode = IR_MUL; break;
-        case OP_DIV: inst->opcode = IR_DIV; break;
-        case OP_MOD: inst->opcode = IR_MOD; break;
+        case OP_ADD: opcode = IR_ADD; break;
+        case OP_SUB: opcode = IR_SUB; break;
+        case OP_MUL: opcode = IR_MUL; break;
+        case OP_DIV: opcode = IR_DIV; break;
+        case OP_MOD: opcode = IR_MOD; break;
         case OP_EQ: case OP_NE: case OP_LT: case OP_LE:
         case OP_GT: case OP_GE:
-            inst->opcode = IR_CMP;
+            opcode = IR_CMP;
             result_type = &g_ir_type_i32;
-            inst->type = result_type;
             // Set comparison kind
             switch (bin->op) {
-                case OP_EQ: inst->cmp_kind = IR_CMP_EQ; break;
-                case OP_NE: inst->cmp_kind = IR_CMP_NE; break;
-                case OP_LT: inst->cmp_kind = IR_CMP_SLT; break;
-                case OP_LE: inst->cmp_kind = IR_CMP_SLE; break;
-                case OP_GT: inst->cmp_kind = IR_CMP_SGT; break;
-                case OP_GE: inst->cmp_kind = IR_CMP_SGE; break;
-                default: inst->cmp_kind = IR_CMP_EQ; break;
+                case OP_EQ: cmp_kind = IR_CMP_EQ; break;
+                case OP_NE: cmp_kind = IR_CMP_NE; break;
+                case OP_LT: cmp_kind = IR_CMP_SLT; break;
+                case OP_LE: cmp_kind = IR_CMP_SLE; break;
+                case OP_GT: cmp_kind = IR_CMP_SGT; break;
+                case OP_GE: cmp_kind = IR_CMP_SGE; break;
+                default: cmp_kind = IR_CMP_EQ; break;
             }
             break;
-        case OP_AND: inst->opcode = IR_AND; break;
-        case OP_OR: inst->opcode = IR_OR; break;
+        case OP_BIT_AND: opcode = IR_AND; break;
+        case OP_BIT_OR: opcode = IR_OR; break;
+        case OP_BIT_XOR: opcode = IR_XOR; break;
+        case OP_SHL: opcode = IR_SHL; break;
+        case OP_SHR: opcode = IR_SHR; break;
         default:
-            inst->opcode = IR_ADD;
+            opcode = IR_ADD;
     }
 
-    return result;
+    IRInstruction *inst = ir_inst_create(b->block, opcode, result_type);
+    inst->cmp_kind = (uint8_t)cmp_kind;
+    ir_set_operand(inst, 0, left);
+    ir_set_operand(inst, 1, right);
+    return (IRValue*)inst;
 }
 
 // Generate unary expression
-static IRValue *generate_unary_expr(ASTNode *node) {
+static IRValue *generate_unary_expr(IRBuilder *b, ASTNode *node) {
     ASTUnaryExpr *unary = (ASTUnaryExpr*)node;
-    IRValue *operand = generate_expression(unary->operand);
-    
-    IRInstruction *inst = ir_inst_create(current_block, IR_SUB);
-    inst->arg = operand;
-    inst->type = operand->type;
-    
-    IRValue *result = ir_temp(current_module, inst->type);
-    inst->result = result;
-    result->data.inst = inst;
+    IRValue *operand = generate_expression(b, unary->operand);
+    IRInstruction *inst;
     
     switch (unary->op) {
-        case OP_NEG: inst->opcode = IR_SUB; break;
-        case OP_NOT: inst->opcode = IR_XOR; break;
-        case OP_BIT_NOT: inst->opcode = IR_XOR; break;
-        case OP_DEREF: inst->opcode = IR_LOAD; break;
-        case OP_ADDR_OF: inst->opcode = IR_ALLOC; break;
-        default: inst->opcode = IR_SUB;
+        case OP_NEG:
+            // -x => 0 - x
+            inst = ir_inst_create(b->block, IR_SUB, operand->type);
+            ir_set_operand(inst, 0, ir_const_int(b->function, operand->type, 0));
+            ir_set_operand(inst, 1, operand);
+            break;
+        case OP_NOT:
+            // !x => x == 0
+            inst = ir_inst_create(b->block, IR_CMP, &g_ir_type_i32);
+            inst->cmp_kind = IR_CMP_EQ;
+            ir_set_operand(inst, 0, operand);
+            ir_set_operand(inst, 1, ir_const_int(b->function, operand->type, 0));
+            break;
+        case OP_BIT_NOT:
+            // ~x => x ^ -1
+            inst = ir_inst_create(b->block, IR_XOR, operand->type);
+            ir_set_operand(inst, 0, operand);
+            ir_set_operand(inst, 1, ir_const_int(b->function, operand->type, -1));
+            break;
+        case OP_DEREF:
+            inst = ir_inst_create(b->block, IR_LOAD, operand->type);
+            ir_set_operand(inst, 0, operand);
+            break;
+        default:
+            return operand;
     }
     
-    return result;
+    return (IRValue*)inst;
 }
 
 // Generate function call
-static IRValue *generate_call(ASTNode *node) {
+static IRValue *generate_call(IRBuilder *b, ASTNode *node) {
     ASTCallExpr *call = (ASTCallExpr*)node;
     
     // Generate arguments
-    IRValue **args = arena_alloc_array(current_arena, IRValue*, call->arg_count);
+    IRValue **args = malloc(sizeof(IRValue*) * (call->arg_count ? call->arg_count : 1));
     for (size_t i = 0; i < call->arg_count; i++) {
-        args[i] = generate_expression(call->args[i]);
+        args[i] = generate_expression(b, call->args[i]);
     }
     
-    IRInstruction *inst = ir_inst_create(current_block, IR_CALL);
-    inst->args = args;
-    inst->arg_count = call->arg_count;
-    
-    // Get callee name
+    // Get callee name and, when it is defined in this module, its return
+    // type; arguments to such functions take the parameter types
+    const char *callee_name = "";
+    IRType *return_type = &g_ir_type_i64;
     if (call->callee->kind == AST_IDENTIFIER) {
         ASTIdentifier *ident = (ASTIdentifier*)call->callee;
-        inst->callee_name = strdup(ident->name);
+        callee_name = ident->name;
+        IRFunction *callee = b->module->function_table ?
+            (IRFunction*)findEntry(b->module->function_table, ident->name) : NULL;
+        if (callee && callee->return_type->kind != IR_TYPE_VOID) {
+            return_type = callee->return_type;
+        }
+        for (size_t i = 0; callee && i < call->arg_count && i < callee->param_count; i++) {
+            args[i] = generate_cast(b, args[i], callee->param_types[i]);
+        }
     }
     
-    inst->type = &g_ir_type_i64;
-    IRValue *result = ir_temp(current_module, inst->type);
-    inst->result = result;
-    result->data.inst = inst;
+    IRInstruction *inst = ir_inst_create(b->block, IR_CALL, return_type);
+    inst->ops[0].call = ir_call_data_create(b->function, callee_name, call->arg_count);
+    for (size_t i = 0; i < call->arg_count; i++) {
+        ir_set_operand(inst, i, args[i]);
+    }
+    free(args);
     
-    return result;
+    return (IRValue*)inst;
 }
 
 // Generate expression
-static IRValue *generate_expression(ASTNode *node) {
+static IRValue *generate_expression(IRBuilder *b, ASTNode *node) {
     if (!node) return NULL;
     
     switch (node->kind) {
@@ -480,19 +1071,19 @@ static IRValue *generate_expression(ASTNode *node) {
         case AST_LITERAL_FLOAT:
         case AST_LITERAL_STRING:
         case AST_LITERAL_BOOL:
-            return generate_literal(node);
+            return generate_literal(b, node);
             
         case AST_IDENTIFIER:
-            return generate_identifier(node);
+            return generate_identifier(b, node);
             
         case AST_BINARY_EXPR:
-            return generate_binary_expr(node);
+            return generate_binary_expr(b, node);
             
         case AST_UNARY_EXPR:
-            return generate_unary_expr(node);
+            return generate_unary_expr(b, node);
             
         case AST_CALL_EXPR:
-            return generate_call(node);
+            return generate_call(b, node);
             
         default:
             return NULL;
@@ -500,116 +1091,187 @@ static IRValue *generate_expression(ASTNode *node) {
 }
 
 // Generate block
-static void generate_block(ASTNode *node) {
+static void generate_block(IRBuilder *b, ASTNode *node) {
     ASTBlock *block = (ASTBlock*)node;
     for (size_t i = 0; i < block->statement_count; i++) {
-        generate_statement(block->statements[i]);
+        generate_statement(b, block->statements[i]);
+    }
+}
+
+// Append an unconditional branch to the current block
+static void generate_br(IRBuilder *b, IRBasicBlock *target) {
+    IRInstruction *br = ir_inst_create(b->block, IR_BR, NULL);
+    br->ops[0].block = target;
+}
+
+// Append a conditional branch to the current block
+static void generate_cbr(IRBuilder *b, IRValue *cond, IRBasicBlock *true_target, IRBasicBlock *false_target) {
+    IRInstruction *cbr = ir_inst_create(b->block, IR_CBR, NULL);
+    ir_set_operand(cbr, 0, cond);
+    cbr->ops[1].block = true_target;
+    cbr->ops[2].block = false_target;
+}
+
+// Branch to `on_true` or `on_false` on a condition. && and || become
+// branches that skip the right side, ! swaps the targets, and a comparison
+// feeds the branch directly, which QBE fuses into a compare-and-jump; no
+// 0/1 value is built for any of them.
+static void generate_condition(IRBuilder *b, ASTNode *node, IRBasicBlock *on_true, IRBasicBlock *on_false) {
+    if (node->kind == AST_BINARY_EXPR) {
+        ASTBinaryExpr *bin = (ASTBinaryExpr*)node;
+        if (bin->op == OP_AND || bin->op == OP_OR) {
+            bool is_and = bin->op == OP_AND;
+            IRBasicBlock *rhs_block = ir_basic_block_create(b->function, is_and ? "and.rhs" : "or.rhs");
+            generate_condition(b, bin->left, is_and ? rhs_block : on_true, is_and ? on_false : rhs_block);
+            b->block = rhs_block;
+            generate_condition(b, bin->right, on_true, on_false);
+            return;
+        }
+    } else if (node->kind == AST_UNARY_EXPR && ((ASTUnaryExpr*)node)->op == OP_NOT) {
+        generate_condition(b, ((ASTUnaryExpr*)node)->operand, on_false, on_true);
+        return;
+    }
+
+    IRValue *cond = generate_expression(b, node);
+    if (cond && cond->type->kind != IR_TYPE_I32) {
+        // jnz only tests a word
+        IRValue *zero = (cond->type->kind == IR_TYPE_F32 || cond->type->kind == IR_TYPE_F64) ?
+            ir_const_float(b->function, cond->type, 0.0) : ir_const_int(b->function, cond->type, 0);
+        IRInstruction *test = ir_inst_create(b->block, IR_CMP, &g_ir_type_i32);
+        test->cmp_kind = IR_CMP_NE;
+        ir_set_operand(test, 0, cond);
+        ir_set_operand(test, 1, zero);
+        cond = (IRValue*)test;
     }
+    generate_cbr(b, cond, on_true, on_false);
+}
+
+// a && b and a || b as a value, 1 or 0
+static IRValue *generate_logical_expr(IRBuilder *b, ASTNode *node) {
+    IRBasicBlock *true_block = ir_basic_block_create(b->function, "logic.true");
+    IRBasicBlock *false_block = ir_basic_block_create(b->function, "logic.false");
+    IRBasicBlock *end_block = ir_basic_block_create(b->function, "logic.end");
+    generate_condition(b, node, true_block, false_block);
+
+    b->block = true_block;
+    generate_br(b, end_block);
+    b->block = false_block;
+    generate_br(b, end_block);
+
+    b->block = end_block;
+    IRInstruction *phi = ir_inst_create(end_block, IR_PHI, &g_ir_type_i32);
+    ir_phi_add_incoming(b->function, phi, ir_const_int(b->function, &g_ir_type_i32, 1), true_block);
+    ir_phi_add_incoming(b->function, phi, ir_const_int(b->function, &g_ir_type_i32, 0), false_block);
+    return (IRValue*)phi;
 }
 
 // Generate if statement
-static void generate_if(ASTNode *node) {
+static void generate_if(IRBuilder *b, ASTNode *node) {
     ASTIfStmt *if_stmt = (ASTIfStmt*)node;
     
-    // Generate condition
-    IRValue *cond = generate_expression(if_stmt->condition);
-    
     // Create blocks
-    IRBasicBlock *then_block = ir_basic_block_create(current_function, "if.then");
+    IRBasicBlock *then_block = ir_basic_block_create(b->function, "if.then");
     IRBasicBlock *else_block = if_stmt->else_branch ? 
-        ir_basic_block_create(current_function, "if.else") : NULL;
-    IRBasicBlock *merge_block = ir_basic_block_create(current_function, "if.end");
+        ir_basic_block_create(b->function, "if.else") : NULL;
+    IRBasicBlock *merge_block = ir_basic_block_create(b->function, "if.end");
     
     // Conditional branch
-    IRInstruction *cbr = ir_inst_create(current_block, IR_CBR);
-    cbr->arg = cond;
-    cbr->true_target = then_block;
-    cbr->false_target = else_block ? else_block : merge_block;
+    generate_condition(b, if_stmt->condition, then_block, else_block ? else_block : merge_block);
     
     // Then block
-    current_block = then_block;
-    generate_statement(if_stmt->then_branch);
-    IRInstruction *br_then = ir_inst_create(current_block, IR_BR);
-    br_then->target = merge_block;
+    b->block = then_block;
+    generate_statement(b, if_stmt->then_branch);
+    generate_br(b, merge_block);
     
     // Else block
     if (else_block) {
-        current_block = else_block;
-        generate_statement(if_stmt->else_branch);
-        IRInstruction *br_else = ir_inst_create(current_block, IR_BR);
-        br_else->target = merge_block;
+        b->block = else_block;
+        generate_statement(b, if_stmt->else_branch);
+        generate_br(b, merge_block);
     }
     
     // Merge block
-    current_block = merge_block;
+    b->block = merge_block;
 }
 
 
 // Generate for loop
-static void generate_for(ASTNode *node) {
+static void generate_for(IRBuilder *b, ASTNode *node) {
     ASTForStmt *for_stmt = (ASTForStmt*)node;
     
-    IRBasicBlock *init_block = ir_basic_block_create(current_function, "for.init");
-    IRBasicBlock *cond_block = ir_basic_block_create(current_function, "for.cond");
-    IRBasicBlock *update_block = ir_basic_block_create(current_function, "for.update");
-    IRBasicBlock *body_block = ir_basic_block_create(current_function, "for.body");
-    IRBasicBlock *end_block = ir_basic_block_create(current_function, "for.end");
+    IRBasicBlock *init_block = ir_basic_block_create(b->function, "for.init");
+    IRBasicBlock *cond_block = ir_basic_block_create(b->function, "for.cond");
+    IRBasicBlock *update_block = ir_basic_block_create(b->function, "for.update");
+    IRBasicBlock *body_block = ir_basic_block_create(b->function, "for.body");
+    IRBasicBlock *end_block = ir_basic_block_create(b->function, "for.end");
+    
+    // Enter the loop explicitly; the preceding block is not necessarily
+    // laid out right before for.init
+    generate_br(b, init_block);
     
     // Init block
-    current_block = init_block;
-    if (for_stmt->init) {
-        generate_statement(for_stmt->init);
+    b->block = init_block;
+    if (for_stmt->init && for_stmt->init->kind == AST_VARIABLE_DECL) {
+        generate_statement(b, for_stmt->init);
+    } else if (for_stmt->init) {
+        generate_expression(b, for_stmt->init);
     }
-    IRInstruction *br_init = ir_inst_create(current_block, IR_BR);
-    br_init->target = cond_block;
+    generate_br(b, cond_block);
     
     // Condition block
-    current_block = cond_block;
+    b->block = cond_block;
     if (for_stmt->condition) {
-        IRValue *cond = generate_expression(for_stmt->condition);
-        IRInstruction *cbr = ir_inst_create(current_block, IR_CBR);
-        cbr->arg = cond;
-        cbr->true_target = body_block;
-        cbr->false_target = end_block;
+        generate_condition(b, for_stmt->condition, body_block, end_block);
     } else {
         // Infinite loop
-        IRInstruction *br = ir_inst_create(current_block, IR_BR);
-        br->target = body_block;
+        generate_br(b, body_block);
     }
     
     // Update block (jump back to condition)
-    current_block = update_block;
+    b->block = update_block;
     if (for_stmt->update) {
-        generate_expression(for_stmt->update); // Expression statement
+        generate_expression(b, for_stmt->update); // Expression statement
     }
-    IRInstruction *br_update = ir_inst_create(current_block, IR_BR);
-    br_update->target = cond_block;
+    generate_br(b, cond_block);
     
     // Body block
-    current_block = body_block;
-    generate_statement(for_stmt->body);
-    IRInstruction *br_body = ir_inst_create(current_block, IR_BR);
-    br_body->target = update_block;
+    b->block = body_block;
+    generate_statement(b, for_stmt->body);
+    generate_br(b, update_block);
     
     // End block
-    current_block = end_block;
+    b->block = end_block;
 }
 
 // Generate return statement
-static void generate_return(ASTNode *node) {
+static void generate_return(IRBuilder *b, ASTNode *node) {
     ASTReturnStmt *ret = (ASTReturnStmt*)node;
     
     IRValue *ret_val = NULL;
     if (ret->value) {
-        ret_val = generate_expression(ret->value);
+        ret_val = generate_expression(b, ret->value);
+        if (b->function->return_type->kind != IR_TYPE_VOID) {
+            ret_val = generate_cast(b, ret_val, b->function->return_type);
+        }
     }
     
-    IRInstruction *inst = ir_inst_create(current_block, IR_RET);
-    inst->arg = ret_val;
+    IRInstruction *inst = ir_inst_create(b->block, IR_RET, NULL);
+    ir_set_operand(inst, 0, ret_val);
+
+    // Anything after a return lands in a block with no predecessors
+    b->block = ir_basic_block_create(b->function, "unreachable");
+}
+
+// Emit a call to a libc print routine
+static void generate_print_call(IRBuilder *b, const char *callee_name, IRValue *arg0, IRValue *arg1) {
+    IRInstruction *call = ir_inst_create(b->block, IR_CALL, &g_ir_type_i32);
+    call->ops[0].call = ir_call_data_create(b->function, callee_name, arg1 ? 2 : 1);
+    ir_set_operand(call, 0, arg0);
+    if (arg1) ir_set_operand(call, 1, arg1);
 }
 
 // Generate print statement
-static void generate_print(ASTNode *node) {
+static void generate_print(IRBuilder *b, ASTNode *node) {
     ASTPrintStmt *print = (ASTPrintStmt*)node;
     
     // Handle each argument
@@ -619,106 +1281,93 @@ static void generate_print(ASTNode *node) {
         if (arg->kind == AST_LITERAL_STRING) {
             // Print string
             ASTLiteralString *lit = (ASTLiteralString*)arg;
-
-            IRInstruction *call = ir_inst_create(current_block, IR_CALL);
-            call->callee_name = strdup("puts");
-            call->args = arena_alloc_array(current_arena, IRValue*, 1);
-            call->args[0] = ir_const_string(current_module, &g_ir_type_string, lit->value);
-            call->arg_count = 1;
-            call->type = &g_ir_type_i32;
-            IRValue *result = ir_temp(current_module, call->type);
-            call->result = result;
-            result->data.inst = call;
+            generate_print_call(b, "puts",
+                ir_const_string(b->function, &g_ir_type_string, lit->value), NULL);
         } else {
             // Print integer (use printf with format)
-            IRValue *val = generate_expression(arg);
+            IRValue *val = generate_expression(b, arg);
 
             const char *format = (val->type->kind == IR_TYPE_I64) ? "%lld" : "%d";
 
-            IRInstruction *call = ir_inst_create(current_block, IR_CALL);
-            call->callee_name = strdup("printf");
-            call->args = arena_alloc_array(current_arena, IRValue*, 2);
-            call->args[0] = ir_const_string(current_module, &g_ir_type_string, format);
-            call->args[1] = val;
-            call->arg_count = 2;
-            call->type = &g_ir_type_i32;
-            IRValue *result = ir_temp(current_module, call->type);
-            call->result = result;
-            result->data.inst = call;
+            generate_print_call(b, "printf",
+                ir_const_string(b->function, &g_ir_type_string, format), val);
         }
         
         // Add newline for println
         if (print->is_println) {
-            IRInstruction *call = ir_inst_create(current_block, IR_CALL);
-            call->callee_name = strdup("puts");
-            call->args = arena_alloc_array(current_arena, IRValue*, 1);
-            call->args[0] = ir_const_string(current_module, &g_ir_type_string, "");
-            call->arg_count = 1;
-            call->type = &g_ir_type_i32;
-            IRValue *result = ir_temp(current_module, call->type);
-            call->result = result;
-            result->data.inst = call;
+            generate_print_call(b, "puts",
+                ir_const_string(b->function, &g_ir_type_string, ""), NULL);
         }
     }
 }
 
+// Stack slot for a local; the slot's type is the variable's type. Slots
+// all go at the start of the entry block, where QBE gives them a fixed
+// place in the frame; an alloc anywhere else grows the stack each time it
+// runs, e.g. on every iteration of a loop.
+static IRInstruction *generate_alloc(IRBuilder *b, IRType *type) {
+    IRBasicBlock *entry = b->function->entry_block;
+    IRInstruction *alloc = ir_inst_insert(entry, b->slot_count++, IR_ALLOC, type);
+    alloc->ops[0].imm = (int64_t)ir_type_size(type);
+    return alloc;
+}
+
 // Generate variable declaration
-static void generate_variable_decl(ASTNode *node) {
+static void generate_variable_decl(IRBuilder *b, ASTNode *node) {
     ASTVariableDecl *decl = (ASTVariableDecl*)node;
-
-    // Allocate space for variable
-    IRInstruction *alloc = ir_inst_create(current_block, IR_ALLOC);
-    alloc->type = ir_type_from_ast(decl->var_type);
-
-    IRValue *result = ir_temp(current_module, alloc->type);
-    alloc->result = result;
-    result->data.inst = alloc;
+    IRType *var_type = ir_type_from_ast(decl->var_type);
+    IRInstruction *alloc = generate_alloc(b, var_type);
 
     // Store in variable table
-    insertEntry(variable_table, decl->name, (void*)result, 0);
+    insertEntry(b->variable_table, decl->name, (void*)alloc, 0);
 
-    // Initialize if there's an initializer
+    // Without an initializer the variable starts at zero, as mem2reg
+    // assumes. The slot itself may still hold an earlier iteration's value.
+    IRValue *init_val;
     if (decl->init) {
-        IRValue *init_val = generate_expression(decl->init);
-
-        IRInstruction *store = ir_inst_create(current_block, IR_STORE);
-        store->mem_addr = result;
-        store->arg = init_val;
+        init_val = generate_cast(b, generate_expression(b, decl->init), var_type);
+    } else if (var_type->kind == IR_TYPE_F32 || var_type->kind == IR_TYPE_F64) {
+        init_val = ir_const_float(b->function, var_type, 0.0);
+    } else {
+        init_val = ir_const_int(b->function, var_type, 0);
     }
+    IRInstruction *store = ir_inst_create(b->block, IR_STORE, NULL);
+    ir_set_operand(store, 0, init_val);
+    ir_set_operand(store, 1, (IRValue*)alloc);
 }
 
 // Generate statement
-static void generate_statement(ASTNode *node) {
+static void generate_statement(IRBuilder *b, ASTNode *node) {
     if (!node) return;
     
     switch (node->kind) {
         case AST_BLOCK:
-            generate_block(node);
+            generate_block(b, node);
             break;
             
         case AST_IF_STMT:
-            generate_if(node);
+            generate_if(b, node);
             break;
 
         case AST_FOR_STMT:
-            generate_for(node);
+            generate_for(b, node);
             break;
             
         case AST_RETURN_STMT:
-            generate_return(node);
+            generate_return(b, node);
             break;
             
         case AST_PRINT_STMT:
-            generate_print(node);
+            generate_print(b, node);
             break;
             
         case AST_VARIABLE_DECL:
-            generate_variable_decl(node);
+            generate_variable_decl(b, node);
             break;
             
         case AST_EXPR_STMT: {
             ASTExprStmt *stmt = (ASTExprStmt*)node;
-            generate_expression(stmt->expr);
+            generate_expression(b, stmt->expr);
             break;
         }
         
@@ -727,45 +1376,297 @@ static void generate_statement(ASTNode *node) {
     }
 }
 
+// Fill in the parameter types of a function shell. Runs before any
+// function is lowered, so calls can convert their arguments.
+static void declare_params(IRModule *mod, IRFunction *ir_func, ASTFunction *func) {
+    ir_func->param_count = func->param_count;
+    ir_func->param_types = func->param_count ?
+        arena_alloc_array(mod->arena, IRType*, func->param_count) : NULL;
+    for (size_t i = 0; i < func->param_count; i++) {
+        ASTParam *param = (ASTParam*)func->params[i];
+        ir_func->param_types[i] = ir_type_from_ast(param->param_type);
+    }
+}
+
 // Generate function
-static void generate_function(ASTNode *node) {
+static void generate_function(IRBuilder *b, ASTNode *node, IRFunction *ir_func) {
     ASTFunction *func = (ASTFunction*)node;
 
-    // Create IR function
-    IRFunction *ir_func = ir_function_create(current_module, func->name, ir_type_from_ast(func->func_type->return_type));
-    ir_func->is_exported = func->is_exported;
+    b->function = ir_func;
+    b->variable_table = createHashtable(128);
+    b->slot_count = 0;
     
+    ir_func->building = true;
+
     // Create entry block
     IRBasicBlock *entry = ir_basic_block_create(ir_func, "entry");
-    current_block = entry;
+    b->block = entry;
+
+    // Parameters live in stack slots like other locals
+    for (size_t i = 0; i < ir_func->param_count && i < func->param_count; i++) {
+        ASTParam *param = (ASTParam*)func->params[i];
+        IRType *type = ir_func->param_types[i];
+        IRInstruction *alloc = generate_alloc(b, type);
+        IRInstruction *store = ir_inst_create(b->block, IR_STORE, NULL);
+        ir_set_operand(store, 0, ir_arg(ir_func, type, i));
+        ir_set_operand(store, 1, (IRValue*)alloc);
+        insertEntry(b->variable_table, param->name, (void*)alloc, 0);
+    }
     
     // Generate function body
     if (func->body) {
-        generate_block((ASTNode*)func->body);
+        generate_block(b, (ASTNode*)func->body);
     }
 
     // Add implicit return if no explicit return
-    if (current_block) {
+    if (b->block) {
         // Check if last instruction is a return
-        bool has_return = false;
-        if (current_block->last_instruction &&
-            (current_block->last_instruction->opcode == IR_RET ||
-             current_block->last_instruction->opcode == IR_CBR)) {
-            has_return = true;
-        }
+        IRInstruction *last = ir_block_terminator(b->block);
+        bool has_return = last && (last->opcode == IR_RET || last->opcode == IR_CBR);
         if (!has_return) {
-            IRInstruction *ret = ir_inst_create(current_block, IR_RET);
-            ret->arg = ir_const_int(&g_ir_type_i64, 0);
+            IRInstruction *ret = ir_inst_create(b->block, IR_RET, NULL);
+            ir_set_operand(ret, 0, ir_const_int(b->function, &g_ir_type_i64, 0));
+        }
+    }
+
+    // Move the instruction arrays into the arena
+    for (IRBasicBlock *block = ir_func->blocks; block; block = block->next) {
+        IRInstruction **insts = block->inst_count ?
+            arena_alloc_array(ir_func->arena, IRInstruction*, block->inst_count) : NULL;
+        if (insts) {
+            memcpy(insts, block->instructions, sizeof(IRInstruction*) * block->inst_count);
+        }
+        free(block->instructions);
+        block->instructions = insts;
+        block->inst_capacity = block->inst_count;
+    }
+    ir_func->building = false;
+    free(ir_func->constants);
+    ir_func->constants = NULL;
+    ir_func->constant_count = 0;
+    ir_func->constant_capacity = 0;
+
+    freeHashtable(b->variable_table);
+    b->variable_table = NULL;
+}
+
+
+//=============================================================================
+// Parallel Driver
+//=============================================================================
+
+// Work shared by all workers of one parallel phase. Functions are handed
+// out one at a time through next_index so uneven sizes balance out, except
+// to workers pinned to a list of their own.
+typedef struct IRWorkQueue {
+    IRModule *mod;
+    ASTProgram *ast;
+    char **buffers;               // Emission phase: rendered text per function
+    size_t *buffer_sizes;
+    size_t pass_begin;            // Pipeline slots run on each function
+    size_t pass_end;
+    atomic_size_t next_index;
+} IRWorkQueue;
+
+typedef struct IRWorker {
+    IRWorkQueue *queue;
+    Arena *arena;
+    size_t *pinned;               // Function indices this worker alone runs
+    size_t pinned_count;
+    void (*run)(struct IRWorker *worker, size_t index);
+} IRWorker;
+
+static void *worker_main(void *arg) {
+    IRWorker *worker = (IRWorker*)arg;
+    if (worker->pinned) {
+        for (size_t i = 0; i < worker->pinned_count; i++) {
+            worker->run(worker, worker->pinned[i]);
+        }
+        return NULL;
+    }
+    size_t count = worker->queue->mod->function_count;
+    for (;;) {
+        size_t index = atomic_fetch_add(&worker->queue->next_index, 1);
+        if (index >= count) break;
+        worker->run(worker, index);
+    }
+    return NULL;
+}
+
+// Number of workers to use for a phase over the module's functions
+static size_t worker_count_for(IRModule *mod) {
+    size_t threads = mod->thread_count;
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (size_t)cpus : 1;
+    }
+    if (threads > mod->function_count) threads = mod->function_count;
+    return threads ? threads : 1;
+}
+
+// Run worker->run over every function index using `count` threads. A single
+// worker runs on the calling thread, so -j1 never touches pthreads.
+static void run_workers(IRWorker *workers, size_t count) {
+    if (count == 1) {
+        worker_main(&workers[0]);
+        return;
+    }
+
+    pthread_t *threads = malloc(sizeof(pthread_t) * count);
+    size_t started = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0) break;
+        started++;
+    }
+    // If thread creation failed part way, finish the queue here
+    if (started < count) {
+        worker_main(&workers[started]);
+    }
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+static void generate_worker_run(IRWorker *worker, size_t index) {
+    IRModule *mod = worker->queue->mod;
+    IRFunction *ir_func = mod->functions[index];
+    IRBuilder builder = { .module = mod };
+
+    ir_func->arena = worker->arena;
+    generate_function(&builder, worker->queue->ast->functions[index], ir_func);
+    // Optimize while the function is still in cache
+    if (worker->queue->pass_begin < worker->queue->pass_end) {
+        ir_pass_manager_run_function(mod->pass_manager, ir_func,
+            worker->queue->pass_begin, worker->queue->pass_end);
+    }
+}
+
+static void optimize_worker_run(IRWorker *worker, size_t index) {
+    IRWorkQueue *queue = worker->queue;
+    ir_pass_manager_run_function(queue->mod->pass_manager, queue->mod->functions[index],
+        queue->pass_begin, queue->pass_end);
+}
+
+// End of the run of function passes starting at pipeline slot `begin`
+static size_t function_passes_end(IRPassManager *pm, size_t begin) {
+    size_t end = begin;
+    while (end < pm->pass_count && !pm->passes[end]->run_module) {
+        end++;
+    }
+    return end;
+}
+
+// One worker per arena the functions live in, pinned to the functions in
+// it: passes allocate from the function's arena, and an arena must not be
+// used by two threads at once. `indices` backs the pinned lists.
+static IRWorker *pinned_workers(IRModule *mod, size_t **indices, size_t *count) {
+    size_t n = mod->function_count ? mod->function_count : 1;
+    IRWorker *workers = calloc(n, sizeof(IRWorker));
+    size_t *group = malloc(sizeof(size_t) * n);
+    size_t used = 0;
+    for (size_t i = 0; i < mod->function_count; i++) {
+        size_t w = 0;
+        while (w < used && workers[w].arena != mod->functions[i]->arena) w++;
+        if (w == used) workers[used++].arena = mod->functions[i]->arena;
+        workers[w].pinned_count++;
+        group[i] = w;
+    }
+
+    *indices = malloc(sizeof(size_t) * n);
+    size_t offset = 0;
+    for (size_t w = 0; w < used; w++) {
+        workers[w].pinned = *indices + offset;
+        offset += workers[w].pinned_count;
+        workers[w].pinned_count = 0;
+    }
+    for (size_t i = 0; i < mod->function_count; i++) {
+        IRWorker *worker = &workers[group[i]];
+        worker->pinned[worker->pinned_count++] = i;
+    }
+    free(group);
+    *count = used;
+    return workers;
+}
+
+// Run the pipeline from slot `begin` on. Module passes are barriers; the
+// function passes between them run over all functions in parallel.
+static void optimize_module(IRModule *mod, size_t begin) {
+    IRPassManager *pm = mod->pass_manager;
+    size_t *indices;
+    size_t count;
+    IRWorker *workers = pinned_workers(mod, &indices, &count);
+    while (begin < pm->pass_count) {
+        if (pm->passes[begin]->run_module) {
+            ir_pass_manager_run_module(pm, mod, begin++);
+            continue;
+        }
+        IRWorkQueue queue = { .mod = mod, .pass_begin = begin };
+        queue.pass_end = function_passes_end(pm, begin);
+        atomic_init(&queue.next_index, 0);
+        for (size_t i = 0; i < count; i++) {
+            workers[i].queue = &queue;
+            workers[i].run = optimize_worker_run;
+        }
+        run_workers(workers, count);
+        begin = queue.pass_end;
+    }
+    free(indices);
+    free(workers);
+}
+
+// Assign module-wide string names in source order, exactly as a sequential
+// run would, and point each string reference at its module global.
+static void merge_function_strings(IRModule *mod) {
+    for (size_t i = 0; i < mod->function_count; i++) {
+        IRFunction *func = mod->functions[i];
+        for (size_t j = 0; j < func->string_count; j++) {
+            IRGlobalRef *ref = func->strings[j];
+            ref->global = ir_add_string(mod, ref->string);
+            ref->id = (uint32_t)j; // Names the address temp of a tail-merged string
         }
     }
 }
 
 // Generate module
-static void generate_module(ASTNode *node) {
-    ASTProgram *prog = (ASTProgram*)node;
-    
+static void generate_module(IRModule *mod, ASTProgram *prog) {
+    // Create function shells up front so module order is source order.
+    // The name table is read-only while workers run.
+    mod->function_table = createHashtable(prog->function_count * 2 + 1);
     for (size_t i = 0; i < prog->function_count; i++) {
-        generate_function(prog->functions[i]);
+        ASTFunction *func = (ASTFunction*)prog->functions[i];
+        Type *return_type = func->func_type ? func->func_type->return_type : NULL;
+        IRFunction *ir_func = ir_function_create(mod, func->name, ir_type_from_ast(return_type));
+        ir_func->is_exported = func->is_exported;
+        declare_params(mod, ir_func, func);
+        insertEntry(mod->function_table, func->name, ir_func, 0);
+    }
+    if (mod->function_count == 0) return;
+
+    size_t count = worker_count_for(mod);
+    mod->worker_arenas = realloc(mod->worker_arenas, sizeof(Arena*) * (mod->worker_count + count));
+
+    // The leading function passes run as part of generation
+    IRWorkQueue queue = { .mod = mod, .ast = prog };
+    if (mod->pass_manager) {
+        queue.pass_end = function_passes_end(mod->pass_manager, 0);
+    }
+    atomic_init(&queue.next_index, 0);
+    IRWorker *workers = malloc(sizeof(IRWorker) * count);
+    for (size_t i = 0; i < count; i++) {
+        workers[i] = (IRWorker){ .queue = &queue, .arena = arena_create(64 * 1024), .run = generate_worker_run };
+        mod->worker_arenas[mod->worker_count++] = workers[i].arena;
+    }
+
+    run_workers(workers, count);
+    free(workers);
+    if (mod->pass_manager) {
+        optimize_module(mod, queue.pass_end);
+    }
+
+    merge_function_strings(mod);
+    if (mod->merge_strings) {
+        ir_merge_string_tails(mod);
     }
 }
 
@@ -774,17 +1675,11 @@ static void generate_module(ASTNode *node) {
 //=============================================================================
 
 int ir_generate(IRModule *mod, ASTProgram *ast) {
-    current_module = mod;
-    string_table = createHashtable(128);
-    variable_table = createHashtable(128);
-
-    generate_module((ASTNode*)ast);
-
-    freeHashtable(string_table);
-    freeHashtable(variable_table);
+    generate_module(mod, ast);
     return 0;
 }
 
+
 //=============================================================================
 // QBE Emitter
 //=============================================================================
@@ -818,28 +1713,43 @@ static void emit_value(FILE *fp, IRValue *val) {
     }
     
     switch (val->kind) {
-        case IR_VALUE_CONST:
-            if (val->type->kind == IR_TYPE_F64 || val->type->kind == IR_TYPE_F32) {
-                fprintf(fp, "%f", val->data.const_float);
+        case IR_VALUE_CONST: {
+            IRConstant *c = (IRConstant*)val;
+            if (val->type->kind == IR_TYPE_F64) {
+                fprintf(fp, "d_%.17g", c->float_value);
+            } else if (val->type->kind == IR_TYPE_F32) {
+                fprintf(fp, "s_%.9g", c->float_value);
             } else {
-                fprintf(fp, "%" PRId64, val->data.const_int);
+                fprintf(fp, "%" PRId64, c->int_value);
             }
             break;
+        }
             
         case IR_VALUE_ARG:
-            fprintf(fp, "%%arg%zu", val->data.arg_index);
+            fprintf(fp, "%%arg%" PRIu32, val->id);
             break;
             
         case IR_VALUE_INST:
-            fprintf(fp, "%%t%zu", val->id);
+            fprintf(fp, "%%t%" PRIu32, val->id);
             break;
             
-        case IR_VALUE_GLOBAL:
-            fprintf(fp, "$%s", val->data.global_name);
+        case IR_VALUE_GLOBAL: {
+            IRGlobal *global = ((IRGlobalRef*)val)->global;
+            if (global->tail_of) {
+                fprintf(fp, "%%tail%u", val->id);
+            } else {
+                fprintf(fp, "$%s", global->name);
+            }
             break;
+        }
     }
 }
 
+// Emit block label (formatted from the block's ID)
+static void emit_label(FILE *fp, IRBasicBlock *block) {
+    fprintf(fp, "@%s.%" PRIu32, block->name, block->id);
+}
+
 // Get QBE opcode string
 static const char *get_qbe_op(IROpcode op) {
     switch (op) {
@@ -848,16 +1758,46 @@ static const char *get_qbe_op(IROpcode op) {
         case IR_MUL: return "mul";
         case IR_DIV: return "div";
         case IR_MOD: return "rem";
+        case IR_UDIV: return "udiv";
+        case IR_UREM: return "urem";
         case IR_AND: return "and";
         case IR_OR: return "or";
         case IR_XOR: return "xor";
         case IR_SHL: return "shl";
         case IR_SHR: return "shr";
+        case IR_SAR: return "sar";
         case IR_CMP: return "cmp";
         default: return "add";
     }
 }
 
+// Get QBE conversion mnemonic for a cast instruction
+static const char *get_cast_op(IRInstruction *inst) {
+    IRTypeKind from = inst->ops[0].value->type->kind;
+    IRTypeKind to = inst->type->kind;
+    bool from_float = from == IR_TYPE_F32 || from == IR_TYPE_F64;
+    bool to_float = to == IR_TYPE_F32 || to == IR_TYPE_F64;
+
+    switch (inst->opcode) {
+        case IR_SEXT:
+            if (from == IR_TYPE_I8) return "extsb";
+            if (from == IR_TYPE_I16) return "extsh";
+            return "extsw";
+        case IR_ZEXT:
+            if (from == IR_TYPE_I8) return "extub";
+            if (from == IR_TYPE_I16) return "extuh";
+            return "extuw";
+        case IR_SITOFPD:
+            return (from == IR_TYPE_I64) ? "sltof" : "swtof";
+        case IR_FPTOSI:
+            return (from == IR_TYPE_F32) ? "stosi" : "dtosi";
+        default:
+            // Truncation and same-class bit casts are plain copies; QBE only
+            // needs `cast` to move bits between int and float classes
+            return (from_float != to_float) ? "cast" : "copy";
+    }
+}
+
 // Emit instruction
 static void emit_instruction(FILE *fp, IRInstruction *inst) {
     if (!inst) return;
@@ -868,33 +1808,38 @@ static void emit_instruction(FILE *fp, IRInstruction *inst) {
         case IR_MUL:
         case IR_DIV:
         case IR_MOD:
+        case IR_UDIV:
+        case IR_UREM:
         case IR_AND:
         case IR_OR:
         case IR_XOR:
         case IR_SHL:
-        case IR_SHR: {
+        case IR_SHR:
+        case IR_SAR: {
             const char *suffix = get_type_suffix(inst->type);
-            fprintf(fp, "    %%t%zu =%s %s ", inst->result->id, suffix, get_qbe_op(inst->opcode));
-            emit_value(fp, inst->arg1);
+            fprintf(fp, "    %%t%" PRIu32 " =%s %s ", inst->id, suffix, get_qbe_op(inst->opcode));
+            emit_value(fp, inst->ops[0].value);
             fprintf(fp, ", ");
-            emit_value(fp, inst->arg2);
+            emit_value(fp, inst->ops[1].value);
             fprintf(fp, "\n");
             break;
         }
         
         case IR_CMP: {
-            fprintf(fp, "    %%t%zu =%s c%s%s ", inst->result->id, get_type_suffix(inst->type), get_cmp_suffix(inst->cmp_kind), get_type_suffix(inst->arg1->type));
-            emit_value(fp, inst->arg1);
+            IRType *operand_type = inst->ops[0].value->type;
+            fprintf(fp, "    %%t%" PRIu32 " =%s c%s%s ", inst->id, get_type_suffix(inst->type),
+                get_cmp_suffix(inst->cmp_kind, operand_type), get_type_suffix(operand_type));
+            emit_value(fp, inst->ops[0].value);
             fprintf(fp, ", ");
-            emit_value(fp, inst->arg2);
+            emit_value(fp, inst->ops[1].value);
             fprintf(fp, "\n");
             break;
         }
         
         case IR_RET:
-            if (inst->arg) {
+            if (inst->ops[0].value) {
                 fprintf(fp, "    ret ");
-                emit_value(fp, inst->arg);
+                emit_value(fp, inst->ops[0].value);
                 fprintf(fp, "\n");
             } else {
                 fprintf(fp, "    ret\n");
@@ -902,68 +1847,90 @@ static void emit_instruction(FILE *fp, IRInstruction *inst) {
             break;
             
         case IR_BR:
-            fprintf(fp, "    jmp @%s\n", inst->target->name);
+            fprintf(fp, "    jmp ");
+            emit_label(fp, inst->ops[0].block);
+            fprintf(fp, "\n");
             break;
             
         case IR_CBR:
             fprintf(fp, "    jnz ");
-            emit_value(fp, inst->arg);
-            fprintf(fp, ", @%s, @%s\n", 
-                inst->true_target->name, 
-                inst->false_target->name);
+            emit_value(fp, inst->ops[0].value);
+            fprintf(fp, ", ");
+            emit_label(fp, inst->ops[1].block);
+            fprintf(fp, ", ");
+            emit_label(fp, inst->ops[2].block);
+            fprintf(fp, "\n");
             break;
             
         case IR_CALL: {
-            const char *suffix = get_type_suffix(inst->type);
-            fprintf(fp, "    %%t%zu =%s call $%s(", inst->result->id, suffix, inst->callee_name);
-            for (size_t i = 0; i < inst->arg_count; i++) {
+            IRCallData *call = inst->ops[0].call;
+            // An unused result needs no temp
+            if (inst->type->kind != IR_TYPE_VOID && inst->uses) {
+                fprintf(fp, "    %%t%" PRIu32 " =%s call $%s(", inst->id, get_type_suffix(inst->type), call->callee_name);
+            } else {
+                fprintf(fp, "    call $%s(", call->callee_name);
+            }
+            for (size_t i = 0; i < call->arg_count; i++) {
                 if (i > 0) fprintf(fp, ", ");
-                emit_type(fp, inst->args[i]->type);
+                emit_type(fp, call->args[i].use.value->type);
                 fprintf(fp, " ");
-                emit_value(fp, inst->args[i]);
+                emit_value(fp, call->args[i].use.value);
             }
             fprintf(fp, ")\n");
             break;
         }
+
+        case IR_PHI: {
+            IRPhiData *phi = inst->ops[0].phi;
+            fprintf(fp, "    %%t%" PRIu32 " =%s phi ", inst->id, get_type_suffix(inst->type));
+            for (uint32_t i = 0; phi && i < phi->arg_count; i++) {
+                if (i > 0) fprintf(fp, ", ");
+                emit_label(fp, phi->args[i].block);
+                fprintf(fp, " ");
+                emit_value(fp, phi->args[i].use.value);
+            }
+            fprintf(fp, "\n");
+            break;
+        }
         
         case IR_ALLOC: {
-            fprintf(fp, "    %%t%zu =l alloc %zu\n", inst->result->id, ir_type_size(inst->type));
+            int64_t size = inst->ops[0].imm;
+            fprintf(fp, "    %%t%" PRIu32 " =l alloc%d %" PRId64 "\n", inst->id, size > 4 ? 8 : 4, size);
             break;
         }
         
         case IR_LOAD: {
-            fprintf(fp, "    %%t%zu =l load ", inst->result->id);
-            emit_value(fp, inst->mem_addr);
+            const char *suffix = get_type_suffix(inst->type);
+            fprintf(fp, "    %%t%" PRIu32 " =%s load%s ", inst->id, suffix, suffix);
+            emit_value(fp, inst->ops[0].value);
             fprintf(fp, "\n");
             break;
         }
         
         case IR_STORE: {
-            fprintf(fp, "    store ");
-            emit_value(fp, inst->arg);
+            // Store width follows the slot, i.e. the alloc's type
+            IRValue *addr = inst->ops[1].value;
+            IRType *slot_type = (addr->kind == IR_VALUE_INST &&
+                ((IRInstruction*)addr)->opcode == IR_ALLOC) ? addr->type : inst->ops[0].value->type;
+            fprintf(fp, "    store%s ", get_type_suffix(slot_type));
+            emit_value(fp, inst->ops[0].value);
             fprintf(fp, ", ");
-            emit_value(fp, inst->mem_addr);
+            emit_value(fp, addr);
             fprintf(fp, "\n");
             break;
         }
 
-        case IR_BITCAST: {
-            fprintf(fp, "    %%t%zu =%s cast %%t%zu\n", inst->result->id, get_type_suffix(inst->type), inst->arg->id);
-            break;
-        }
-
-        case IR_SEXT: {
-            fprintf(fp, "    %%t%zu =%s cast %%t%zu\n", inst->result->id, get_type_suffix(inst->type), inst->arg->id);
-            break;
-        }
-
-        case IR_SITOFPD: {
-            fprintf(fp, "    %%t%zu =d extsw %%t%zu\n", inst->result->id, inst->arg->id);
-            break;
-        }
-
-        case IR_FPTOSI: {
-            fprintf(fp, "    %%t%zu =w truncd %%t%zu\n", inst->result->id, inst->arg->id);
+        case IR_SEXT:
+        case IR_ZEXT:
+        case IR_TRUNC:
+        case IR_BITCAST:
+        case IR_SITOFPD:
+        case IR_FPTOSI:
+        case IR_COPY: {
+            const char *op = inst->opcode == IR_COPY ? "copy" : get_cast_op(inst);
+            fprintf(fp, "    %%t%" PRIu32 " =%s %s ", inst->id, get_type_suffix(inst->type), op);
+            emit_value(fp, inst->ops[0].value);
+            fprintf(fp, "\n");
             break;
         }
 
@@ -973,13 +1940,27 @@ static void emit_instruction(FILE *fp, IRInstruction *inst) {
 }
 
 // Emit basic block
+// QBE operands cannot carry a symbol offset, so the address of each
+// tail-merged string is computed once at function entry
+static void emit_string_addresses(FILE *fp, IRFunction *func) {
+    for (size_t i = 0; i < func->string_count; i++) {
+        IRGlobalRef *ref = func->strings[i];
+        if (ref->global && ref->global->tail_of) {
+            fprintf(fp, "    %%tail%u =l add $%s, %zu\n",
+                ref->id, ref->global->tail_of->name, ref->global->tail_offset);
+        }
+    }
+}
+
 static void emit_basic_block(FILE *fp, IRBasicBlock *block) {
-    fprintf(fp, "@%s\n", block->name);
+    emit_label(fp, block);
+    fprintf(fp, "\n");
+    if (block == block->function->entry_block) {
+        emit_string_addresses(fp, block->function);
+    }
     
-    IRInstruction *inst = block->instructions;
-    while (inst) {
-        emit_instruction(fp, inst);
-        inst = inst->next;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        emit_instruction(fp, block->instructions[i]);
     }
 }
 
@@ -1008,17 +1989,46 @@ static void emit_function(FILE *fp, IRFunction *func) {
     fprintf(fp, "}\n\n");
 }
 
-// Emit global
+// Emit global. Printable characters go in a quoted run; quotes,
+// backslashes and other bytes are written as numbers so the output does
+// not depend on how QBE or the assembler treat escapes.
 static void emit_global(FILE *fp, IRGlobal *global) {
     if (global->kind == IR_GLOBAL_STRING) {
-        fprintf(fp, "data $%s = { b \"%s\", b 0 }\n",
-            global->name,
-            global->string_value);
+        if (global->tail_of) return; // Stored inside tail_of
+
+        fprintf(fp, "data $%s = { ", global->name);
+        bool in_run = false;
+        for (size_t i = 0; i < global->length; i++) {
+            unsigned char c = (unsigned char)global->string_value[i];
+            if (c >= 0x20 && c < 0x7f && c != '"' && c != '\\') {
+                if (!in_run) {
+                    fprintf(fp, "b \"");
+                    in_run = true;
+                }
+                fputc(c, fp);
+            } else {
+                if (in_run) {
+                    fprintf(fp, "\", ");
+                    in_run = false;
+                }
+                fprintf(fp, "b %u, ", c);
+            }
+        }
+        if (in_run) fprintf(fp, "\", ");
+        fprintf(fp, "b 0 }\n");
     }
 }
 
-void ir_print(IRModule *mod, FILE *fp) {
-    // Emit string constants first
+static void emit_worker_run(IRWorker *worker, size_t index) {
+    IRWorkQueue *queue = worker->queue;
+    FILE *fp = open_memstream(&queue->buffers[index], &queue->buffer_sizes[index]);
+    if (!fp) return; // Rendered directly by ir_print instead
+    emit_function(fp, queue->mod->functions[index]);
+    fclose(fp);
+}
+
+// Emit string constants and the integer format string
+static void emit_module_data(FILE *fp, IRModule *mod) {
     for (size_t i = 0; i < mod->global_count; i++) {
         emit_global(fp, mod->globals[i]);
     }
@@ -1026,21 +2036,52 @@ void ir_print(IRModule *mod, FILE *fp) {
     
     // Emit format string for integers
     fprintf(fp, "data $fmt_d = { b \"%%d\\n\", b 0 }\n\n");
+}
+
+void ir_print(IRModule *mod, FILE *fp) {
+    // Emit string constants first
+    emit_module_data(fp, mod);
     
+    if (mod->function_count == 0) return;
+
+    // Render functions in parallel, then concatenate in source order
+    size_t count = worker_count_for(mod);
+    IRWorkQueue queue = { .mod = mod };
+    queue.buffers = calloc(mod->function_count, sizeof(char*));
+    queue.buffer_sizes = calloc(mod->function_count, sizeof(size_t));
+    atomic_init(&queue.next_index, 0);
+    IRWorker *workers = malloc(sizeof(IRWorker) * count);
+    for (size_t i = 0; i < count; i++) {
+        workers[i] = (IRWorker){ .queue = &queue, .run = emit_worker_run };
+    }
+
+    run_workers(workers, count);
+    free(workers);
+
     // Emit functions
     for (size_t i = 0; i < mod->function_count; i++) {
-        emit_function(fp, mod->functions[i]);
+        if (queue.buffers[i]) {
+            fwrite(queue.buffers[i], 1, queue.buffer_sizes[i], fp);
+            free(queue.buffers[i]);
+        } else {
+            emit_function(fp, mod->functions[i]);
+        }
     }
+    free(queue.buffers);
+    free(queue.buffer_sizes);
 }
 
-int ir_emit(IRModule *mod, const char *filename) {
-    // Create build directory if needed
+// Open an output file, creating the build directory if needed
+static FILE *open_output(const char *filename) {
     struct stat st = {0};
     if (stat("build", &st) != 0) {
         mkdir("build", 0700);
     }
-    
-    FILE *fp = fopen(filename, "w");
+    return fopen(filename, "w");
+}
+
+int ir_emit(IRModule *mod, const char *filename) {
+    FILE *fp = open_output(filename);
     if (!fp) {
         fprintf(stderr, "Error: Could not open file %s\n", filename);
         return -1;
@@ -1052,7 +2093,216 @@ int ir_emit(IRModule *mod, const char *filename) {
     return 0;
 }
 
+//=============================================================================
+// Streaming Pipeline
+//=============================================================================
+
+// Register the signature of a function seen in the first pass
+static IRFunction *stream_declare(IRModule *mod, ASTFunction *func) {
+    Type *return_type = func->func_type ? func->func_type->return_type : NULL;
+    IRFunction *ir_func = ir_function_create(mod, func->name, ir_type_from_ast(return_type));
+    ir_func->is_exported = func->is_exported;
+    declare_params(mod, ir_func, func);
+    if (!findEntry(mod->function_table, func->name)) {
+        insertEntry(mod->function_table, func->name, ir_func, 0);
+    }
+    return ir_func;
+}
+
+// Lower and emit one function, then drop its IR. The AST and IR both
+// live in `arena`; the caller rewinds it.
+static void stream_function(IRModule *mod, IRFunction *ir_func, ASTFunction *func, Arena *arena, FILE *fp) {
+    IRBuilder b = { .module = mod };
+    ir_func->arena = arena;
+    generate_function(&b, (ASTNode*)func, ir_func);
+    if (mod->pass_manager) {
+        IRPassManager *pm = mod->pass_manager;
+        for (size_t begin = 0; begin < pm->pass_count;) {
+            size_t end = function_passes_end(pm, begin);
+            ir_pass_manager_run_function(pm, ir_func, begin, end);
+            begin = end + 1; // Skip the module pass
+        }
+    }
+
+    for (size_t i = 0; i < ir_func->string_count; i++) {
+        IRGlobalRef *ref = ir_func->strings[i];
+        ref->global = ir_add_string(mod, ref->string);
+        ref->id = (uint32_t)i;
+    }
+
+    emit_function(fp, ir_func);
+
+    for (IRBasicBlock *block = ir_func->blocks; block; block = block->next) {
+        mod->streamed_blocks++;
+        mod->streamed_instructions += block->inst_count;
+    }
+    size_t bytes = arena_get_used_memory(arena);
+    if (bytes > mod->peak_function_bytes) {
+        mod->peak_function_bytes = bytes;
+    }
+
+    free(ir_func->strings);
+    ir_func->strings = NULL;
+    ir_func->string_count = 0;
+    ir_func->string_capacity = 0;
+    ir_func->blocks = NULL;
+    ir_func->last_block = NULL;
+    ir_func->entry_block = NULL;
+    memset(ir_func->spare_arrays, 0, sizeof(ir_func->spare_arrays));
+    ir_cfg_invalidate(ir_func);
+    ir_func->arena = mod->arena;
+}
+
+// Body of main followed by the top-level statements
+static ASTFunction *stream_main(Arena *arena, ASTFunction *func, ASTNode **statements, size_t statement_count) {
+    ASTBlock *body = (ASTBlock*)func->body;
+    size_t own = body ? body->statement_count : 0;
+
+    ASTBlock *block = ast_new(arena, ASTBlock);
+    block->kind = AST_BLOCK;
+    block->type = NULL;
+    block->line = func->line;
+    block->column = func->column;
+    block->statement_count = own + statement_count;
+    block->statements = arena_alloc_array(arena, ASTNode*, block->statement_count ? block->statement_count : 1);
+    if (own) {
+        memcpy(block->statements, body->statements, sizeof(ASTNode*) * own);
+    }
+    if (statement_count) {
+        memcpy(block->statements + own, statements, sizeof(ASTNode*) * statement_count);
+    }
+
+    ASTFunction *main_func = ast_new(arena, ASTFunction);
+    *main_func = *func;
+    main_func->body = (ASTNode*)block;
+    return main_func;
+}
+
+int ir_compile_stream(IRModule *mod, const char *source, const char *filename) {
+    Arena *arena = arena_create(64 * 1024);
+    mod->streamed = true;
+    mod->function_table = createHashtable(64);
+
+    // First pass: signatures, so calls to later functions get their types,
+    // and the top-level statements that belong to main
+    ASTStream stream;
+    ast_stream_init(&stream, source, mod->arena);
+    IRFunction *main_func = NULL;
+    ASTProgram *prog;
+    while ((prog = ast_stream_next(&stream, arena))) {
+        for (size_t i = 0; i < prog->function_count; i++) {
+            IRFunction *ir_func = stream_declare(mod, (ASTFunction*)prog->functions[i]);
+            if (!main_func && strcmp(ir_func->name, "main") == 0) {
+                main_func = ir_func;
+            }
+        }
+        arena_rewind(arena);
+    }
+    ASTNode **statements = stream.statements;
+    size_t statement_count = stream.statement_count;
+    ast_stream_free(&stream);
+
+    // Top-level statements without a main function form their own
+    ASTFunction *synthesized = NULL;
+    if (!main_func && statement_count) {
+        synthesized = ast_new(mod->arena, ASTFunction);
+        memset(synthesized, 0, sizeof(ASTFunction));
+        synthesized->kind = AST_FUNCTION;
+        synthesized->name = "main";
+        main_func = stream_declare(mod, synthesized);
+    }
+    if (!main_func) {
+        fprintf(stderr, "Error: No main function found. Programs must have a 'main' function as the entry point.\n");
+        arena_destroy(arena);
+        return -1;
+    }
+
+    FILE *fp = open_output(filename);
+    if (!fp) {
+        fprintf(stderr, "Error: Could not open file %s\n", filename);
+        arena_destroy(arena);
+        return -1;
+    }
+
+    // Second pass: one function at a time, in source order
+    ast_stream_init(&stream, source, NULL);
+    size_t index = 0;
+    while ((prog = ast_stream_next(&stream, arena))) {
+        for (size_t i = 0; i < prog->function_count; i++) {
+            ASTFunction *func = (ASTFunction*)prog->functions[i];
+            IRFunction *ir_func = mod->functions[index++];
+            if (ir_func == main_func) {
+                func = stream_main(arena, func, statements, statement_count);
+            }
+            stream_function(mod, ir_func, func, arena, fp);
+        }
+        arena_rewind(arena);
+    }
+    ast_stream_free(&stream);
+    if (synthesized) {
+        stream_function(mod, main_func, stream_main(arena, synthesized, statements, statement_count), arena, fp);
+        arena_rewind(arena);
+    }
+
+    // Module-level data last; QBE does not care about definition order
+    emit_module_data(fp, mod);
+    fclose(fp);
+    arena_destroy(arena);
+    return 0;
+}
+
+void ir_print_stats(IRModule *mod, FILE *fp) {
+    if (mod->streamed) {
+        fprintf(fp, "IR: %zu functions, %zu blocks, %zu instructions streamed, "
+            "peak %zu bytes per function\n",
+            mod->function_count, mod->streamed_blocks, mod->streamed_instructions,
+            mod->peak_function_bytes);
+        return;
+    }
+
+    size_t blocks = 0;
+    size_t instructions = 0;
+    for (size_t i = 0; i < mod->function_count; i++) {
+        for (IRBasicBlock *block = mod->functions[i]->blocks; block; block = block->next) {
+            blocks++;
+            instructions += block->inst_count;
+        }
+    }
+
+    // All function IR lives in the worker arenas
+    size_t bytes = 0;
+    for (size_t i = 0; i < mod->worker_count; i++) {
+        bytes += arena_get_used_memory(mod->worker_arenas[i]);
+    }
+
+    fprintf(fp, "IR: %zu functions, %zu blocks, %zu instructions, %zu bytes",
+        mod->function_count, blocks, instructions, bytes);
+    if (instructions) {
+        fprintf(fp, " (%.1f bytes/instruction)", (double)bytes / (double)instructions);
+    }
+    fprintf(fp, "\n");
+}
+
 void ir_module_free(IRModule *mod) {
-    // Arena handles cleanup
-    (void)mod;
+    // Module and function IR live in arenas; only the worker arenas and the
+    // malloc'd side tables are owned here
+    for (size_t i = 0; i < mod->function_count; i++) {
+        free(mod->functions[i]->strings);
+        mod->functions[i]->strings = NULL;
+        ir_cfg_invalidate(mod->functions[i]);
+    }
+    for (size_t i = 0; i < mod->worker_count; i++) {
+        arena_destroy(mod->worker_arenas[i]);
+    }
+    free(mod->worker_arenas);
+    if (mod->function_table) {
+        freeHashtable(mod->function_table);
+        mod->function_table = NULL;
+    }
+    if (mod->string_table) {
+        freeHashtable(mod->string_table);
+        mod->string_table = NULL;
+    }
+    mod->worker_arenas = NULL;
+    mod->worker_count = 0;
 }
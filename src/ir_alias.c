@@ -0,0 +1,127 @@
+#include "ir_analysis.h"
+#include "ir_pass.h"
+
+//=============================================================================
+// Alias Analysis
+//=============================================================================
+
+static bool is_inst(IRValue *value, IROpcode opcode) {
+    return value->kind == IR_VALUE_INST && ((IRInstruction*)value)->opcode == opcode;
+}
+
+IRMemLoc ir_mem_loc(IRValue *address) {
+    IRMemLoc loc = { address, 0, true };
+    while (is_inst(loc.base, IR_GETPTR)) {
+        IRInstruction *getptr = (IRInstruction*)loc.base;
+        IRFoldValue index;
+        if (loc.offset_known && ir_fold_operand(getptr->ops[1].value, &index)) {
+            loc.offset += index.i * getptr->ops[2].imm;
+        } else {
+            loc.offset_known = false;
+        }
+        loc.base = getptr->ops[0].value;
+    }
+    return loc;
+}
+
+IRValue *ir_mem_address(IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_LOAD: return inst->ops[0].value;
+        case IR_STORE: return inst->ops[1].value;
+        default: return NULL;
+    }
+}
+
+// Bytes written by the QBE class of `type`
+static uint32_t class_size(IRType *type) {
+    if (type->kind == IR_TYPE_F32) return 4;
+    return ir_type_bits(type) / 8;
+}
+
+uint32_t ir_mem_access_size(IRInstruction *inst) {
+    if (inst->opcode == IR_LOAD) return class_size(inst->type);
+    IRValue *address = inst->ops[1].value;
+    return class_size(is_inst(address, IR_ALLOC) ? address->type : inst->ops[0].value->type);
+}
+
+// Passed to a callee known not to keep it
+static bool call_keeps_nothing(IRInstruction *call, IRValue *pointer) {
+    IRCallData *data = call->ops[0].call;
+    if (!data || !(data->callee_attrs & IR_ATTR_NOCAPTURE)) return false;
+    for (size_t i = 0; i < data->arg_count; i++) {
+        if (data->args[i].use.value == pointer) return true;
+    }
+    return false;
+}
+
+// Uses of a pointer into an alloc, following GETPTRs
+static bool pointer_escapes(IRValue *pointer) {
+    for (IRUse *use = pointer->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        switch (user->opcode) {
+            case IR_LOAD:
+                continue;
+            case IR_STORE:
+                if (user->ops[0].value == pointer) return true; // Address stored away
+                continue;
+            case IR_GETPTR:
+                if (user->ops[0].value != pointer || pointer_escapes((IRValue*)user)) return true;
+                continue;
+            case IR_CALL:
+                if (!call_keeps_nothing(user, pointer)) return true;
+                continue;
+            default:
+                return true;
+        }
+    }
+    return false;
+}
+
+bool ir_alloc_escapes(IRInstruction *alloc) {
+    return pointer_escapes((IRValue*)alloc);
+}
+
+static bool is_identified(IRValue *base) {
+    return is_inst(base, IR_ALLOC) || base->kind == IR_VALUE_GLOBAL;
+}
+
+static bool same_global(IRValue *a, IRValue *b) {
+    IRGlobalRef *ga = (IRGlobalRef*)a, *gb = (IRGlobalRef*)b;
+    if (ga->global || gb->global) return ga->global == gb->global;
+    return ga->string == gb->string;
+}
+
+IRAliasResult ir_alias(IRValue *a, uint32_t a_size, IRValue *b, uint32_t b_size) {
+    if (a == b) return a_size == b_size ? IR_MUST_ALIAS : IR_MAY_ALIAS;
+    IRMemLoc la = ir_mem_loc(a);
+    IRMemLoc lb = ir_mem_loc(b);
+
+    bool same_base = la.base == lb.base;
+    if (!same_base && la.base->kind == IR_VALUE_GLOBAL && lb.base->kind == IR_VALUE_GLOBAL) {
+        same_base = same_global(la.base, lb.base);
+        if (!same_base) return IR_NO_ALIAS;
+    }
+    if (!same_base) {
+        if (is_identified(la.base) && is_identified(lb.base)) return IR_NO_ALIAS;
+        // Nothing but the alloc itself can point into a private one
+        if (is_inst(la.base, IR_ALLOC) && !ir_alloc_escapes((IRInstruction*)la.base)) return IR_NO_ALIAS;
+        if (is_inst(lb.base, IR_ALLOC) && !ir_alloc_escapes((IRInstruction*)lb.base)) return IR_NO_ALIAS;
+        return IR_MAY_ALIAS;
+    }
+
+    if (!la.offset_known || !lb.offset_known) return IR_MAY_ALIAS;
+    if (la.offset + a_size <= lb.offset || lb.offset + b_size <= la.offset) return IR_NO_ALIAS;
+    return la.offset == lb.offset && a_size == b_size ? IR_MUST_ALIAS : IR_MAY_ALIAS;
+}
+
+bool ir_call_may_access(IRInstruction *call, IRValue *address) {
+    IRCallData *data = call->ops[0].call;
+    if (data && (data->callee_attrs & IR_ATTR_READNONE)) return false;
+    IRValue *base = ir_mem_loc(address).base;
+    if (!is_inst(base, IR_ALLOC) || ir_alloc_escapes((IRInstruction*)base)) return true;
+    // A private slot is reachable only through the pointers the call is passed
+    for (size_t i = 0; data && i < data->arg_count; i++) {
+        if (ir_mem_loc(data->args[i].use.value).base == base) return true;
+    }
+    return false;
+}
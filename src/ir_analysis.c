@@ -0,0 +1,556 @@
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Successors
+//=============================================================================
+
+size_t ir_block_succ_count(IRBasicBlock *block) {
+    IRInstruction *term = ir_block_terminator(block);
+    if (!term) return 0;
+    switch (term->opcode) {
+        case IR_BR: return 1;
+        case IR_CBR: return 2;
+        default: return 0;
+    }
+}
+
+IRBasicBlock *ir_block_succ(IRBasicBlock *block, size_t index) {
+    IRInstruction *term = ir_block_terminator(block);
+    return term->opcode == IR_BR ? term->ops[0].block : term->ops[1 + index].block;
+}
+
+void ir_branch_set_target(IRInstruction *branch, size_t index, IRBasicBlock *target) {
+    if (branch->opcode == IR_BR) {
+        branch->ops[0].block = target;
+    } else {
+        branch->ops[1 + index].block = target;
+    }
+    if (branch->block) {
+        ir_cfg_invalidate(branch->block->function);
+    }
+}
+
+void ir_branch_fold(IRInstruction *branch, size_t taken) {
+    IRBasicBlock *block = branch->block;
+    IRBasicBlock *target = branch->ops[1 + taken].block;
+    IRBasicBlock *dropped = branch->ops[2 - taken].block;
+    if (dropped != target) {
+        // Erased instructions linger as nops until the block is compacted
+        for (uint32_t i = 0; i < dropped->inst_count; i++) {
+            IRInstruction *phi = dropped->instructions[i];
+            if (phi->opcode == IR_NOP) continue;
+            if (phi->opcode != IR_PHI) break;
+            ir_phi_remove_incoming(phi, block);
+        }
+    }
+    ir_set_operand(branch, 0, NULL);
+    branch->opcode = IR_BR;
+    branch->ops[0].block = target;
+    branch->ops[1].block = NULL;
+    branch->ops[2].block = NULL;
+    ir_cfg_invalidate(block->function);
+}
+
+//=============================================================================
+// Construction
+//=============================================================================
+
+// Fill one IRBlockList per block from a count pass; `lists[i].count` holds
+// the final size on entry and is refilled as items are added
+static void allocate_lists(Arena *arena, IRBlockList *lists, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        lists[i].items = lists[i].count ?
+            arena_alloc_array(arena, IRBasicBlock*, lists[i].count) : NULL;
+        lists[i].count = 0;
+    }
+}
+
+static void build_edges(IRCFG *cfg) {
+    IRFunction *func = cfg->function;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        size_t count = ir_block_succ_count(block);
+        cfg->succs[block->id].count = (uint32_t)count;
+        for (size_t i = 0; i < count; i++) {
+            cfg->preds[ir_block_succ(block, i)->id].count++;
+        }
+    }
+    allocate_lists(cfg->arena, cfg->succs, cfg->capacity);
+    allocate_lists(cfg->arena, cfg->preds, cfg->capacity);
+
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        size_t count = ir_block_succ_count(block);
+        for (size_t i = 0; i < count; i++) {
+            IRBasicBlock *succ = ir_block_succ(block, i);
+            IRBlockList *succs = &cfg->succs[block->id];
+            IRBlockList *preds = &cfg->preds[succ->id];
+            succs->items[succs->count++] = succ;
+            preds->items[preds->count++] = block;
+        }
+    }
+}
+
+// Iterative DFS from the entry block; deep CFGs must not recurse
+static void build_rpo(IRCFG *cfg) {
+    IRFunction *func = cfg->function;
+    uint32_t capacity = cfg->capacity;
+    IRBasicBlock **postorder = malloc(sizeof(IRBasicBlock*) * (capacity ? capacity : 1));
+    IRBasicBlock **stack = malloc(sizeof(IRBasicBlock*) * (capacity ? capacity : 1));
+    uint32_t *next_succ = calloc(capacity ? capacity : 1, sizeof(uint32_t));
+    bool *visited = calloc(capacity ? capacity : 1, sizeof(bool));
+    uint32_t count = 0;
+    uint32_t depth = 0;
+
+    if (func->entry_block) {
+        stack[depth++] = func->entry_block;
+        visited[func->entry_block->id] = true;
+    }
+    while (depth > 0) {
+        IRBasicBlock *block = stack[depth - 1];
+        IRBlockList *succs = &cfg->succs[block->id];
+        if (next_succ[block->id] < succs->count) {
+            IRBasicBlock *succ = succs->items[next_succ[block->id]++];
+            if (!visited[succ->id]) {
+                visited[succ->id] = true;
+                stack[depth++] = succ;
+            }
+        } else {
+            postorder[count++] = block;
+            depth--;
+        }
+    }
+
+    cfg->rpo = arena_alloc_array(cfg->arena, IRBasicBlock*, count ? count : 1);
+    cfg->rpo_count = count;
+    for (uint32_t i = 0; i < capacity; i++) {
+        cfg->rpo_index[i] = IR_CFG_UNREACHABLE;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        IRBasicBlock *block = postorder[count - 1 - i];
+        cfg->rpo[i] = block;
+        cfg->rpo_index[block->id] = i;
+    }
+
+    free(postorder);
+    free(stack);
+    free(next_succ);
+    free(visited);
+}
+
+// Cooper, Harvey and Kennedy, "A Simple, Fast Dominance Algorithm".
+// Works on RPO positions; the entry block is its own dominator during the
+// fixpoint and gets a NULL idom afterwards.
+static void build_dominators(IRCFG *cfg) {
+    uint32_t count = cfg->rpo_count;
+    uint32_t *idom = malloc(sizeof(uint32_t) * (count ? count : 1));
+    for (uint32_t i = 0; i < count; i++) {
+        idom[i] = IR_CFG_UNREACHABLE;
+    }
+    if (count) idom[0] = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t i = 1; i < count; i++) {
+            IRBlockList *preds = &cfg->preds[cfg->rpo[i]->id];
+            uint32_t new_idom = IR_CFG_UNREACHABLE;
+            for (uint32_t j = 0; j < preds->count; j++) {
+                uint32_t p = cfg->rpo_index[preds->items[j]->id];
+                if (p == IR_CFG_UNREACHABLE || idom[p] == IR_CFG_UNREACHABLE) continue;
+                if (new_idom == IR_CFG_UNREACHABLE) {
+                    new_idom = p;
+                    continue;
+                }
+                // Walk both fingers up to the common dominator
+                uint32_t a = p, b = new_idom;
+                while (a != b) {
+                    while (a > b) a = idom[a];
+                    while (b > a) b = idom[b];
+                }
+                new_idom = a;
+            }
+            if (idom[i] != new_idom) {
+                idom[i] = new_idom;
+                changed = true;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < cfg->capacity; i++) {
+        cfg->idom[i] = NULL;
+        cfg->dom_children[i].count = 0;
+    }
+    for (uint32_t i = 1; i < count; i++) {
+        IRBasicBlock *parent = cfg->rpo[idom[i]];
+        cfg->idom[cfg->rpo[i]->id] = parent;
+        cfg->dom_children[parent->id].count++;
+    }
+    allocate_lists(cfg->arena, cfg->dom_children, cfg->capacity);
+    for (uint32_t i = 1; i < count; i++) {
+        IRBlockList *children = &cfg->dom_children[cfg->rpo[idom[i]]->id];
+        children->items[children->count++] = cfg->rpo[i];
+    }
+    free(idom);
+
+    // Number the tree so dominance is an interval test
+    if (!count) return;
+    IRBasicBlock **stack = malloc(sizeof(IRBasicBlock*) * count);
+    uint32_t *next_child = calloc(cfg->capacity, sizeof(uint32_t));
+    uint32_t depth = 0, pre = 0, post = 0;
+    stack[depth++] = cfg->rpo[0];
+    cfg->dom_pre[cfg->rpo[0]->id] = pre++;
+    while (depth > 0) {
+        IRBasicBlock *block = stack[depth - 1];
+        IRBlockList *children = &cfg->dom_children[block->id];
+        if (next_child[block->id] < children->count) {
+            IRBasicBlock *child = children->items[next_child[block->id]++];
+            cfg->dom_pre[child->id] = pre++;
+            stack[depth++] = child;
+        } else {
+            cfg->dom_post[block->id] = post++;
+            depth--;
+        }
+    }
+    free(stack);
+    free(next_child);
+}
+
+IRCFG *ir_cfg_get(IRFunction *func) {
+    if (func->cfg) return func->cfg;
+
+    uint32_t capacity = func->block_counter;
+    Arena *arena = arena_create(1024 + (size_t)capacity * 96);
+    IRCFG *cfg = arena_alloc_type(arena, IRCFG);
+    memset(cfg, 0, sizeof(IRCFG));
+    cfg->function = func;
+    cfg->arena = arena;
+    cfg->capacity = capacity;
+
+    size_t n = capacity ? capacity : 1;
+    cfg->preds = arena_alloc_array(arena, IRBlockList, n);
+    cfg->succs = arena_alloc_array(arena, IRBlockList, n);
+    cfg->rpo_index = arena_alloc_array(arena, uint32_t, n);
+    cfg->idom = arena_alloc_array(arena, IRBasicBlock*, n);
+    cfg->dom_children = arena_alloc_array(arena, IRBlockList, n);
+    cfg->dom_pre = arena_alloc_array(arena, uint32_t, n);
+    cfg->dom_post = arena_alloc_array(arena, uint32_t, n);
+    memset(cfg->preds, 0, sizeof(IRBlockList) * n);
+    memset(cfg->succs, 0, sizeof(IRBlockList) * n);
+
+    build_edges(cfg);
+    build_rpo(cfg);
+    build_dominators(cfg);
+
+    func->cfg = cfg;
+    return cfg;
+}
+
+void ir_cfg_invalidate(IRFunction *func) {
+    if (!func->cfg) return;
+    arena_destroy(func->cfg->arena);
+    func->cfg = NULL;
+}
+
+//=============================================================================
+// Dominance Queries
+//=============================================================================
+
+bool ir_block_reachable(IRCFG *cfg, IRBasicBlock *block) {
+    return block->id < cfg->capacity && cfg->rpo_index[block->id] != IR_CFG_UNREACHABLE;
+}
+
+bool ir_dominates(IRCFG *cfg, IRBasicBlock *a, IRBasicBlock *b) {
+    if (a == b) return true;
+    if (!ir_block_reachable(cfg, a) || !ir_block_reachable(cfg, b)) return false;
+    return cfg->dom_pre[a->id] <= cfg->dom_pre[b->id] &&
+           cfg->dom_post[b->id] <= cfg->dom_post[a->id];
+}
+
+bool ir_inst_dominates(IRCFG *cfg, IRInstruction *def, IRInstruction *use) {
+    if (def->block != use->block) {
+        return ir_dominates(cfg, def->block, use->block);
+    }
+    IRBasicBlock *block = def->block;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        if (block->instructions[i] == def) return true;
+        if (block->instructions[i] == use) return false;
+    }
+    return false;
+}
+
+//=============================================================================
+// Dominance Frontiers
+//=============================================================================
+
+// For each join point, walk up from every predecessor to the join's idom;
+// every block passed has the join in its frontier. `last` drops the
+// duplicates a block would get from several predecessors.
+static void walk_frontiers(IRCFG *cfg, uint32_t *last, bool fill) {
+    for (uint32_t i = 0; i < cfg->rpo_count; i++) {
+        IRBasicBlock *join = cfg->rpo[i];
+        IRBlockList *preds = &cfg->preds[join->id];
+        if (preds->count < 2) continue;
+        for (uint32_t j = 0; j < preds->count; j++) {
+            IRBasicBlock *runner = preds->items[j];
+            if (!ir_block_reachable(cfg, runner)) continue;
+            while (runner && runner != cfg->idom[join->id]) {
+                if (last[runner->id] == join->id) break;
+                last[runner->id] = join->id;
+                IRBlockList *frontier = &cfg->frontiers[runner->id];
+                if (fill) {
+                    frontier->items[frontier->count] = join;
+                }
+                frontier->count++;
+                runner = cfg->idom[runner->id];
+            }
+        }
+    }
+}
+
+IRBlockList *ir_cfg_frontiers(IRCFG *cfg) {
+    if (cfg->frontiers) return cfg->frontiers;
+
+    size_t n = cfg->capacity ? cfg->capacity : 1;
+    cfg->frontiers = arena_alloc_array(cfg->arena, IRBlockList, n);
+    memset(cfg->frontiers, 0, sizeof(IRBlockList) * n);
+    uint32_t *last = malloc(sizeof(uint32_t) * n);
+
+    memset(last, 0xff, sizeof(uint32_t) * n);
+    walk_frontiers(cfg, last, false);
+    allocate_lists(cfg->arena, cfg->frontiers, cfg->capacity);
+    memset(last, 0xff, sizeof(uint32_t) * n);
+    walk_frontiers(cfg, last, true);
+
+    free(last);
+    return cfg->frontiers;
+}
+
+//=============================================================================
+// Loops
+//=============================================================================
+
+static IRLoop *outermost_loop(IRLoop *loop) {
+    while (loop->parent) loop = loop->parent;
+    return loop;
+}
+
+// Claim a block for `loop` during the backward walk. A block owned by an
+// inner loop is not walked again: the inner loop is nested under `loop`
+// and the walk continues from its header.
+static void loop_visit(IRCFG *cfg, IRLoop *loop, IRBasicBlock *block,
+                       IRBasicBlock **worklist, uint32_t *top) {
+    IRLoop *owner = cfg->loop_of[block->id];
+    if (!owner) {
+        cfg->loop_of[block->id] = loop;
+        worklist[(*top)++] = block;
+        return;
+    }
+    IRLoop *inner = outermost_loop(owner);
+    if (inner != loop) {
+        inner->parent = loop;
+        worklist[(*top)++] = inner->header;
+    }
+}
+
+// Headers are visited in dominator-tree postorder, so inner loops are
+// discovered before the loops containing them. Every block is claimed once
+// and every inner loop is entered once through its header, which keeps
+// the computation near-linear.
+void ir_cfg_compute_loops(IRCFG *cfg) {
+    if (cfg->loop_of) return;
+
+    size_t n = cfg->capacity ? cfg->capacity : 1;
+    cfg->loop_of = arena_alloc_array(cfg->arena, IRLoop*, n);
+    memset(cfg->loop_of, 0, sizeof(IRLoop*) * n);
+
+    // Dominator tree postorder
+    IRBasicBlock **order = malloc(sizeof(IRBasicBlock*) * (cfg->rpo_count ? cfg->rpo_count : 1));
+    for (uint32_t i = 0; i < cfg->rpo_count; i++) {
+        IRBasicBlock *block = cfg->rpo[i];
+        order[cfg->dom_post[block->id]] = block;
+    }
+
+    IRBasicBlock **worklist = malloc(sizeof(IRBasicBlock*) * n);
+    uint32_t loop_count = 0;
+
+    for (uint32_t i = 0; i < cfg->rpo_count; i++) {
+        IRBasicBlock *header = order[i];
+        IRBlockList *preds = &cfg->preds[header->id];
+        uint32_t latches = 0;
+        for (uint32_t j = 0; j < preds->count; j++) {
+            if (ir_dominates(cfg, header, preds->items[j])) latches++;
+        }
+        if (!latches) continue;
+
+        IRLoop *loop = arena_alloc_type(cfg->arena, IRLoop);
+        memset(loop, 0, sizeof(IRLoop));
+        loop->header = header;
+        loop->latches = arena_alloc_array(cfg->arena, IRBasicBlock*, latches);
+        cfg->loop_of[header->id] = loop;
+        loop_count++;
+
+        uint32_t top = 0;
+        for (uint32_t j = 0; j < preds->count; j++) {
+            if (ir_dominates(cfg, header, preds->items[j])) {
+                loop->latches[loop->latch_count++] = preds->items[j];
+                loop_visit(cfg, loop, preds->items[j], worklist, &top);
+            }
+        }
+        while (top > 0) {
+            IRBlockList *block_preds = &cfg->preds[worklist[--top]->id];
+            for (uint32_t j = 0; j < block_preds->count; j++) {
+                if (ir_block_reachable(cfg, block_preds->items[j])) {
+                    loop_visit(cfg, loop, block_preds->items[j], worklist, &top);
+                }
+            }
+        }
+    }
+
+    // Loops in RPO of their headers put outer loops first. Each block
+    // belongs to its innermost loop and all enclosing ones.
+    cfg->loops = arena_alloc_array(cfg->arena, IRLoop*, loop_count ? loop_count : 1);
+    for (uint32_t i = 0; i < cfg->rpo_count; i++) {
+        IRBasicBlock *block = cfg->rpo[i];
+        IRLoop *own = cfg->loop_of[block->id];
+        if (own && own->header == block) {
+            cfg->loops[cfg->loop_count++] = own;
+        }
+        for (IRLoop *loop = own; loop; loop = loop->parent) {
+            loop->block_count++;
+        }
+    }
+    for (uint32_t i = 0; i < cfg->loop_count; i++) {
+        IRLoop *loop = cfg->loops[i];
+        loop->blocks = arena_alloc_array(cfg->arena, IRBasicBlock*, loop->block_count);
+        loop->block_count = 0;
+        loop->depth = loop->parent ? loop->parent->depth + 1 : 1;
+    }
+    for (uint32_t i = 0; i < cfg->rpo_count; i++) {
+        IRBasicBlock *block = cfg->rpo[i];
+        for (IRLoop *loop = cfg->loop_of[block->id]; loop; loop = loop->parent) {
+            loop->blocks[loop->block_count++] = block;
+        }
+    }
+
+    free(order);
+    free(worklist);
+}
+
+IRLoop *ir_cfg_loop_of(IRCFG *cfg, IRBasicBlock *block) {
+    ir_cfg_compute_loops(cfg);
+    return block->id < cfg->capacity ? cfg->loop_of[block->id] : NULL;
+}
+
+bool ir_loop_contains(IRCFG *cfg, IRLoop *loop, IRBasicBlock *block) {
+    for (IRLoop *inner = ir_cfg_loop_of(cfg, block); inner; inner = inner->parent) {
+        if (inner == loop) return true;
+    }
+    return false;
+}
+
+//=============================================================================
+// Loop Preheaders
+//=============================================================================
+
+IRBasicBlock *ir_loop_preheader(IRCFG *cfg, IRLoop *loop) {
+    IRBlockList *preds = &cfg->preds[loop->header->id];
+    IRBasicBlock *outside = NULL;
+    for (uint32_t i = 0; i < preds->count; i++) {
+        IRBasicBlock *pred = preds->items[i];
+        if (ir_loop_contains(cfg, loop, pred)) continue;
+        if (outside && outside != pred) return NULL;
+        outside = pred;
+    }
+    if (!outside || ir_block_succ_count(outside) != 1) return NULL;
+    return outside;
+}
+
+// Route the edges from `outside` into `header` through a new block. Phi
+// entries from those edges move to the new block, merged by a phi of
+// their own if there are several.
+static void insert_preheader(IRFunction *func, IRBasicBlock *header, IRBasicBlock **outside, uint32_t count) {
+    IRBasicBlock *pre = ir_basic_block_create(func, "preheader");
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = header->instructions[i];
+        IRPhiData *data = phi->ops[0].phi;
+        if (count == 1) {
+            for (uint32_t j = 0; data && j < data->arg_count; j++) {
+                if (data->args[j].block == outside[0]) data->args[j].block = pre;
+            }
+            continue;
+        }
+        IRInstruction *merged = ir_inst_create(pre, IR_PHI, phi->type);
+        for (uint32_t k = 0; k < count; k++) {
+            for (uint32_t j = 0; data && j < data->arg_count; j++) {
+                if (data->args[j].block != outside[k]) continue;
+                ir_phi_add_incoming(func, merged, data->args[j].use.value, outside[k]);
+                ir_phi_remove_incoming(phi, outside[k]);
+                break;
+            }
+        }
+        ir_phi_add_incoming(func, phi, (IRValue*)merged, pre);
+    }
+    IRInstruction *br = ir_inst_create(pre, IR_BR, NULL);
+    br->ops[0].block = header;
+
+    for (uint32_t k = 0; k < count; k++) {
+        IRInstruction *term = ir_block_terminator(outside[k]);
+        size_t succs = ir_block_succ_count(outside[k]);
+        for (size_t i = 0; i < succs; i++) {
+            if (ir_block_succ(outside[k], i) == header) ir_branch_set_target(term, i, pre);
+        }
+    }
+
+    // Emit it right before the header
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        if (block->next == header) {
+            ir_block_move_after(pre, block);
+            break;
+        }
+    }
+}
+
+bool ir_loops_insert_preheaders(IRFunction *func) {
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+
+    // Collect everything first: adding a block drops the CFG
+    typedef struct Pending { IRBasicBlock *header; uint32_t first; uint32_t count; } Pending;
+    Pending *pending = malloc(sizeof(Pending) * (cfg->loop_count ? cfg->loop_count : 1));
+    uint32_t pending_count = 0;
+    size_t outside_count = 0, outside_capacity = 16;
+    IRBasicBlock **outside = malloc(sizeof(IRBasicBlock*) * outside_capacity);
+
+    for (uint32_t l = 0; l < cfg->loop_count; l++) {
+        IRLoop *loop = cfg->loops[l];
+        if (loop->header == func->entry_block || ir_loop_preheader(cfg, loop)) continue;
+        Pending *p = &pending[pending_count];
+        p->header = loop->header;
+        p->first = (uint32_t)outside_count;
+        IRBlockList *preds = &cfg->preds[loop->header->id];
+        for (uint32_t i = 0; i < preds->count; i++) {
+            IRBasicBlock *pred = preds->items[i];
+            if (ir_loop_contains(cfg, loop, pred)) continue;
+            bool seen = false;
+            for (size_t j = p->first; j < outside_count; j++) {
+                if (outside[j] == pred) seen = true;
+            }
+            if (seen) continue;
+            if (outside_count == outside_capacity) {
+                outside_capacity *= 2;
+                outside = realloc(outside, sizeof(IRBasicBlock*) * outside_capacity);
+            }
+            outside[outside_count++] = pred;
+        }
+        p->count = (uint32_t)outside_count - p->first;
+        if (p->count) pending_count++;
+    }
+
+    for (uint32_t i = 0; i < pending_count; i++) {
+        insert_preheader(func, pending[i].header, &outside[pending[i].first], pending[i].count);
+    }
+    free(pending);
+    free(outside);
+    return pending_count > 0;
+}
@@ -0,0 +1,85 @@
+#include "ir_analysis.h"
+#include "ir_pass.h"
+
+//=============================================================================
+// Branch Probabilities
+//=============================================================================
+
+// How likely the favoured side is under each heuristic, from the hit
+// rates Ball and Larus measured
+#define PROB_LOOP 901     // 0.88
+#define PROB_CALL 799     // 0.78
+#define PROB_RETURN 737   // 0.72
+#define PROB_COMPARE 640  // 0.625
+
+static uint32_t favour(bool true_side, uint32_t prob) {
+    return true_side ? prob : IR_PROB_SCALE - prob;
+}
+
+static bool only_returns(IRCFG *cfg, IRBasicBlock *block) {
+    IRInstruction *term = ir_block_terminator(block);
+    return cfg->preds[block->id].count == 1 && term && term->opcode == IR_RET;
+}
+
+static bool makes_call(IRCFG *cfg, IRBasicBlock *block) {
+    if (cfg->preds[block->id].count != 1) return false;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        if (block->instructions[i]->opcode == IR_CALL) return true;
+    }
+    return false;
+}
+
+// Compare against a constant, written as `value kind constant`. -1 if the
+// heuristic has nothing to say, else whether the compare is likely true.
+static int compare_heuristic(IRValue *condition) {
+    if (condition->kind != IR_VALUE_INST || ((IRInstruction*)condition)->opcode != IR_CMP) return -1;
+    IRInstruction *cmp = (IRInstruction*)condition;
+    IRCmpKind kind = (IRCmpKind)cmp->cmp_kind;
+    IRFoldValue constant;
+    if (!ir_fold_operand(cmp->ops[1].value, &constant)) {
+        if (!ir_fold_operand(cmp->ops[0].value, &constant)) return -1;
+        kind = ir_cmp_swap(kind);
+    }
+    if (ir_type_is_float(cmp->ops[0].value->type)) return -1;
+
+    switch (kind) {
+        case IR_CMP_EQ: return 0;
+        case IR_CMP_NE: return 1;
+        // Also x < 1 and x > -1, as instcombine writes x <= 0 and x >= 0
+        case IR_CMP_SLT:
+            return constant.i == 0 || constant.i == 1 ? 0 : -1;
+        case IR_CMP_SLE:
+            return constant.i == 0 ? 0 : -1;
+        case IR_CMP_SGT:
+            return constant.i == 0 || constant.i == -1 ? 1 : -1;
+        case IR_CMP_SGE:
+            return constant.i == 0 ? 1 : -1;
+        default:
+            return -1;
+    }
+}
+
+uint32_t ir_branch_probability(IRCFG *cfg, IRBasicBlock *block) {
+    IRInstruction *branch = ir_block_terminator(block);
+    if (!branch || branch->opcode != IR_CBR) return IR_PROB_EVEN;
+    IRBasicBlock *on_true = branch->ops[1].block;
+    IRBasicBlock *on_false = branch->ops[2].block;
+    if (on_true == on_false) return IR_PROB_EVEN;
+
+    ir_cfg_compute_loops(cfg);
+    IRLoop *loop = ir_cfg_loop_of(cfg, block);
+    if (loop) {
+        bool stays_true = ir_loop_contains(cfg, loop, on_true);
+        if (stays_true != ir_loop_contains(cfg, loop, on_false)) return favour(stays_true, PROB_LOOP);
+    }
+
+    bool returns_true = only_returns(cfg, on_true);
+    if (returns_true != only_returns(cfg, on_false)) return favour(!returns_true, PROB_RETURN);
+
+    bool calls_true = makes_call(cfg, on_true);
+    if (calls_true != makes_call(cfg, on_false)) return favour(!calls_true, PROB_CALL);
+
+    int likely = compare_heuristic(branch->ops[0].value);
+    if (likely >= 0) return favour(likely == 1, PROB_COMPARE);
+    return IR_PROB_EVEN;
+}
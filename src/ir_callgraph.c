@@ -0,0 +1,126 @@
+#include "ir_analysis.h"
+#include "hash_table.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Call Graph
+//=============================================================================
+
+IRCallGraphNode *ir_call_graph_callee(IRCallGraph *graph, IRInstruction *call) {
+    if (call->opcode != IR_CALL || !call->ops[0].call) return NULL;
+    return findEntry(graph->by_name, (char*)call->ops[0].call->callee_name);
+}
+
+// Tarjan's algorithm with an explicit stack; call chains can be long. A
+// component is complete only once every component it reaches is, so
+// numbering them in completion order lists callees first.
+static void find_components(IRCallGraph *graph) {
+    uint32_t count = graph->node_count;
+    uint32_t *index = malloc(sizeof(uint32_t) * count);
+    uint32_t *low = malloc(sizeof(uint32_t) * count);
+    bool *on_stack = calloc(count, sizeof(bool));
+    uint32_t *stack = malloc(sizeof(uint32_t) * count);
+    typedef struct Frame { uint32_t node; uint32_t next_edge; } Frame;
+    Frame *frames = malloc(sizeof(Frame) * count);
+    for (uint32_t i = 0; i < count; i++) {
+        index[i] = UINT32_MAX;
+    }
+
+    uint32_t next_index = 0;
+    uint32_t top = 0;
+    uint32_t order = 0;
+    for (uint32_t root = 0; root < count; root++) {
+        if (index[root] != UINT32_MAX) continue;
+        uint32_t depth = 0;
+        frames[depth++] = (Frame){ root, 0 };
+        index[root] = low[root] = next_index++;
+        stack[top++] = root;
+        on_stack[root] = true;
+
+        while (depth > 0) {
+            Frame *frame = &frames[depth - 1];
+            IRCallGraphNode *node = &graph->nodes[frame->node];
+            if (frame->next_edge < node->callee_count) {
+                uint32_t callee = node->callees[frame->next_edge++];
+                if (index[callee] == UINT32_MAX) {
+                    index[callee] = low[callee] = next_index++;
+                    stack[top++] = callee;
+                    on_stack[callee] = true;
+                    frames[depth++] = (Frame){ callee, 0 };
+                } else if (on_stack[callee] && index[callee] < low[frame->node]) {
+                    low[frame->node] = index[callee];
+                }
+                continue;
+            }
+
+            uint32_t v = frame->node;
+            depth--;
+            if (depth > 0 && low[v] < low[frames[depth - 1].node]) {
+                low[frames[depth - 1].node] = low[v];
+            }
+            if (low[v] != index[v]) continue;
+            uint32_t member;
+            do {
+                member = stack[--top];
+                on_stack[member] = false;
+                graph->nodes[member].scc = graph->scc_count;
+                graph->bottom_up[order++] = member;
+            } while (member != v);
+            graph->scc_count++;
+        }
+    }
+
+    free(index);
+    free(low);
+    free(on_stack);
+    free(stack);
+    free(frames);
+}
+
+IRCallGraph *ir_call_graph_build(IRModule *mod) {
+    IRCallGraph *graph = calloc(1, sizeof(IRCallGraph));
+    uint32_t count = (uint32_t)mod->function_count;
+    graph->module = mod;
+    graph->node_count = count;
+    graph->nodes = calloc(count ? count : 1, sizeof(IRCallGraphNode));
+    graph->bottom_up = malloc(sizeof(uint32_t) * (count ? count : 1));
+    graph->by_name = createHashtable((int)count * 2 + 1);
+    for (uint32_t i = 0; i < count; i++) {
+        graph->nodes[i].function = mod->functions[i];
+        // The first definition wins, as in the module's function table
+        if (!findEntry(graph->by_name, mod->functions[i]->name)) {
+            insertEntry(graph->by_name, mod->functions[i]->name, &graph->nodes[i], 0);
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        IRCallGraphNode *node = &graph->nodes[i];
+        uint32_t capacity = 0;
+        for (IRBasicBlock *block = node->function->blocks; block; block = block->next) {
+            for (uint32_t j = 0; j < block->inst_count; j++) {
+                IRCallGraphNode *callee = ir_call_graph_callee(graph, block->instructions[j]);
+                if (!callee) continue;
+                if (node->callee_count == capacity) {
+                    capacity = capacity ? capacity * 2 : 4;
+                    node->callees = realloc(node->callees, sizeof(uint32_t) * capacity);
+                }
+                node->callees[node->callee_count++] = (uint32_t)(callee - graph->nodes);
+                callee->caller_count++;
+            }
+        }
+    }
+
+    find_components(graph);
+    return graph;
+}
+
+void ir_call_graph_free(IRCallGraph *graph) {
+    if (!graph) return;
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        free(graph->nodes[i].callees);
+    }
+    free(graph->nodes);
+    free(graph->bottom_up);
+    freeHashtable(graph->by_name);
+    free(graph);
+}
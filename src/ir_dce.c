@@ -0,0 +1,122 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Dead Code Elimination
+//=============================================================================
+
+// Jumps through empty blocks go straight to their destination, blocks no
+// longer reachable from entry are deleted, phis left with a single value
+// are replaced by it, and then every instruction not needed by a store,
+// call, branch or return is deleted. Liveness is marked from those roots,
+// so dead phi cycles (a loop counter nobody reads) go too, which use
+// counts alone would keep.
+
+// Replace phis whose incoming values are all the same (ignoring the phi
+// itself) by that value. Removing edges leaves many with a single entry.
+static bool remove_trivial_phis(IRFunction *func) {
+    bool changed = false;
+    bool again = true;
+    while (again) {
+        again = false;
+        for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+            bool erased = false;
+            for (uint32_t i = 0; i < block->inst_count && block->instructions[i]->opcode == IR_PHI; i++) {
+                IRInstruction *phi = block->instructions[i];
+                IRPhiData *data = phi->ops[0].phi;
+                IRValue *same = NULL;
+                bool trivial = true;
+                for (uint32_t j = 0; data && j < data->arg_count; j++) {
+                    IRValue *value = data->args[j].use.value;
+                    if (value == (IRValue*)phi || value == same) continue;
+                    if (same) {
+                        trivial = false;
+                        break;
+                    }
+                    same = value;
+                }
+                if (!trivial || !same) continue;
+                ir_replace_all_uses((IRValue*)phi, same);
+                ir_inst_erase(phi);
+                erased = true;
+            }
+            if (erased) {
+                ir_block_compact(block);
+                again = changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+static bool remove_dead_instructions(IRFunction *func) {
+    bool *live = calloc(func->temp_counter ? func->temp_counter : 1, sizeof(bool));
+    size_t top = 0;
+    size_t capacity = 64;
+    IRInstruction **work = malloc(sizeof(IRInstruction*) * capacity);
+
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (!ir_inst_has_side_effects(inst)) continue;
+            if (inst->type->kind != IR_TYPE_VOID) live[inst->id] = true;
+            if (top == capacity) {
+                capacity *= 2;
+                work = realloc(work, sizeof(IRInstruction*) * capacity);
+            }
+            work[top++] = inst;
+        }
+    }
+
+    while (top > 0) {
+        IRInstruction *inst = work[--top];
+        size_t count = ir_operand_count(inst);
+        for (size_t i = 0; i < count; i++) {
+            IRValue *value = ir_get_operand(inst, i);
+            if (!value || value->kind != IR_VALUE_INST || live[value->id]) continue;
+            live[value->id] = true;
+            if (top == capacity) {
+                capacity *= 2;
+                work = realloc(work, sizeof(IRInstruction*) * capacity);
+            }
+            work[top++] = (IRInstruction*)value;
+        }
+    }
+
+    bool changed = false;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        bool erased = false;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->type->kind == IR_TYPE_VOID || live[inst->id]) continue;
+            if (ir_inst_has_side_effects(inst)) continue;
+            ir_inst_erase(inst);
+            erased = true;
+        }
+        if (erased) {
+            ir_block_compact(block);
+            changed = true;
+        }
+    }
+
+    free(live);
+    free(work);
+    return changed;
+}
+
+static bool dce_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = ir_bypass_empty_blocks(func);
+    changed |= ir_remove_unreachable_blocks(func);
+    changed |= remove_trivial_phis(func);
+    changed |= remove_dead_instructions(func);
+    return changed;
+}
+
+const IRPass ir_pass_dce = {
+    .name = "dce",
+    .description = "Delete unreachable blocks, empty jump blocks and unused values",
+    .run = dce_run,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,245 @@
+#include "ir_pass.h"
+#include <math.h>
+
+//=============================================================================
+// Constant Folding
+//=============================================================================
+
+// Integers are held sign-extended from the width of their QBE class, so a
+// w value always reads the same whatever the upper bits of the register.
+
+bool ir_type_is_float(IRType *type) {
+    return type->kind == IR_TYPE_F32 || type->kind == IR_TYPE_F64;
+}
+
+int ir_type_bits(IRType *type) {
+    switch (type->kind) {
+        case IR_TYPE_I8:
+        case IR_TYPE_I16:
+        case IR_TYPE_I32:
+            return 32;
+        default:
+            return 64;
+    }
+}
+
+int64_t ir_fold_normalize(int64_t value, int bits) {
+    return bits == 32 ? (int64_t)(int32_t)(uint32_t)value : value;
+}
+
+bool ir_fold_operand(IRValue *value, IRFoldValue *out) {
+    if (!value || value->kind != IR_VALUE_CONST) return false;
+    IRConstant *c = (IRConstant*)value;
+    if (ir_type_is_float(value->type)) {
+        out->f = c->float_value;
+    } else {
+        out->i = ir_fold_normalize(c->int_value, ir_type_bits(value->type));
+    }
+    return true;
+}
+
+IRValue *ir_fold_constant(IRFunction *func, IRType *type, IRFoldValue value) {
+    if (ir_type_is_float(type)) {
+        return ir_const_float(func, type, value.f);
+    }
+    return ir_const_int(func, type, value.i);
+}
+
+static bool fold_int_binary(IROpcode opcode, int bits, int64_t a, int64_t b, int64_t *out) {
+    uint64_t ua = (uint64_t)a, ub = (uint64_t)b;
+    int64_t min = bits == 32 ? INT32_MIN : INT64_MIN;
+    switch (opcode) {
+        case IR_ADD: *out = (int64_t)(ua + ub); break;
+        case IR_SUB: *out = (int64_t)(ua - ub); break;
+        case IR_MUL: *out = (int64_t)(ua * ub); break;
+        case IR_DIV:
+            if (b == 0 || (a == min && b == -1)) return false; // Traps at run time
+            *out = a / b;
+            break;
+        case IR_MOD:
+            if (b == 0 || (a == min && b == -1)) return false;
+            *out = a % b;
+            break;
+        case IR_UDIV:
+        case IR_UREM: {
+            uint64_t mask = bits == 32 ? UINT32_MAX : UINT64_MAX;
+            if ((ub & mask) == 0) return false;
+            *out = (int64_t)(opcode == IR_UDIV ? (ua & mask) / (ub & mask) : (ua & mask) % (ub & mask));
+            break;
+        }
+        case IR_AND: *out = a & b; break;
+        case IR_OR: *out = a | b; break;
+        case IR_XOR: *out = a ^ b; break;
+        case IR_SHL: *out = (int64_t)(ua << (ub & (uint64_t)(bits - 1))); break;
+        case IR_SHR: // Logical
+            *out = bits == 32 ? (int64_t)((uint32_t)ua >> (ub & 31)) : (int64_t)(ua >> (ub & 63));
+            break;
+        case IR_SAR:
+            *out = a >> (ub & (uint64_t)(bits - 1)); // a is sign-extended
+            break;
+        default:
+            return false;
+    }
+    *out = ir_fold_normalize(*out, bits);
+    return true;
+}
+
+static bool fold_float_binary(IROpcode opcode, bool single, double a, double b, double *out) {
+    switch (opcode) {
+        case IR_ADD: *out = a + b; break;
+        case IR_SUB: *out = a - b; break;
+        case IR_MUL: *out = a * b; break;
+        case IR_DIV: *out = a / b; break;
+        default: return false;
+    }
+    if (single) *out = (float)*out;
+    return isfinite(*out); // QBE has no syntax for inf or nan constants
+}
+
+IRCmpKind ir_cmp_swap(IRCmpKind kind) {
+    switch (kind) {
+        case IR_CMP_ULT: return IR_CMP_UGT;
+        case IR_CMP_ULE: return IR_CMP_UGE;
+        case IR_CMP_UGT: return IR_CMP_ULT;
+        case IR_CMP_UGE: return IR_CMP_ULE;
+        case IR_CMP_SLT: return IR_CMP_SGT;
+        case IR_CMP_SLE: return IR_CMP_SGE;
+        case IR_CMP_SGT: return IR_CMP_SLT;
+        case IR_CMP_SGE: return IR_CMP_SLE;
+        default: return kind;
+    }
+}
+
+IRCmpKind ir_cmp_invert(IRCmpKind kind) {
+    switch (kind) {
+        case IR_CMP_EQ: return IR_CMP_NE;
+        case IR_CMP_NE: return IR_CMP_EQ;
+        case IR_CMP_ULT: return IR_CMP_UGE;
+        case IR_CMP_ULE: return IR_CMP_UGT;
+        case IR_CMP_UGT: return IR_CMP_ULE;
+        case IR_CMP_UGE: return IR_CMP_ULT;
+        case IR_CMP_SLT: return IR_CMP_SGE;
+        case IR_CMP_SLE: return IR_CMP_SGT;
+        case IR_CMP_SGT: return IR_CMP_SLE;
+        case IR_CMP_SGE: return IR_CMP_SLT;
+        default: return kind;
+    }
+}
+
+bool ir_fold_compare(IRCmpKind kind, IRType *operand_type, IRFoldValue a, IRFoldValue b, bool *out) {
+    if (ir_type_is_float(operand_type)) {
+        if (isnan(a.f) || isnan(b.f)) return false;
+        switch (kind) {
+            case IR_CMP_EQ: *out = a.f == b.f; return true;
+            case IR_CMP_NE: *out = a.f != b.f; return true;
+            case IR_CMP_SLT: *out = a.f < b.f; return true;
+            case IR_CMP_SLE: *out = a.f <= b.f; return true;
+            case IR_CMP_SGT: *out = a.f > b.f; return true;
+            case IR_CMP_SGE: *out = a.f >= b.f; return true;
+            default: return false;
+        }
+    }
+    int bits = ir_type_bits(operand_type);
+    uint64_t mask = bits == 32 ? UINT32_MAX : UINT64_MAX;
+    uint64_t ua = (uint64_t)a.i & mask, ub = (uint64_t)b.i & mask;
+    switch (kind) {
+        case IR_CMP_EQ: *out = a.i == b.i; break;
+        case IR_CMP_NE: *out = a.i != b.i; break;
+        case IR_CMP_SLT: *out = a.i < b.i; break;
+        case IR_CMP_SLE: *out = a.i <= b.i; break;
+        case IR_CMP_SGT: *out = a.i > b.i; break;
+        case IR_CMP_SGE: *out = a.i >= b.i; break;
+        case IR_CMP_ULT: *out = ua < ub; break;
+        case IR_CMP_ULE: *out = ua <= ub; break;
+        case IR_CMP_UGT: *out = ua > ub; break;
+        case IR_CMP_UGE: *out = ua >= ub; break;
+        default: return false;
+    }
+    return true;
+}
+
+static bool fold_cast(IRInstruction *inst, IRFoldValue a, IRFoldValue *out) {
+    IRType *from = inst->ops[0].value->type;
+    IRType *to = inst->type;
+    int bits = ir_type_bits(to);
+
+    switch (inst->opcode) {
+        case IR_SEXT:
+            if (from->kind == IR_TYPE_I8) out->i = (int8_t)a.i;
+            else if (from->kind == IR_TYPE_I16) out->i = (int16_t)a.i;
+            else out->i = (int32_t)a.i;
+            out->i = ir_fold_normalize(out->i, bits);
+            return true;
+        case IR_ZEXT:
+            if (from->kind == IR_TYPE_I8) out->i = (uint8_t)a.i;
+            else if (from->kind == IR_TYPE_I16) out->i = (uint16_t)a.i;
+            else out->i = (uint32_t)a.i;
+            out->i = ir_fold_normalize(out->i, bits);
+            return true;
+        case IR_SITOFPD:
+            out->f = (double)a.i;
+            if (to->kind == IR_TYPE_F32) out->f = (float)out->f;
+            return true;
+        case IR_FPTOSI: {
+            double limit = bits == 32 ? 2147483648.0 : 9223372036854775808.0;
+            if (isnan(a.f) || a.f >= limit || a.f <= -limit - 1.0) return false;
+            out->i = ir_fold_normalize((int64_t)a.f, bits);
+            return true;
+        }
+        case IR_TRUNC:
+        case IR_COPY:
+        case IR_BITCAST:
+            if (ir_type_is_float(from) != ir_type_is_float(to)) return false;
+            if (ir_type_is_float(to)) {
+                out->f = to->kind == IR_TYPE_F32 ? (float)a.f : a.f;
+            } else {
+                out->i = ir_fold_normalize(a.i, bits);
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ir_fold_instruction(IRInstruction *inst, const IRFoldValue *operands, IRFoldValue *out) {
+    switch (inst->opcode) {
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_DIV:
+        case IR_MOD:
+        case IR_UDIV:
+        case IR_UREM:
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR:
+        case IR_SHL:
+        case IR_SHR:
+        case IR_SAR:
+            if (ir_type_is_float(inst->type)) {
+                return fold_float_binary((IROpcode)inst->opcode, inst->type->kind == IR_TYPE_F32,
+                    operands[0].f, operands[1].f, &out->f);
+            }
+            return fold_int_binary((IROpcode)inst->opcode, ir_type_bits(inst->type),
+                operands[0].i, operands[1].i, &out->i);
+        case IR_CMP: {
+            bool result;
+            if (!ir_fold_compare((IRCmpKind)inst->cmp_kind, inst->ops[0].value->type,
+                    operands[0], operands[1], &result)) {
+                return false;
+            }
+            out->i = result;
+            return true;
+        }
+        case IR_SEXT:
+        case IR_ZEXT:
+        case IR_TRUNC:
+        case IR_BITCAST:
+        case IR_SITOFPD:
+        case IR_FPTOSI:
+        case IR_COPY:
+            return fold_cast(inst, operands[0], out);
+        default:
+            return false;
+    }
+}
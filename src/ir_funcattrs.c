@@ -0,0 +1,216 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Function Attributes
+//=============================================================================
+
+// Infers what each function may do (see IRFuncAttr) and records it on the
+// function and on every call naming it, where function passes read it:
+// dce deletes unused calls without side effects, gvn and licm treat calls
+// to pure functions as computations, memopt lets readonly calls keep
+// values available, and the inliner skips calls that never return.
+//
+// Components of the call graph are visited callees first. Within a
+// component every member is first assumed to have the memory attributes,
+// then a member's own body may take them away; the component keeps what
+// all members keep. A call into the component is never known to return,
+// as the recursion might not end, and neither is a loop whose trip count
+// scev cannot find. Calls to functions defined elsewhere (printf) may do
+// anything.
+
+#define MEMORY_ATTRS (IR_ATTR_READNONE | IR_ATTR_READONLY | IR_ATTR_WILLRETURN | IR_ATTR_NOCAPTURE)
+
+static bool is_inst(IRValue *value, IROpcode opcode) {
+    return value->kind == IR_VALUE_INST && ((IRInstruction*)value)->opcode == opcode;
+}
+
+// An address into one of the function's own stack slots no pointer
+// outside reaches
+static bool is_private(IRValue *address) {
+    IRValue *base = ir_mem_loc(address).base;
+    return is_inst(base, IR_ALLOC) && !ir_alloc_escapes((IRInstruction*)base);
+}
+
+// An address into a global or a stack slot, which can always be read
+static bool is_object(IRValue *address) {
+    IRValue *base = ir_mem_loc(address).base;
+    return base->kind == IR_VALUE_GLOBAL || is_inst(base, IR_ALLOC);
+}
+
+// Whether `value` may hold a pointer the function was passed. Pointers
+// into globals and its own slots are not; a pointer it loaded might be.
+static bool may_be_argument(IRValue *value) {
+    if (value->type->kind != IR_TYPE_PTR && value->type->kind != IR_TYPE_STRING) return false;
+    IRValue *base = ir_mem_loc(value).base;
+    return base->kind != IR_VALUE_GLOBAL && !is_inst(base, IR_ALLOC);
+}
+
+// Attributes of what `node` calls, with members of its own component
+// assumed to keep memory and pointers to themselves
+static uint32_t callee_attrs(IRCallGraph *graph, IRCallGraphNode *node, IRInstruction *call) {
+    IRCallGraphNode *callee = ir_call_graph_callee(graph, call);
+    if (!callee) return 0;
+    if (callee->scc == node->scc) return IR_ATTR_READNONE | IR_ATTR_READONLY | IR_ATTR_NOCAPTURE;
+    return callee->function->attrs;
+}
+
+static uint32_t scan_call(IRCallGraph *graph, IRCallGraphNode *node, IRInstruction *call) {
+    uint32_t callee = callee_attrs(graph, node, call);
+    uint32_t attrs = MEMORY_ATTRS & (callee | IR_ATTR_NOCAPTURE);
+    if (!(callee & IR_ATTR_NOCAPTURE)) {
+        IRCallData *data = call->ops[0].call;
+        for (size_t i = 0; i < data->arg_count; i++) {
+            if (may_be_argument(data->args[i].use.value)) attrs &= ~IR_ATTR_NOCAPTURE;
+        }
+    }
+    return attrs;
+}
+
+// What the instructions of one function allow
+static uint32_t scan_body(IRCallGraph *graph, IRCallGraphNode *node, IRCFG *cfg) {
+    uint32_t attrs = MEMORY_ATTRS;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            switch (inst->opcode) {
+                case IR_LOAD:
+                    if (!is_private(inst->ops[0].value)) attrs &= ~IR_ATTR_READNONE;
+                    if (!is_object(inst->ops[0].value)) attrs &= ~IR_ATTR_WILLRETURN; // Might be a bad pointer
+                    break;
+                case IR_STORE:
+                    if (!is_private(inst->ops[1].value)) {
+                        attrs &= ~(IR_ATTR_READNONE | IR_ATTR_READONLY | IR_ATTR_WILLRETURN);
+                    }
+                    if (may_be_argument(inst->ops[0].value)) attrs &= ~IR_ATTR_NOCAPTURE;
+                    break;
+                case IR_CALL:
+                    attrs &= scan_call(graph, node, inst);
+                    break;
+                case IR_RET:
+                    if (inst->ops[0].value && may_be_argument(inst->ops[0].value)) attrs &= ~IR_ATTR_NOCAPTURE;
+                    break;
+                default:
+                    if (ir_inst_has_side_effects(inst) && inst->opcode != IR_BR && inst->opcode != IR_CBR) {
+                        attrs &= ~IR_ATTR_WILLRETURN; // A division that may trap
+                    }
+                    break;
+            }
+        }
+    }
+    return attrs;
+}
+
+// Every loop must be counted for the function to be sure to return
+static bool loops_terminate(IRCFG *cfg) {
+    ir_cfg_compute_loops(cfg);
+    for (uint32_t l = 0; l < cfg->loop_count; l++) {
+        IRLoopSCEV *se = ir_scev_create(cfg, cfg->loops[l]);
+        bool counted = se && ir_scev_trip_count(se);
+        ir_scev_free(se);
+        if (!counted) return false;
+    }
+    return true;
+}
+
+static bool calls_noreturn(IRCallGraph *graph, IRCallGraphNode *node, IRBasicBlock *block) {
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        IRCallGraphNode *callee = ir_call_graph_callee(graph, block->instructions[i]);
+        if (callee && callee->scc != node->scc && (callee->function->attrs & IR_ATTR_NORETURN)) return true;
+    }
+    return false;
+}
+
+// No return can be reached from the entry without passing a call that
+// never comes back
+static bool never_returns(IRCallGraph *graph, IRCallGraphNode *node, IRCFG *cfg) {
+    bool *seen = calloc(cfg->capacity, sizeof(bool));
+    IRBasicBlock **worklist = malloc(sizeof(IRBasicBlock*) * (cfg->rpo_count ? cfg->rpo_count : 1));
+    uint32_t count = 0;
+    bool returns = false;
+    worklist[count++] = cfg->rpo[0];
+    seen[cfg->rpo[0]->id] = true;
+    while (count > 0 && !returns) {
+        IRBasicBlock *block = worklist[--count];
+        if (calls_noreturn(graph, node, block)) continue;
+        IRInstruction *term = ir_block_terminator(block);
+        if (!term || term->opcode == IR_RET) {
+            returns = true;
+            break;
+        }
+        IRBlockList *succs = &cfg->succs[block->id];
+        for (uint32_t i = 0; i < succs->count; i++) {
+            if (seen[succs->items[i]->id]) continue;
+            seen[succs->items[i]->id] = true;
+            worklist[count++] = succs->items[i];
+        }
+    }
+    free(seen);
+    free(worklist);
+    return !returns;
+}
+
+static uint32_t infer(IRCallGraph *graph, IRCallGraphNode *node) {
+    IRFunction *func = node->function;
+    if (!func->entry_block) return 0;
+    IRCFG *cfg = ir_cfg_get(func);
+    uint32_t attrs = scan_body(graph, node, cfg);
+    if ((attrs & IR_ATTR_WILLRETURN) && !loops_terminate(cfg)) attrs &= ~IR_ATTR_WILLRETURN;
+    if (never_returns(graph, node, cfg)) attrs = (attrs & ~IR_ATTR_WILLRETURN) | IR_ATTR_NORETURN;
+    // A component member calling another is not sure to return
+    for (uint32_t i = 0; i < node->callee_count; i++) {
+        if (graph->nodes[node->callees[i]].scc == node->scc) attrs &= ~IR_ATTR_WILLRETURN;
+    }
+    if (attrs & IR_ATTR_READNONE) attrs |= IR_ATTR_READONLY;
+    return attrs;
+}
+
+static bool funcattrs_run_module(IRModule *mod) {
+    IRCallGraph *graph = ir_call_graph_build(mod);
+    uint32_t *attrs = malloc(sizeof(uint32_t) * (graph->node_count ? graph->node_count : 1));
+
+    // Members of a component are adjacent in bottom-up order
+    for (uint32_t first = 0; first < graph->node_count;) {
+        uint32_t scc = graph->nodes[graph->bottom_up[first]].scc;
+        uint32_t end = first;
+        uint32_t shared = MEMORY_ATTRS;
+        for (; end < graph->node_count && graph->nodes[graph->bottom_up[end]].scc == scc; end++) {
+            uint32_t index = graph->bottom_up[end];
+            attrs[index] = infer(graph, &graph->nodes[index]);
+            shared &= attrs[index];
+        }
+        for (uint32_t i = first; i < end; i++) {
+            uint32_t index = graph->bottom_up[i];
+            graph->nodes[index].function->attrs = (attrs[index] & ~MEMORY_ATTRS) | shared;
+        }
+        first = end;
+    }
+
+    bool changed = false;
+    for (uint32_t n = 0; n < graph->node_count; n++) {
+        IRFunction *func = graph->nodes[n].function;
+        for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+            for (uint32_t i = 0; i < block->inst_count; i++) {
+                IRInstruction *inst = block->instructions[i];
+                if (inst->opcode != IR_CALL || !inst->ops[0].call) continue;
+                IRCallGraphNode *callee = ir_call_graph_callee(graph, inst);
+                uint32_t known = callee ? callee->function->attrs : 0;
+                if (inst->ops[0].call->callee_attrs != known) changed = true;
+                inst->ops[0].call->callee_attrs = known;
+            }
+        }
+    }
+
+    free(attrs);
+    ir_call_graph_free(graph);
+    return changed;
+}
+
+const IRPass ir_pass_funcattrs = {
+    .name = "funcattrs",
+    .description = "Infer which functions are pure, readonly or never return, and mark their calls",
+    .run_module = funcattrs_run_module,
+    .preserves = IR_PRESERVES_CFG,
+};
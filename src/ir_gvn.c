@@ -0,0 +1,291 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Global Value Numbering
+//=============================================================================
+
+// Dominator-based value numbering: walk the dominator tree keeping a
+// scoped table of the pure computations available so far. A computation
+// already in the table is redundant, since its first occurrence dominates
+// it, and is replaced by that value. Leaving a subtree pops what it added.
+//
+// Loads are numbered too, but only within a block and only until the next
+// store or call; memopt looks further, using alias information. Calls to
+// functions that read no memory are numbered like any pure computation,
+// and calls to readonly ones like loads.
+
+typedef struct GVNEntry {
+    IRInstruction *inst;
+    uint32_t hash;
+    uint32_t epoch;          // Memory state a load or call read
+    struct GVNEntry *next;   // Bucket chain, newest first
+} GVNEntry;
+
+typedef struct GVN {
+    IRCFG *cfg;
+    GVNEntry **buckets;
+    uint32_t mask;
+    GVNEntry *entries;       // Stack of entries; scopes pop back to a mark
+    size_t entry_count;
+    uint32_t epoch;          // Bumped by every store, writing call and block entry
+} GVN;
+
+static bool is_commutative(IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_ADD:
+        case IR_MUL:
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR:
+        case IR_CMP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Instructions whose result depends only on their operands
+static bool is_numbered(IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_LOAD:
+        case IR_GETPTR:
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_DIV:  // A trapping division already trapped at the first one
+        case IR_MOD:
+        case IR_UDIV:
+        case IR_UREM:
+        case IR_CMP:
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR:
+        case IR_SHL:
+        case IR_SHR:
+        case IR_SAR:
+        case IR_ZEXT:
+        case IR_SEXT:
+        case IR_TRUNC:
+        case IR_BITCAST:
+        case IR_SITOFPD:
+        case IR_FPTOSI:
+        case IR_COPY:
+            return inst->type->kind != IR_TYPE_VOID;
+        case IR_CALL:
+            return inst->type->kind != IR_TYPE_VOID && (inst->ops[0].call->callee_attrs & IR_ATTR_READONLY);
+        default:
+            return false;
+    }
+}
+
+// Calls that write memory end what loads (and readonly calls) have read
+static bool writes_memory(IRInstruction *inst) {
+    if (inst->opcode == IR_STORE) return true;
+    return inst->opcode == IR_CALL && !(inst->ops[0].call->callee_attrs & IR_ATTR_READONLY);
+}
+
+// Results that depend on the memory state as well as the operands
+static bool reads_memory(IRInstruction *inst) {
+    if (inst->opcode == IR_LOAD) return true;
+    return inst->opcode == IR_CALL && !(inst->ops[0].call->callee_attrs & IR_ATTR_READNONE);
+}
+
+static uint32_t mix(uint32_t hash, uint64_t value) {
+    hash ^= (uint32_t)value ^ (uint32_t)(value >> 32);
+    return hash * 16777619u;
+}
+
+// Constants and arguments are created per use, so compare them by content
+static uint32_t hash_value(IRValue *value) {
+    switch (value->kind) {
+        case IR_VALUE_CONST: {
+            uint64_t bits;
+            memcpy(&bits, &((IRConstant*)value)->int_value, sizeof(bits));
+            return mix(mix(2166136261u, value->type->kind), bits);
+        }
+        case IR_VALUE_ARG:
+            return mix(2166136261u, value->id);
+        case IR_VALUE_GLOBAL:
+            return mix(2166136261u, (uintptr_t)((IRGlobalRef*)value)->string);
+        default:
+            return mix(2166136261u, (uintptr_t)value);
+    }
+}
+
+static bool same_value(IRValue *a, IRValue *b) {
+    if (a == b) return true;
+    if (a->kind != b->kind) return false;
+    switch (a->kind) {
+        case IR_VALUE_CONST:
+            return a->type->kind == b->type->kind &&
+                memcmp(&((IRConstant*)a)->int_value, &((IRConstant*)b)->int_value, sizeof(int64_t)) == 0;
+        case IR_VALUE_ARG:
+            return a->id == b->id;
+        case IR_VALUE_GLOBAL:
+            return ((IRGlobalRef*)a)->string == ((IRGlobalRef*)b)->string;
+        default:
+            return false;
+    }
+}
+
+static uint32_t hash_inst(IRInstruction *inst) {
+    uint32_t hash = mix(mix(2166136261u, inst->opcode), inst->type->kind);
+    size_t count = ir_operand_count(inst);
+    if (is_commutative(inst)) {
+        // Order-independent, so swapped operands land in the same bucket
+        hash = mix(hash, hash_value(inst->ops[0].value) + hash_value(inst->ops[1].value));
+        if (inst->opcode == IR_CMP) {
+            IRCmpKind kind = (IRCmpKind)inst->cmp_kind;
+            IRCmpKind swapped = ir_cmp_swap(kind);
+            hash = mix(hash, kind < swapped ? kind : swapped);
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            hash = mix(hash, hash_value(ir_get_operand(inst, i)));
+        }
+    }
+    if (inst->opcode == IR_GETPTR) hash = mix(hash, (uint64_t)inst->ops[2].imm);
+    if (inst->opcode == IR_CALL) {
+        for (const char *c = inst->ops[0].call->callee_name; *c; c++) {
+            hash = mix(hash, (unsigned char)*c);
+        }
+    }
+    return hash;
+}
+
+static bool same_call(IRInstruction *a, IRInstruction *b) {
+    IRCallData *x = a->ops[0].call;
+    IRCallData *y = b->ops[0].call;
+    if (x->arg_count != y->arg_count || strcmp(x->callee_name, y->callee_name) != 0) return false;
+    for (size_t i = 0; i < x->arg_count; i++) {
+        if (!same_value(x->args[i].use.value, y->args[i].use.value)) return false;
+    }
+    return true;
+}
+
+static bool same_inst(IRInstruction *a, IRInstruction *b) {
+    if (a->opcode != b->opcode || a->type->kind != b->type->kind) return false;
+    if (a->opcode == IR_GETPTR && a->ops[2].imm != b->ops[2].imm) return false;
+    if (a->opcode == IR_CALL) return same_call(a, b);
+    // Casts to a narrower type depend on the source type as well
+    size_t count = ir_operand_count(a);
+    if (count == 1) {
+        return a->ops[0].value->type->kind == b->ops[0].value->type->kind &&
+            same_value(a->ops[0].value, b->ops[0].value);
+    }
+    if (a->opcode == IR_CMP) {
+        if (a->ops[0].value->type->kind != b->ops[0].value->type->kind) return false;
+        if (a->cmp_kind == b->cmp_kind && same_value(a->ops[0].value, b->ops[0].value) &&
+            same_value(a->ops[1].value, b->ops[1].value)) {
+            return true;
+        }
+        return ir_cmp_swap((IRCmpKind)a->cmp_kind) == (IRCmpKind)b->cmp_kind &&
+            same_value(a->ops[0].value, b->ops[1].value) && same_value(a->ops[1].value, b->ops[0].value);
+    }
+    if (same_value(a->ops[0].value, b->ops[0].value) && same_value(a->ops[1].value, b->ops[1].value)) {
+        return true;
+    }
+    return is_commutative(a) &&
+        same_value(a->ops[0].value, b->ops[1].value) && same_value(a->ops[1].value, b->ops[0].value);
+}
+
+static IRInstruction *lookup(GVN *g, IRInstruction *inst, uint32_t hash) {
+    for (GVNEntry *entry = g->buckets[hash & g->mask]; entry; entry = entry->next) {
+        if (entry->hash != hash || !same_inst(entry->inst, inst)) continue;
+        if (reads_memory(inst) && entry->epoch != g->epoch) continue;
+        return entry->inst;
+    }
+    return NULL;
+}
+
+static void insert(GVN *g, IRInstruction *inst, uint32_t hash) {
+    GVNEntry *entry = &g->entries[g->entry_count++];
+    entry->inst = inst;
+    entry->hash = hash;
+    entry->epoch = g->epoch;
+    entry->next = g->buckets[hash & g->mask];
+    g->buckets[hash & g->mask] = entry;
+}
+
+// Pop entries back to `mark`; they were pushed in order, so each is at the
+// head of its bucket when removed
+static void pop_to(GVN *g, size_t mark) {
+    while (g->entry_count > mark) {
+        GVNEntry *entry = &g->entries[--g->entry_count];
+        g->buckets[entry->hash & g->mask] = entry->next;
+    }
+}
+
+static bool number_block(GVN *g, IRBasicBlock *block) {
+    bool erased = false;
+    g->epoch++;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        IRInstruction *inst = block->instructions[i];
+        if (writes_memory(inst)) {
+            g->epoch++;
+            continue;
+        }
+        if (!is_numbered(inst)) continue;
+        uint32_t hash = hash_inst(inst);
+        IRInstruction *leader = lookup(g, inst, hash);
+        if (leader) {
+            ir_replace_all_uses((IRValue*)inst, (IRValue*)leader);
+            ir_inst_erase(inst);
+            erased = true;
+        } else {
+            insert(g, inst, hash);
+        }
+    }
+    if (erased) ir_block_compact(block);
+    return erased;
+}
+
+static bool gvn_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    GVN g = { .cfg = ir_cfg_get(func) };
+    IRCFG *cfg = g.cfg;
+
+    size_t inst_count = ir_function_inst_count(func);
+    uint32_t bucket_count = 16;
+    while (bucket_count < inst_count) bucket_count *= 2;
+    g.buckets = calloc(bucket_count, sizeof(GVNEntry*));
+    g.mask = bucket_count - 1;
+    g.entries = malloc(sizeof(GVNEntry) * (inst_count ? inst_count : 1));
+
+    typedef struct Frame { IRBasicBlock *block; uint32_t next_child; size_t mark; } Frame;
+    Frame *stack = malloc(sizeof(Frame) * (cfg->rpo_count ? cfg->rpo_count : 1));
+    uint32_t depth = 0;
+    bool changed = false;
+
+    IRBasicBlock *entry = cfg->rpo[0];
+    stack[depth++] = (Frame){ entry, 0, g.entry_count };
+    changed |= number_block(&g, entry);
+
+    while (depth > 0) {
+        Frame *frame = &stack[depth - 1];
+        IRBlockList *children = &cfg->dom_children[frame->block->id];
+        if (frame->next_child < children->count) {
+            IRBasicBlock *child = children->items[frame->next_child++];
+            stack[depth++] = (Frame){ child, 0, g.entry_count };
+            changed |= number_block(&g, child);
+        } else {
+            pop_to(&g, frame->mark);
+            depth--;
+        }
+    }
+
+    free(stack);
+    free(g.buckets);
+    free(g.entries);
+    return changed;
+}
+
+const IRPass ir_pass_gvn = {
+    .name = "gvn",
+    .description = "Replace computations already available in a dominating block",
+    .run = gvn_run,
+    .preserves = IR_PRESERVES_CFG,
+};
@@ -0,0 +1,346 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Induction Variable Simplification
+//=============================================================================
+
+// Built on scalar evolution, innermost loops first:
+//
+//   - Strength reduction: a multiplication that grows by a fixed amount
+//     each iteration (i*stride) becomes a phi advanced by an add.
+//   - Exit values: uses after the loop of a header phi with a closed form
+//     (counters, sums over the range) read a value computed before the
+//     loop from the trip count instead.
+//   - Test replacement: if the counter only feeds its own increment and
+//     the exit test, the test is rewritten against a strength-reduced
+//     value so the counter dies.
+//   - Deletion: a loop with a known trip count whose results are no
+//     longer used and that has no side effects is skipped entirely.
+
+typedef struct IndVars {
+    IRFunction *func;
+    IRCFG *cfg;
+    IRLoop *loop;
+    IRLoopSCEV *se;
+    IRBasicBlock *preheader;
+    size_t insert_at;        // Emission point in the preheader
+    IRValue *trip_count;     // Expanded on first use
+} IndVars;
+
+static size_t preheader_end(IRBasicBlock *preheader) {
+    return preheader->inst_count - 1; // Before the jump to the header
+}
+
+//-----------------------------------------------------------------------------
+// Strength reduction
+//-----------------------------------------------------------------------------
+
+static bool strength_reduce(IndVars *iv) {
+    IRBasicBlock *header = iv->loop->header;
+    IRBasicBlock *latch = ir_scev_latch(iv->se);
+    bool changed = false;
+
+    for (uint32_t b = 0; b < iv->loop->block_count; b++) {
+        IRBasicBlock *block = iv->loop->blocks[b];
+        bool erased = false;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->opcode != IR_MUL && inst->opcode != IR_SHL) continue;
+            IRSCEV scev;
+            if (!ir_scev_get(iv->se, (IRValue*)inst, &scev)) continue;
+            if (scev.degree != 1 || scev.bits < (uint32_t)ir_type_bits(inst->type)) continue;
+
+            iv->insert_at = preheader_end(iv->preheader);
+            IRValue *start = ir_scev_expand_coef(iv->func, &scev.coef[0], inst->type, iv->preheader, &iv->insert_at);
+            IRValue *step = ir_scev_expand_coef(iv->func, &scev.coef[1], inst->type, iv->preheader, &iv->insert_at);
+
+            IRInstruction *phi = ir_inst_insert(header, 0, IR_PHI, inst->type);
+            if (block == header) i++; // The phi went in front of us
+            IRInstruction *next = ir_inst_insert(latch, latch->inst_count - 1, IR_ADD, inst->type);
+            ir_set_operand(next, 0, (IRValue*)phi);
+            ir_set_operand(next, 1, step);
+            ir_phi_add_incoming(iv->func, phi, start, iv->preheader);
+            ir_phi_add_incoming(iv->func, phi, (IRValue*)next, latch);
+
+            ir_replace_all_uses((IRValue*)inst, (IRValue*)phi);
+            ir_inst_erase(inst);
+            erased = changed = true;
+        }
+        if (erased) ir_block_compact(block);
+    }
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// Exit values
+//-----------------------------------------------------------------------------
+
+static IRValue *trip_count(IndVars *iv) {
+    if (!iv->trip_count) {
+        iv->insert_at = preheader_end(iv->preheader);
+        iv->trip_count = ir_scev_expand_trip_count(iv->se, iv->preheader, &iv->insert_at);
+    }
+    return iv->trip_count;
+}
+
+// Point the uses of `value` outside the loop at `replacement`
+static void replace_outside_uses(IndVars *iv, IRValue *value, IRValue *replacement) {
+    IRUse *use = value->uses;
+    while (use) {
+        IRInstruction *user = ir_use_user(use);
+        use = ir_use_next(use);
+        if (ir_loop_contains(iv->cfg, iv->loop, user->block)) continue;
+        size_t count = ir_operand_count(user);
+        for (size_t i = 0; i < count; i++) {
+            if (ir_get_operand(user, i) == value) ir_set_operand(user, i, replacement);
+        }
+        use = value->uses; // Setting operands rewrote the list
+    }
+}
+
+static bool used_outside(IndVars *iv, IRInstruction *inst) {
+    for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+        if (!ir_loop_contains(iv->cfg, iv->loop, ir_use_user(use)->block)) return true;
+    }
+    return false;
+}
+
+static bool replace_exit_values(IndVars *iv) {
+    if (!ir_scev_trip_count(iv->se)) return false;
+    IRBasicBlock *header = iv->loop->header;
+    bool changed = false;
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = header->instructions[i];
+        if (!used_outside(iv, phi)) continue;
+        IRSCEV scev;
+        if (!ir_scev_get(iv->se, (IRValue*)phi, &scev)) continue;
+        IRValue *count = trip_count(iv);
+        IRValue *exit = ir_scev_expand_at(iv->func, &scev, count, phi->type, iv->preheader, &iv->insert_at);
+        replace_outside_uses(iv, (IRValue*)phi, exit);
+        changed = true;
+    }
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// Linear function test replacement
+//-----------------------------------------------------------------------------
+
+static bool in_set(IRInstruction **set, size_t count, IRInstruction *inst) {
+    for (size_t i = 0; i < count; i++) {
+        if (set[i] == inst) return true;
+    }
+    return false;
+}
+
+// Would the counter die if the exit test stopped reading it? Collect the
+// counter, its update chain and the test, and check nothing else uses them.
+static bool counter_only_counts(IndVars *iv, const IRTripCount *trip) {
+    size_t capacity = 16, count = 0;
+    IRInstruction **set = malloc(sizeof(IRInstruction*) * capacity);
+    set[count++] = trip->iv;
+    set[count++] = trip->test;
+
+    bool ok = true;
+    for (size_t i = 0; i < count && ok; i++) {
+        IRInstruction *inst = set[i];
+        size_t operands = inst->opcode == IR_PHI ? 0 : ir_operand_count(inst);
+        if (inst == trip->iv) {
+            IRPhiData *data = inst->ops[0].phi;
+            for (uint32_t j = 0; j < data->arg_count; j++) {
+                IRValue *value = data->args[j].use.value;
+                if (data->args[j].block == ir_scev_latch(iv->se) && value->kind == IR_VALUE_INST &&
+                    ir_loop_contains(iv->cfg, iv->loop, ((IRInstruction*)value)->block) &&
+                    !in_set(set, count, (IRInstruction*)value)) {
+                    if (count == capacity) {
+                        capacity *= 2;
+                        set = realloc(set, sizeof(IRInstruction*) * capacity);
+                    }
+                    set[count++] = (IRInstruction*)value;
+                }
+            }
+        }
+        for (size_t j = 0; j < operands; j++) {
+            IRValue *value = ir_get_operand(inst, j);
+            if (value->kind != IR_VALUE_INST || in_set(set, count, (IRInstruction*)value)) continue;
+            IRInstruction *def = (IRInstruction*)value;
+            if (!ir_loop_contains(iv->cfg, iv->loop, def->block) || def->opcode == IR_PHI) continue;
+            if (ir_inst_has_side_effects(def)) {
+                ok = false;
+                break;
+            }
+            if (count == capacity) {
+                capacity *= 2;
+                set = realloc(set, sizeof(IRInstruction*) * capacity);
+            }
+            set[count++] = def;
+        }
+    }
+
+    for (size_t i = 0; i < count && ok; i++) {
+        for (IRUse *use = set[i]->uses; use; use = ir_use_next(use)) {
+            IRInstruction *user = ir_use_user(use);
+            if (user == ir_block_terminator(iv->loop->header) && set[i] == trip->test) continue;
+            if (!in_set(set, count, user)) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    free(set);
+    return ok;
+}
+
+// A 64-bit header phi that moves in lockstep with the counter:
+// other = scale * counter + offset, small enough that neither side of the
+// rewritten test can overflow
+static bool lockstep(IndVars *iv, const IRTripCount *trip, IRInstruction *other,
+                     int64_t *scale, int64_t *offset) {
+    IRSCEV counter, scev;
+    if (other == trip->iv || other->type->kind != IR_TYPE_I64) return false;
+    if (!ir_scev_get(iv->se, (IRValue*)other, &scev)) return false;
+    if (scev.degree != 1 || scev.bits < 64 || scev.coef[1].term_count) return false;
+    if (scev.coef[1].constant % trip->step) return false;
+    int64_t a = scev.coef[1].constant / trip->step;
+    if (a == 0 || a > INT32_MAX || a < -INT32_MAX) return false;
+
+    IRSCEVCoef rest;
+    if (!ir_scev_get(iv->se, (IRValue*)trip->iv, &counter)) return false;
+    if (!ir_scev_coef_add(&rest, &scev.coef[0], &counter.coef[0], -a) || rest.term_count) return false;
+    if (rest.constant > ((int64_t)1 << 60) || rest.constant < -((int64_t)1 << 60)) return false;
+    *scale = a;
+    *offset = rest.constant;
+    return true;
+}
+
+static bool replace_exit_test(IndVars *iv) {
+    const IRTripCount *trip = ir_scev_trip_count(iv->se);
+    if (!trip || !counter_only_counts(iv, trip)) return false;
+
+    IRBasicBlock *header = iv->loop->header;
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *other = header->instructions[i];
+        int64_t a, b;
+        if (!lockstep(iv, trip, other, &a, &b)) continue;
+
+        // counter < bound  <=>  a*counter + b < a*bound + b  (flipped if a < 0)
+        iv->insert_at = preheader_end(iv->preheader);
+        IRSCEVCoef limit = { .constant = b, .term_count = 1 };
+        limit.terms[0] = (IRSCEVTerm){ trip->bound, a };
+        IRFoldValue constant_bound;
+        if (ir_fold_operand(trip->bound, &constant_bound)) {
+            limit.constant = b + a * constant_bound.i;
+            limit.term_count = 0;
+        }
+        IRValue *end = ir_scev_expand_coef(iv->func, &limit, other->type, iv->preheader, &iv->insert_at);
+
+        bool up = (trip->step > 0) == (a > 0);
+        IRInstruction *branch = ir_block_terminator(header);
+        bool stay_on_true = ir_loop_contains(iv->cfg, iv->loop, branch->ops[1].block);
+        IRCmpKind kind = up ? (stay_on_true ? IR_CMP_SLT : IR_CMP_SGE) : (stay_on_true ? IR_CMP_SGT : IR_CMP_SLE);
+        IRInstruction *test = ir_inst_insert(header, header->inst_count - 1, IR_CMP, &g_ir_type_i32);
+        test->cmp_kind = (uint8_t)kind;
+        ir_set_operand(test, 0, (IRValue*)other);
+        ir_set_operand(test, 1, end);
+        ir_set_operand(branch, 0, (IRValue*)test);
+        return true;
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Loop deletion
+//-----------------------------------------------------------------------------
+
+// Nothing in the loop is observable: no side effects, no values used after
+// it. Its trip count (and those of loops inside it) must be known, since
+// deleting an infinite loop would change what the program does.
+static bool loop_is_dead(IndVars *iv) {
+    for (uint32_t b = 0; b < iv->loop->block_count; b++) {
+        IRBasicBlock *block = iv->loop->blocks[b];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->opcode == IR_BR || inst->opcode == IR_CBR) continue;
+            if (ir_inst_has_side_effects(inst) || used_outside(iv, inst)) return false;
+        }
+    }
+    return true;
+}
+
+// Jump from the preheader straight to the exit; dead code elimination
+// removes the unreachable body. The header still branches to the exit
+// until then, so its phi entries stay next to the preheader's.
+static void delete_loop(IRFunction *func, IRBasicBlock *preheader, IRBasicBlock *header, IRBasicBlock *exit) {
+    for (uint32_t i = 0; i < exit->inst_count && exit->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = exit->instructions[i];
+        IRPhiData *data = phi->ops[0].phi;
+        uint32_t count = data ? data->arg_count : 0;
+        for (uint32_t j = 0; j < count; j++) {
+            if (data->args[j].block == header) {
+                ir_phi_add_incoming(func, phi, data->args[j].use.value, preheader);
+                break;
+            }
+        }
+    }
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        ir_phi_remove_incoming(header->instructions[i], preheader);
+    }
+    ir_branch_set_target(ir_block_terminator(preheader), 0, exit);
+}
+
+static bool indvars_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = ir_loops_insert_preheaders(func);
+
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+    uint32_t loop_count = cfg->loop_count;
+    if (loop_count == 0) return changed;
+
+    // Deleting changes the CFG, so it waits until every loop is done
+    typedef struct Dead { IRBasicBlock *preheader, *header, *exit; } Dead;
+    Dead *dead = malloc(sizeof(Dead) * loop_count);
+    bool *finite = calloc(loop_count, sizeof(bool));
+    uint32_t dead_count = 0;
+
+    // Innermost loops first
+    for (uint32_t l = loop_count; l-- > 0;) {
+        IRLoop *loop = cfg->loops[l];
+        IRLoopSCEV *se = ir_scev_create(cfg, loop);
+        if (!se) continue;
+        IndVars iv = { .func = func, .cfg = cfg, .loop = loop, .se = se, .preheader = ir_scev_preheader(se) };
+
+        changed |= strength_reduce(&iv);
+        changed |= replace_exit_values(&iv);
+        changed |= replace_exit_test(&iv);
+
+        finite[l] = ir_scev_trip_count(se) != NULL;
+        for (uint32_t inner = l + 1; inner < loop_count; inner++) {
+            if (cfg->loops[inner]->parent == loop && !finite[inner]) finite[l] = false;
+        }
+        if (finite[l] && loop_is_dead(&iv)) {
+            IRInstruction *branch = ir_block_terminator(loop->header);
+            IRBasicBlock *exit = ir_loop_contains(cfg, loop, branch->ops[1].block) ?
+                branch->ops[2].block : branch->ops[1].block;
+            dead[dead_count++] = (Dead){ iv.preheader, loop->header, exit };
+        }
+        ir_scev_free(se);
+    }
+
+    for (uint32_t i = 0; i < dead_count; i++) {
+        delete_loop(func, dead[i].preheader, dead[i].header, dead[i].exit);
+        changed = true;
+    }
+    free(dead);
+    free(finite);
+    return changed;
+}
+
+const IRPass ir_pass_indvars = {
+    .name = "indvars",
+    .description = "Strength-reduce induction variables, compute exit values, delete dead counted loops",
+    .run = indvars_run,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,274 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Inlining
+//=============================================================================
+
+// Functions are visited bottom-up over the call graph, so a callee has
+// already absorbed its own small callees when its size is judged. A call
+// is replaced by a copy of the callee's blocks when the callee is small
+// enough: calls inside loops and calls to functions with a single call
+// site get a larger budget. Calls within a recursive component are left
+// alone, and so are calls to functions funcattrs found never return:
+// they end cold paths. Calls inside loops are considered first, so the
+// caller's size limit is spent where it pays most.
+//
+// The caller's block is split after the call, the copied returns jump to
+// the second half, and a phi there merges the returned values.
+
+#define INLINE_THRESHOLD 24          // Callee instructions
+#define INLINE_HOT_THRESHOLD 64      // Call sites inside a loop
+#define INLINE_ONCE_THRESHOLD 160    // Callees with a single call site
+#define INLINE_CALLER_MAX_SIZE 4096  // Stop growing a caller past this
+
+typedef struct Inliner {
+    IRFunction *caller;
+    IRFunction *callee;
+    IRInstruction *call;
+    IRValue **value_map;       // Callee temp id -> caller value
+    IRBasicBlock **block_map;  // Callee block id -> copy
+} Inliner;
+
+static size_t function_size(IRFunction *func) {
+    size_t size = 0;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            if (block->instructions[i]->opcode != IR_PHI) size++;
+        }
+    }
+    return size;
+}
+
+// Arguments and returned values must already have the types the callee
+// and the call expect; the lowering converts them at every call
+static bool signature_matches(IRInstruction *call, IRFunction *callee) {
+    IRCallData *data = call->ops[0].call;
+    if (callee->is_variadic || data->arg_count != callee->param_count) return false;
+    for (size_t i = 0; i < data->arg_count; i++) {
+        if (data->args[i].use.value->type->kind != callee->param_types[i]->kind) return false;
+    }
+    if (!callee->entry_block || callee->entry_block->instructions[0]->opcode == IR_PHI) return false;
+    if (!call->uses) return true;
+    for (IRBasicBlock *block = callee->blocks; block; block = block->next) {
+        IRInstruction *term = ir_block_terminator(block);
+        if (!term || term->opcode != IR_RET || !term->ops[0].value) continue;
+        IRValue *value = term->ops[0].value;
+        if (value->kind != IR_VALUE_CONST && value->type->kind != call->type->kind) return false;
+    }
+    return true;
+}
+
+// Constants and global refs are created per use, so each use in the
+// caller gets its own
+static IRValue *copy_value(Inliner *in, IRValue *value) {
+    switch (value->kind) {
+        case IR_VALUE_CONST:
+            // Copies the bits of either member
+            return ir_const_int(in->caller, value->type, ((IRConstant*)value)->int_value);
+        case IR_VALUE_GLOBAL:
+            return ir_const_string(in->caller, value->type, ((IRGlobalRef*)value)->string);
+        default:
+            return value;
+    }
+}
+
+// The caller's version of a callee operand
+static IRValue *map_operand(Inliner *in, IRValue *value) {
+    if (!value) return NULL;
+    switch (value->kind) {
+        case IR_VALUE_INST:
+            return in->value_map[value->id];
+        case IR_VALUE_ARG:
+            return copy_value(in, in->call->ops[0].call->args[value->id].use.value);
+        default:
+            return copy_value(in, value);
+    }
+}
+
+static IRValue *returned_value(Inliner *in, IRValue *value) {
+    IRType *type = in->call->type;
+    if (!value) return ir_const_int(in->caller, type, 0);
+    if (value->kind == IR_VALUE_CONST && value->type->kind != type->kind) {
+        IRFoldValue constant;
+        ir_fold_operand(value, &constant);
+        return ir_const_int(in->caller, type, ir_fold_normalize(constant.i, ir_type_bits(type)));
+    }
+    return map_operand(in, value);
+}
+
+// Point a copied instruction at the caller's values and the copied blocks.
+// Phi entries from blocks that were not copied came from unreachable code.
+static void remap(Inliner *in, IRInstruction *inst) {
+    if (inst->opcode == IR_PHI) {
+        IRPhiData *data = inst->ops[0].phi;
+        for (uint32_t i = data->arg_count; i-- > 0;) {
+            IRBasicBlock *from = in->block_map[data->args[i].block->id];
+            if (from) {
+                data->args[i].block = from;
+            } else {
+                ir_phi_remove_incoming(inst, data->args[i].block);
+            }
+        }
+    }
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        ir_set_operand(inst, i, map_operand(in, ir_get_operand(inst, i)));
+    }
+    if (inst->opcode == IR_BR || inst->opcode == IR_CBR) {
+        size_t succs = ir_block_succ_count(inst->block);
+        for (size_t i = 0; i < succs; i++) {
+            ir_branch_set_target(inst, i, in->block_map[ir_block_succ(inst->block, i)->id]);
+        }
+    }
+}
+
+static void inline_call(Inliner *in) {
+    IRFunction *caller = in->caller;
+    IRFunction *callee = in->callee;
+    IRInstruction *call = in->call;
+    IRBasicBlock *block = call->block;
+    IRCFG *cfg = ir_cfg_get(callee);
+
+    size_t position = 0;
+    while (block->instructions[position] != call) position++;
+    IRBasicBlock *rest = ir_block_split(block, position + 1, "inline.ret");
+
+    in->value_map = calloc(callee->temp_counter ? callee->temp_counter : 1, sizeof(IRValue*));
+    in->block_map = calloc(callee->block_counter, sizeof(IRBasicBlock*));
+
+    // Copy the reachable blocks, in order, between the two halves
+    IRBasicBlock *layout = block;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *copy = ir_basic_block_create(caller, cfg->rpo[b]->name);
+        ir_block_move_after(copy, layout);
+        layout = copy;
+        in->block_map[cfg->rpo[b]->id] = copy;
+    }
+
+    // Operands are remapped once everything is copied: phis can name
+    // values from blocks further down. Stack slots of the callee's entry
+    // block become slots of the caller's.
+    IRInstruction **copies = malloc(sizeof(IRInstruction*) * (ir_function_inst_count(callee) + 1));
+    IRInstruction **returns = malloc(sizeof(IRInstruction*) * cfg->rpo_count);
+    size_t copy_count = 0;
+    size_t return_count = 0;
+    size_t slot_index = 0;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *original = cfg->rpo[b];
+        IRBasicBlock *copy = in->block_map[original->id];
+        for (uint32_t i = 0; i < original->inst_count; i++) {
+            IRInstruction *inst = original->instructions[i];
+            if (inst->opcode == IR_RET) {
+                IRInstruction *jump = ir_inst_create(copy, IR_BR, NULL);
+                jump->ops[0].block = rest;
+                returns[return_count++] = inst;
+                continue;
+            }
+            IRInstruction *clone = inst->opcode == IR_ALLOC && original == callee->entry_block ?
+                ir_inst_clone(caller->entry_block, slot_index++, inst) :
+                ir_inst_clone(copy, copy->inst_count, inst);
+            if (inst->type->kind != IR_TYPE_VOID) in->value_map[inst->id] = (IRValue*)clone;
+            copies[copy_count++] = clone;
+        }
+    }
+    for (size_t i = 0; i < copy_count; i++) {
+        remap(in, copies[i]);
+    }
+
+    // Merge what the copied returns pass back
+    if (call->uses) {
+        IRValue *result;
+        if (return_count == 0) {
+            result = ir_const_int(caller, call->type, 0); // Never returns
+        } else if (return_count == 1) {
+            result = returned_value(in, returns[0]->ops[0].value);
+        } else {
+            IRInstruction *phi = ir_inst_insert(rest, 0, IR_PHI, call->type);
+            for (size_t i = 0; i < return_count; i++) {
+                ir_phi_add_incoming(caller, phi, returned_value(in, returns[i]->ops[0].value),
+                    in->block_map[returns[i]->block->id]);
+            }
+            result = (IRValue*)phi;
+        }
+        ir_replace_all_uses((IRValue*)call, result);
+    }
+    ir_inst_remove(call);
+    IRInstruction *enter = ir_inst_create(block, IR_BR, NULL);
+    enter->ops[0].block = in->block_map[callee->entry_block->id];
+
+    free(copies);
+    free(returns);
+    free(in->value_map);
+    free(in->block_map);
+}
+
+static bool inline_into(IRCallGraph *graph, IRCallGraphNode *node) {
+    IRFunction *caller = node->function;
+    if (!caller->entry_block) return false;
+
+    // Collect the call sites first; inlining splits blocks and drops the CFG
+    typedef struct Site { IRInstruction *call; IRCallGraphNode *callee; bool hot; } Site;
+    Site *sites = NULL;
+    size_t site_count = 0;
+    size_t site_capacity = 0;
+    IRCFG *cfg = ir_cfg_get(caller);
+    ir_cfg_compute_loops(cfg);
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRCallGraphNode *callee = ir_call_graph_callee(graph, block->instructions[i]);
+            if (!callee || callee->scc == node->scc || (callee->function->attrs & IR_ATTR_NORETURN)) continue;
+            if (site_count == site_capacity) {
+                site_capacity = site_capacity ? site_capacity * 2 : 8;
+                sites = realloc(sites, sizeof(Site) * site_capacity);
+            }
+            sites[site_count++] = (Site){ block->instructions[i], callee, ir_cfg_loop_of(cfg, block) != NULL };
+        }
+    }
+
+    // Hot sites first, otherwise in program order
+    size_t hot_count = 0;
+    for (size_t i = 0; i < site_count; i++) {
+        if (!sites[i].hot) continue;
+        Site site = sites[i];
+        memmove(&sites[hot_count + 1], &sites[hot_count], sizeof(Site) * (i - hot_count));
+        sites[hot_count++] = site;
+    }
+
+    bool changed = false;
+    size_t size = function_size(caller);
+    for (size_t i = 0; i < site_count; i++) {
+        IRFunction *callee = sites[i].callee->function;
+        size_t threshold = sites[i].callee->caller_count == 1 ? INLINE_ONCE_THRESHOLD :
+            sites[i].hot ? INLINE_HOT_THRESHOLD : INLINE_THRESHOLD;
+        size_t callee_size = function_size(callee);
+        if (callee_size > threshold || size + callee_size > INLINE_CALLER_MAX_SIZE) continue;
+        if (!signature_matches(sites[i].call, callee)) continue;
+        Inliner in = { .caller = caller, .callee = callee, .call = sites[i].call };
+        inline_call(&in);
+        size += callee_size;
+        changed = true;
+    }
+    free(sites);
+    return changed;
+}
+
+static bool inline_run_module(IRModule *mod) {
+    IRCallGraph *graph = ir_call_graph_build(mod);
+    bool changed = false;
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        changed |= inline_into(graph, &graph->nodes[graph->bottom_up[i]]);
+    }
+    ir_call_graph_free(graph);
+    return changed;
+}
+
+const IRPass ir_pass_inline = {
+    .name = "inline",
+    .description = "Inline small functions into their callers, callees first",
+    .run_module = inline_run_module,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,479 @@
+#include "ir_pass.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Instruction Combining
+//=============================================================================
+
+// Peephole rewrites of single instructions, looking through their operands:
+// algebraic identities, strength reduction of multiplies and divides by
+// constants, cast chains and comparison canonicalization. Constants go on
+// the right of commutative operations and compares, and subtracting a
+// constant becomes adding its negation, so each rule only needs to look
+// for one form. Floats are left alone apart from that; x + 0 is not x for
+// x = -0.
+//
+// Each rule either changes the instruction in place or returns the value
+// to replace it with, emitting any new instructions just before it.
+// Operands left unused are for dce.
+
+#define INSTCOMBINE_MAX_ROUNDS 8
+
+typedef struct Combiner {
+    IRFunction *func;
+    IRBasicBlock *block;
+    uint32_t index;          // Where new instructions go
+} Combiner;
+
+static IRValue *emit(Combiner *c, IROpcode opcode, IRType *type, IRValue *a, IRValue *b) {
+    IRInstruction *inst = ir_inst_insert(c->block, c->index++, opcode, type);
+    ir_set_operand(inst, 0, a);
+    if (b) ir_set_operand(inst, 1, b);
+    return (IRValue*)inst;
+}
+
+static IRValue *constant(Combiner *c, IRType *type, int64_t value) {
+    return ir_const_int(c->func, type, ir_fold_normalize(value, ir_type_bits(type)));
+}
+
+static bool int_constant(IRValue *value, int64_t *out) {
+    IRFoldValue folded;
+    if (ir_type_is_float(value->type) || !ir_fold_operand(value, &folded)) return false;
+    *out = folded.i;
+    return true;
+}
+
+static IRInstruction *defined_by(IRValue *value, IROpcode opcode) {
+    if (!value || value->kind != IR_VALUE_INST || ((IRInstruction*)value)->opcode != opcode) return NULL;
+    return (IRInstruction*)value;
+}
+
+// A value that may stand in for a result of `type`: same QBE class
+static bool fits(IRValue *value, IRType *type) {
+    if (ir_type_is_float(value->type) || ir_type_is_float(type)) return value->type->kind == type->kind;
+    return ir_type_bits(value->type) == ir_type_bits(type);
+}
+
+static void swap_operands(IRInstruction *inst) {
+    IRValue *a = inst->ops[0].value;
+    IRValue *b = inst->ops[1].value;
+    ir_set_operand(inst, 0, b);
+    ir_set_operand(inst, 1, a);
+}
+
+// k if value is 2^k, else -1
+static int log2_exact(uint64_t value) {
+    if (value == 0 || (value & (value - 1))) return -1;
+    int k = 0;
+    while (value >>= 1) k++;
+    return k;
+}
+
+static bool is_commutative(IROpcode opcode) {
+    return opcode == IR_ADD || opcode == IR_MUL || opcode == IR_AND || opcode == IR_OR || opcode == IR_XOR;
+}
+
+//-----------------------------------------------------------------------------
+// Division by constants
+//-----------------------------------------------------------------------------
+
+// Multiplier and shift for signed 32-bit division by d, 2 <= |d| < 2^31
+// (Hacker's Delight, 10-1). Returned as a 33-bit multiplier with its
+// add/subtract fixup folded in, for use in a 64-bit multiply.
+static int64_t division_magic(int32_t d, int *shift) {
+    const uint32_t two31 = 0x80000000u;
+    uint32_t ad = d < 0 ? 0u - (uint32_t)d : (uint32_t)d;
+    uint32_t t = two31 + ((uint32_t)d >> 31);
+    uint32_t anc = t - 1 - t % ad;
+    uint32_t q1 = two31 / anc, r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / ad, r2 = two31 - q2 * ad;
+    uint32_t delta;
+    int p = 31;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    int32_t m = (int32_t)(q2 + 1);
+    if (d < 0) m = -m;
+    *shift = p - 32;
+    int64_t wide = m;
+    if (d > 0 && m < 0) wide += INT64_C(1) << 32;
+    if (d < 0 && m > 0) wide -= INT64_C(1) << 32;
+    return wide;
+}
+
+// The dividend as an l value, if it is known to fit in 32 bits
+static IRValue *narrow_dividend(Combiner *c, IRValue *value) {
+    if (value->type->kind == IR_TYPE_I32) return emit(c, IR_SEXT, &g_ir_type_i64, value, NULL);
+    if (ir_type_bits(value->type) == 64 && defined_by(value, IR_SEXT)) return value;
+    return NULL;
+}
+
+// x / ±2^k rounds toward zero: negative dividends get 2^k - 1 added first
+static IRValue *divide_power_of_two(Combiner *c, IRInstruction *inst, IRValue *x, int64_t d, int k) {
+    IRType *type = inst->type;
+    int bits = ir_type_bits(type);
+    IRValue *sign = x;
+    if (k > 1) sign = emit(c, IR_SAR, type, x, constant(c, type, bits - 1));
+    IRValue *bias = emit(c, IR_SHR, type, sign, constant(c, type, bits - k));
+    IRValue *biased = emit(c, IR_ADD, type, x, bias);
+    if (inst->opcode == IR_MOD) {
+        // The remainder takes the sign of the dividend whatever d's is
+        IRValue *rounded = emit(c, IR_AND, type, biased, constant(c, type, -(INT64_C(1) << k)));
+        return emit(c, IR_SUB, type, x, rounded);
+    }
+    IRValue *q = emit(c, IR_SAR, type, biased, constant(c, type, k));
+    return d < 0 ? emit(c, IR_SUB, type, constant(c, type, 0), q) : q;
+}
+
+// QBE has no multiply-high, so the magic number multiply is done in 64
+// bits, which holds the full product only for 32-bit dividends. Those are
+// w divisions and l divisions of a sign extension, which is how source
+// level int division is lowered.
+static IRValue *divide_by_constant(Combiner *c, IRInstruction *inst, int64_t d) {
+    IRValue *x = inst->ops[0].value;
+    int bits = ir_type_bits(inst->type);
+    int64_t min = bits == 32 ? INT32_MIN : INT64_MIN;
+    if (d == 0 || d == min) return NULL;
+    if (d == 1 || d == -1) {
+        if (inst->opcode == IR_MOD) return constant(c, inst->type, 0);
+        if (d == 1) return fits(x, inst->type) ? x : NULL;
+        return NULL; // -min traps
+    }
+    int k = log2_exact((uint64_t)(d < 0 ? -d : d));
+    if (k > 0) return divide_power_of_two(c, inst, x, d, k);
+    if (d < INT32_MIN || d > INT32_MAX) return NULL;
+
+    IRValue *wide = narrow_dividend(c, x);
+    if (!wide) return NULL;
+    int shift;
+    int64_t magic = division_magic((int32_t)d, &shift);
+    IRType *l = &g_ir_type_i64;
+    IRValue *product = emit(c, IR_MUL, l, wide, constant(c, l, magic));
+    IRValue *floor = emit(c, IR_SAR, l, product, constant(c, l, 32 + shift));
+    IRValue *negative = emit(c, IR_SHR, l, floor, constant(c, l, 63));
+    IRValue *result = emit(c, IR_ADD, l, floor, negative);
+    if (inst->opcode == IR_MOD) {
+        result = emit(c, IR_SUB, l, wide, emit(c, IR_MUL, l, result, constant(c, l, d)));
+    }
+    if (bits == 32) result = emit(c, IR_TRUNC, inst->type, result, NULL);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Rules
+//-----------------------------------------------------------------------------
+
+static IRValue *combine_binary(Combiner *c, IRInstruction *inst) {
+    IROpcode opcode = (IROpcode)inst->opcode;
+    IRType *type = inst->type;
+    IRValue *x = inst->ops[0].value;
+    IRValue *y = inst->ops[1].value;
+    int64_t a, b;
+    bool ca = int_constant(x, &a);
+    bool cb = int_constant(y, &b);
+
+    if (ca && !cb && is_commutative(opcode)) {
+        swap_operands(inst);
+        return (IRValue*)inst;
+    }
+
+    if (x == y) {
+        switch (opcode) {
+            case IR_SUB:
+            case IR_XOR:
+                return constant(c, type, 0);
+            case IR_AND:
+            case IR_OR:
+                return fits(x, type) ? x : NULL;
+            default:
+                break;
+        }
+    }
+
+    // (p + q) - q, (p + q) - p and (p - q) + q
+    IRInstruction *sum = defined_by(x, IR_ADD);
+    if (opcode == IR_SUB && sum && sum->ops[1].value == y && fits(sum->ops[0].value, type)) return sum->ops[0].value;
+    if (opcode == IR_SUB && sum && sum->ops[0].value == y && fits(sum->ops[1].value, type)) return sum->ops[1].value;
+    IRInstruction *difference = defined_by(x, IR_SUB);
+    if (opcode == IR_ADD && difference && difference->ops[1].value == y && fits(difference->ops[0].value, type)) {
+        return difference->ops[0].value;
+    }
+
+    if (!cb) return NULL;
+    int bits = ir_type_bits(type);
+    b = ir_fold_normalize(b, bits);
+    if (b == 0) {
+        switch (opcode) {
+            case IR_ADD:
+            case IR_SUB:
+            case IR_OR:
+            case IR_XOR:
+            case IR_SHL:
+            case IR_SHR:
+            case IR_SAR:
+                return fits(x, type) ? x : NULL;
+            case IR_MUL:
+            case IR_AND:
+                return constant(c, type, 0);
+            default:
+                break;
+        }
+    }
+    if (b == -1) {
+        if (opcode == IR_AND && fits(x, type)) return x;
+        if (opcode == IR_OR) return constant(c, type, -1);
+    }
+
+    switch (opcode) {
+        case IR_SUB:
+            inst->opcode = IR_ADD;
+            ir_set_operand(inst, 1, constant(c, type, (int64_t)(0 - (uint64_t)b)));
+            return (IRValue*)inst;
+        case IR_MUL: {
+            if (b == 1) return fits(x, type) ? x : NULL;
+            if (b == -1) return emit(c, IR_SUB, type, constant(c, type, 0), x);
+            int k = log2_exact((uint64_t)b & (bits == 32 ? UINT32_MAX : UINT64_MAX));
+            if (k > 0) {
+                inst->opcode = IR_SHL;
+                ir_set_operand(inst, 1, constant(c, type, k));
+                return (IRValue*)inst;
+            }
+            break;
+        }
+        case IR_DIV:
+        case IR_MOD:
+            return divide_by_constant(c, inst, b);
+        case IR_UDIV:
+        case IR_UREM: {
+            int k = log2_exact((uint64_t)b & (bits == 32 ? UINT32_MAX : UINT64_MAX));
+            if (k < 0) break;
+            if (inst->opcode == IR_UDIV) {
+                inst->opcode = IR_SHR;
+                ir_set_operand(inst, 1, constant(c, type, k));
+            } else {
+                inst->opcode = IR_AND;
+                ir_set_operand(inst, 1, constant(c, type, (INT64_C(1) << k) - 1));
+            }
+            return (IRValue*)inst;
+        }
+        default:
+            break;
+    }
+
+    // (p op c1) op c2 = p op (c1 op c2)
+    IRInstruction *inner = defined_by(x, opcode);
+    int64_t inner_constant;
+    if (inner && is_commutative(opcode) && inner->type == type &&
+            int_constant(inner->ops[1].value, &inner_constant)) {
+        IRFoldValue operands[2] = { { .i = inner_constant }, { .i = b } };
+        IRFoldValue folded;
+        if (!ir_fold_instruction(inst, operands, &folded)) return NULL;
+        ir_set_operand(inst, 0, inner->ops[0].value);
+        ir_set_operand(inst, 1, constant(c, type, folded.i));
+        return (IRValue*)inst;
+    }
+    return NULL;
+}
+
+// Trunc and copy to w of a sign extension from w give back the original
+static IRValue *combine_cast(Combiner *c, IRInstruction *inst) {
+    (void)c;
+    IRValue *x = inst->ops[0].value;
+    switch (inst->opcode) {
+        case IR_COPY:
+        case IR_TRUNC:
+        case IR_BITCAST: {
+            if (x->type->kind == inst->type->kind) return x;
+            IRInstruction *ext = defined_by(x, IR_SEXT);
+            if (!ext) ext = defined_by(x, IR_ZEXT);
+            if (ext && ext->ops[0].value->type->kind == inst->type->kind) return ext->ops[0].value;
+            return NULL;
+        }
+        default:
+            return NULL;
+    }
+}
+
+// Compares of sign extensions from w are done in w
+static bool narrow_compare(Combiner *c, IRInstruction *inst) {
+    IRInstruction *left = defined_by(inst->ops[0].value, IR_SEXT);
+    if (!left || left->ops[0].value->type->kind != IR_TYPE_I32) return false;
+    IRValue *narrow = left->ops[0].value;
+    IRInstruction *right = defined_by(inst->ops[1].value, IR_SEXT);
+    int64_t b;
+    if (right && right->ops[0].value->type->kind == IR_TYPE_I32) {
+        ir_set_operand(inst, 1, right->ops[0].value);
+    } else if (int_constant(inst->ops[1].value, &b) && b >= INT32_MIN && b <= INT32_MAX) {
+        ir_set_operand(inst, 1, constant(c, narrow->type, b));
+    } else {
+        return false;
+    }
+    ir_set_operand(inst, 0, narrow);
+    return true;
+}
+
+static IRValue *combine_compare(Combiner *c, IRInstruction *inst) {
+    IRValue *x = inst->ops[0].value;
+    IRValue *y = inst->ops[1].value;
+    IRCmpKind kind = (IRCmpKind)inst->cmp_kind;
+    IRFoldValue unused;
+    if (ir_fold_operand(x, &unused) && !ir_fold_operand(y, &unused)) {
+        swap_operands(inst);
+        inst->cmp_kind = (uint8_t)ir_cmp_swap(kind);
+        return (IRValue*)inst;
+    }
+    if (ir_type_is_float(x->type)) return NULL;
+
+    if (x == y) {
+        bool equal_holds = kind == IR_CMP_EQ || kind == IR_CMP_SLE || kind == IR_CMP_SGE ||
+            kind == IR_CMP_ULE || kind == IR_CMP_UGE;
+        return constant(c, inst->type, equal_holds);
+    }
+    if (narrow_compare(c, inst)) return (IRValue*)inst;
+
+    int bits = ir_type_bits(x->type);
+    int64_t b;
+    if (!int_constant(y, &b)) return NULL;
+    b = ir_fold_normalize(b, bits);
+
+    // !cmp is the inverted compare, and cmp != 0 is cmp itself
+    IRInstruction *inner = defined_by(x, IR_CMP);
+    if (inner && b == 0 && (kind == IR_CMP_EQ || kind == IR_CMP_NE)) {
+        if (kind == IR_CMP_NE) return fits(x, inst->type) ? x : NULL;
+        if (ir_type_is_float(inner->ops[0].value->type)) return NULL;
+        IRInstruction *inverted = (IRInstruction*)emit(c, IR_CMP, inst->type, inner->ops[0].value, inner->ops[1].value);
+        inverted->cmp_kind = (uint8_t)ir_cmp_invert((IRCmpKind)inner->cmp_kind);
+        return (IRValue*)inverted;
+    }
+
+    // Strict comparisons: x <= c is x < c + 1 unless c is the largest value
+    int64_t max = bits == 32 ? INT32_MAX : INT64_MAX;
+    int64_t min = bits == 32 ? INT32_MIN : INT64_MIN;
+    switch (kind) {
+        case IR_CMP_SLE:
+            if (b == max) return constant(c, inst->type, 1);
+            inst->cmp_kind = IR_CMP_SLT;
+            ir_set_operand(inst, 1, constant(c, x->type, b + 1));
+            return (IRValue*)inst;
+        case IR_CMP_SGE:
+            if (b == min) return constant(c, inst->type, 1);
+            inst->cmp_kind = IR_CMP_SGT;
+            ir_set_operand(inst, 1, constant(c, x->type, b - 1));
+            return (IRValue*)inst;
+        case IR_CMP_ULE:
+            if (b == -1) return constant(c, inst->type, 1);
+            inst->cmp_kind = IR_CMP_ULT;
+            ir_set_operand(inst, 1, constant(c, x->type, b + 1));
+            return (IRValue*)inst;
+        case IR_CMP_UGE:
+            if (b == 0) return constant(c, inst->type, 1);
+            inst->cmp_kind = IR_CMP_UGT;
+            ir_set_operand(inst, 1, constant(c, x->type, b - 1));
+            return (IRValue*)inst;
+        default:
+            return NULL;
+    }
+}
+
+// NULL if nothing applies, the instruction itself if it was rewritten in
+// place, else its replacement
+static IRValue *combine(Combiner *c, IRInstruction *inst) {
+    size_t count = ir_operand_count(inst);
+    if (count > 0 && count <= 2 && inst->opcode != IR_STORE && inst->opcode != IR_GETPTR &&
+            inst->opcode != IR_CALL && inst->opcode != IR_PHI) {
+        IRFoldValue operands[2];
+        bool known = true;
+        for (size_t i = 0; i < count && known; i++) {
+            known = ir_fold_operand(inst->ops[i].value, &operands[i]);
+        }
+        IRFoldValue folded;
+        if (known && ir_fold_instruction(inst, operands, &folded)) return ir_fold_constant(c->func, inst->type, folded);
+    }
+
+    switch (inst->opcode) {
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_DIV:
+        case IR_MOD:
+        case IR_UDIV:
+        case IR_UREM:
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR:
+        case IR_SHL:
+        case IR_SHR:
+        case IR_SAR:
+            if (ir_type_is_float(inst->type)) return NULL;
+            return combine_binary(c, inst);
+        case IR_CMP:
+            return combine_compare(c, inst);
+        case IR_COPY:
+        case IR_TRUNC:
+        case IR_BITCAST:
+            return combine_cast(c, inst);
+        default:
+            return NULL;
+    }
+}
+
+static bool combine_block(IRFunction *func, IRBasicBlock *block) {
+    Combiner c = { .func = func, .block = block };
+    bool changed = false;
+    bool erased = false;
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        IRInstruction *inst = block->instructions[i];
+        if (inst->opcode == IR_NOP || inst->type->kind == IR_TYPE_VOID) continue;
+        c.index = i;
+        IRValue *result;
+        for (int steps = 0; steps < INSTCOMBINE_MAX_ROUNDS; steps++) {
+            result = combine(&c, inst);
+            if (result != (IRValue*)inst) break;
+            changed = true;
+        }
+        i = c.index; // Past anything emitted
+        if (!result || result == (IRValue*)inst) continue;
+        ir_replace_all_uses((IRValue*)inst, result);
+        if (!ir_inst_has_side_effects(inst)) {
+            ir_inst_erase(inst);
+            erased = true;
+        }
+        changed = true;
+    }
+    if (erased) ir_block_compact(block);
+    return changed;
+}
+
+static bool instcombine_run(IRFunction *func) {
+    bool changed = false;
+    for (int round = 0; round < INSTCOMBINE_MAX_ROUNDS; round++) {
+        bool again = false;
+        for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+            again |= combine_block(func, block);
+        }
+        if (!again) break;
+        changed = true;
+    }
+    return changed;
+}
+
+const IRPass ir_pass_instcombine = {
+    .name = "instcombine",
+    .description = "Simplify identities, strength-reduce by constants and canonicalize compares",
+    .run = instcombine_run,
+    .preserves = IR_PRESERVES_CFG,
+};
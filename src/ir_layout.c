@@ -0,0 +1,136 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Block Layout
+//=============================================================================
+
+// Blocks are emitted in list order, and QBE falls through to the next
+// block when it can. Chains are built greedily: each block is followed by
+// its likelier successor (see ir_branch_probability()) if that is still
+// unplaced. When a chain ends, the next one starts at the first unplaced
+// block in the old order, which keeps the lowering's nesting for the rest.
+//
+// Cold blocks come after all others. A block is cold if every edge into
+// it is unlikely or comes from a cold block. Leaving a loop is unlikely
+// for each iteration but happens once per loop, so those edges do not
+// count.
+
+#define UNLIKELY_PROB (IR_PROB_SCALE * 3 / 10)
+
+typedef struct Layout {
+    IRCFG *cfg;
+    IRBasicBlock **order;
+    uint32_t count;
+    bool *placed;
+    bool *cold;
+} Layout;
+
+static bool edge_unlikely(IRCFG *cfg, IRBasicBlock *from, IRBasicBlock *to) {
+    IRInstruction *branch = ir_block_terminator(from);
+    if (branch->opcode != IR_CBR || branch->ops[1].block == branch->ops[2].block) return false;
+    IRLoop *loop = ir_cfg_loop_of(cfg, from);
+    if (loop && !ir_loop_contains(cfg, loop, to)) return false;
+    uint32_t prob = ir_branch_probability(cfg, from);
+    if (branch->ops[2].block == to) prob = IR_PROB_SCALE - prob;
+    return prob < UNLIKELY_PROB;
+}
+
+// In reverse postorder, so a block's forward predecessors are known. Back
+// edges count as cold: a loop is cold exactly when it is entered coldly.
+static void find_cold_blocks(Layout *l) {
+    IRCFG *cfg = l->cfg;
+    bool *visited = calloc(cfg->capacity, sizeof(bool));
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        IRBlockList *preds = &cfg->preds[block->id];
+        bool cold = b > 0;
+        for (uint32_t i = 0; i < preds->count && cold; i++) {
+            IRBasicBlock *pred = preds->items[i];
+            if (visited[pred->id] && !l->cold[pred->id] && !edge_unlikely(cfg, pred, block)) cold = false;
+        }
+        l->cold[block->id] = cold;
+        visited[block->id] = true;
+    }
+    free(visited);
+}
+
+// The successor to fall through to: the likelier one if it is free
+static IRBasicBlock *next_in_chain(Layout *l, IRBasicBlock *block) {
+    IRInstruction *branch = ir_block_terminator(block);
+    IRBasicBlock *succs[2] = { NULL, NULL };
+    if (branch->opcode == IR_BR) {
+        succs[0] = branch->ops[0].block;
+    } else if (branch->opcode == IR_CBR) {
+        bool true_first = ir_branch_probability(l->cfg, block) >= IR_PROB_EVEN;
+        succs[0] = branch->ops[true_first ? 1 : 2].block;
+        succs[1] = branch->ops[true_first ? 2 : 1].block;
+    }
+    for (int i = 0; i < 2; i++) {
+        IRBasicBlock *succ = succs[i];
+        if (succ && !l->placed[succ->id] && l->cold[succ->id] == l->cold[block->id]) return succ;
+    }
+    return NULL;
+}
+
+static void place_chain(Layout *l, IRBasicBlock *block) {
+    while (block) {
+        l->placed[block->id] = true;
+        l->order[l->count++] = block;
+        block = next_in_chain(l, block);
+    }
+}
+
+static bool layout_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+
+    Layout l = { .cfg = cfg };
+    uint32_t block_count = 0;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        block_count++;
+    }
+    l.order = malloc(sizeof(IRBasicBlock*) * block_count);
+    l.placed = calloc(cfg->capacity, sizeof(bool));
+    l.cold = calloc(cfg->capacity, sizeof(bool));
+    find_cold_blocks(&l);
+
+    for (int cold = 0; cold < 2; cold++) {
+        for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+            if (!l.placed[block->id] && ir_block_reachable(cfg, block) && l.cold[block->id] == cold) {
+                place_chain(&l, block);
+            }
+        }
+    }
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        if (!l.placed[block->id]) l.order[l.count++] = block;
+    }
+
+    bool changed = false;
+    IRBasicBlock *block = func->blocks;
+    for (uint32_t i = 0; i < l.count; i++, block = block->next) {
+        if (l.order[i] != block) changed = true;
+    }
+    if (changed) {
+        for (uint32_t i = 0; i + 1 < l.count; i++) {
+            l.order[i]->next = l.order[i + 1];
+        }
+        l.order[l.count - 1]->next = NULL;
+        func->blocks = l.order[0];
+        func->last_block = l.order[l.count - 1];
+    }
+
+    free(l.order);
+    free(l.placed);
+    free(l.cold);
+    return changed;
+}
+
+const IRPass ir_pass_layout = {
+    .name = "layout",
+    .description = "Order blocks so likely successors fall through and cold code goes last",
+    .run = layout_run,
+    .preserves = IR_PRESERVES_CFG,
+};
@@ -0,0 +1,123 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Loop-Invariant Code Motion
+//=============================================================================
+
+// Every loop gets a preheader, then instructions whose operands are all
+// defined outside the loop move there, innermost loops first so values can
+// climb several levels. Only instructions that cannot trap are moved: the
+// preheader runs even when the loop body would not. That includes calls
+// to pure functions.
+
+// A stack slot whose address is only ever loaded from or stored to. Calls
+// and stores through other pointers cannot reach it.
+static bool slot_is_private(IRInstruction *alloc) {
+    for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        if (user->opcode == IR_LOAD) continue;
+        if (user->opcode == IR_STORE && user->ops[1].value == (IRValue*)alloc &&
+            user->ops[0].value != (IRValue*)alloc) {
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+static bool stored_in_loop(IRCFG *cfg, IRLoop *loop, IRInstruction *alloc) {
+    for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        if (user->opcode == IR_STORE && ir_loop_contains(cfg, loop, user->block)) return true;
+    }
+    return false;
+}
+
+static bool can_hoist(IRCFG *cfg, IRLoop *loop, IRInstruction *inst) {
+    if (inst->type->kind == IR_TYPE_VOID || ir_inst_has_side_effects(inst)) return false;
+    switch (inst->opcode) {
+        case IR_PHI:
+        case IR_ALLOC:
+            return false;
+        case IR_CALL:
+            // A pure callee gives the same result for the same arguments,
+            // and always returns, so running it early is harmless
+            return (inst->ops[0].call->callee_attrs & IR_ATTRS_PURE) == IR_ATTRS_PURE;
+        case IR_LOAD: {
+            // Stack slots can always be read, so their loads are safe to
+            // run early as long as nothing in the loop writes the slot
+            IRValue *address = inst->ops[0].value;
+            if (address->kind != IR_VALUE_INST) return false;
+            IRInstruction *alloc = (IRInstruction*)address;
+            return alloc->opcode == IR_ALLOC && slot_is_private(alloc) && !stored_in_loop(cfg, loop, alloc);
+        }
+        default:
+            return true;
+    }
+}
+
+static bool is_invariant(IRCFG *cfg, IRLoop *loop, IRInstruction *inst) {
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        IRValue *value = ir_get_operand(inst, i);
+        if (value->kind != IR_VALUE_INST) continue;
+        if (ir_loop_contains(cfg, loop, ((IRInstruction*)value)->block)) return false;
+    }
+    return true;
+}
+
+static int compare_rpo(const void *a, const void *b, void *arg) {
+    IRCFG *cfg = arg;
+    uint32_t x = cfg->rpo_index[(*(IRBasicBlock *const *)a)->id];
+    uint32_t y = cfg->rpo_index[(*(IRBasicBlock *const *)b)->id];
+    return (x > y) - (x < y);
+}
+
+static bool hoist_loop(IRCFG *cfg, IRLoop *loop, IRBasicBlock *preheader) {
+    // Visit definitions before uses, so chains of invariants move together
+    IRBasicBlock **blocks = malloc(sizeof(IRBasicBlock*) * loop->block_count);
+    for (uint32_t i = 0; i < loop->block_count; i++) {
+        blocks[i] = loop->blocks[i];
+    }
+    qsort_r(blocks, loop->block_count, sizeof(IRBasicBlock*), compare_rpo, cfg);
+
+    bool changed = false;
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        IRBasicBlock *block = blocks[b];
+        for (uint32_t i = 0; i < block->inst_count;) {
+            IRInstruction *inst = block->instructions[i];
+            if (!can_hoist(cfg, loop, inst) || !is_invariant(cfg, loop, inst)) {
+                i++;
+                continue;
+            }
+            ir_inst_move(inst, preheader, preheader->inst_count - 1);
+            changed = true;
+        }
+    }
+    free(blocks);
+    return changed;
+}
+
+static bool licm_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = ir_loops_insert_preheaders(func);
+
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+    for (uint32_t l = cfg->loop_count; l-- > 0;) {
+        IRLoop *loop = cfg->loops[l];
+        IRBasicBlock *preheader = ir_loop_preheader(cfg, loop);
+        if (!preheader) continue; // Headed by the entry block
+        changed |= hoist_loop(cfg, loop, preheader);
+    }
+    return changed;
+}
+
+const IRPass ir_pass_licm = {
+    .name = "licm",
+    .description = "Hoist loop-invariant computations into loop preheaders",
+    .run = licm_run,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,343 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Promote Stack Slots to SSA Values
+//=============================================================================
+
+// Classic SSA construction (Cytron et al.): phis go on the iterated
+// dominance frontier of each slot's stores, then a walk over the dominator
+// tree replaces every load with the value reaching it.
+
+#define NO_SLOT UINT32_MAX
+
+typedef struct Slot {
+    IRInstruction *alloc;
+    IRValue *current;  // Reaching value during the rename walk
+    IRValue *zero;     // Value of a load that no store reaches
+} Slot;
+
+// Entry in the rename walk's undo log
+typedef struct SlotDef {
+    uint32_t slot;
+    IRValue *previous;
+} SlotDef;
+
+typedef struct Mem2Reg {
+    IRFunction *func;
+    IRCFG *cfg;
+    Slot *slots;
+    uint32_t slot_count;
+    uint32_t *slot_of;      // Indexed by instruction id, NO_SLOT for others
+    uint32_t id_limit;      // Size of slot_of
+    SlotDef *log;
+    size_t log_count;
+    size_t log_capacity;
+} Mem2Reg;
+
+// An alloc can be promoted if it is only loaded from and stored to with
+// its own type, never escaping as a value
+static bool promotable(IRInstruction *alloc) {
+    if (alloc->type->kind == IR_TYPE_VOID) return false;
+    for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        if (user->opcode == IR_LOAD) {
+            if (user->type->kind != alloc->type->kind) return false;
+        } else if (user->opcode == IR_STORE) {
+            if (user->ops[0].value == (IRValue*)alloc) return false;
+            if (user->ops[0].value->type->kind != alloc->type->kind) return false;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t slot_of_value(Mem2Reg *m, IRValue *value) {
+    if (!value || value->kind != IR_VALUE_INST || value->id >= m->id_limit) return NO_SLOT;
+    uint32_t slot = m->slot_of[value->id];
+    if (slot == NO_SLOT || (IRValue*)m->slots[slot].alloc != value) return NO_SLOT;
+    return slot;
+}
+
+// Phis created here get ids above those of the original instructions
+static uint32_t slot_of_phi(Mem2Reg *m, IRInstruction *phi) {
+    if (phi->opcode != IR_PHI || phi->id >= m->id_limit) return NO_SLOT;
+    return m->slot_of[phi->id];
+}
+
+static IRValue *slot_zero(Mem2Reg *m, Slot *slot) {
+    if (!slot->zero) {
+        IRType *type = slot->alloc->type;
+        slot->zero = (type->kind == IR_TYPE_F32 || type->kind == IR_TYPE_F64) ?
+            ir_const_float(m->func, type, 0.0) : ir_const_int(m->func, type, 0);
+    }
+    return slot->zero;
+}
+
+static IRValue *slot_value(Mem2Reg *m, uint32_t slot) {
+    return m->slots[slot].current ? m->slots[slot].current : slot_zero(m, &m->slots[slot]);
+}
+
+static void slot_define(Mem2Reg *m, uint32_t slot, IRValue *value) {
+    if (m->log_count == m->log_capacity) {
+        m->log_capacity = m->log_capacity ? m->log_capacity * 2 : 64;
+        m->log = realloc(m->log, sizeof(SlotDef) * m->log_capacity);
+    }
+    m->log[m->log_count].slot = slot;
+    m->log[m->log_count].previous = m->slots[slot].current;
+    m->log_count++;
+    m->slots[slot].current = value;
+}
+
+static void collect_slots(Mem2Reg *m) {
+    IRFunction *func = m->func;
+    m->id_limit = func->temp_counter;
+    m->slot_of = malloc(sizeof(uint32_t) * (m->id_limit ? m->id_limit : 1));
+    memset(m->slot_of, 0xff, sizeof(uint32_t) * m->id_limit);
+
+    size_t capacity = 0;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->opcode != IR_ALLOC || !promotable(inst)) continue;
+            if (m->slot_count == capacity) {
+                capacity = capacity ? capacity * 2 : 16;
+                m->slots = realloc(m->slots, sizeof(Slot) * capacity);
+            }
+            m->slot_of[inst->id] = m->slot_count;
+            m->slots[m->slot_count++] = (Slot){ .alloc = inst };
+        }
+    }
+}
+
+// Place phis for every slot on the iterated dominance frontier of the
+// blocks that store to it
+static void insert_phis(Mem2Reg *m) {
+    IRCFG *cfg = m->cfg;
+    IRBlockList *frontiers = ir_cfg_frontiers(cfg);
+    uint32_t capacity = cfg->capacity ? cfg->capacity : 1;
+    uint32_t *has_phi = calloc(capacity, sizeof(uint32_t));   // Last slot + 1
+    uint32_t *queued = calloc(capacity, sizeof(uint32_t));
+    IRBasicBlock **worklist = malloc(sizeof(IRBasicBlock*) * capacity);
+    IRInstruction **phis = NULL;
+    uint32_t *phi_slots = NULL;
+    size_t phi_count = 0, phi_capacity = 0;
+
+    for (uint32_t s = 0; s < m->slot_count; s++) {
+        IRInstruction *alloc = m->slots[s].alloc;
+        uint32_t top = 0;
+        for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+            IRBasicBlock *block = ir_use_user(use)->block;
+            if (ir_use_user(use)->opcode != IR_STORE || !ir_block_reachable(cfg, block)) continue;
+            if (queued[block->id] != s + 1) {
+                queued[block->id] = s + 1;
+                worklist[top++] = block;
+            }
+        }
+        while (top > 0) {
+            IRBlockList *frontier = &frontiers[worklist[--top]->id];
+            for (uint32_t i = 0; i < frontier->count; i++) {
+                IRBasicBlock *join = frontier->items[i];
+                if (has_phi[join->id] == s + 1) continue;
+                has_phi[join->id] = s + 1;
+
+                IRInstruction *phi = ir_inst_insert(join, 0, IR_PHI, alloc->type);
+                if (phi_count == phi_capacity) {
+                    phi_capacity = phi_capacity ? phi_capacity * 2 : 16;
+                    phis = realloc(phis, sizeof(IRInstruction*) * phi_capacity);
+                    phi_slots = realloc(phi_slots, sizeof(uint32_t) * phi_capacity);
+                }
+                phis[phi_count] = phi;
+                phi_slots[phi_count++] = s;
+
+                if (queued[join->id] != s + 1) {
+                    queued[join->id] = s + 1;
+                    worklist[top++] = join;
+                }
+            }
+        }
+    }
+
+    // Extend the id map over the new phis
+    uint32_t limit = m->func->temp_counter;
+    m->slot_of = realloc(m->slot_of, sizeof(uint32_t) * (limit ? limit : 1));
+    memset(m->slot_of + m->id_limit, 0xff, sizeof(uint32_t) * (limit - m->id_limit));
+    m->id_limit = limit;
+    for (size_t i = 0; i < phi_count; i++) {
+        m->slot_of[phis[i]->id] = phi_slots[i];
+    }
+
+    free(has_phi);
+    free(queued);
+    free(worklist);
+    free(phis);
+    free(phi_slots);
+}
+
+// Rewrite the loads and stores of one block against the reaching values
+static void rename_block(Mem2Reg *m, IRBasicBlock *block) {
+    for (uint32_t i = 0; i < block->inst_count; i++) {
+        IRInstruction *inst = block->instructions[i];
+        uint32_t slot;
+        if (inst->opcode == IR_PHI && (slot = slot_of_phi(m, inst)) != NO_SLOT) {
+            slot_define(m, slot, (IRValue*)inst);
+        } else if (inst->opcode == IR_LOAD && (slot = slot_of_value(m, inst->ops[0].value)) != NO_SLOT) {
+            ir_replace_all_uses((IRValue*)inst, slot_value(m, slot));
+            ir_inst_erase(inst);
+        } else if (inst->opcode == IR_STORE && (slot = slot_of_value(m, inst->ops[1].value)) != NO_SLOT) {
+            slot_define(m, slot, inst->ops[0].value);
+            ir_inst_erase(inst);
+        }
+    }
+}
+
+// Give the phis at the start of each successor their value for this edge
+static void fill_successor_phis(Mem2Reg *m, IRBasicBlock *block) {
+    size_t count = ir_block_succ_count(block);
+    for (size_t i = 0; i < count; i++) {
+        IRBasicBlock *succ = ir_block_succ(block, i);
+        if (i > 0 && succ == ir_block_succ(block, 0)) continue; // One entry per predecessor
+        for (uint32_t j = 0; j < succ->inst_count; j++) {
+            IRInstruction *phi = succ->instructions[j];
+            if (phi->opcode != IR_PHI) break;
+            uint32_t slot = slot_of_phi(m, phi);
+            if (slot != NO_SLOT) {
+                ir_phi_add_incoming(m->func, phi, slot_value(m, slot), block);
+            }
+        }
+    }
+}
+
+static void rename_slots(Mem2Reg *m) {
+    IRCFG *cfg = m->cfg;
+    if (!cfg->rpo_count) return;
+
+    // Iterative preorder walk of the dominator tree; each frame remembers
+    // where its block's definitions start in the undo log
+    typedef struct Frame { IRBasicBlock *block; uint32_t next_child; size_t log_mark; } Frame;
+    Frame *stack = malloc(sizeof(Frame) * cfg->rpo_count);
+    uint32_t depth = 0;
+
+    IRBasicBlock *entry = cfg->rpo[0];
+    stack[depth++] = (Frame){ entry, 0, m->log_count };
+    rename_block(m, entry);
+    fill_successor_phis(m, entry);
+
+    while (depth > 0) {
+        Frame *frame = &stack[depth - 1];
+        IRBlockList *children = &cfg->dom_children[frame->block->id];
+        if (frame->next_child < children->count) {
+            IRBasicBlock *child = children->items[frame->next_child++];
+            stack[depth++] = (Frame){ child, 0, m->log_count };
+            rename_block(m, child);
+            fill_successor_phis(m, child);
+        } else {
+            while (m->log_count > frame->log_mark) {
+                SlotDef *def = &m->log[--m->log_count];
+                m->slots[def->slot].current = def->previous;
+            }
+            depth--;
+        }
+    }
+    free(stack);
+
+    // Unreachable code sees no stores; its edges into reachable joins
+    // still need phi entries
+    for (IRBasicBlock *block = m->func->blocks; block; block = block->next) {
+        if (ir_block_reachable(cfg, block)) continue;
+        rename_block(m, block);
+        fill_successor_phis(m, block);
+        while (m->log_count > 0) {
+            SlotDef *def = &m->log[--m->log_count];
+            m->slots[def->slot].current = def->previous;
+        }
+    }
+}
+
+// Drop the phis placed here whose value ended up unused. Liveness is
+// marked from the other instructions, so cycles of phis that only feed
+// each other (a variable carried around a loop but never read) go too.
+static void remove_dead_phis(Mem2Reg *m) {
+    bool *live = calloc(m->func->temp_counter ? m->func->temp_counter : 1, sizeof(bool));
+    size_t capacity = 64, top = 0;
+    IRInstruction **work = malloc(sizeof(IRInstruction*) * capacity);
+    for (IRBasicBlock *block = m->func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count && block->instructions[i]->opcode == IR_PHI; i++) {
+            IRInstruction *phi = block->instructions[i];
+            if (slot_of_phi(m, phi) == NO_SLOT) continue;
+            for (IRUse *use = phi->uses; use; use = ir_use_next(use)) {
+                if (slot_of_phi(m, ir_use_user(use)) != NO_SLOT) continue;
+                live[phi->id] = true;
+                if (top == capacity) {
+                    capacity *= 2;
+                    work = realloc(work, sizeof(IRInstruction*) * capacity);
+                }
+                work[top++] = phi;
+                break;
+            }
+        }
+    }
+
+    while (top > 0) {
+        IRInstruction *phi = work[--top];
+        size_t count = ir_operand_count(phi);
+        for (size_t i = 0; i < count; i++) {
+            IRValue *value = ir_get_operand(phi, i);
+            if (!value || value->kind != IR_VALUE_INST || live[value->id]) continue;
+            IRInstruction *input = (IRInstruction*)value;
+            if (slot_of_phi(m, input) == NO_SLOT) continue;
+            live[input->id] = true;
+            if (top == capacity) {
+                capacity *= 2;
+                work = realloc(work, sizeof(IRInstruction*) * capacity);
+            }
+            work[top++] = input;
+        }
+    }
+
+    for (IRBasicBlock *block = m->func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *phi = block->instructions[i];
+            if (phi->opcode == IR_NOP) continue; // Erased just before
+            if (phi->opcode != IR_PHI) break;
+            if (slot_of_phi(m, phi) != NO_SLOT && !live[phi->id]) ir_inst_erase(phi);
+        }
+    }
+    free(live);
+    free(work);
+}
+
+static bool mem2reg_run(IRFunction *func) {
+    Mem2Reg m = { .func = func };
+    collect_slots(&m);
+    if (m.slot_count == 0) {
+        free(m.slot_of);
+        return false;
+    }
+
+    m.cfg = ir_cfg_get(func);
+    insert_phis(&m);
+    rename_slots(&m);
+    for (uint32_t s = 0; s < m.slot_count; s++) {
+        ir_inst_erase(m.slots[s].alloc);
+    }
+    remove_dead_phis(&m);
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        ir_block_compact(block);
+    }
+
+    free(m.slots);
+    free(m.slot_of);
+    free(m.log);
+    return true;
+}
+
+const IRPass ir_pass_mem2reg = {
+    .name = "mem2reg",
+    .description = "Promote stack slots that are only loaded and stored to SSA values",
+    .run = mem2reg_run,
+    .preserves = IR_PRESERVES_CFG,
+};
@@ -0,0 +1,429 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Memory Optimization
+//=============================================================================
+
+// Loads and stores mem2reg could not promote, using the alias analysis.
+//
+// Forwarding: a store leaves its value available at its address and a
+// load leaves what it read. Availability is computed forwards across the
+// CFG, as available expressions with one bit per access; a store kills
+// the accesses it may alias and a call those it can reach, unless the
+// callee is known to write nothing. A load whose address must alias an
+// available access is replaced by that value: a stored value forwarded,
+// or a redundant load reused. The access executes on every path to the
+// load, so its value dominates the load.
+//
+// Dead stores: computed backwards, an access is overwritten if on every
+// path its bytes are stored again, or the frame holding them is popped,
+// before anything may read them. A store whose own bytes are overwritten
+// right after it is deleted.
+
+#define MEMOPT_MAX_ACCESSES 1024
+#define NO_ACCESS UINT32_MAX
+
+typedef struct Access {
+    IRInstruction *inst;
+    IRValue *address;
+    uint32_t size;
+} Access;
+
+typedef struct MemOpt {
+    IRFunction *func;
+    IRCFG *cfg;
+    Access *accesses;
+    uint32_t access_count;
+    uint32_t *first_access;  // Per block: its loads and stores in order, up
+    uint32_t *end_access;    // to the end; empty if the block is not tracked
+    uint64_t *call_visible;  // Accesses any call may read or write
+    uint64_t *in_frame;      // Stores into allocs, dead once the function returns
+    uint32_t words;          // Per access set
+    uint64_t *gen;           // Per block
+    uint64_t *kill;
+    uint64_t *in;
+    uint64_t *out;
+    IRValue **replaced;      // By instruction id: what a forwarded load became
+} MemOpt;
+
+static uint64_t *set_of(MemOpt *m, uint64_t *sets, uint32_t index) {
+    return &sets[(size_t)index * m->words];
+}
+
+static void set_add(uint64_t *set, uint32_t bit) {
+    set[bit / 64] |= UINT64_C(1) << (bit % 64);
+}
+
+static bool set_has(const uint64_t *set, uint32_t bit) {
+    return (set[bit / 64] >> (bit % 64)) & 1;
+}
+
+static void set_fill(MemOpt *m, uint64_t *set, uint64_t word) {
+    for (uint32_t w = 0; w < m->words; w++) {
+        set[w] = word;
+    }
+}
+
+// Accesses `inst` may overwrite (stores, `writes`) or read (loads); calls
+// may do either to whatever they can reach, less what the callee is known
+// to leave alone
+static void add_clobbered(MemOpt *m, IRInstruction *inst, bool writes, uint64_t *set) {
+    if (inst->opcode == IR_CALL) {
+        uint32_t attrs = inst->ops[0].call->callee_attrs;
+        if ((attrs & IR_ATTR_READNONE) || (writes && (attrs & IR_ATTR_READONLY))) return;
+        for (uint32_t w = 0; w < m->words; w++) {
+            set[w] |= m->call_visible[w];
+        }
+        // Private slots are reachable only through pointers passed in
+        for (uint32_t j = 0; j < m->access_count && inst->ops[0].call->arg_count; j++) {
+            if (!set_has(m->call_visible, j) && ir_call_may_access(inst, m->accesses[j].address)) set_add(set, j);
+        }
+        return;
+    }
+    IRValue *address = ir_mem_address(inst);
+    uint32_t size = ir_mem_access_size(inst);
+    for (uint32_t j = 0; j < m->access_count; j++) {
+        Access *other = &m->accesses[j];
+        if (ir_alias(other->address, other->size, address, size) != IR_NO_ALIAS) set_add(set, j);
+    }
+}
+
+// Whether every byte of `inner` is written by a store to `outer`
+static bool covers(Access *outer, Access *inner) {
+    if (outer->address == inner->address) return outer->size >= inner->size;
+    IRMemLoc lo = ir_mem_loc(outer->address);
+    IRMemLoc li = ir_mem_loc(inner->address);
+    if (lo.base != li.base || !lo.offset_known || !li.offset_known) {
+        return ir_alias(outer->address, outer->size, inner->address, inner->size) == IR_MUST_ALIAS;
+    }
+    return lo.offset <= li.offset && li.offset + inner->size <= lo.offset + outer->size;
+}
+
+static void clear_bits(MemOpt *m, uint64_t *gen, uint64_t *kill, const uint64_t *bits) {
+    for (uint32_t w = 0; w < m->words; w++) {
+        gen[w] &= ~bits[w];
+        kill[w] |= bits[w];
+    }
+}
+
+// Index of the next load or store walking the block forwards; void
+// instructions share an id, so accesses are numbered by position
+static uint32_t next_access(IRInstruction *inst, uint32_t *cursor, uint32_t end) {
+    if (!ir_mem_address(inst) || *cursor == end) return NO_ACCESS;
+    return (*cursor)++;
+}
+
+static uint32_t prev_access(IRInstruction *inst, uint32_t *cursor, uint32_t first) {
+    if (!ir_mem_address(inst) || *cursor == first) return NO_ACCESS;
+    return --(*cursor);
+}
+
+// Step `inst`, access `index`, into a summary gen | (set & ~kill) of the
+// accesses available after it; with a scratch `kill`, steps a concrete
+// set held in `gen`
+static void forward_step(MemOpt *m, IRInstruction *inst, uint32_t index, uint64_t *gen, uint64_t *kill,
+                         uint64_t *scratch) {
+    if (inst->opcode == IR_STORE || inst->opcode == IR_CALL) {
+        memset(scratch, 0, sizeof(uint64_t) * m->words);
+        add_clobbered(m, inst, true, scratch);
+        clear_bits(m, gen, kill, scratch);
+    }
+    if (index != NO_ACCESS) set_add(gen, index);
+}
+
+// Step `inst` backwards into a summary of the accesses overwritten after it
+static void backward_step(MemOpt *m, IRInstruction *inst, uint64_t *gen, uint64_t *kill, uint64_t *scratch) {
+    if (inst->opcode == IR_RET) {
+        memcpy(gen, m->in_frame, sizeof(uint64_t) * m->words);
+        set_fill(m, kill, UINT64_MAX);
+    } else if (inst->opcode == IR_LOAD || inst->opcode == IR_CALL) {
+        memset(scratch, 0, sizeof(uint64_t) * m->words);
+        add_clobbered(m, inst, false, scratch);
+        clear_bits(m, gen, kill, scratch);
+    } else if (inst->opcode == IR_STORE) {
+        Access store = { inst, ir_mem_address(inst), ir_mem_access_size(inst) };
+        for (uint32_t j = 0; j < m->access_count; j++) {
+            Access *other = &m->accesses[j];
+            if (other->inst->opcode == IR_STORE && covers(&store, other)) set_add(gen, j);
+        }
+    }
+}
+
+static void summarize_blocks(MemOpt *m, bool forward) {
+    uint64_t *scratch = malloc(sizeof(uint64_t) * m->words);
+    for (uint32_t b = 0; b < m->cfg->rpo_count; b++) {
+        IRBasicBlock *block = m->cfg->rpo[b];
+        uint64_t *gen = set_of(m, m->gen, block->id);
+        uint64_t *kill = set_of(m, m->kill, block->id);
+        set_fill(m, gen, 0);
+        set_fill(m, kill, 0);
+        if (forward) {
+            uint32_t cursor = m->first_access[block->id];
+            for (uint32_t i = 0; i < block->inst_count; i++) {
+                IRInstruction *inst = block->instructions[i];
+                forward_step(m, inst, next_access(inst, &cursor, m->end_access[block->id]), gen, kill, scratch);
+            }
+        } else {
+            for (uint32_t i = block->inst_count; i-- > 0;) {
+                backward_step(m, block->instructions[i], gen, kill, scratch);
+            }
+        }
+    }
+    free(scratch);
+}
+
+// Meet over `neighbours` into `meet`, then apply the block's summary into
+// `result`; returns whether `result` changed
+static bool apply_block(MemOpt *m, IRBasicBlock *block, IRBlockList *neighbours, uint64_t *neighbour_sets,
+                        uint64_t *meet, uint64_t *result) {
+    set_fill(m, meet, neighbours->count ? UINT64_MAX : 0);
+    for (uint32_t i = 0; i < neighbours->count; i++) {
+        uint64_t *set = set_of(m, neighbour_sets, neighbours->items[i]->id);
+        for (uint32_t w = 0; w < m->words; w++) {
+            meet[w] &= set[w];
+        }
+    }
+    uint64_t *gen = set_of(m, m->gen, block->id);
+    uint64_t *kill = set_of(m, m->kill, block->id);
+    bool changed = false;
+    for (uint32_t w = 0; w < m->words; w++) {
+        uint64_t value = gen[w] | (meet[w] & ~kill[w]);
+        if (value != result[w]) {
+            result[w] = value;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// Greatest fixed point: every set starts full, so a loop keeps what it
+// does not kill
+static void solve(MemOpt *m, bool forward) {
+    IRCFG *cfg = m->cfg;
+    size_t block_sets = (size_t)cfg->capacity * m->words;
+    for (size_t w = 0; w < block_sets; w++) {
+        m->in[w] = m->out[w] = UINT64_MAX;
+    }
+    IRBlockList none = { 0 };
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+            IRBasicBlock *block = cfg->rpo[forward ? b : cfg->rpo_count - 1 - b];
+            uint64_t *in = set_of(m, m->in, block->id);
+            uint64_t *out = set_of(m, m->out, block->id);
+            if (forward) {
+                IRBlockList *preds = block == cfg->rpo[0] ? &none : &cfg->preds[block->id];
+                changed |= apply_block(m, block, preds, m->out, in, out);
+            } else {
+                changed |= apply_block(m, block, &cfg->succs[block->id], m->in, out, in);
+            }
+        }
+    }
+}
+
+static IRValue *resolve(MemOpt *m, IRValue *value) {
+    while (value->kind == IR_VALUE_INST && m->replaced[value->id]) {
+        value = m->replaced[value->id];
+    }
+    return value;
+}
+
+// Value `load` would read from the available access, NULL if its type
+// does not match. Constants are retyped; the sizes are already equal.
+static IRValue *forwarded_value(MemOpt *m, Access *access, IRInstruction *load) {
+    IRInstruction *inst = access->inst;
+    // Erased loads are NOPs by now
+    IRValue *value = resolve(m, inst->opcode == IR_STORE ? inst->ops[0].value : (IRValue*)inst);
+    if (value->type->kind == load->type->kind) return value;
+    IRFoldValue constant;
+    if (ir_type_is_float(value->type) || ir_type_is_float(load->type) || !ir_fold_operand(value, &constant)) {
+        return NULL;
+    }
+    return ir_const_int(m->func, load->type, ir_fold_normalize(constant.i, ir_type_bits(load->type)));
+}
+
+static IRValue *find_available(MemOpt *m, const uint64_t *available, IRInstruction *load) {
+    IRValue *address = load->ops[0].value;
+    uint32_t size = ir_mem_access_size(load);
+    for (uint32_t j = 0; j < m->access_count; j++) {
+        Access *access = &m->accesses[j];
+        if (!set_has(available, j) || access->inst == load) continue;
+        if (ir_alias(access->address, access->size, address, size) != IR_MUST_ALIAS) continue;
+        IRValue *value = forwarded_value(m, access, load);
+        if (value) return value;
+    }
+    return NULL;
+}
+
+static bool forward_loads(MemOpt *m) {
+    summarize_blocks(m, true);
+    solve(m, true);
+
+    IRCFG *cfg = m->cfg;
+    uint64_t *available = malloc(sizeof(uint64_t) * m->words);
+    uint64_t *kill = malloc(sizeof(uint64_t) * m->words);
+    uint64_t *scratch = malloc(sizeof(uint64_t) * m->words);
+    IRBlockList none = { 0 };
+    bool changed = false;
+
+    // Dominators come first in reverse postorder, so a forwarded value
+    // that was itself a load is already resolved
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        IRBlockList *preds = b == 0 ? &none : &cfg->preds[block->id];
+        set_fill(m, available, preds->count ? UINT64_MAX : 0);
+        for (uint32_t i = 0; i < preds->count; i++) {
+            uint64_t *set = set_of(m, m->out, preds->items[i]->id);
+            for (uint32_t w = 0; w < m->words; w++) {
+                available[w] &= set[w];
+            }
+        }
+
+        bool erased = false;
+        uint32_t cursor = m->first_access[block->id];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            IRValue *value = inst->opcode == IR_LOAD ? find_available(m, available, inst) : NULL;
+            // A replaced load still leaves its value available, as what it
+            // was replaced with
+            uint32_t index = next_access(inst, &cursor, m->end_access[block->id]);
+            forward_step(m, inst, index, available, kill, scratch);
+            if (value) {
+                m->replaced[inst->id] = value;
+                ir_replace_all_uses((IRValue*)inst, value);
+                ir_inst_erase(inst);
+                erased = true;
+            }
+        }
+        if (erased) {
+            ir_block_compact(block);
+            changed = true;
+        }
+    }
+
+    free(available);
+    free(kill);
+    free(scratch);
+    return changed;
+}
+
+static bool remove_dead_stores(MemOpt *m) {
+    summarize_blocks(m, false);
+    solve(m, false);
+
+    IRCFG *cfg = m->cfg;
+    uint64_t *overwritten = malloc(sizeof(uint64_t) * m->words);
+    uint64_t *kill = malloc(sizeof(uint64_t) * m->words);
+    uint64_t *scratch = malloc(sizeof(uint64_t) * m->words);
+    bool changed = false;
+
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        memcpy(overwritten, set_of(m, m->out, block->id), sizeof(uint64_t) * m->words);
+        bool erased = false;
+        uint32_t cursor = m->end_access[block->id];
+        for (uint32_t i = block->inst_count; i-- > 0;) {
+            IRInstruction *inst = block->instructions[i];
+            uint32_t index = prev_access(inst, &cursor, m->first_access[block->id]);
+            bool dead = inst->opcode == IR_STORE && index != NO_ACCESS && set_has(overwritten, index);
+            // A dead store still marks what it covers: those bytes are
+            // overwritten after it as well
+            backward_step(m, inst, overwritten, kill, scratch);
+            if (dead) {
+                ir_inst_erase(inst);
+                erased = true;
+            }
+        }
+        if (erased) {
+            ir_block_compact(block);
+            changed = true;
+        }
+    }
+
+    free(overwritten);
+    free(kill);
+    free(scratch);
+    return changed;
+}
+
+static void collect_accesses(MemOpt *m) {
+    IRCFG *cfg = m->cfg;
+    m->access_count = 0;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        uint32_t first = m->access_count;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            IRValue *address = ir_mem_address(inst);
+            if (!address) continue;
+            // Blocks are tracked whole or not at all
+            if (m->access_count == MEMOPT_MAX_ACCESSES) {
+                m->access_count = first;
+                break;
+            }
+            m->accesses[m->access_count++] = (Access){ inst, address, ir_mem_access_size(inst) };
+        }
+        m->first_access[block->id] = first;
+        m->end_access[block->id] = m->access_count;
+    }
+
+    m->words = (m->access_count + 63) / 64;
+    memset(m->call_visible, 0, sizeof(uint64_t) * m->words);
+    memset(m->in_frame, 0, sizeof(uint64_t) * m->words);
+    for (uint32_t j = 0; j < m->access_count; j++) {
+        Access *access = &m->accesses[j];
+        IRValue *base = ir_mem_loc(access->address).base;
+        bool in_slot = base->kind == IR_VALUE_INST && ((IRInstruction*)base)->opcode == IR_ALLOC;
+        if (!in_slot || ir_alloc_escapes((IRInstruction*)base)) set_add(m->call_visible, j);
+        if (access->inst->opcode == IR_STORE && in_slot) set_add(m->in_frame, j);
+    }
+}
+
+static bool memopt_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    MemOpt m = { .func = func, .cfg = ir_cfg_get(func) };
+    m.first_access = malloc(sizeof(uint32_t) * m.cfg->capacity);
+    m.end_access = malloc(sizeof(uint32_t) * m.cfg->capacity);
+    m.replaced = calloc(func->temp_counter ? func->temp_counter : 1, sizeof(IRValue*));
+    m.accesses = malloc(sizeof(Access) * MEMOPT_MAX_ACCESSES);
+    uint32_t max_words = (MEMOPT_MAX_ACCESSES + 63) / 64;
+    m.call_visible = malloc(sizeof(uint64_t) * max_words);
+    m.in_frame = malloc(sizeof(uint64_t) * max_words);
+    size_t block_sets = (size_t)m.cfg->capacity * max_words;
+    m.gen = malloc(sizeof(uint64_t) * block_sets);
+    m.kill = malloc(sizeof(uint64_t) * block_sets);
+    m.in = malloc(sizeof(uint64_t) * block_sets);
+    m.out = malloc(sizeof(uint64_t) * block_sets);
+
+    bool changed = false;
+    collect_accesses(&m);
+    if (m.access_count > 0) {
+        changed |= forward_loads(&m);
+        // Forwarded loads no longer read what the stores wrote
+        if (changed) collect_accesses(&m);
+        changed |= remove_dead_stores(&m);
+    }
+
+    free(m.first_access);
+    free(m.end_access);
+    free(m.replaced);
+    free(m.accesses);
+    free(m.call_visible);
+    free(m.in_frame);
+    free(m.gen);
+    free(m.kill);
+    free(m.in);
+    free(m.out);
+    return changed;
+}
+
+const IRPass ir_pass_memopt = {
+    .name = "memopt",
+    .description = "Forward stored values to loads and delete redundant loads and dead stores",
+    .run = memopt_run,
+    .preserves = IR_PRESERVES_CFG,
+};
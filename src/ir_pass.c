@@ -0,0 +1,362 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+
+//=============================================================================
+// Verifier
+//=============================================================================
+
+static bool verify_fail(FILE *fp, IRFunction *func, IRBasicBlock *block, const char *message) {
+    if (fp) {
+        fprintf(fp, "Error: invalid IR in %s, block %s.%u: %s\n",
+            func->name, block->name, block->id, message);
+    }
+    return false;
+}
+
+static bool value_in_operands(IRInstruction *user, IRValue *value) {
+    size_t count = ir_operand_count(user);
+    for (size_t i = 0; i < count; i++) {
+        if (ir_get_operand(user, i) == value) return true;
+    }
+    return false;
+}
+
+// NULL if the phi names every predecessor of its block exactly once and
+// nothing else, else what is wrong
+static const char *check_phi_edges(IRCFG *cfg, IRInstruction *phi) {
+    IRBlockList *preds = &cfg->preds[phi->block->id];
+    IRPhiData *data = phi->ops[0].phi;
+    uint32_t count = data ? data->arg_count : 0;
+    for (uint32_t i = 0; i < count; i++) {
+        IRBasicBlock *from = data->args[i].block;
+        bool is_pred = false;
+        for (uint32_t p = 0; p < preds->count && !is_pred; p++) {
+            is_pred = preds->items[p] == from;
+        }
+        if (!is_pred) return "phi names a block that is not a predecessor";
+        for (uint32_t j = 0; j < i; j++) {
+            if (data->args[j].block == from) return "phi names a predecessor twice";
+        }
+    }
+    for (uint32_t p = 0; p < preds->count; p++) {
+        bool named = false;
+        for (uint32_t i = 0; i < count && !named; i++) {
+            named = data->args[i].block == preds->items[p];
+        }
+        if (!named) return "phi is missing a predecessor";
+    }
+    return NULL;
+}
+
+bool ir_verify_function(IRFunction *func, FILE *fp) {
+    IRCFG *cfg = ir_cfg_get(func);
+    // Every operand slot naming an instruction has exactly one use record
+    size_t operand_uses = 0;
+    size_t use_records = 0;
+
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        if (block->function != func) {
+            return verify_fail(fp, func, block, "block belongs to another function");
+        }
+        if (!ir_block_terminator(block)) {
+            return verify_fail(fp, func, block, "block does not end in a terminator");
+        }
+        bool reachable = ir_block_reachable(cfg, block);
+        bool phis_done = false;
+
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->block != block) {
+                return verify_fail(fp, func, block, "instruction has a stale block pointer");
+            }
+            if (i + 1 < block->inst_count &&
+                (inst->opcode == IR_BR || inst->opcode == IR_CBR || inst->opcode == IR_RET)) {
+                return verify_fail(fp, func, block, "terminator before the end of the block");
+            }
+            if (inst->opcode == IR_PHI) {
+                if (phis_done) return verify_fail(fp, func, block, "phi after a non-phi instruction");
+                const char *problem = check_phi_edges(cfg, inst);
+                if (problem) return verify_fail(fp, func, block, problem);
+            } else {
+                phis_done = true;
+            }
+
+            size_t count = ir_operand_count(inst);
+            for (size_t j = 0; j < count; j++) {
+                IRValue *value = ir_get_operand(inst, j);
+                if (!value) {
+                    if (inst->opcode == IR_RET) continue; // ret without a value
+                    return verify_fail(fp, func, block, "missing operand");
+                }
+                if (value->kind != IR_VALUE_INST) continue;
+                operand_uses++;
+
+                IRInstruction *def = (IRInstruction*)value;
+                if (!def->block || def->block->function != func) {
+                    return verify_fail(fp, func, block, "operand is not in this function");
+                }
+                if (!reachable) continue;
+                bool dominated;
+                if (inst->opcode == IR_PHI) {
+                    // Values on edges from unreachable code are never read
+                    IRBasicBlock *from = inst->ops[0].phi->args[j].block;
+                    dominated = !ir_block_reachable(cfg, from) || ir_dominates(cfg, def->block, from);
+                } else {
+                    dominated = ir_inst_dominates(cfg, def, inst);
+                }
+                if (!dominated) {
+                    return verify_fail(fp, func, block, "operand does not dominate its use");
+                }
+            }
+
+            for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+                use_records++;
+                if (!ir_use_user(use)->block || !value_in_operands(ir_use_user(use), (IRValue*)inst)) {
+                    return verify_fail(fp, func, block, "use list names an instruction that does not use the value");
+                }
+            }
+        }
+    }
+
+    if (operand_uses != use_records) {
+        return verify_fail(fp, func, func->entry_block, "use lists out of sync with operands");
+    }
+    return true;
+}
+
+static bool verify_pass_run(IRFunction *func) {
+    if (!ir_verify_function(func, stderr)) {
+        exit(1);
+    }
+    return false;
+}
+
+static const IRPass verify_pass = {
+    .name = "verify",
+    .description = "Check IR invariants and stop on the first violation",
+    .run = verify_pass_run,
+    .preserves = IR_PRESERVES_CFG,
+};
+
+//=============================================================================
+// Registry and Pipelines
+//=============================================================================
+
+static const IRPass *const registry[] = {
+    &verify_pass,
+    &ir_pass_mem2reg,
+    &ir_pass_tailrec,
+    &ir_pass_funcattrs,
+    &ir_pass_inline,
+    &ir_pass_sccp,
+    &ir_pass_instcombine,
+    &ir_pass_gvn,
+    &ir_pass_memopt,
+    &ir_pass_licm,
+    &ir_pass_indvars,
+    &ir_pass_unroll,
+    &ir_pass_rotate,
+    &ir_pass_vrp,
+    &ir_pass_simplifycfg,
+    &ir_pass_dce,
+    &ir_pass_stackcolor,
+    &ir_pass_layout,
+};
+
+#define REGISTRY_SIZE (sizeof(registry) / sizeof(registry[0]))
+
+// Pipelines by -O level. -O0 generates straight-line code for debugging.
+// -O3 cleans up after the loop passes and goes round again: callees they
+// shrank may now fit the inliner, and loops it brings in get optimized.
+static const char *const pipelines[] = {
+    "",
+    "mem2reg,tailrec,sccp,instcombine,gvn,memopt,dce,simplifycfg,stackcolor,layout",
+    "mem2reg,tailrec,sccp,instcombine,funcattrs,gvn,memopt,dce,simplifycfg,inline,sccp,instcombine,funcattrs,gvn,vrp,licm,indvars,unroll,rotate,sccp,instcombine,gvn,memopt,dce,simplifycfg,stackcolor,layout",
+    "mem2reg,tailrec,sccp,instcombine,funcattrs,gvn,memopt,dce,simplifycfg,inline,sccp,instcombine,funcattrs,gvn,vrp,licm,indvars,unroll,sccp,instcombine,gvn,memopt,dce,simplifycfg,"
+        "inline,sccp,instcombine,funcattrs,gvn,vrp,licm,indvars,unroll,rotate,sccp,instcombine,gvn,memopt,dce,simplifycfg,stackcolor,layout",
+};
+
+const IRPass *ir_pass_lookup(const char *name) {
+    for (size_t i = 0; i < REGISTRY_SIZE; i++) {
+        if (strcmp(registry[i]->name, name) == 0) return registry[i];
+    }
+    return NULL;
+}
+
+void ir_pass_list(FILE *fp) {
+    fprintf(fp, "Passes:\n");
+    for (size_t i = 0; i < REGISTRY_SIZE; i++) {
+        fprintf(fp, "  %-16s %s%s\n", registry[i]->name, registry[i]->description,
+            registry[i]->run_module ? " (module)" : "");
+    }
+    fprintf(fp, "Pipelines:\n");
+    for (size_t i = 0; i < sizeof(pipelines) / sizeof(pipelines[0]); i++) {
+        fprintf(fp, "  -O%zu  %s\n", i, pipelines[i][0] ? pipelines[i] : "(none)");
+    }
+}
+
+//=============================================================================
+// Pass Manager
+//=============================================================================
+
+void ir_pass_manager_init(IRPassManager *pm) {
+    pm->passes = NULL;
+    pm->pass_count = 0;
+    pm->pass_capacity = 0;
+    pm->stats = NULL;
+    pm->verify_each = false;
+    pthread_mutex_init(&pm->lock, NULL);
+}
+
+void ir_pass_manager_free(IRPassManager *pm) {
+    free(pm->passes);
+    free(pm->stats);
+    pm->passes = NULL;
+    pm->stats = NULL;
+    pm->pass_count = 0;
+    pm->pass_capacity = 0;
+    pthread_mutex_destroy(&pm->lock);
+}
+
+static void pass_manager_append(IRPassManager *pm, const IRPass *pass) {
+    if (pm->pass_count == pm->pass_capacity) {
+        pm->pass_capacity = pm->pass_capacity ? pm->pass_capacity * 2 : 16;
+        pm->passes = realloc(pm->passes, sizeof(IRPass*) * pm->pass_capacity);
+        pm->stats = realloc(pm->stats, sizeof(IRPassStats) * pm->pass_capacity);
+    }
+    memset(&pm->stats[pm->pass_count], 0, sizeof(IRPassStats));
+    pm->passes[pm->pass_count++] = pass;
+}
+
+bool ir_pass_manager_add_list(IRPassManager *pm, const char *list) {
+    const char *p = list;
+    while (*p) {
+        const char *end = strchr(p, ',');
+        size_t length = end ? (size_t)(end - p) : strlen(p);
+        if (length) {
+            char name[64];
+            const IRPass *pass = NULL;
+            if (length < sizeof(name)) {
+                memcpy(name, p, length);
+                name[length] = '\0';
+                pass = ir_pass_lookup(name);
+            }
+            if (!pass) {
+                fprintf(stderr, "Error: unknown pass '%.*s'\n", (int)length, p);
+                return false;
+            }
+            pass_manager_append(pm, pass);
+        }
+        p += length;
+        if (*p == ',') p++;
+    }
+    return true;
+}
+
+void ir_pass_manager_add_level(IRPassManager *pm, int level) {
+    int max = (int)(sizeof(pipelines) / sizeof(pipelines[0])) - 1;
+    if (level < 0) level = 0;
+    if (level > max) level = max;
+    ir_pass_manager_add_list(pm, pipelines[level]);
+}
+
+size_t ir_function_inst_count(IRFunction *func) {
+    size_t count = 0;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        count += block->inst_count;
+    }
+    return count;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void record(IRPassManager *pm, size_t index, double seconds, bool changed, int64_t delta) {
+    pthread_mutex_lock(&pm->lock);
+    IRPassStats *stats = &pm->stats[index];
+    stats->seconds += seconds;
+    stats->runs++;
+    stats->changed += changed;
+    stats->inst_delta += delta;
+    pthread_mutex_unlock(&pm->lock);
+}
+
+// Stop at the first pass that leaves invalid IR behind
+static void verify_after(const IRPass *pass, IRFunction *func) {
+    if (!func->entry_block || pass == &verify_pass) return;
+    if (!ir_verify_function(func, stderr)) {
+        fprintf(stderr, "Error: pass '%s' left invalid IR in %s\n", pass->name, func->name);
+        exit(1);
+    }
+}
+
+void ir_pass_manager_run_function(IRPassManager *pm, IRFunction *func, size_t begin, size_t end) {
+    size_t before = ir_function_inst_count(func);
+    for (size_t i = begin; i < end; i++) {
+        const IRPass *pass = pm->passes[i];
+        double start = now_seconds();
+        bool changed = pass->run(func);
+        if (changed && !(pass->preserves & IR_PRESERVES_CFG)) {
+            ir_cfg_invalidate(func);
+        }
+        if (pm->verify_each) verify_after(pass, func);
+        double seconds = now_seconds() - start;
+        size_t after = ir_function_inst_count(func);
+        record(pm, i, seconds, changed, (int64_t)after - (int64_t)before);
+        before = after;
+    }
+    // Don't keep analyses alive for thousands of functions waiting to be emitted
+    ir_cfg_invalidate(func);
+}
+
+void ir_pass_manager_run_module(IRPassManager *pm, IRModule *mod, size_t index) {
+    const IRPass *pass = pm->passes[index];
+    size_t before = 0;
+    for (size_t i = 0; i < mod->function_count; i++) {
+        before += ir_function_inst_count(mod->functions[i]);
+    }
+
+    double start = now_seconds();
+    bool changed = pass->run_module(mod);
+    if (changed && !(pass->preserves & IR_PRESERVES_CFG)) {
+        for (size_t i = 0; i < mod->function_count; i++) {
+            ir_cfg_invalidate(mod->functions[i]);
+        }
+    }
+    for (size_t i = 0; pm->verify_each && i < mod->function_count; i++) {
+        verify_after(pass, mod->functions[i]);
+    }
+    double seconds = now_seconds() - start;
+
+    size_t after = 0;
+    for (size_t i = 0; i < mod->function_count; i++) {
+        after += ir_function_inst_count(mod->functions[i]);
+    }
+    record(pm, index, seconds, changed, (int64_t)after - (int64_t)before);
+}
+
+void ir_pass_manager_print_stats(IRPassManager *pm, FILE *fp) {
+    if (pm->pass_count == 0) return;
+
+    // Time is summed over worker threads
+    fprintf(fp, "%-16s %10s %16s %12s\n", "Pass", "Time (ms)", "Changed/Runs", "Instructions");
+    double total = 0;
+    int64_t delta = 0;
+    for (size_t i = 0; i < pm->pass_count; i++) {
+        IRPassStats *stats = &pm->stats[i];
+        char changed[40];
+        snprintf(changed, sizeof(changed), "%zu/%zu", stats->changed, stats->runs);
+        fprintf(fp, "%-16s %10.2f %16s %+12" PRId64 "\n",
+            pm->passes[i]->name, stats->seconds * 1000.0, changed, stats->inst_delta);
+        total += stats->seconds;
+        delta += stats->inst_delta;
+    }
+    fprintf(fp, "%-16s %10.2f %16s %+12" PRId64 "\n", "Total", total * 1000.0, "", delta);
+}
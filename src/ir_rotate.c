@@ -0,0 +1,223 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Loop Rotation
+//=============================================================================
+
+// Loops are lowered with the test at the top: every iteration jumps back to
+// the header, runs the test and branches into the body, two branches where
+// one would do. Rotation copies the header into the preheader, as a guard
+// that skips the loop when it runs no iterations, and into the latch,
+// where it becomes a test at the bottom. Each copy runs exactly when the
+// header would have, so any instruction may be copied.
+//
+// The body block becomes the new header. Values of the old one meet in
+// phis there for uses inside the loop and in the exit block for uses after
+// it. That needs the header to be the only way out of the loop, into an
+// exit block nothing else enters.
+
+#define ROTATE_MAX_HEADER_SIZE 16
+
+typedef struct Rotation {
+    IRFunction *func;
+    IRBasicBlock *preheader;
+    IRBasicBlock *header;
+    IRBasicBlock *latch;
+    IRBasicBlock *body;        // In-loop successor of the header
+    IRBasicBlock *exit;
+    bool *in_loop;             // By block id
+    IRValue **on_entry;        // Header value -> what it is on the first pass
+    IRValue **on_latch;        // Header value -> what it is on later passes
+} Rotation;
+
+static IRValue *incoming(IRInstruction *phi, IRBasicBlock *from) {
+    IRPhiData *data = phi->ops[0].phi;
+    for (uint32_t i = 0; data && i < data->arg_count; i++) {
+        if (data->args[i].block == from) return data->args[i].use.value;
+    }
+    return NULL;
+}
+
+static bool defined_in(IRValue *value, IRBasicBlock *block) {
+    return value && value->kind == IR_VALUE_INST && ((IRInstruction*)value)->block == block;
+}
+
+static bool plan_rotation(IRCFG *cfg, IRLoop *loop, Rotation *r) {
+    IRBasicBlock *header = loop->header;
+    IRBasicBlock *preheader = ir_loop_preheader(cfg, loop);
+    if (!preheader || loop->latch_count != 1 || loop->latches[0] == header) return false;
+    IRBasicBlock *latch = loop->latches[0];
+    IRInstruction *branch = ir_block_terminator(header);
+    if (ir_block_terminator(latch)->opcode != IR_BR || !branch || branch->opcode != IR_CBR) return false;
+
+    bool stay_on_true = ir_loop_contains(cfg, loop, branch->ops[1].block);
+    IRBasicBlock *body = stay_on_true ? branch->ops[1].block : branch->ops[2].block;
+    IRBasicBlock *exit = stay_on_true ? branch->ops[2].block : branch->ops[1].block;
+    if (!ir_loop_contains(cfg, loop, body) || ir_loop_contains(cfg, loop, exit)) return false;
+    if (cfg->preds[body->id].count != 1 || cfg->preds[exit->id].count != 1) return false;
+
+    // The header is the only exit
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        IRBlockList *succs = &cfg->succs[loop->blocks[b]->id];
+        for (uint32_t i = 0; i < succs->count; i++) {
+            if (!ir_loop_contains(cfg, loop, succs->items[i]) && loop->blocks[b] != header) return false;
+        }
+    }
+
+    // A phi taking a header value from the latch would need the value of
+    // the previous pass through the header, which is gone once it is copied
+    uint32_t size = 0;
+    for (uint32_t i = 0; i + 1 < header->inst_count; i++) {
+        IRInstruction *inst = header->instructions[i];
+        if (inst->opcode != IR_PHI) {
+            size++;
+        } else if (defined_in(incoming(inst, latch), header)) {
+            return false;
+        }
+    }
+    if (size > ROTATE_MAX_HEADER_SIZE) return false;
+
+    *r = (Rotation){ .preheader = preheader, .header = header, .latch = latch, .body = body, .exit = exit };
+    r->in_loop = calloc(cfg->capacity, sizeof(bool));
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        r->in_loop[loop->blocks[b]->id] = true;
+    }
+    return true;
+}
+
+static IRValue *lookup(Rotation *r, IRValue **map, IRValue *value) {
+    if (!defined_in(value, r->header)) return value;
+    return map[value->id];
+}
+
+// Replace the jump at the end of `block` by a copy of the header's
+// instructions and branch
+static void copy_header(Rotation *r, IRBasicBlock *block, IRValue **map) {
+    IRBasicBlock *header = r->header;
+    for (uint32_t i = 0; i < header->inst_count; i++) {
+        IRInstruction *inst = header->instructions[i];
+        if (inst->opcode == IR_PHI) map[inst->id] = incoming(inst, block);
+    }
+    ir_inst_remove(ir_block_terminator(block));
+    for (uint32_t i = 0; i < header->inst_count; i++) {
+        IRInstruction *inst = header->instructions[i];
+        if (inst->opcode == IR_PHI) continue;
+        IRInstruction *clone = ir_inst_clone(block, block->inst_count, inst);
+        if (inst->type->kind != IR_TYPE_VOID) map[inst->id] = (IRValue*)clone;
+        size_t count = ir_operand_count(clone);
+        for (size_t j = 0; j < count; j++) {
+            ir_set_operand(clone, j, lookup(r, map, ir_get_operand(clone, j)));
+        }
+    }
+}
+
+// Phis of `block` took values from the header; they now come from the
+// preheader and the latch
+static void split_entries(Rotation *r, IRBasicBlock *block) {
+    for (uint32_t i = 0; i < block->inst_count && block->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = block->instructions[i];
+        IRValue *value = incoming(phi, r->header);
+        if (!value) continue;
+        ir_phi_remove_incoming(phi, r->header);
+        ir_phi_add_incoming(r->func, phi, lookup(r, r->on_entry, value), r->preheader);
+        ir_phi_add_incoming(r->func, phi, lookup(r, r->on_latch, value), r->latch);
+    }
+}
+
+static IRInstruction *merge_phi(Rotation *r, IRBasicBlock *block, IRInstruction *inst) {
+    IRInstruction *phi = ir_inst_insert(block, 0, IR_PHI, inst->type);
+    ir_phi_add_incoming(r->func, phi, r->on_entry[inst->id], r->preheader);
+    ir_phi_add_incoming(r->func, phi, r->on_latch[inst->id], r->latch);
+    return phi;
+}
+
+// Point the uses of a header value outside the header at phis merging
+// its copies
+static void replace_uses(Rotation *r, IRInstruction *inst) {
+    size_t user_count = 0;
+    for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+        user_count++;
+    }
+    IRInstruction **users = malloc(sizeof(IRInstruction*) * user_count);
+    user_count = 0;
+    for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+        if (ir_use_user(use)->block != r->header) users[user_count++] = ir_use_user(use);
+    }
+
+    IRInstruction *in_loop = NULL;
+    IRInstruction *after = NULL;
+    for (size_t u = 0; u < user_count; u++) {
+        IRInstruction *user = users[u];
+        IRInstruction **phi = r->in_loop[user->block->id] ? &in_loop : &after;
+        if (!*phi) *phi = merge_phi(r, phi == &in_loop ? r->body : r->exit, inst);
+        size_t count = ir_operand_count(user);
+        for (size_t i = 0; i < count; i++) {
+            if (ir_get_operand(user, i) == (IRValue*)inst) ir_set_operand(user, i, (IRValue*)*phi);
+        }
+    }
+    free(users);
+}
+
+static void rotate(Rotation *r) {
+    IRBasicBlock *header = r->header;
+    copy_header(r, r->preheader, r->on_entry);
+    copy_header(r, r->latch, r->on_latch);
+    split_entries(r, r->body);
+    split_entries(r, r->exit);
+
+    // Nothing enters the header any more; it is deleted once the rest of
+    // the function no longer uses its values
+    for (uint32_t i = 0; i < header->inst_count; i++) {
+        IRInstruction *inst = header->instructions[i];
+        if (inst->type->kind != IR_TYPE_VOID && inst->uses) replace_uses(r, inst);
+    }
+}
+
+static bool rotate_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = ir_loops_insert_preheaders(func);
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+    if (cfg->loop_count == 0) return changed;
+
+    // Rotating drops the CFG, so remember the headers, inner loops first
+    uint32_t header_count = cfg->loop_count;
+    IRBasicBlock **headers = malloc(sizeof(IRBasicBlock*) * header_count);
+    for (uint32_t i = 0; i < header_count; i++) {
+        headers[i] = cfg->loops[header_count - 1 - i]->header;
+    }
+
+    bool rotated = false;
+    for (uint32_t i = 0; i < header_count; i++) {
+        cfg = ir_cfg_get(func);
+        ir_cfg_compute_loops(cfg);
+        IRLoop *loop = ir_cfg_loop_of(cfg, headers[i]);
+        Rotation r;
+        if (!loop || loop->header != headers[i] || !plan_rotation(cfg, loop, &r)) continue;
+        r.func = func;
+        uint32_t temps = func->temp_counter ? func->temp_counter : 1;
+        r.on_entry = calloc(temps, sizeof(IRValue*));
+        r.on_latch = calloc(temps, sizeof(IRValue*));
+        rotate(&r);
+        free(r.in_loop);
+        free(r.on_entry);
+        free(r.on_latch);
+        rotated = true;
+    }
+    free(headers);
+
+    if (rotated) {
+        ir_remove_unreachable_blocks(func);
+        ir_loops_insert_preheaders(func);
+    }
+    return changed || rotated;
+}
+
+const IRPass ir_pass_rotate = {
+    .name = "rotate",
+    .description = "Move loop tests to the bottom, behind a guard",
+    .run = rotate_run,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,261 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Sparse Conditional Constant Propagation
+//=============================================================================
+
+// Wegman and Zadeck's algorithm. Values start undefined and only move down
+// the lattice (undefined -> constant -> overdefined); blocks are only
+// evaluated once an edge into them is found executable, so constants that
+// depend on branches not taken are still found.
+
+typedef enum {
+    LATTICE_UNDEFINED,
+    LATTICE_CONSTANT,
+    LATTICE_OVERDEFINED,
+} LatticeState;
+
+typedef struct Lattice {
+    uint8_t state;
+    IRFoldValue value;
+} Lattice;
+
+typedef struct SCCP {
+    IRFunction *func;
+    IRCFG *cfg;
+    Lattice *values;          // Indexed by instruction id
+    uint32_t value_count;
+    bool *block_executable;   // Indexed by block id
+    bool *edge_executable;    // Block id * 2 + successor index
+
+    IRBasicBlock **block_work;   // Blocks entered through a new edge
+    size_t block_top;
+    IRInstruction **inst_work;   // Users of values that changed
+    size_t inst_top;
+    size_t inst_capacity;
+} SCCP;
+
+static bool same_value(IRType *type, IRFoldValue a, IRFoldValue b) {
+    // Compare float bits so 0.0 and -0.0 stay distinct
+    return ir_type_is_float(type) ? memcmp(&a.f, &b.f, sizeof(double)) == 0 : a.i == b.i;
+}
+
+static Lattice lattice_of(SCCP *s, IRValue *value) {
+    Lattice lattice = { .state = LATTICE_OVERDEFINED };
+    if (!value) return lattice;
+    if (value->kind == IR_VALUE_CONST) {
+        lattice.state = LATTICE_CONSTANT;
+        ir_fold_operand(value, &lattice.value);
+    } else if (value->kind == IR_VALUE_INST && value->id < s->value_count &&
+               value->type->kind != IR_TYPE_VOID) {
+        lattice = s->values[value->id];
+    }
+    return lattice;
+}
+
+static void push_users(SCCP *s, IRInstruction *inst) {
+    for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+        if (s->inst_top == s->inst_capacity) {
+            s->inst_capacity = s->inst_capacity ? s->inst_capacity * 2 : 64;
+            s->inst_work = realloc(s->inst_work, sizeof(IRInstruction*) * s->inst_capacity);
+        }
+        s->inst_work[s->inst_top++] = ir_use_user(use);
+    }
+}
+
+// Move an instruction's lattice value down to `next`
+static void update(SCCP *s, IRInstruction *inst, Lattice next) {
+    Lattice *current = &s->values[inst->id];
+    if (current->state == LATTICE_OVERDEFINED) return;
+    if (next.state == LATTICE_UNDEFINED) return;
+    if (current->state == LATTICE_CONSTANT && next.state == LATTICE_CONSTANT &&
+        same_value(inst->type, current->value, next.value)) {
+        return;
+    }
+    if (current->state == LATTICE_CONSTANT) next.state = LATTICE_OVERDEFINED;
+    *current = next;
+    push_users(s, inst);
+}
+
+static void mark_edge(SCCP *s, IRBasicBlock *block, size_t index) {
+    size_t edge = (size_t)block->id * 2 + index;
+    if (s->edge_executable[edge]) return;
+    s->edge_executable[edge] = true;
+    // Entering a block evaluates all of it; a new edge into a block already
+    // entered only changes its phis
+    s->block_work[s->block_top++] = ir_block_succ(block, index);
+}
+
+static bool edge_is_executable(SCCP *s, IRBasicBlock *from, IRBasicBlock *to) {
+    size_t count = ir_block_succ_count(from);
+    for (size_t i = 0; i < count; i++) {
+        if (ir_block_succ(from, i) == to && s->edge_executable[(size_t)from->id * 2 + i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void visit_phi(SCCP *s, IRInstruction *phi) {
+    IRPhiData *data = phi->ops[0].phi;
+    Lattice result = { .state = LATTICE_UNDEFINED };
+    for (uint32_t i = 0; data && i < data->arg_count; i++) {
+        if (!edge_is_executable(s, data->args[i].block, phi->block)) continue;
+        Lattice in = lattice_of(s, data->args[i].use.value);
+        if (in.state == LATTICE_UNDEFINED) continue;
+        if (in.state == LATTICE_OVERDEFINED ||
+            (result.state == LATTICE_CONSTANT && !same_value(phi->type, result.value, in.value))) {
+            result.state = LATTICE_OVERDEFINED;
+            break;
+        }
+        result = in;
+    }
+    update(s, phi, result);
+}
+
+static void visit_branch(SCCP *s, IRInstruction *branch) {
+    if (branch->opcode == IR_BR) {
+        mark_edge(s, branch->block, 0);
+        return;
+    }
+    Lattice cond = lattice_of(s, branch->ops[0].value);
+    if (cond.state == LATTICE_CONSTANT) {
+        // jnz tests the low word
+        mark_edge(s, branch->block, (uint32_t)cond.value.i != 0 ? 0 : 1);
+    } else if (cond.state == LATTICE_OVERDEFINED) {
+        mark_edge(s, branch->block, 0);
+        mark_edge(s, branch->block, 1);
+    }
+}
+
+static void visit(SCCP *s, IRInstruction *inst) {
+    switch (inst->opcode) {
+        case IR_PHI:
+            visit_phi(s, inst);
+            return;
+        case IR_BR:
+        case IR_CBR:
+            visit_branch(s, inst);
+            return;
+        default:
+            break;
+    }
+    if (inst->type->kind == IR_TYPE_VOID) return;
+
+    size_t count = ir_operand_count(inst);
+    IRFoldValue operands[2];
+    Lattice result = { .state = LATTICE_OVERDEFINED };
+    if (count <= 2 && inst->opcode != IR_CALL && inst->opcode != IR_LOAD) {
+        result.state = LATTICE_CONSTANT;
+        for (size_t i = 0; i < count; i++) {
+            Lattice in = lattice_of(s, ir_get_operand(inst, i));
+            if (in.state == LATTICE_UNDEFINED) return; // Wait for a value
+            if (in.state == LATTICE_OVERDEFINED) {
+                result.state = LATTICE_OVERDEFINED;
+                break;
+            }
+            operands[i] = in.value;
+        }
+        if (result.state == LATTICE_CONSTANT && !ir_fold_instruction(inst, operands, &result.value)) {
+            result.state = LATTICE_OVERDEFINED;
+        }
+    }
+    update(s, inst, result);
+}
+
+static void solve(SCCP *s) {
+    IRBasicBlock *entry = s->func->entry_block;
+    s->block_executable[entry->id] = true;
+    for (uint32_t i = 0; i < entry->inst_count; i++) {
+        visit(s, entry->instructions[i]);
+    }
+
+    while (s->block_top > 0 || s->inst_top > 0) {
+        while (s->block_top > 0) {
+            IRBasicBlock *block = s->block_work[--s->block_top];
+            if (s->block_executable[block->id]) {
+                for (uint32_t i = 0; i < block->inst_count && block->instructions[i]->opcode == IR_PHI; i++) {
+                    visit_phi(s, block->instructions[i]);
+                }
+                continue;
+            }
+            s->block_executable[block->id] = true;
+            for (uint32_t i = 0; i < block->inst_count; i++) {
+                visit(s, block->instructions[i]);
+            }
+        }
+        while (s->inst_top > 0 && s->block_top == 0) {
+            IRInstruction *inst = s->inst_work[--s->inst_top];
+            if (inst->block && s->block_executable[inst->block->id]) {
+                visit(s, inst);
+            }
+        }
+    }
+}
+
+// Fold branches with a known condition, then replace constant results.
+// Branches go first: folding edits the phis of the dropped successor,
+// which must not have been erased and left waiting for compaction yet.
+static bool rewrite(SCCP *s) {
+    bool changed = false;
+    for (IRBasicBlock *block = s->func->blocks; block; block = block->next) {
+        if (!s->block_executable[block->id]) continue;
+        IRInstruction *branch = ir_block_terminator(block);
+        if (!branch || branch->opcode != IR_CBR) continue;
+        Lattice cond = lattice_of(s, branch->ops[0].value);
+        if (cond.state == LATTICE_CONSTANT) {
+            ir_branch_fold(branch, (uint32_t)cond.value.i != 0 ? 0 : 1);
+            changed = true;
+        }
+    }
+
+    for (IRBasicBlock *block = s->func->blocks; block; block = block->next) {
+        if (!s->block_executable[block->id]) continue;
+        bool erased = false;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->type->kind == IR_TYPE_VOID || inst->id >= s->value_count) continue;
+            if (s->values[inst->id].state != LATTICE_CONSTANT) continue;
+            if (ir_inst_has_side_effects(inst)) continue;
+            ir_replace_all_uses((IRValue*)inst, ir_fold_constant(s->func, inst->type, s->values[inst->id].value));
+            ir_inst_erase(inst);
+            erased = true;
+            changed = true;
+        }
+        if (erased) ir_block_compact(block);
+    }
+    return changed;
+}
+
+static bool sccp_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+
+    SCCP s = { .func = func };
+    s.cfg = ir_cfg_get(func);
+    s.value_count = func->temp_counter;
+    size_t blocks = s.cfg->capacity ? s.cfg->capacity : 1;
+    s.values = calloc(s.value_count ? s.value_count : 1, sizeof(Lattice));
+    s.block_executable = calloc(blocks, sizeof(bool));
+    s.edge_executable = calloc(blocks * 2, sizeof(bool));
+    s.block_work = malloc(sizeof(IRBasicBlock*) * blocks * 2); // One push per edge
+
+    solve(&s);
+    bool changed = rewrite(&s);
+
+    free(s.values);
+    free(s.block_executable);
+    free(s.edge_executable);
+    free(s.block_work);
+    free(s.inst_work);
+    return changed;
+}
+
+const IRPass ir_pass_sccp = {
+    .name = "sccp",
+    .description = "Propagate constants through values and branches that can execute",
+    .run = sccp_run,
+    .preserves = IR_PRESERVES_NONE,
+};
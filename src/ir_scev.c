@@ -0,0 +1,612 @@
+#include "ir_analysis.h"
+#include "ir_pass.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Scalar Evolution
+//=============================================================================
+
+// Recurrences are solved by analyzing a header phi's latch value with the
+// phi itself standing in as an unknown: if the latch value is "phi + X"
+// with X free of the phi, the phi is {start,+,X}. Results that mention a
+// phi still being solved are not cached.
+
+#define SCEV_DEPTH_LIMIT 64
+#define SCEV_BUDGET 4096   // Instructions visited per query
+
+typedef enum {
+    MEMO_NONE,
+    MEMO_BUSY,    // Header phi whose recurrence is being solved
+    MEMO_DONE,
+    MEMO_FAILED,
+} MemoState;
+
+typedef struct Memo {
+    uint8_t state;
+    IRSCEV scev;
+} Memo;
+
+struct IRLoopSCEV {
+    IRFunction *func;
+    IRCFG *cfg;
+    IRLoop *loop;
+    IRBasicBlock *preheader;
+    IRBasicBlock *latch;
+    Memo **memo;             // By instruction id, allocated on first visit
+    uint32_t memo_count;
+    uint32_t busy;           // Phis being solved
+    uint32_t budget;
+    bool has_trip_count;
+    IRTripCount trip;
+};
+
+static bool scev_type(IRType *type) {
+    return type->kind == IR_TYPE_I32 || type->kind == IR_TYPE_I64;
+}
+
+static bool in_loop(IRLoopSCEV *se, IRValue *value) {
+    if (value->kind != IR_VALUE_INST) return false;
+    IRBasicBlock *block = ((IRInstruction*)value)->block;
+    return block && ir_loop_contains(se->cfg, se->loop, block);
+}
+
+//-----------------------------------------------------------------------------
+// Coefficient arithmetic (wrapping, normalized by scev_finish)
+//-----------------------------------------------------------------------------
+
+static bool same_term(IRValue *a, IRValue *b) {
+    // Arguments are created per use
+    return a == b || (a->kind == IR_VALUE_ARG && b->kind == IR_VALUE_ARG && a->id == b->id);
+}
+
+static int64_t wrap_add(int64_t a, int64_t b) { return (int64_t)((uint64_t)a + (uint64_t)b); }
+static int64_t wrap_mul(int64_t a, int64_t b) { return (int64_t)((uint64_t)a * (uint64_t)b); }
+
+static bool coef_add_term(IRSCEVCoef *c, IRValue *value, int64_t scale) {
+    for (uint32_t i = 0; i < c->term_count; i++) {
+        if (!same_term(c->terms[i].value, value)) continue;
+        c->terms[i].scale = wrap_add(c->terms[i].scale, scale);
+        if (c->terms[i].scale == 0) c->terms[i] = c->terms[--c->term_count];
+        return true;
+    }
+    if (scale == 0) return true;
+    if (c->term_count == IR_SCEV_MAX_TERMS) return false;
+    c->terms[c->term_count++] = (IRSCEVTerm){ value, scale };
+    return true;
+}
+
+bool ir_scev_coef_add(IRSCEVCoef *out, const IRSCEVCoef *a, const IRSCEVCoef *b, int64_t scale) {
+    IRSCEVCoef result = *a;
+    result.constant = wrap_add(a->constant, wrap_mul(b->constant, scale));
+    for (uint32_t i = 0; i < b->term_count; i++) {
+        if (!coef_add_term(&result, b->terms[i].value, wrap_mul(b->terms[i].scale, scale))) return false;
+    }
+    *out = result;
+    return true;
+}
+
+static bool coef_mul(IRSCEVCoef *out, const IRSCEVCoef *a, const IRSCEVCoef *b) {
+    // Products of two unknowns are not representable
+    if (a->term_count && b->term_count) return false;
+    if (a->term_count) {
+        const IRSCEVCoef *t = a;
+        a = b;
+        b = t;
+    }
+    IRSCEVCoef zero = { 0 };
+    return ir_scev_coef_add(out, &zero, b, a->constant);
+}
+
+static bool coef_is_zero(const IRSCEVCoef *c) {
+    return c->constant == 0 && c->term_count == 0;
+}
+
+static void scev_finish(IRSCEV *s, uint32_t bits) {
+    s->bits = bits;
+    s->degree = 0;
+    for (uint32_t j = 0; j <= IR_SCEV_MAX_DEGREE; j++) {
+        IRSCEVCoef *c = &s->coef[j];
+        c->constant = ir_fold_normalize(c->constant, (int)bits);
+        for (uint32_t i = 0; i < c->term_count;) {
+            c->terms[i].scale = ir_fold_normalize(c->terms[i].scale, (int)bits);
+            if (c->terms[i].scale == 0) {
+                c->terms[i] = c->terms[--c->term_count];
+            } else {
+                i++;
+            }
+        }
+        if (!coef_is_zero(c)) s->degree = j;
+    }
+}
+
+static bool scev_add(IRSCEV *out, const IRSCEV *a, const IRSCEV *b, int64_t scale) {
+    for (uint32_t j = 0; j <= IR_SCEV_MAX_DEGREE; j++) {
+        if (!ir_scev_coef_add(&out->coef[j], &a->coef[j], &b->coef[j], scale)) return false;
+    }
+    return true;
+}
+
+static bool scev_mul(IRSCEV *out, const IRSCEV *a, const IRSCEV *b) {
+    if (a->degree > 0 && b->degree > 0) return false;
+    if (a->degree > 0) {
+        const IRSCEV *t = a;
+        a = b;
+        b = t;
+    }
+    for (uint32_t j = 0; j <= IR_SCEV_MAX_DEGREE; j++) {
+        if (!coef_mul(&out->coef[j], &a->coef[0], &b->coef[j])) return false;
+    }
+    return true;
+}
+
+static void scev_term(IRSCEV *out, IRValue *value) {
+    memset(out, 0, sizeof(*out));
+    out->coef[0].term_count = 1;
+    out->coef[0].terms[0] = (IRSCEVTerm){ value, 1 };
+    out->bits = 64;
+}
+
+// Does the formula mention a value computed inside the loop (a phi being
+// solved)? Such results only hold while that phi is being solved.
+static bool scev_mentions_loop(IRLoopSCEV *se, const IRSCEV *s) {
+    for (uint32_t j = 0; j <= s->degree; j++) {
+        for (uint32_t i = 0; i < s->coef[j].term_count; i++) {
+            if (in_loop(se, s->coef[j].terms[i].value)) return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Analysis
+//-----------------------------------------------------------------------------
+
+static Memo *memo_of(IRLoopSCEV *se, IRInstruction *inst) {
+    if (inst->id >= se->memo_count) {
+        uint32_t count = se->memo_count ? se->memo_count : 64;
+        while (count <= inst->id) count *= 2;
+        se->memo = realloc(se->memo, sizeof(Memo*) * count);
+        memset(se->memo + se->memo_count, 0, sizeof(Memo*) * (count - se->memo_count));
+        se->memo_count = count;
+    }
+    if (!se->memo[inst->id]) se->memo[inst->id] = calloc(1, sizeof(Memo));
+    return se->memo[inst->id];
+}
+
+static bool analyze(IRLoopSCEV *se, IRValue *value, IRSCEV *out, uint32_t depth);
+
+static bool solve_phi(IRLoopSCEV *se, IRInstruction *phi, IRSCEV *out, uint32_t depth) {
+    IRPhiData *data = phi->ops[0].phi;
+    if (phi->block != se->loop->header || !data || data->arg_count != 2) return false;
+    IRValue *initial = NULL, *next = NULL;
+    for (uint32_t i = 0; i < 2; i++) {
+        if (data->args[i].block == se->preheader) initial = data->args[i].use.value;
+        if (data->args[i].block == se->latch) next = data->args[i].use.value;
+    }
+    if (!initial || !next) return false;
+
+    uint32_t bits = (uint32_t)ir_type_bits(phi->type);
+    IRSCEV start;
+    if (!analyze(se, initial, &start, depth + 1) || start.degree > 0 || start.bits < bits) return false;
+
+    Memo *memo = memo_of(se, phi);
+    memo->state = MEMO_BUSY;
+    se->busy++;
+    IRSCEV latch;
+    bool ok = analyze(se, next, &latch, depth + 1);
+    se->busy--;
+    memo->state = MEMO_NONE;
+    if (!ok || latch.bits < bits) return false;
+
+    // latch = phi + step
+    IRSCEV step = latch;
+    if (!coef_add_term(&step.coef[0], (IRValue*)phi, -1)) return false;
+    scev_finish(&step, bits);
+    for (uint32_t j = 0; j <= step.degree; j++) {
+        for (uint32_t i = 0; i < step.coef[j].term_count; i++) {
+            if (step.coef[j].terms[i].value == (IRValue*)phi) return false;
+        }
+    }
+    if (step.degree >= IR_SCEV_MAX_DEGREE) return false;
+
+    memset(out, 0, sizeof(*out));
+    out->coef[0] = start.coef[0];
+    for (uint32_t j = 0; j <= step.degree; j++) {
+        out->coef[j + 1] = step.coef[j];
+    }
+    scev_finish(out, bits);
+    return true;
+}
+
+static bool evaluate(IRLoopSCEV *se, IRInstruction *inst, IRSCEV *out, uint32_t depth) {
+    uint32_t bits = (uint32_t)ir_type_bits(inst->type);
+    IRSCEV a, b;
+    memset(out, 0, sizeof(*out));
+
+    switch (inst->opcode) {
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+            if (!analyze(se, inst->ops[0].value, &a, depth + 1) ||
+                !analyze(se, inst->ops[1].value, &b, depth + 1)) {
+                return false;
+            }
+            if (inst->opcode == IR_MUL) {
+                if (!scev_mul(out, &a, &b)) return false;
+            } else if (!scev_add(out, &a, &b, inst->opcode == IR_ADD ? 1 : -1)) {
+                return false;
+            }
+            if (a.bits < bits) bits = a.bits;
+            if (b.bits < bits) bits = b.bits;
+            break;
+
+        case IR_SHL: {
+            IRFoldValue amount;
+            if (!ir_fold_operand(inst->ops[1].value, &amount)) return false;
+            if (!analyze(se, inst->ops[0].value, &a, depth + 1)) return false;
+            IRSCEV scale = { .bits = 64 };
+            scale.coef[0].constant = (int64_t)((uint64_t)1 << ((uint64_t)amount.i & (bits - 1)));
+            if (!scev_mul(out, &a, &scale)) return false;
+            if (a.bits < bits) bits = a.bits;
+            break;
+        }
+
+        case IR_SEXT:
+            // A sign-extended w value is exact wherever the w value is
+            if (inst->ops[0].value->type->kind != IR_TYPE_I32) return false;
+            if (!analyze(se, inst->ops[0].value, out, depth + 1)) return false;
+            bits = out->bits;
+            break;
+
+        case IR_TRUNC:
+        case IR_COPY:
+        case IR_BITCAST:
+            if (!scev_type(inst->ops[0].value->type)) return false;
+            if (!analyze(se, inst->ops[0].value, out, depth + 1)) return false;
+            if (out->bits < bits) bits = out->bits;
+            break;
+
+        case IR_PHI:
+            return solve_phi(se, inst, out, depth);
+
+        default:
+            return false;
+    }
+    scev_finish(out, bits);
+    return true;
+}
+
+static bool analyze(IRLoopSCEV *se, IRValue *value, IRSCEV *out, uint32_t depth) {
+    if (!scev_type(value->type)) return false;
+    switch (value->kind) {
+        case IR_VALUE_CONST: {
+            IRFoldValue constant;
+            ir_fold_operand(value, &constant);
+            memset(out, 0, sizeof(*out));
+            out->coef[0].constant = constant.i;
+            out->bits = 64;
+            return true;
+        }
+        case IR_VALUE_ARG:
+            scev_term(out, value);
+            return true;
+        case IR_VALUE_INST:
+            break;
+        default:
+            return false;
+    }
+
+    IRInstruction *inst = (IRInstruction*)value;
+    if (!in_loop(se, value)) {
+        scev_term(out, value);
+        return true;
+    }
+    if (depth > SCEV_DEPTH_LIMIT || se->budget == 0) return false;
+    se->budget--;
+
+    Memo *memo = memo_of(se, inst);
+    switch (memo->state) {
+        case MEMO_DONE:
+            *out = memo->scev;
+            return true;
+        case MEMO_FAILED:
+            return false;
+        case MEMO_BUSY:
+            scev_term(out, value); // The phi being solved stands for itself
+            return true;
+        default:
+            break;
+    }
+
+    bool ok = evaluate(se, inst, out, depth);
+    // Anything found while a phi is being solved may depend on it
+    if (ok && !scev_mentions_loop(se, out)) {
+        memo = memo_of(se, inst);
+        memo->state = MEMO_DONE;
+        memo->scev = *out;
+    } else if (!ok && se->busy == 0) {
+        memo = memo_of(se, inst);
+        memo->state = MEMO_FAILED;
+    }
+    return ok;
+}
+
+bool ir_scev_get(IRLoopSCEV *se, IRValue *value, IRSCEV *out) {
+    se->budget = SCEV_BUDGET;
+    return analyze(se, value, out, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Trip counts
+//-----------------------------------------------------------------------------
+
+// The 32-bit header phi `value` is (a sign extension of), or NULL
+static IRInstruction *header_iv(IRLoopSCEV *se, IRValue *value) {
+    if (value->kind != IR_VALUE_INST) return NULL;
+    IRInstruction *inst = (IRInstruction*)value;
+    if (inst->opcode == IR_SEXT) {
+        if (inst->ops[0].value->kind != IR_VALUE_INST) return NULL;
+        inst = (IRInstruction*)inst->ops[0].value;
+    }
+    if (inst->opcode != IR_PHI || inst->block != se->loop->header) return NULL;
+    return inst->type->kind == IR_TYPE_I32 ? inst : NULL;
+}
+
+// A loop-invariant value known to fit in 32 bits, as a w value or
+// constant; NULL if there is none
+static IRValue *bound_value(IRLoopSCEV *se, IRValue *value) {
+    if (value->kind == IR_VALUE_CONST) {
+        IRFoldValue constant;
+        ir_fold_operand(value, &constant);
+        if (constant.i < INT32_MIN || constant.i > INT32_MAX) return NULL;
+        return ir_const_int(se->func, &g_ir_type_i32, constant.i);
+    }
+    if (value->kind == IR_VALUE_INST && ((IRInstruction*)value)->opcode == IR_SEXT &&
+        ((IRInstruction*)value)->ops[0].value->type->kind == IR_TYPE_I32) {
+        value = ((IRInstruction*)value)->ops[0].value;
+    }
+    if (value->type->kind != IR_TYPE_I32 || in_loop(se, value)) return NULL;
+    if (value->kind != IR_VALUE_INST && value->kind != IR_VALUE_ARG) return NULL;
+    return value;
+}
+
+static bool only_header_exits(IRLoopSCEV *se) {
+    IRLoop *loop = se->loop;
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        IRBasicBlock *block = loop->blocks[b];
+        size_t count = ir_block_succ_count(block);
+        for (size_t i = 0; i < count; i++) {
+            if (!ir_loop_contains(se->cfg, loop, ir_block_succ(block, i)) && block != loop->header) return false;
+        }
+    }
+    return true;
+}
+
+static void find_trip_count(IRLoopSCEV *se) {
+    IRBasicBlock *header = se->loop->header;
+    IRInstruction *branch = ir_block_terminator(header);
+    if (!branch || branch->opcode != IR_CBR || !only_header_exits(se)) return;
+    bool stay_on_true = ir_loop_contains(se->cfg, se->loop, branch->ops[1].block);
+    bool stay_on_false = ir_loop_contains(se->cfg, se->loop, branch->ops[2].block);
+    if (stay_on_true == stay_on_false) return;
+
+    IRValue *cond = branch->ops[0].value;
+    if (cond->kind != IR_VALUE_INST || ((IRInstruction*)cond)->opcode != IR_CMP) return;
+    IRInstruction *test = (IRInstruction*)cond;
+    IRCmpKind kind = (IRCmpKind)test->cmp_kind;
+    if (!stay_on_true) kind = ir_cmp_invert(kind);
+
+    IRValue *lhs = test->ops[0].value, *rhs = test->ops[1].value;
+    IRInstruction *iv = header_iv(se, lhs);
+    if (!iv) {
+        iv = header_iv(se, rhs);
+        IRValue *t = lhs;
+        lhs = rhs;
+        rhs = t;
+        kind = ir_cmp_swap(kind);
+    }
+    if (!iv || (lhs->type->kind == IR_TYPE_I32 && lhs != (IRValue*)iv)) return;
+    IRValue *bound = bound_value(se, rhs);
+    if (!bound) return;
+
+    IRSCEV scev;
+    if (!ir_scev_get(se, (IRValue*)iv, &scev) || scev.degree != 1 || scev.coef[1].term_count) return;
+    int64_t step = scev.coef[1].constant;
+    IRFoldValue n;
+    bool constant_bound = ir_fold_operand(bound, &n);
+
+    // Make the bound exclusive and check the iv cannot wrap before it
+    // fails the test
+    switch (kind) {
+        case IR_CMP_SLT:
+        case IR_CMP_SLE:
+            if (step <= 0) return;
+            if (kind == IR_CMP_SLE) {
+                if (!constant_bound) return;
+                n.i++;
+            }
+            if ((step != 1 || kind != IR_CMP_SLT) && (!constant_bound || n.i - 1 + step > INT32_MAX)) return;
+            break;
+        case IR_CMP_SGT:
+        case IR_CMP_SGE:
+            if (step >= 0) return;
+            if (kind == IR_CMP_SGE) {
+                if (!constant_bound) return;
+                n.i--;
+            }
+            if ((step != -1 || kind != IR_CMP_SGT) && (!constant_bound || n.i + 1 + step < INT32_MIN)) return;
+            break;
+        default:
+            return;
+    }
+    if (constant_bound) bound = ir_const_int(se->func, &g_ir_type_i32, n.i);
+
+    IRPhiData *data = iv->ops[0].phi;
+    IRValue *start = data->args[0].block == se->preheader ? data->args[0].use.value : data->args[1].use.value;
+
+    se->has_trip_count = true;
+    se->trip = (IRTripCount){ .iv = iv, .test = test, .start = start, .bound = bound, .step = step };
+    IRFoldValue s;
+    if (constant_bound && ir_fold_operand(start, &s)) {
+        int64_t distance = step > 0 ? n.i - s.i : s.i - n.i;
+        int64_t stride = step > 0 ? step : -step;
+        se->trip.is_constant = true;
+        se->trip.count = distance > 0 ? (distance + stride - 1) / stride : 0;
+    }
+
+    // The iv is exact as a 64-bit value now; forget what was derived
+    // from it before that was known
+    for (uint32_t i = 0; i < se->memo_count; i++) {
+        free(se->memo[i]);
+        se->memo[i] = NULL;
+    }
+    scev.bits = 64;
+    Memo *memo = memo_of(se, iv);
+    memo->state = MEMO_DONE;
+    memo->scev = scev;
+}
+
+IRLoopSCEV *ir_scev_create(IRCFG *cfg, IRLoop *loop) {
+    IRBasicBlock *preheader = ir_loop_preheader(cfg, loop);
+    if (!preheader || loop->latch_count != 1) return NULL;
+
+    IRLoopSCEV *se = calloc(1, sizeof(IRLoopSCEV));
+    se->func = loop->header->function;
+    se->cfg = cfg;
+    se->loop = loop;
+    se->preheader = preheader;
+    se->latch = loop->latches[0];
+    find_trip_count(se);
+    return se;
+}
+
+void ir_scev_free(IRLoopSCEV *se) {
+    if (!se) return;
+    for (uint32_t i = 0; i < se->memo_count; i++) {
+        free(se->memo[i]);
+    }
+    free(se->memo);
+    free(se);
+}
+
+IRBasicBlock *ir_scev_preheader(IRLoopSCEV *se) {
+    return se->preheader;
+}
+
+IRBasicBlock *ir_scev_latch(IRLoopSCEV *se) {
+    return se->latch;
+}
+
+const IRTripCount *ir_scev_trip_count(IRLoopSCEV *se) {
+    return se->has_trip_count ? &se->trip : NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Expansion
+//-----------------------------------------------------------------------------
+
+typedef struct Builder {
+    IRFunction *func;
+    IRBasicBlock *block;
+    size_t *index;
+} Builder;
+
+static IRValue *constant(Builder *b, IRType *type, int64_t value) {
+    return ir_const_int(b->func, type, ir_fold_normalize(value, ir_type_bits(type)));
+}
+
+// Emit `op` unless it folds to a constant or one of its operands
+static IRValue *emit(Builder *b, IROpcode op, IRType *type, IRValue *x, IRValue *y) {
+    IRFoldValue fx, fy, result;
+    bool cx = ir_fold_operand(x, &fx);
+    bool cy = y && ir_fold_operand(y, &fy);
+    if (cx && (!y || cy)) {
+        IRInstruction probe = { .type = type, .opcode = (uint8_t)op };
+        probe.ops[0].value = x;
+        probe.ops[1].value = y;
+        IRFoldValue operands[2] = { fx, cy ? fy : fx };
+        if (ir_fold_instruction(&probe, operands, &result)) return constant(b, type, result.i);
+    }
+    if (cy && fy.i == 0 && (op == IR_ADD || op == IR_SUB)) return x;
+    if (cx && fx.i == 0 && op == IR_ADD) return y;
+    if (op == IR_MUL && ((cy && fy.i == 0) || (cx && fx.i == 0))) return constant(b, type, 0);
+    if (op == IR_MUL && cy && fy.i == 1) return x;
+    if (op == IR_MUL && cx && fx.i == 1) return y;
+
+    IRInstruction *inst = ir_inst_insert(b->block, (*b->index)++, op, type);
+    ir_set_operand(inst, 0, x);
+    if (y) ir_set_operand(inst, 1, y);
+    return (IRValue*)inst;
+}
+
+static IRValue *convert(Builder *b, IRValue *value, IRType *type) {
+    int from = ir_type_bits(value->type), to = ir_type_bits(type);
+    if (from == to) return value;
+    return emit(b, from < to ? IR_SEXT : IR_TRUNC, type, value, NULL);
+}
+
+static IRValue *expand_coef(Builder *b, const IRSCEVCoef *coef, IRType *type) {
+    IRValue *sum = NULL;
+    for (uint32_t i = 0; i < coef->term_count; i++) {
+        IRValue *term = convert(b, coef->terms[i].value, type);
+        term = emit(b, IR_MUL, type, term, constant(b, type, coef->terms[i].scale));
+        sum = sum ? emit(b, IR_ADD, type, sum, term) : term;
+    }
+    IRValue *c = constant(b, type, coef->constant);
+    return sum ? emit(b, IR_ADD, type, sum, c) : c;
+}
+
+IRValue *ir_scev_expand_coef(IRFunction *func, const IRSCEVCoef *coef, IRType *type,
+                             IRBasicBlock *block, size_t *index) {
+    Builder b = { func, block, index };
+    return expand_coef(&b, coef, type);
+}
+
+IRValue *ir_scev_expand_at(IRFunction *func, const IRSCEV *scev, IRValue *k, IRType *type,
+                           IRBasicBlock *block, size_t *index) {
+    Builder b = { func, block, index };
+    IRValue *result = expand_coef(&b, &scev->coef[0], type);
+    if (scev->degree >= 1) {
+        IRValue *c1 = expand_coef(&b, &scev->coef[1], type);
+        IRValue *term = emit(&b, IR_MUL, type, c1, convert(&b, k, type));
+        result = emit(&b, IR_ADD, type, result, term);
+    }
+    if (scev->degree >= 2) {
+        // k*(k-1)/2 is exact in 64 bits for trip counts below 2^32
+        IRValue *km1 = emit(&b, IR_SUB, &g_ir_type_i64, k, constant(&b, &g_ir_type_i64, 1));
+        IRValue *pairs = emit(&b, IR_MUL, &g_ir_type_i64, k, km1);
+        pairs = emit(&b, IR_SHR, &g_ir_type_i64, pairs, constant(&b, &g_ir_type_i64, 1));
+        IRValue *c2 = expand_coef(&b, &scev->coef[2], type);
+        IRValue *term = emit(&b, IR_MUL, type, c2, convert(&b, pairs, type));
+        result = emit(&b, IR_ADD, type, result, term);
+    }
+    return result;
+}
+
+IRValue *ir_scev_expand_trip_count(IRLoopSCEV *se, IRBasicBlock *block, size_t *index) {
+    IRTripCount *trip = &se->trip;
+    Builder b = { se->func, block, index };
+    IRType *l = &g_ir_type_i64;
+    if (trip->is_constant) return constant(&b, l, trip->count);
+
+    // max(0, ceil(distance / stride)) without a branch: the division is
+    // multiplied by whether the loop is entered at all
+    IRValue *start = convert(&b, trip->start, l);
+    IRValue *bound = convert(&b, trip->bound, l);
+    IRValue *from = trip->step > 0 ? start : bound;
+    IRValue *to = trip->step > 0 ? bound : start;
+    int64_t stride = trip->step > 0 ? trip->step : -trip->step;
+
+    IRValue *distance = emit(&b, IR_SUB, l, to, from);
+    if (stride != 1) {
+        distance = emit(&b, IR_ADD, l, distance, constant(&b, l, stride - 1));
+        distance = emit(&b, IR_DIV, l, distance, constant(&b, l, stride));
+    }
+    IRInstruction *entered = ir_inst_insert(block, (*index)++, IR_CMP, &g_ir_type_i32);
+    entered->cmp_kind = IR_CMP_SGT;
+    ir_set_operand(entered, 0, to);
+    ir_set_operand(entered, 1, from);
+    IRValue *mask = emit(&b, IR_ZEXT, l, (IRValue*)entered, NULL);
+    return emit(&b, IR_MUL, l, distance, mask);
+}
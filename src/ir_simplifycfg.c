@@ -0,0 +1,329 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// CFG Simplification
+//=============================================================================
+
+// Cleans up the control flow the lowering and the loop passes leave
+// behind, repeating until nothing changes:
+//   - branches on constants, or on compares of constants, become jumps
+//   - a predecessor that fixes the outcome of a block's branch (the block
+//     only merges values and tests them) jumps straight to the outcome
+//   - jumps through empty blocks go to their destination
+//   - a block is merged into its predecessor when it is the only successor
+//     of that predecessor, and that predecessor is its only one
+//   - blocks no longer reachable are deleted
+// Labels need no work here: the emitter already makes each one unique by
+// adding the block id.
+
+#define SIMPLIFY_MAX_ROUNDS 8
+
+static IRPhiArg *phi_entry(IRInstruction *phi, IRBasicBlock *from) {
+    IRPhiData *data = phi->ops[0].phi;
+    for (uint32_t i = 0; data && i < data->arg_count; i++) {
+        if (data->args[i].block == from) return &data->args[i];
+    }
+    return NULL;
+}
+
+static bool has_phis(IRBasicBlock *block) {
+    return block->inst_count > 0 && block->instructions[0]->opcode == IR_PHI;
+}
+
+//-----------------------------------------------------------------------------
+// Empty and unreachable blocks
+//-----------------------------------------------------------------------------
+
+// Destination of a block that holds only a jump, NULL otherwise
+static IRBasicBlock *forward_target(IRBasicBlock *block) {
+    if (block == block->function->entry_block || block->inst_count != 1) return NULL;
+    IRInstruction *term = block->instructions[0];
+    if (term->opcode != IR_BR || term->ops[0].block == block) return NULL;
+    return term->ops[0].block;
+}
+
+// Point `pred` past the empty block `skip` at `target`. The values the
+// phis of `target` took from `skip` now come from `pred`; that is only
+// possible if `pred` is not already an incoming block with its own values.
+static bool bypass(IRFunction *func, IRBasicBlock *pred, IRBasicBlock *skip, IRBasicBlock *target) {
+    if (has_phis(target)) {
+        if (phi_entry(target->instructions[0], pred)) return false;
+        for (uint32_t i = 0; i < target->inst_count && target->instructions[i]->opcode == IR_PHI; i++) {
+            IRInstruction *phi = target->instructions[i];
+            IRPhiArg *from_skip = phi_entry(phi, skip);
+            if (from_skip) ir_phi_add_incoming(func, phi, from_skip->use.value, pred);
+        }
+    }
+    IRInstruction *term = ir_block_terminator(pred);
+    size_t count = ir_block_succ_count(pred);
+    for (size_t i = 0; i < count; i++) {
+        if (ir_block_succ(pred, i) == skip) ir_branch_set_target(term, i, target);
+    }
+    return true;
+}
+
+bool ir_bypass_empty_blocks(IRFunction *func) {
+    bool changed = false;
+    uint32_t limit = func->block_counter; // Bounds chains that loop forever
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (size_t i = 0; i < ir_block_succ_count(block); i++) {
+            IRBasicBlock *succ = ir_block_succ(block, i);
+            IRBasicBlock *target;
+            for (uint32_t steps = 0; steps < limit && (target = forward_target(succ)) != NULL; steps++) {
+                if (target == succ || !bypass(func, block, succ, target)) break;
+                succ = target;
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+bool ir_remove_unreachable_blocks(IRFunction *func) {
+    IRCFG *cfg = ir_cfg_get(func);
+    // Erasing a terminator drops the CFG, so note what is dead up front
+    bool *dead = calloc(func->block_counter ? func->block_counter : 1, sizeof(bool));
+    bool changed = false;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        if (ir_block_reachable(cfg, block)) continue;
+        dead[block->id] = true;
+        IRBlockList *succs = &cfg->succs[block->id];
+        for (uint32_t i = 0; i < succs->count; i++) {
+            IRBasicBlock *succ = succs->items[i];
+            if (!ir_block_reachable(cfg, succ)) continue;
+            for (uint32_t j = 0; j < succ->inst_count && succ->instructions[j]->opcode == IR_PHI; j++) {
+                ir_phi_remove_incoming(succ->instructions[j], block);
+            }
+        }
+    }
+
+    // Values defined in dead blocks are now only used in dead blocks
+    IRBasicBlock **link = &func->blocks;
+    func->last_block = NULL;
+    while (*link) {
+        IRBasicBlock *block = *link;
+        if (!dead[block->id]) {
+            func->last_block = block;
+            link = &block->next;
+            continue;
+        }
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            ir_inst_erase(block->instructions[i]);
+        }
+        ir_block_compact(block);
+        *link = block->next;
+        changed = true;
+    }
+    free(dead);
+    if (changed) ir_cfg_invalidate(func);
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// Branches
+//-----------------------------------------------------------------------------
+
+// Value of a branch condition that is a constant or a compare of two
+static bool fold_condition(IRValue *value, IRFoldValue *out) {
+    if (ir_fold_operand(value, out)) return true;
+    if (value->kind != IR_VALUE_INST || ((IRInstruction*)value)->opcode != IR_CMP) return false;
+    IRInstruction *cmp = (IRInstruction*)value;
+    IRFoldValue operands[2];
+    return ir_fold_operand(cmp->ops[0].value, &operands[0]) &&
+           ir_fold_operand(cmp->ops[1].value, &operands[1]) &&
+           ir_fold_instruction(cmp, operands, out);
+}
+
+static bool fold_constant_branches(IRFunction *func) {
+    bool changed = false;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        IRInstruction *term = ir_block_terminator(block);
+        if (!term || term->opcode != IR_CBR) continue;
+        IRFoldValue cond;
+        if (term->ops[1].block == term->ops[2].block) {
+            ir_branch_fold(term, 0);
+        } else if (fold_condition(term->ops[0].value, &cond)) {
+            ir_branch_fold(term, cond.i != 0 ? 0 : 1);
+        } else {
+            continue;
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+// Values defined in `block` may only be read there and by the phis of its
+// successors, for the edges leaving it: edges that skip the block then
+// only need those phis updated
+static bool uses_stay_local(IRBasicBlock *block, IRInstruction *inst) {
+    for (IRUse *use = inst->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        if (user->block == block) continue;
+        if (user->opcode != IR_PHI) return false;
+        IRPhiData *data = user->ops[0].phi;
+        for (uint32_t i = 0; i < data->arg_count; i++) {
+            if (data->args[i].use.value == (IRValue*)inst && data->args[i].block != block) return false;
+        }
+    }
+    return true;
+}
+
+// What `value` is when `block` is entered from `pred`. NULL if that is a
+// value of the block itself, which would not be available at the edge.
+static IRValue *value_on_edge(IRBasicBlock *block, IRBasicBlock *pred, IRValue *value) {
+    if (value->kind != IR_VALUE_INST || ((IRInstruction*)value)->block != block) return value;
+    IRInstruction *inst = (IRInstruction*)value;
+    if (inst->opcode != IR_PHI) return NULL;
+    IRPhiArg *entry = phi_entry(inst, pred);
+    if (!entry) return NULL;
+    IRValue *incoming = entry->use.value;
+    if (incoming->kind == IR_VALUE_INST && ((IRInstruction*)incoming)->block == block) return NULL;
+    return incoming;
+}
+
+// Fold the branch condition of `block` for entry from `pred`
+static bool condition_on_edge(IRBasicBlock *block, IRBasicBlock *pred, IRInstruction *cond, IRFoldValue *out) {
+    if (cond->opcode == IR_PHI) {
+        IRValue *value = value_on_edge(block, pred, (IRValue*)cond);
+        return value && ir_fold_operand(value, out);
+    }
+    IRFoldValue operands[2];
+    for (int i = 0; i < 2; i++) {
+        IRValue *value = value_on_edge(block, pred, cond->ops[i].value);
+        if (!value || !ir_fold_operand(value, &operands[i])) return false;
+    }
+    return ir_fold_instruction(cond, operands, out);
+}
+
+// A block made of phis, at most a compare of them, and a branch on the
+// result. Predecessors for which the outcome is known go to it directly.
+static bool thread_block(IRFunction *func, IRBasicBlock *block) {
+    IRInstruction *term = ir_block_terminator(block);
+    if (block == func->entry_block || !term || term->opcode != IR_CBR) return false;
+    IRValue *condition = term->ops[0].value;
+    if (condition->kind != IR_VALUE_INST) return false;
+    IRInstruction *cond = (IRInstruction*)condition;
+    if (cond->block != block || (cond->opcode != IR_PHI && cond->opcode != IR_CMP)) return false;
+
+    uint32_t phi_count = 0;
+    while (block->instructions[phi_count]->opcode == IR_PHI) phi_count++;
+    if (phi_count == 0) return false;
+    uint32_t rest = block->inst_count - 1 - phi_count;
+    if (rest > 1 || (rest == 1 && block->instructions[phi_count] != cond)) return false;
+    for (uint32_t i = 0; i + 1 < block->inst_count; i++) {
+        if (!uses_stay_local(block, block->instructions[i])) return false;
+    }
+
+    // The CFG is dropped by the first retargeted edge
+    IRCFG *cfg = ir_cfg_get(func);
+    IRBlockList *list = &cfg->preds[block->id];
+    uint32_t pred_count = list->count;
+    IRBasicBlock **preds = malloc(sizeof(IRBasicBlock*) * (pred_count ? pred_count : 1));
+    for (uint32_t i = 0; i < pred_count; i++) {
+        preds[i] = list->items[i];
+    }
+
+    bool changed = false;
+    for (uint32_t p = 0; p < pred_count; p++) {
+        IRBasicBlock *pred = preds[p];
+        IRFoldValue known;
+        if (!condition_on_edge(block, pred, cond, &known)) continue;
+        IRBasicBlock *target = term->ops[known.i != 0 ? 1 : 2].block;
+        if (target == block || (has_phis(target) && phi_entry(target->instructions[0], pred))) continue;
+
+        // The phis of the target take what they would have through the block
+        bool mapped = true;
+        for (uint32_t i = 0; i < target->inst_count && target->instructions[i]->opcode == IR_PHI; i++) {
+            IRPhiArg *entry = phi_entry(target->instructions[i], block);
+            if (entry && !value_on_edge(block, pred, entry->use.value)) mapped = false;
+        }
+        if (!mapped) continue;
+        for (uint32_t i = 0; i < target->inst_count && target->instructions[i]->opcode == IR_PHI; i++) {
+            IRInstruction *phi = target->instructions[i];
+            IRPhiArg *entry = phi_entry(phi, block);
+            if (entry) ir_phi_add_incoming(func, phi, value_on_edge(block, pred, entry->use.value), pred);
+        }
+
+        IRInstruction *branch = ir_block_terminator(pred);
+        size_t count = ir_block_succ_count(pred);
+        for (size_t i = 0; i < count; i++) {
+            if (ir_block_succ(pred, i) == block) ir_branch_set_target(branch, i, target);
+        }
+        for (uint32_t i = 0; i < phi_count; i++) {
+            ir_phi_remove_incoming(block->instructions[i], pred);
+        }
+        changed = true;
+    }
+    free(preds);
+    return changed;
+}
+
+static bool thread_jumps(IRFunction *func) {
+    bool changed = false;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        changed |= thread_block(func, block);
+    }
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// Merging
+//-----------------------------------------------------------------------------
+
+static bool merge_blocks(IRFunction *func) {
+    // Merging keeps the predecessor counts of every other block
+    IRCFG *cfg = ir_cfg_get(func);
+    uint32_t *pred_count = malloc(sizeof(uint32_t) * cfg->capacity);
+    bool *live = malloc(sizeof(bool) * cfg->capacity);
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        pred_count[block->id] = cfg->preds[block->id].count;
+        live[block->id] = ir_block_reachable(cfg, block);
+    }
+
+    bool changed = false;
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        if (!live[block->id]) continue;
+        IRInstruction *term;
+        while ((term = ir_block_terminator(block)) != NULL && term->opcode == IR_BR) {
+            IRBasicBlock *succ = term->ops[0].block;
+            if (succ == block || succ == func->entry_block || pred_count[succ->id] != 1) break;
+            while (has_phis(succ)) {
+                IRInstruction *phi = succ->instructions[0];
+                ir_replace_all_uses((IRValue*)phi, phi->ops[0].phi->args[0].use.value);
+                ir_inst_remove(phi);
+            }
+            ir_inst_remove(term);
+            ir_block_merge(block, succ);
+            live[succ->id] = false;
+            changed = true;
+        }
+    }
+
+    free(pred_count);
+    free(live);
+    return changed;
+}
+
+static bool simplifycfg_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = false;
+    for (int round = 0; round < SIMPLIFY_MAX_ROUNDS; round++) {
+        bool progress = fold_constant_branches(func);
+        progress |= thread_jumps(func);
+        progress |= ir_bypass_empty_blocks(func);
+        progress |= merge_blocks(func);
+        progress |= ir_remove_unreachable_blocks(func);
+        if (!progress) break;
+        changed = true;
+    }
+    return changed;
+}
+
+const IRPass ir_pass_simplifycfg = {
+    .name = "simplifycfg",
+    .description = "Fold branches, thread jumps, merge blocks and delete dead ones",
+    .run = simplifycfg_run,
+    .preserves = IR_PRESERVES_NONE,
+};
@@ -0,0 +1,268 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Stack Slot Coloring
+//=============================================================================
+
+// Allocs anywhere but the entry block grow the stack each time they run;
+// they are moved to the entry block, where QBE gives them a fixed place in
+// the frame. Slots mem2reg could not promote then share storage when their
+// contents are never live at the same time.
+//
+// A slot's contents are live from a store to the loads that may read it,
+// computed like register liveness with stores as definitions. Two slots
+// interfere if one is stored to while the other is live; the store would
+// clobber it. Slots are colored greedily, and only slots of the same type
+// share, since a store's width follows its slot's type.
+//
+// Only slots used as the address of loads and stores take part; any other
+// use might keep the address past the contents' lifetime.
+
+#define NO_SLOT UINT32_MAX
+#define STACKCOLOR_MAX_SLOTS 1024
+
+typedef struct StackColor {
+    IRCFG *cfg;
+    IRInstruction **slots;
+    uint32_t slot_count;
+    uint32_t *slot_of;       // By instruction id
+    uint32_t words;          // Per slot set
+    uint64_t *gen;           // Per block: loaded before any store
+    uint64_t *kill;          // Per block: stored
+    uint64_t *live_in;
+    uint64_t *live_out;
+    uint64_t *interferes;    // Per slot
+} StackColor;
+
+static uint64_t *set_of(StackColor *s, uint64_t *sets, uint32_t index) {
+    return &sets[(size_t)index * s->words];
+}
+
+static void set_add(uint64_t *set, uint32_t bit) {
+    set[bit / 64] |= UINT64_C(1) << (bit % 64);
+}
+
+static bool set_has(const uint64_t *set, uint32_t bit) {
+    return (set[bit / 64] >> (bit % 64)) & 1;
+}
+
+static bool hoist_allocs(IRFunction *func) {
+    IRBasicBlock *entry = func->entry_block;
+    uint32_t front = 0;
+    while (front < entry->inst_count && entry->instructions[front]->opcode == IR_ALLOC) front++;
+
+    bool changed = false;
+    for (IRBasicBlock *block = entry->next; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->opcode != IR_ALLOC) continue;
+            ir_inst_move(inst, entry, front++);
+            i--;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static bool only_loaded_and_stored(IRInstruction *alloc) {
+    for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+        IRInstruction *user = ir_use_user(use);
+        if (user->opcode == IR_LOAD) continue;
+        if (user->opcode == IR_STORE && user->ops[0].value != (IRValue*)alloc) continue;
+        return false;
+    }
+    return true;
+}
+
+// Slot read or written by `inst`, NO_SLOT if none
+static uint32_t slot_accessed(StackColor *s, IRInstruction *inst, bool *is_store) {
+    IRValue *address;
+    if (inst->opcode == IR_LOAD) {
+        address = inst->ops[0].value;
+    } else if (inst->opcode == IR_STORE) {
+        address = inst->ops[1].value;
+    } else {
+        return NO_SLOT;
+    }
+    *is_store = inst->opcode == IR_STORE;
+    if (address->kind != IR_VALUE_INST) return NO_SLOT;
+    return s->slot_of[address->id];
+}
+
+static void summarize_blocks(StackColor *s) {
+    IRCFG *cfg = s->cfg;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        uint64_t *gen = set_of(s, s->gen, block->id);
+        uint64_t *kill = set_of(s, s->kill, block->id);
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            bool is_store;
+            uint32_t slot = slot_accessed(s, block->instructions[i], &is_store);
+            if (slot == NO_SLOT) continue;
+            if (is_store) {
+                set_add(kill, slot);
+            } else if (!set_has(kill, slot)) {
+                set_add(gen, slot);
+            }
+        }
+    }
+}
+
+static void compute_liveness(StackColor *s) {
+    IRCFG *cfg = s->cfg;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t b = cfg->rpo_count; b-- > 0;) {
+            IRBasicBlock *block = cfg->rpo[b];
+            uint64_t *out = set_of(s, s->live_out, block->id);
+            uint64_t *in = set_of(s, s->live_in, block->id);
+            uint64_t *gen = set_of(s, s->gen, block->id);
+            uint64_t *kill = set_of(s, s->kill, block->id);
+            IRBlockList *succs = &cfg->succs[block->id];
+            for (uint32_t i = 0; i < succs->count; i++) {
+                uint64_t *succ_in = set_of(s, s->live_in, succs->items[i]->id);
+                for (uint32_t w = 0; w < s->words; w++) {
+                    out[w] |= succ_in[w];
+                }
+            }
+            for (uint32_t w = 0; w < s->words; w++) {
+                uint64_t value = gen[w] | (out[w] & ~kill[w]);
+                if (value != in[w]) {
+                    in[w] = value;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+static void compute_interference(StackColor *s) {
+    IRCFG *cfg = s->cfg;
+    uint64_t *live = malloc(sizeof(uint64_t) * s->words);
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        IRBasicBlock *block = cfg->rpo[b];
+        memcpy(live, set_of(s, s->live_out, block->id), sizeof(uint64_t) * s->words);
+        for (uint32_t i = block->inst_count; i-- > 0;) {
+            bool is_store;
+            uint32_t slot = slot_accessed(s, block->instructions[i], &is_store);
+            if (slot == NO_SLOT) continue;
+            if (is_store) {
+                uint64_t *row = set_of(s, s->interferes, slot);
+                for (uint32_t w = 0; w < s->words; w++) {
+                    row[w] |= live[w];
+                }
+                live[slot / 64] &= ~(UINT64_C(1) << (slot % 64));
+            } else {
+                set_add(live, slot);
+            }
+        }
+    }
+    free(live);
+
+    // Make the relation symmetric
+    for (uint32_t a = 0; a < s->slot_count; a++) {
+        uint64_t *row = set_of(s, s->interferes, a);
+        for (uint32_t b = 0; b < s->slot_count; b++) {
+            if (set_has(row, b)) set_add(set_of(s, s->interferes, b), a);
+        }
+    }
+}
+
+static bool same_slot_kind(IRInstruction *a, IRInstruction *b) {
+    return a->type->kind == b->type->kind && a->ops[0].imm == b->ops[0].imm;
+}
+
+// Give every slot the first earlier one it can share with; returns
+// whether any slot was merged
+static bool color_slots(StackColor *s) {
+    uint32_t *reps = malloc(sizeof(uint32_t) * s->slot_count);
+    uint64_t *members = calloc((size_t)s->slot_count * s->words, sizeof(uint64_t));
+    uint32_t color_count = 0;
+    bool merged = false;
+
+    for (uint32_t slot = 0; slot < s->slot_count; slot++) {
+        uint64_t *row = set_of(s, s->interferes, slot);
+        uint32_t color = 0;
+        for (; color < color_count; color++) {
+            if (!same_slot_kind(s->slots[reps[color]], s->slots[slot])) continue;
+            uint64_t *in_color = set_of(s, members, color);
+            bool clash = false;
+            for (uint32_t w = 0; w < s->words && !clash; w++) {
+                clash = (row[w] & in_color[w]) != 0;
+            }
+            if (!clash) break;
+        }
+        if (color == color_count) reps[color_count++] = slot;
+        set_add(set_of(s, members, color), slot);
+
+        if (reps[color] != slot) {
+            IRInstruction *alloc = s->slots[slot];
+            ir_replace_all_uses((IRValue*)alloc, (IRValue*)s->slots[reps[color]]);
+            ir_inst_erase(alloc);
+            merged = true;
+        }
+    }
+
+    free(reps);
+    free(members);
+    return merged;
+}
+
+static bool stackcolor_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = hoist_allocs(func);
+
+    StackColor s = { 0 };
+    IRBasicBlock *entry = func->entry_block;
+    s.slots = malloc(sizeof(IRInstruction*) * (entry->inst_count + 1));
+    s.slot_of = malloc(sizeof(uint32_t) * (func->temp_counter ? func->temp_counter : 1));
+    for (uint32_t i = 0; i < func->temp_counter; i++) {
+        s.slot_of[i] = NO_SLOT;
+    }
+    for (uint32_t i = 0; i < entry->inst_count && s.slot_count < STACKCOLOR_MAX_SLOTS; i++) {
+        IRInstruction *inst = entry->instructions[i];
+        if (inst->opcode != IR_ALLOC || !only_loaded_and_stored(inst)) continue;
+        s.slot_of[inst->id] = s.slot_count;
+        s.slots[s.slot_count++] = inst;
+    }
+
+    if (s.slot_count > 1) {
+        s.cfg = ir_cfg_get(func);
+        s.words = (s.slot_count + 63) / 64;
+        size_t block_sets = (size_t)s.cfg->capacity * s.words;
+        s.gen = calloc(block_sets, sizeof(uint64_t));
+        s.kill = calloc(block_sets, sizeof(uint64_t));
+        s.live_in = calloc(block_sets, sizeof(uint64_t));
+        s.live_out = calloc(block_sets, sizeof(uint64_t));
+        s.interferes = calloc((size_t)s.slot_count * s.words, sizeof(uint64_t));
+
+        summarize_blocks(&s);
+        compute_liveness(&s);
+        compute_interference(&s);
+        if (color_slots(&s)) {
+            ir_block_compact(entry);
+            changed = true;
+        }
+
+        free(s.gen);
+        free(s.kill);
+        free(s.live_in);
+        free(s.live_out);
+        free(s.interferes);
+    }
+
+    free(s.slots);
+    free(s.slot_of);
+    return changed;
+}
+
+const IRPass ir_pass_stackcolor = {
+    .name = "stackcolor",
+    .description = "Hoist stack slots to the entry block and share them between locals with disjoint lifetimes",
+    .run = stackcolor_run,
+    .preserves = IR_PRESERVES_CFG,
+};
@@ -0,0 +1,284 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Tail Recursion Elimination
+//=============================================================================
+
+// A function that returns the result of calling itself jumps back to its
+// start instead. The entry block is split: what was in it becomes a loop
+// header with a phi per parameter, and each tail call passes its arguments
+// to those phis.
+//
+// `return n * f(n - 1)` is handled too when the operation is an integer
+// add or multiply: both are associative and commutative modulo 2^bits, so
+// an accumulator phi collects the pending operands and every remaining
+// return applies them to its value.
+//
+// QBE has no way to mark other calls as tail calls, so calls to other
+// functions are left as they are.
+
+typedef struct TailSite {
+    IRInstruction *call;
+    IRInstruction *return_phi;  // Phi of a shared return block, or NULL
+    IRInstruction *chain[3];    // Instructions from the call to the returned value
+    uint32_t chain_length;
+    IROpcode op;                // IR_NOP when the call result is returned as is
+    IRValue *operand;           // Other operand of `op`
+} TailSite;
+
+// Stack slots that are only loaded and stored can be reused by the next
+// iteration; a slot whose address escapes could still be in use by it
+static bool slots_escape(IRFunction *func) {
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *alloc = block->instructions[i];
+            if (alloc->opcode != IR_ALLOC) continue;
+            for (IRUse *use = alloc->uses; use; use = ir_use_next(use)) {
+                IRInstruction *user = ir_use_user(use);
+                if (user->opcode == IR_LOAD) continue;
+                if (user->opcode == IR_STORE && user->ops[0].value != (IRValue*)alloc) continue;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool is_self_call(IRFunction *func, IRInstruction *inst) {
+    if (inst->opcode != IR_CALL) return false;
+    IRCallData *data = inst->ops[0].call;
+    if (strcmp(data->callee_name, func->name) != 0 || data->arg_count != func->param_count) return false;
+    for (size_t i = 0; i < data->arg_count; i++) {
+        if (data->args[i].use.value->type->kind != func->param_types[i]->kind) return false;
+    }
+    return true;
+}
+
+static bool single_use(IRInstruction *inst) {
+    return inst->uses && !ir_use_next(inst->uses);
+}
+
+static IRInstruction *as_inst(IRValue *value) {
+    return value && value->kind == IR_VALUE_INST ? (IRInstruction*)value : NULL;
+}
+
+// Match the returned value against the call: the call itself, or an add
+// or multiply of it (possibly done in 64 bits and truncated back)
+static bool match_chain(TailSite *site, IRValue *returned) {
+    IRInstruction *call = site->call;
+    if (returned == (IRValue*)call) {
+        site->op = IR_NOP;
+        return single_use(call);
+    }
+
+    IRInstruction *inst = as_inst(returned);
+    if (!inst || inst->block != call->block || !single_use(inst)) return false;
+    if ((inst->opcode == IR_COPY || inst->opcode == IR_TRUNC) && inst->type->kind == IR_TYPE_I32) {
+        site->chain[site->chain_length++] = inst;
+        inst = as_inst(inst->ops[0].value);
+        if (!inst || inst->block != call->block || !single_use(inst)) return false;
+    }
+    if (inst->opcode != IR_ADD && inst->opcode != IR_MUL) return false;
+    site->chain[site->chain_length++] = inst;
+    site->op = (IROpcode)inst->opcode;
+
+    for (int side = 0; side < 2; side++) {
+        IRValue *value = inst->ops[side].value;
+        IRValue *other = inst->ops[1 - side].value;
+        IRInstruction *extend = as_inst(value);
+        if (extend && extend->opcode == IR_SEXT && extend->ops[0].value == (IRValue*)call &&
+            single_use(extend) && single_use(call)) {
+            site->chain[site->chain_length++] = extend;
+        } else if (value != (IRValue*)call || !single_use(call)) {
+            continue;
+        }
+        // The operand must be available before the call
+        IRInstruction *def = as_inst(other);
+        if (def == call) return false;
+        if (def && def->block == call->block) {
+            for (uint32_t i = 0; i < def->block->inst_count; i++) {
+                if (def->block->instructions[i] == call) return false;
+                if (def->block->instructions[i] == def) break;
+            }
+        }
+        site->operand = other;
+        return true;
+    }
+    return false;
+}
+
+// A self call whose result `block` returns, with nothing but pure code
+// after it
+static bool find_site(IRFunction *func, IRBasicBlock *block, TailSite *site) {
+    IRInstruction *term = ir_block_terminator(block);
+    if (!term) return false;
+    *site = (TailSite){ 0 };
+
+    IRValue *returned;
+    if (term->opcode == IR_RET) {
+        returned = term->ops[0].value;
+    } else if (term->opcode == IR_BR) {
+        // Several returns merged into one block: phi, ret phi
+        IRBasicBlock *merge = term->ops[0].block;
+        if (merge->inst_count != 2 || merge->instructions[0]->opcode != IR_PHI) return false;
+        IRInstruction *phi = merge->instructions[0];
+        if (merge->instructions[1]->opcode != IR_RET || merge->instructions[1]->ops[0].value != (IRValue*)phi) {
+            return false;
+        }
+        IRPhiData *data = phi->ops[0].phi;
+        returned = NULL;
+        for (uint32_t i = 0; i < data->arg_count; i++) {
+            if (data->args[i].block == block) returned = data->args[i].use.value;
+        }
+        if (!returned) return false;
+        site->return_phi = phi;
+    } else {
+        return false;
+    }
+
+    for (uint32_t i = block->inst_count - 1; i-- > 0;) {
+        IRInstruction *inst = block->instructions[i];
+        if (is_self_call(func, inst)) {
+            site->call = inst;
+            break;
+        }
+        if (ir_inst_has_side_effects(inst)) return false;
+    }
+    if (!site->call) return false;
+    if (!returned) {
+        site->op = IR_NOP;
+        return site->call->uses == NULL;
+    }
+    return match_chain(site, returned);
+}
+
+static IRValue *convert(IRFunction *func, IRValue *value, IRType *type, IRBasicBlock *block, size_t index) {
+    if (value->type->kind == type->kind) return value;
+    IRFoldValue constant;
+    if (ir_fold_operand(value, &constant)) {
+        return ir_const_int(func, type, ir_fold_normalize(constant.i, ir_type_bits(type)));
+    }
+    IRInstruction *trunc = ir_inst_insert(block, index, IR_TRUNC, type);
+    ir_set_operand(trunc, 0, value);
+    return (IRValue*)trunc;
+}
+
+static IRValue *accumulate(IRFunction *func, IROpcode op, IRValue *acc, IRValue *value, IRBasicBlock *block) {
+    value = convert(func, value, acc->type, block, block->inst_count - 1);
+    IRInstruction *inst = ir_inst_insert(block, block->inst_count - 1, op, acc->type);
+    ir_set_operand(inst, 0, acc);
+    ir_set_operand(inst, 1, value);
+    return (IRValue*)inst;
+}
+
+static bool tailrec_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    IRType *return_type = func->return_type;
+    bool integer_return = return_type->kind == IR_TYPE_I32 || return_type->kind == IR_TYPE_I64;
+
+    IRCFG *cfg = ir_cfg_get(func);
+    TailSite *sites = malloc(sizeof(TailSite) * cfg->rpo_count);
+    uint32_t site_count = 0;
+    IROpcode op = IR_NOP;
+    for (uint32_t b = 0; b < cfg->rpo_count; b++) {
+        TailSite *site = &sites[site_count];
+        if (!find_site(func, cfg->rpo[b], site)) continue;
+        if (site->op != IR_NOP) {
+            // One accumulator, so every site must use the same operation
+            if (!integer_return || (op != IR_NOP && site->op != op)) continue;
+            op = site->op;
+        }
+        site_count++;
+    }
+    if (site_count == 0 || slots_escape(func)) {
+        free(sites);
+        return false;
+    }
+
+    // Split the entry block; its stack slots stay behind so the loop does
+    // not allocate on every iteration
+    IRBasicBlock *entry = func->entry_block;
+    IRBasicBlock *header = ir_block_split(entry, 0, "tailrec");
+    for (uint32_t i = 0; i < header->inst_count;) {
+        if (header->instructions[i]->opcode == IR_ALLOC) {
+            ir_inst_move(header->instructions[i], entry, entry->inst_count);
+        } else {
+            i++;
+        }
+    }
+    IRInstruction *jump = ir_inst_create(entry, IR_BR, NULL);
+    jump->ops[0].block = header;
+
+    // Parameters become phis
+    size_t param_count = func->param_count;
+    IRInstruction **params = malloc(sizeof(IRInstruction*) * (param_count ? param_count : 1));
+    for (size_t i = 0; i < param_count; i++) {
+        params[i] = ir_inst_insert(header, i, IR_PHI, func->param_types[i]);
+    }
+    for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+        for (uint32_t i = block == header ? param_count : 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            size_t count = ir_operand_count(inst);
+            for (size_t j = 0; j < count; j++) {
+                IRValue *value = ir_get_operand(inst, j);
+                if (value && value->kind == IR_VALUE_ARG) ir_set_operand(inst, j, (IRValue*)params[value->id]);
+            }
+        }
+    }
+    for (size_t i = 0; i < param_count; i++) {
+        ir_phi_add_incoming(func, params[i], ir_arg(func, func->param_types[i], i), entry);
+    }
+    IRInstruction *acc = NULL;
+    if (op != IR_NOP) {
+        acc = ir_inst_insert(header, param_count, IR_PHI, return_type);
+        ir_phi_add_incoming(func, acc, ir_const_int(func, return_type, op == IR_MUL ? 1 : 0), entry);
+    }
+
+    for (uint32_t s = 0; s < site_count; s++) {
+        TailSite *site = &sites[s];
+        IRInstruction *call = site->call;
+        IRBasicBlock *block = call->block;
+        IRCallData *data = call->ops[0].call;
+        for (size_t i = 0; i < param_count; i++) {
+            ir_phi_add_incoming(func, params[i], data->args[i].use.value, block);
+        }
+        if (acc) {
+            IRValue *operand = site->operand;
+            if (operand && operand->kind == IR_VALUE_ARG) operand = (IRValue*)params[operand->id];
+            IRValue *next = site->op == IR_NOP ? (IRValue*)acc :
+                accumulate(func, op, (IRValue*)acc, operand, block);
+            ir_phi_add_incoming(func, acc, next, block);
+        }
+        if (site->return_phi) ir_phi_remove_incoming(site->return_phi, block);
+        ir_inst_remove(ir_block_terminator(block));
+        IRInstruction *loop = ir_inst_create(block, IR_BR, NULL);
+        loop->ops[0].block = header;
+        for (uint32_t i = 0; i < site->chain_length; i++) {
+            ir_inst_remove(site->chain[i]);
+        }
+        ir_inst_remove(call);
+    }
+
+    // The remaining returns apply the pending operations
+    if (acc) {
+        for (IRBasicBlock *block = func->blocks; block; block = block->next) {
+            IRInstruction *term = ir_block_terminator(block);
+            if (!term || term->opcode != IR_RET || !term->ops[0].value) continue;
+            ir_set_operand(term, 0, accumulate(func, op, (IRValue*)acc, term->ops[0].value, block));
+        }
+    }
+
+    free(params);
+    free(sites);
+    return true;
+}
+
+const IRPass ir_pass_tailrec = {
+    .name = "tailrec",
+    .description = "Turn self-recursive tail calls into loops",
+    .run = tailrec_run,
+    .preserves = IR_PRESERVES_NONE,
+};
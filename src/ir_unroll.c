@@ -0,0 +1,348 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Loop Unrolling
+//=============================================================================
+
+// Innermost counted loops (see ir_scev_trip_count()) are unrolled. Small
+// loops with a constant trip count become straight-line code. Others get a
+// guard block that runs `factor` copies of the body while at least that
+// many iterations remain; the original loop then runs the rest.
+//
+// Copies are chained: the header's instructions for each copy go at the
+// end of the block before it, followed by the copied body blocks, and the
+// header phis take the values the previous copy's latch passed back.
+
+#define FULL_UNROLL_MAX_TRIPS 32
+#define FULL_UNROLL_MAX_SIZE 256     // Instructions after unrolling
+#define PARTIAL_UNROLL_MAX_FACTOR 8
+#define PARTIAL_UNROLL_MAX_SIZE 64
+
+typedef struct Unroll {
+    IRFunction *func;
+    IRBasicBlock *preheader;
+    IRBasicBlock *header;
+    IRBasicBlock *latch;
+    IRBasicBlock *body;        // In-loop successor of the header
+    IRBasicBlock *exit;
+    IRBasicBlock **blocks;     // Loop blocks but the header, in RPO
+    uint32_t block_count;
+    IRTripCount trip;
+    uint32_t factor;           // 0 to unroll completely
+
+    // Values and blocks of the copy being built, by id
+    IRValue **value_map;
+    uint32_t value_capacity;
+    IRBasicBlock **block_map;
+    uint32_t block_capacity;
+} Unroll;
+
+static bool is_innermost(IRCFG *cfg, IRLoop *loop) {
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        if (ir_cfg_loop_of(cfg, loop->blocks[b]) != loop) return false;
+    }
+    return true;
+}
+
+static int compare_rpo(const void *a, const void *b, void *arg) {
+    IRCFG *cfg = arg;
+    uint32_t x = cfg->rpo_index[(*(IRBasicBlock *const *)a)->id];
+    uint32_t y = cfg->rpo_index[(*(IRBasicBlock *const *)b)->id];
+    return (x > y) - (x < y);
+}
+
+// Pick an unroll factor from the loop's size and trip count. False if the
+// loop is not worth or not safe to unroll.
+static bool plan_loop(IRFunction *func, IRCFG *cfg, IRLoop *loop, Unroll *u) {
+    if (!is_innermost(cfg, loop)) return false;
+    IRLoopSCEV *se = ir_scev_create(cfg, loop);
+    if (!se) return false;
+    const IRTripCount *trip = ir_scev_trip_count(se);
+    IRBasicBlock *header = loop->header;
+    IRBasicBlock *latch = ir_scev_latch(se);
+    *u = (Unroll){ .func = func, .preheader = ir_scev_preheader(se), .header = header, .latch = latch };
+    if (trip) u->trip = *trip;
+    ir_scev_free(se);
+    if (!trip || latch == header || ir_block_terminator(latch)->opcode != IR_BR) return false;
+
+    IRInstruction *branch = ir_block_terminator(header);
+    bool stay_on_true = ir_loop_contains(cfg, loop, branch->ops[1].block);
+    u->body = stay_on_true ? branch->ops[1].block : branch->ops[2].block;
+    u->exit = stay_on_true ? branch->ops[2].block : branch->ops[1].block;
+
+    uint32_t size = 0;
+    bool header_pure = true;
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        IRBasicBlock *block = loop->blocks[b];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (inst->opcode == IR_PHI || inst == ir_block_terminator(block)) continue;
+            size++;
+            if (block == header && ir_inst_has_side_effects(inst)) header_pure = false;
+        }
+    }
+
+    if (u->trip.is_constant && u->trip.count <= FULL_UNROLL_MAX_TRIPS &&
+        u->trip.count * size <= FULL_UNROLL_MAX_SIZE) {
+        u->factor = 0;
+    } else {
+        // The guard runs the first copy's header instructions before its
+        // test, and the original loop runs them again if the test fails
+        if (!header_pure) return false;
+        u->factor = PARTIAL_UNROLL_MAX_FACTOR;
+        while (u->factor > 1 && u->factor * size > PARTIAL_UNROLL_MAX_SIZE) u->factor /= 2;
+        while (u->trip.is_constant && u->factor > 1 && u->factor > u->trip.count) u->factor /= 2;
+        if (u->factor < 2) return false;
+    }
+
+    // The CFG is dropped by the first block the transformation creates
+    u->block_count = loop->block_count - 1;
+    u->blocks = malloc(sizeof(IRBasicBlock*) * (u->block_count ? u->block_count : 1));
+    uint32_t count = 0;
+    for (uint32_t b = 0; b < loop->block_count; b++) {
+        if (loop->blocks[b] != header) u->blocks[count++] = loop->blocks[b];
+    }
+    qsort_r(u->blocks, u->block_count, sizeof(IRBasicBlock*), compare_rpo, cfg);
+    return true;
+}
+
+static IRValue *lookup(Unroll *u, IRValue *value) {
+    if (!value || value->kind != IR_VALUE_INST || value->id >= u->value_capacity) return value;
+    IRValue *mapped = u->value_map[value->id];
+    return mapped ? mapped : value;
+}
+
+static void map_value(Unroll *u, IRInstruction *inst, IRValue *value) {
+    if (inst->type->kind != IR_TYPE_VOID && inst->id < u->value_capacity) u->value_map[inst->id] = value;
+}
+
+static IRBasicBlock *lookup_block(Unroll *u, IRBasicBlock *block) {
+    if (block->id >= u->block_capacity || !u->block_map[block->id]) return block;
+    return u->block_map[block->id];
+}
+
+static IRValue *incoming(IRInstruction *phi, IRBasicBlock *from) {
+    IRPhiData *data = phi->ops[0].phi;
+    for (uint32_t i = 0; i < data->arg_count; i++) {
+        if (data->args[i].block == from) return data->args[i].use.value;
+    }
+    return NULL;
+}
+
+// Point a copied instruction at the values and blocks of its own copy.
+// Jumps back to the header are left for the caller to chain.
+static void remap(Unroll *u, IRInstruction *inst) {
+    size_t count = ir_operand_count(inst);
+    for (size_t i = 0; i < count; i++) {
+        IRValue *value = ir_get_operand(inst, i);
+        IRValue *mapped = lookup(u, value);
+        if (mapped != value) ir_set_operand(inst, i, mapped);
+    }
+    if (inst->opcode == IR_PHI) {
+        // Edges from outside the loop can only come from unreachable code,
+        // which does not jump to the copy
+        IRPhiData *data = inst->ops[0].phi;
+        for (uint32_t i = data->arg_count; i-- > 0;) {
+            IRBasicBlock *from = lookup_block(u, data->args[i].block);
+            if (from == data->args[i].block) {
+                ir_phi_remove_incoming(inst, from);
+            } else {
+                data->args[i].block = from;
+            }
+        }
+    } else if (inst->opcode == IR_BR || inst->opcode == IR_CBR) {
+        size_t succs = ir_block_succ_count(inst->block);
+        for (size_t i = 0; i < succs; i++) {
+            IRBasicBlock *target = ir_block_succ(inst->block, i);
+            if (target != u->header) ir_branch_set_target(inst, i, lookup_block(u, target));
+        }
+    }
+}
+
+// Append a copy of one iteration after `pred`, which enters it through
+// its first successor. The header phis must map to this iteration's
+// values. Returns the copy of the latch, which still jumps to the header.
+static IRBasicBlock *clone_iteration(Unroll *u, IRBasicBlock *pred, IRBasicBlock **layout) {
+    IRBasicBlock *header = u->header;
+    IRInstruction *header_branch = ir_block_terminator(header);
+    for (uint32_t i = 0; i < header->inst_count; i++) {
+        IRInstruction *inst = header->instructions[i];
+        if (inst->opcode == IR_PHI || inst == header_branch) continue;
+        IRInstruction *copy = ir_inst_clone(pred, pred->inst_count - 1, inst);
+        remap(u, copy);
+        map_value(u, inst, (IRValue*)copy);
+    }
+    u->block_map[header->id] = pred;
+
+    for (uint32_t b = 0; b < u->block_count; b++) {
+        IRBasicBlock *block = u->blocks[b];
+        IRBasicBlock *copy = ir_basic_block_create(u->func, block->name);
+        ir_block_move_after(copy, *layout);
+        *layout = copy;
+        u->block_map[block->id] = copy;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            map_value(u, inst, (IRValue*)ir_inst_clone(copy, copy->inst_count, inst));
+        }
+    }
+    for (uint32_t b = 0; b < u->block_count; b++) {
+        IRBasicBlock *copy = u->block_map[u->blocks[b]->id];
+        for (uint32_t i = 0; i < copy->inst_count; i++) {
+            remap(u, copy->instructions[i]);
+        }
+    }
+
+    ir_branch_set_target(ir_block_terminator(pred), 0, u->block_map[u->body->id]);
+    return u->block_map[u->latch->id];
+}
+
+// Map the header phis to the values `latch` passes back
+static void advance_phis(Unroll *u, IRBasicBlock *latch, IRValue **next) {
+    IRBasicBlock *header = u->header;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        next[count++] = lookup(u, incoming(header->instructions[i], latch));
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        map_value(u, header->instructions[i], next[i]);
+    }
+}
+
+// Make the header take `values` from `from` instead of the preheader
+static void reenter_header(Unroll *u, IRBasicBlock *from, IRValue **values) {
+    IRBasicBlock *header = u->header;
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = header->instructions[i];
+        IRPhiData *data = phi->ops[0].phi;
+        for (uint32_t j = 0; j < data->arg_count; j++) {
+            if (data->args[j].block != u->preheader) continue;
+            data->args[j].block = from;
+            ir_set_operand(phi, j, values[i]);
+        }
+    }
+}
+
+static void unroll_fully(Unroll *u, IRValue **phis) {
+    IRBasicBlock *pred = u->preheader;
+    IRBasicBlock *layout = u->preheader;
+    advance_phis(u, u->preheader, phis);
+    for (int64_t k = 0; k < u->trip.count; k++) {
+        pred = clone_iteration(u, pred, &layout);
+        advance_phis(u, u->latch, phis);
+    }
+
+    // The header runs once more, fails its test and leaves; dead code
+    // elimination deletes the original body
+    reenter_header(u, pred, phis);
+    IRInstruction *branch = ir_block_terminator(u->header);
+    ir_branch_fold(branch, branch->ops[1].block == u->exit ? 0 : 1);
+}
+
+static void unroll_partially(Unroll *u, IRValue **phis) {
+    IRFunction *func = u->func;
+    IRBasicBlock *header = u->header;
+    IRBasicBlock *guard = ir_basic_block_create(func, header->name);
+    ir_block_move_after(guard, u->preheader);
+
+    uint32_t phi_count = 0;
+    for (uint32_t i = 0; i < header->inst_count && header->instructions[i]->opcode == IR_PHI; i++) {
+        IRInstruction *phi = header->instructions[i];
+        IRInstruction *copy = ir_inst_create(guard, IR_PHI, phi->type);
+        ir_phi_add_incoming(func, copy, incoming(phi, u->preheader), u->preheader);
+        map_value(u, phi, (IRValue*)copy);
+        phis[phi_count++] = (IRValue*)copy;
+    }
+
+    // All copies run if the iv of the last one still passes the test.
+    // Computed in 64 bits so it cannot wrap.
+    const IRTripCount *trip = &u->trip;
+    IRInstruction *iv = ir_inst_create(guard, IR_SEXT, &g_ir_type_i64);
+    ir_set_operand(iv, 0, lookup(u, (IRValue*)trip->iv));
+    IRInstruction *last = ir_inst_create(guard, IR_ADD, &g_ir_type_i64);
+    ir_set_operand(last, 0, (IRValue*)iv);
+    ir_set_operand(last, 1, ir_const_int(func, &g_ir_type_i64, (int64_t)(u->factor - 1) * trip->step));
+    IRValue *bound;
+    IRFoldValue n;
+    if (ir_fold_operand(trip->bound, &n)) {
+        bound = ir_const_int(func, &g_ir_type_i64, n.i);
+    } else {
+        IRInstruction *extend = ir_inst_create(guard, IR_SEXT, &g_ir_type_i64);
+        ir_set_operand(extend, 0, trip->bound);
+        bound = (IRValue*)extend;
+    }
+    IRInstruction *test = ir_inst_create(guard, IR_CMP, &g_ir_type_i32);
+    test->cmp_kind = trip->step > 0 ? IR_CMP_SLT : IR_CMP_SGT;
+    ir_set_operand(test, 0, (IRValue*)last);
+    ir_set_operand(test, 1, bound);
+    IRInstruction *branch = ir_inst_create(guard, IR_CBR, NULL);
+    ir_set_operand(branch, 0, (IRValue*)test);
+    branch->ops[1].block = header;
+    branch->ops[2].block = header;
+    ir_branch_set_target(ir_block_terminator(u->preheader), 0, guard);
+
+    IRBasicBlock *pred = guard;
+    IRBasicBlock *layout = guard;
+    IRValue **next = malloc(sizeof(IRValue*) * (phi_count ? phi_count : 1));
+    for (uint32_t k = 0; k < u->factor; k++) {
+        pred = clone_iteration(u, pred, &layout);
+        advance_phis(u, u->latch, next);
+    }
+    ir_branch_set_target(ir_block_terminator(pred), 0, guard);
+    for (uint32_t i = 0; i < phi_count; i++) {
+        ir_phi_add_incoming(func, (IRInstruction*)phis[i], next[i], pred);
+    }
+    free(next);
+
+    // The original loop finishes the iterations left over
+    reenter_header(u, guard, phis);
+}
+
+static bool unroll_run(IRFunction *func) {
+    if (!func->entry_block) return false;
+    bool changed = ir_loops_insert_preheaders(func);
+
+    IRCFG *cfg = ir_cfg_get(func);
+    ir_cfg_compute_loops(cfg);
+    uint32_t loop_count = cfg->loop_count;
+    if (loop_count == 0) return changed;
+
+    // Innermost loops do not overlap, so all of them can be planned on
+    // this CFG and transformed one after the other
+    Unroll *plans = malloc(sizeof(Unroll) * loop_count);
+    uint32_t plan_count = 0;
+    for (uint32_t l = 0; l < loop_count; l++) {
+        if (plan_loop(func, cfg, cfg->loops[l], &plans[plan_count])) plan_count++;
+    }
+
+    for (uint32_t p = 0; p < plan_count; p++) {
+        Unroll *u = &plans[p];
+        u->value_capacity = func->temp_counter;
+        u->value_map = calloc(u->value_capacity ? u->value_capacity : 1, sizeof(IRValue*));
+        u->block_capacity = func->block_counter;
+        u->block_map = calloc(u->block_capacity, sizeof(IRBasicBlock*));
+        IRValue **phis = malloc(sizeof(IRValue*) * (u->header->inst_count ? u->header->inst_count : 1));
+
+        if (u->factor == 0) {
+            unroll_fully(u, phis);
+        } else {
+            unroll_partially(u, phis);
+        }
+        changed = true;
+
+        free(phis);
+        free(u->value_map);
+        free(u->block_map);
+        free(u->blocks);
+    }
+    free(plans);
+    return changed;
+}
+
+const IRPass ir_pass_unroll = {
+    .name = "unroll",
+    .description = "Unroll counted innermost loops, completely when small",
+    .run = unroll_run,
+    .preserves = IR_PRESERVES_NONE,
+};
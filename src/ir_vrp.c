@@ -0,0 +1,574 @@
+#include "ir_pass.h"
+#include "ir_analysis.h"
+#include <stdlib.h>
+
+//=============================================================================
+// Value Range Propagation
+//=============================================================================
+
+// Signed intervals for integer values, in the width of their QBE class.
+// Ranges are computed over the blocks in reverse postorder until nothing
+// changes. Where an edge is the only way into a block, its branch
+// condition narrows the values it compares in every block that edge
+// dominates. A phi whose range keeps growing (a loop counter) is widened
+// to the limit of its type; a few narrowing sweeps afterwards recover the
+// bound the loop test imposes.
+//
+// Functions are done callees first. The range a function returns is
+// known at calls from other components; calls within a component, and to
+// functions defined elsewhere, can return anything.
+//
+// With the ranges:
+//   - values with a single possible value, including compares whose
+//     outcome is decided, become constants, which removes redundant
+//     checks and the branches on them
+//   - divisions of a value that is not negative by a positive one become
+//     unsigned; constant divisors are left to instcombine unless they are
+//     powers of two, whose unsigned form is a shift or a mask
+//   - l adds, subtracts and multiplies of sign-extended w values whose
+//     result fits in w are done in w and extended afterwards
+
+#define VRP_WIDEN_AFTER 3      // Updates before a phi is widened
+#define VRP_NARROW_SWEEPS 2
+#define VRP_MAX_DEPTH 16       // Dominators searched for branch conditions
+
+typedef struct Range {
+    int64_t lo;
+    int64_t hi;                // Empty if lo > hi: not reached yet
+} Range;
+
+static const Range EMPTY = { 1, 0 };
+
+typedef struct VRP {
+    IRCFG *cfg;
+    IRCallGraph *graph;
+    Range *returns;            // Per call graph node
+    bool *returns_known;
+    uint32_t scc;              // Component of the function being analyzed
+    Range *ranges;             // By instruction id
+    uint8_t *updates;          // By instruction id
+    uint32_t value_count;
+    bool widen;
+} VRP;
+
+static bool is_empty(Range r) {
+    return r.lo > r.hi;
+}
+
+static bool tracked(IRType *type) {
+    return type->kind != IR_TYPE_VOID && !ir_type_is_float(type);
+}
+
+static Range full(IRType *type) {
+    if (ir_type_bits(type) == 32) return (Range){ INT32_MIN, INT32_MAX };
+    return (Range){ INT64_MIN, INT64_MAX };
+}
+
+static Range make(IRType *type, int64_t lo, int64_t hi) {
+    Range limit = full(type);
+    if (lo < limit.lo || hi > limit.hi) return limit;
+    return (Range){ lo, hi };
+}
+
+static Range join(Range a, Range b) {
+    if (is_empty(a)) return b;
+    if (is_empty(b)) return a;
+    return (Range){ a.lo < b.lo ? a.lo : b.lo, a.hi > b.hi ? a.hi : b.hi };
+}
+
+static Range meet(Range a, Range b) {
+    return (Range){ a.lo > b.lo ? a.lo : b.lo, a.hi < b.hi ? a.hi : b.hi };
+}
+
+static bool same_range(Range a, Range b) {
+    return (is_empty(a) && is_empty(b)) || (a.lo == b.lo && a.hi == b.hi);
+}
+
+static Range range_of(VRP *v, IRValue *value) {
+    if (!tracked(value->type)) return full(&g_ir_type_i64);
+    IRFoldValue constant;
+    if (ir_fold_operand(value, &constant)) return (Range){ constant.i, constant.i };
+    if (value->kind == IR_VALUE_INST && value->id < v->value_count) return v->ranges[value->id];
+    return full(value->type);
+}
+
+//-----------------------------------------------------------------------------
+// Branch conditions
+//-----------------------------------------------------------------------------
+
+// Arguments are created per use
+static bool same_value(IRValue *a, IRValue *b) {
+    return a == b || (a->kind == IR_VALUE_ARG && b->kind == IR_VALUE_ARG && a->id == b->id);
+}
+
+static bool is_sext_of_w(IRValue *value) {
+    return value->kind == IR_VALUE_INST && ((IRInstruction*)value)->opcode == IR_SEXT &&
+        ((IRInstruction*)value)->ops[0].value->type->kind == IR_TYPE_I32;
+}
+
+// Whether `operand` of a compare has the same numeric value as `value`:
+// the value itself or a sign extension from w either way
+static bool stands_for(IRValue *operand, IRValue *value) {
+    if (same_value(operand, value)) return true;
+    if (is_sext_of_w(operand) && same_value(((IRInstruction*)operand)->ops[0].value, value)) return true;
+    return is_sext_of_w(value) && same_value(((IRInstruction*)value)->ops[0].value, operand);
+}
+
+// Narrow `r` to the values x for which `x kind y` holds
+static Range constrain(Range r, IRCmpKind kind, Range y) {
+    if (is_empty(y)) return r;
+    switch (kind) {
+        case IR_CMP_EQ:
+            return meet(r, y);
+        case IR_CMP_NE:
+            if (y.lo != y.hi) return r;
+            if (r.lo == y.lo) r.lo++;
+            else if (r.hi == y.lo) r.hi--;
+            return r;
+        case IR_CMP_SLT:
+            if (y.hi == INT64_MIN) return EMPTY;
+            return meet(r, (Range){ INT64_MIN, y.hi - 1 });
+        case IR_CMP_SLE:
+            return meet(r, (Range){ INT64_MIN, y.hi });
+        case IR_CMP_SGT:
+            if (y.lo == INT64_MAX) return EMPTY;
+            return meet(r, (Range){ y.lo + 1, INT64_MAX });
+        case IR_CMP_SGE:
+            return meet(r, (Range){ y.lo, INT64_MAX });
+        // Below a bound that is not negative is not negative either
+        case IR_CMP_ULT:
+            if (y.lo < 0) return r;
+            if (y.hi == 0) return EMPTY;
+            return meet(r, (Range){ 0, y.hi - 1 });
+        case IR_CMP_ULE:
+            if (y.lo < 0) return r;
+            return meet(r, (Range){ 0, y.hi });
+        case IR_CMP_UGT:
+            if (y.lo < 0 || r.lo < 0 || y.lo == INT64_MAX) return r;
+            return meet(r, (Range){ y.lo + 1, INT64_MAX });
+        case IR_CMP_UGE:
+            if (y.lo < 0 || r.lo < 0) return r;
+            return meet(r, (Range){ y.lo, INT64_MAX });
+        default:
+            return r;
+    }
+}
+
+// Narrow `r`, the range of `value`, given `operand kind y` where the
+// operand is the value plus a constant that cannot wrap (as in a rotated
+// loop's test of i + 1)
+static Range constrain_operand(Range r, IRValue *value, IRValue *operand, IRCmpKind kind, Range y) {
+    if (stands_for(operand, value)) return constrain(r, kind, y);
+    IRInstruction *add = (IRInstruction*)operand;
+    if (operand->kind != IR_VALUE_INST || add->opcode != IR_ADD || !stands_for(add->ops[0].value, value)) {
+        return r;
+    }
+    IRFoldValue c;
+    Range limit = full(operand->type);
+    Range shifted;
+    if (!ir_fold_operand(add->ops[1].value, &c) || is_empty(r) ||
+        __builtin_add_overflow(r.lo, c.i, &shifted.lo) || __builtin_add_overflow(r.hi, c.i, &shifted.hi) ||
+        shifted.lo < limit.lo || shifted.hi > limit.hi) {
+        return r;
+    }
+    shifted = constrain(shifted, kind, y);
+    if (is_empty(shifted)) return EMPTY;
+    return (Range){ shifted.lo - c.i, shifted.hi - c.i };
+}
+
+// Narrow `r`, the range of `value`, by what taking the edge from `from`
+// to `to` implies
+static Range refine_edge(VRP *v, IRValue *value, Range r, IRBasicBlock *from, IRBasicBlock *to) {
+    IRInstruction *branch = ir_block_terminator(from);
+    if (!branch || branch->opcode != IR_CBR || branch->ops[1].block == branch->ops[2].block) return r;
+    bool taken = branch->ops[1].block == to;
+    IRValue *condition = branch->ops[0].value;
+    if (same_value(condition, value)) {
+        return taken ? constrain(r, IR_CMP_NE, (Range){ 0, 0 }) : meet(r, (Range){ 0, 0 });
+    }
+    if (condition->kind != IR_VALUE_INST || ((IRInstruction*)condition)->opcode != IR_CMP) return r;
+    IRInstruction *cmp = (IRInstruction*)condition;
+    IRValue *x = cmp->ops[0].value;
+    IRValue *y = cmp->ops[1].value;
+    if (!tracked(x->type)) return r;
+    IRCmpKind kind = (IRCmpKind)cmp->cmp_kind;
+    if (!taken) kind = ir_cmp_invert(kind);
+    r = constrain_operand(r, value, x, kind, range_of(v, y));
+    return constrain_operand(r, value, y, ir_cmp_swap(kind), range_of(v, x));
+}
+
+// Range of `value` in `block`, narrowed by the conditions on the way in
+static Range range_at(VRP *v, IRValue *value, IRBasicBlock *block) {
+    Range r = range_of(v, value);
+    if (is_empty(r) || !tracked(value->type)) return r;
+    IRCFG *cfg = v->cfg;
+    for (uint32_t depth = 0; depth < VRP_MAX_DEPTH && block && block != cfg->rpo[0]; depth++) {
+        IRBlockList *preds = &cfg->preds[block->id];
+        if (preds->count == 1) r = refine_edge(v, value, r, preds->items[0], block);
+        block = cfg->idom[block->id];
+    }
+    return r;
+}
+
+//-----------------------------------------------------------------------------
+// Transfer functions
+//-----------------------------------------------------------------------------
+
+typedef bool (*Checked)(int64_t a, int64_t b, int64_t *out);
+
+static bool checked_add(int64_t a, int64_t b, int64_t *out) { return !__builtin_add_overflow(a, b, out); }
+static bool checked_sub(int64_t a, int64_t b, int64_t *out) { return !__builtin_sub_overflow(a, b, out); }
+static bool checked_mul(int64_t a, int64_t b, int64_t *out) { return !__builtin_mul_overflow(a, b, out); }
+
+static bool checked_div(int64_t a, int64_t b, int64_t *out) {
+    if (b == 0 || (a == INT64_MIN && b == -1)) return false;
+    *out = a / b;
+    return true;
+}
+
+// Hull of `op` over the corners of a and b; for operations monotone in
+// each operand over the ranges given
+static Range corners(IRType *type, Range a, Range b, Checked op) {
+    int64_t values[4];
+    if (!op(a.lo, b.lo, &values[0]) || !op(a.lo, b.hi, &values[1]) ||
+        !op(a.hi, b.lo, &values[2]) || !op(a.hi, b.hi, &values[3])) {
+        return full(type);
+    }
+    Range r = EMPTY;
+    for (int i = 0; i < 4; i++) {
+        r = join(r, (Range){ values[i], values[i] });
+    }
+    return make(type, r.lo, r.hi);
+}
+
+// Smallest 2^k - 1 covering a value that is not negative
+static int64_t low_mask(int64_t value) {
+    uint64_t mask = 0;
+    while (mask < (uint64_t)value) mask = mask * 2 + 1;
+    return (int64_t)mask;
+}
+
+static Range divide(IRType *type, IRInstruction *inst, Range a, Range b) {
+    if (b.lo <= 0 && b.hi >= 0) return full(type); // May trap or divide by either sign
+    if (inst->opcode == IR_DIV) return corners(type, a, b, checked_div);
+    // The remainder is smaller than the divisor and has the dividend's sign
+    int64_t limit = b.lo > 0 ? b.hi - 1 : (b.lo == INT64_MIN ? INT64_MAX : -b.lo - 1);
+    int64_t lo = a.lo >= 0 ? 0 : (a.lo > -limit ? a.lo : -limit);
+    int64_t hi = a.hi <= 0 ? 0 : (a.hi < limit ? a.hi : limit);
+    return make(type, lo, hi);
+}
+
+static Range shift(IRType *type, IRInstruction *inst, Range a, Range b) {
+    int bits = ir_type_bits(type);
+    if (b.lo != b.hi || b.lo < 0 || b.lo >= bits) return full(type);
+    int k = (int)b.lo;
+    switch (inst->opcode) {
+        case IR_SHL:
+            return corners(type, a, (Range){ INT64_C(1) << k, INT64_C(1) << k }, checked_mul);
+        case IR_SAR:
+            return (Range){ a.lo >> k, a.hi >> k };
+        default: // Logical: a negative value shifts in as a large one
+            if (a.lo >= 0) return (Range){ a.lo >> k, a.hi >> k };
+            if (k == 0) return full(type);
+            return (Range){ 0, (int64_t)((bits == 32 ? UINT32_MAX : UINT64_MAX) >> k) };
+    }
+}
+
+static Range bitwise(IRType *type, IRInstruction *inst, Range a, Range b) {
+    if (inst->opcode == IR_AND) {
+        if (a.lo >= 0 && b.lo >= 0) return (Range){ 0, a.hi < b.hi ? a.hi : b.hi };
+        if (a.lo >= 0) return (Range){ 0, a.hi };
+        if (b.lo >= 0) return (Range){ 0, b.hi };
+        return full(type);
+    }
+    if (a.lo < 0 || b.lo < 0) return full(type);
+    return (Range){ 0, low_mask(a.hi > b.hi ? a.hi : b.hi) };
+}
+
+static Range cast(IRType *type, IRInstruction *inst, Range a) {
+    IRType *from = inst->ops[0].value->type;
+    Range source = full(from);
+    if (from->kind == IR_TYPE_I8) source = inst->opcode == IR_ZEXT ? (Range){ 0, UINT8_MAX } : (Range){ INT8_MIN, INT8_MAX };
+    if (from->kind == IR_TYPE_I16) source = inst->opcode == IR_ZEXT ? (Range){ 0, UINT16_MAX } : (Range){ INT16_MIN, INT16_MAX };
+    switch (inst->opcode) {
+        case IR_SEXT:
+            return a.lo >= source.lo && a.hi <= source.hi ? a : source;
+        case IR_ZEXT:
+            if (a.lo >= 0 && a.hi <= source.hi) return a;
+            if (from->kind == IR_TYPE_I8 || from->kind == IR_TYPE_I16) return source;
+            return make(type, 0, UINT32_MAX);
+        default: // Truncations and copies keep values that fit
+            return make(type, a.lo, a.hi);
+    }
+}
+
+static Range compare(IRInstruction *inst, Range a, Range b) {
+    IRFoldValue x = { .i = a.lo }, y = { .i = b.lo };
+    bool low, high;
+    if (a.lo == a.hi && b.lo == b.hi) {
+        if (ir_fold_compare((IRCmpKind)inst->cmp_kind, inst->ops[0].value->type, x, y, &low)) {
+            return (Range){ low, low };
+        }
+        return (Range){ 0, 1 };
+    }
+    // Decided if x holds over the whole of each range
+    Range taken = constrain(a, (IRCmpKind)inst->cmp_kind, b);
+    Range not_taken = constrain(a, ir_cmp_invert((IRCmpKind)inst->cmp_kind), b);
+    high = !is_empty(taken);
+    low = !is_empty(not_taken);
+    return (Range){ low ? 0 : 1, high ? 1 : 0 };
+}
+
+static Range call_result(VRP *v, IRInstruction *call) {
+    IRCallGraphNode *callee = v->graph ? ir_call_graph_callee(v->graph, call) : NULL;
+    if (!callee || callee->scc == v->scc) return full(call->type);
+    uint32_t node = (uint32_t)(callee - v->graph->nodes);
+    if (!v->returns_known[node]) return full(call->type);
+    Range r = v->returns[node];
+    return make(call->type, r.lo, r.hi);
+}
+
+static Range phi_range(VRP *v, IRInstruction *phi) {
+    IRPhiData *data = phi->ops[0].phi;
+    Range r = EMPTY;
+    for (uint32_t i = 0; data && i < data->arg_count; i++) {
+        IRBasicBlock *from = data->args[i].block;
+        if (!ir_block_reachable(v->cfg, from)) continue;
+        IRValue *value = data->args[i].use.value;
+        Range incoming = refine_edge(v, value, range_at(v, value, from), from, phi->block);
+        r = join(r, incoming);
+    }
+    return r;
+}
+
+static Range evaluate(VRP *v, IRInstruction *inst) {
+    IRType *type = inst->type;
+    IRBasicBlock *block = inst->block;
+    if (inst->opcode == IR_PHI) return phi_range(v, inst);
+    if (inst->opcode == IR_CALL) return call_result(v, inst);
+    size_t count = ir_operand_count(inst);
+    Range a = count > 0 ? range_at(v, inst->ops[0].value, block) : EMPTY;
+    Range b = count > 1 ? range_at(v, inst->ops[1].value, block) : EMPTY;
+
+    switch (inst->opcode) {
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_DIV:
+        case IR_MOD:
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR:
+        case IR_SHL:
+        case IR_SHR:
+        case IR_SAR:
+        case IR_CMP:
+            if (is_empty(a) || is_empty(b)) return EMPTY;
+            break;
+        case IR_SEXT:
+        case IR_ZEXT:
+        case IR_TRUNC:
+        case IR_COPY:
+            if (is_empty(a)) return EMPTY;
+            break;
+        default:
+            return full(type);
+    }
+
+    switch (inst->opcode) {
+        case IR_ADD: return corners(type, a, b, checked_add);
+        case IR_SUB: return corners(type, a, (Range){ b.hi, b.lo }, checked_sub);
+        case IR_MUL: return corners(type, a, b, checked_mul);
+        case IR_DIV:
+        case IR_MOD: return divide(type, inst, a, b);
+        case IR_AND:
+        case IR_OR:
+        case IR_XOR: return bitwise(type, inst, a, b);
+        case IR_SHL:
+        case IR_SHR:
+        case IR_SAR: return shift(type, inst, a, b);
+        case IR_CMP:
+            if (ir_type_is_float(inst->ops[0].value->type)) return (Range){ 0, 1 };
+            return compare(inst, a, b);
+        default: return cast(type, inst, a);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Solver
+//-----------------------------------------------------------------------------
+
+// Widen the bounds of a phi that keeps moving to the limits of its type
+static Range widen(VRP *v, IRInstruction *inst, Range old, Range next) {
+    if (!v->widen || inst->opcode != IR_PHI || is_empty(old)) return next;
+    if (v->updates[inst->id] < VRP_WIDEN_AFTER) {
+        v->updates[inst->id]++;
+        return next;
+    }
+    Range limit = full(inst->type);
+    if (next.lo < old.lo) next.lo = limit.lo;
+    if (next.hi > old.hi) next.hi = limit.hi;
+    return next;
+}
+
+static bool sweep(VRP *v) {
+    bool changed = false;
+    for (uint32_t b = 0; b < v->cfg->rpo_count; b++) {
+        IRBasicBlock *block = v->cfg->rpo[b];
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (!tracked(inst->type) || inst->id >= v->value_count) continue;
+            Range old = v->ranges[inst->id];
+            Range next = evaluate(v, inst);
+            // Growing only while widening, so loops settle
+            if (v->widen) next = widen(v, inst, old, join(old, next));
+            if (same_range(old, next)) continue;
+            v->ranges[inst->id] = next;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static void solve(VRP *v) {
+    v->widen = true;
+    while (sweep(v)) {
+    }
+    v->widen = false;
+    for (int i = 0; i < VRP_NARROW_SWEEPS && sweep(v); i++) {
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Rewrites
+//-----------------------------------------------------------------------------
+
+// An l operand as a w value without new instructions, NULL if there is none
+static IRValue *narrow_operand(IRFunction *func, IRValue *value) {
+    if (is_sext_of_w(value)) return ((IRInstruction*)value)->ops[0].value;
+    IRFoldValue constant;
+    if (ir_fold_operand(value, &constant) && constant.i >= INT32_MIN && constant.i <= INT32_MAX) {
+        return ir_const_int(func, &g_ir_type_i32, constant.i);
+    }
+    return NULL;
+}
+
+// l add, sub or mul of w values into a w one and a sign extension
+static bool narrow(IRFunction *func, IRInstruction *inst, Range r, uint32_t *index) {
+    if (inst->opcode != IR_ADD && inst->opcode != IR_SUB && inst->opcode != IR_MUL) return false;
+    if (inst->type->kind != IR_TYPE_I64 || r.lo < INT32_MIN || r.hi > INT32_MAX) return false;
+    IRValue *x = inst->ops[0].value, *y = inst->ops[1].value;
+    if (!is_sext_of_w(x) && !is_sext_of_w(y)) return false;
+    IRValue *nx = narrow_operand(func, x);
+    IRValue *ny = narrow_operand(func, y);
+    if (!nx || !ny) return false;
+
+    IRBasicBlock *block = inst->block;
+    IRInstruction *op = ir_inst_insert(block, (*index)++, (IROpcode)inst->opcode, &g_ir_type_i32);
+    ir_set_operand(op, 0, nx);
+    ir_set_operand(op, 1, ny);
+    IRInstruction *wide = ir_inst_insert(block, (*index)++, IR_SEXT, &g_ir_type_i64);
+    ir_set_operand(wide, 0, (IRValue*)op);
+    ir_replace_all_uses((IRValue*)inst, (IRValue*)wide);
+    ir_inst_erase(inst);
+    return true;
+}
+
+// Division of a value that is not negative by a positive one
+static bool make_unsigned(VRP *v, IRInstruction *inst) {
+    if (inst->opcode != IR_DIV && inst->opcode != IR_MOD) return false;
+    if (ir_type_is_float(inst->type)) return false;
+    Range a = range_at(v, inst->ops[0].value, inst->block);
+    Range b = range_at(v, inst->ops[1].value, inst->block);
+    if (is_empty(a) || is_empty(b) || a.lo < 0 || b.lo <= 0) return false;
+    IRFoldValue constant;
+    if (ir_fold_operand(inst->ops[1].value, &constant) && (constant.i & (constant.i - 1))) return false;
+    inst->opcode = inst->opcode == IR_DIV ? IR_UDIV : IR_UREM;
+    return true;
+}
+
+static bool rewrite(VRP *v, IRFunction *func) {
+    bool changed = false;
+    for (uint32_t b = 0; b < v->cfg->rpo_count; b++) {
+        IRBasicBlock *block = v->cfg->rpo[b];
+        bool erased = false;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            IRInstruction *inst = block->instructions[i];
+            if (!tracked(inst->type) || inst->id >= v->value_count) continue;
+            if (inst->opcode == IR_CALL || inst->opcode == IR_LOAD) continue;
+            Range r = v->ranges[inst->id];
+            if (is_empty(r)) continue;
+            if (r.lo == r.hi && inst->type->kind != IR_TYPE_PTR && !ir_inst_has_side_effects(inst)) {
+                ir_replace_all_uses((IRValue*)inst, ir_const_int(func, inst->type, r.lo));
+                ir_inst_erase(inst);
+                erased = changed = true;
+            } else if (make_unsigned(v, inst)) {
+                changed = true;
+            } else if (narrow(func, inst, r, &i)) {
+                erased = changed = true;
+            }
+        }
+        if (erased) ir_block_compact(block);
+    }
+    return changed;
+}
+
+// Union of the ranges the function returns, once its own are known
+static void record_return(VRP *v, IRFunction *func, uint32_t node) {
+    if (!func->return_type || !tracked(func->return_type)) return;
+    Range r = EMPTY;
+    for (uint32_t b = 0; b < v->cfg->rpo_count; b++) {
+        IRBasicBlock *block = v->cfg->rpo[b];
+        IRInstruction *ret = ir_block_terminator(block);
+        if (!ret || ret->opcode != IR_RET) continue;
+        if (!ret->ops[0].value) return;
+        r = join(r, range_at(v, ret->ops[0].value, block));
+    }
+    if (is_empty(r)) return;
+    v->returns[node] = r;
+    v->returns_known[node] = true;
+}
+
+static bool vrp_function(VRP *v, IRFunction *func, uint32_t node) {
+    if (!func->entry_block) return false;
+    v->cfg = ir_cfg_get(func);
+    v->scc = v->graph->nodes[node].scc;
+    v->value_count = func->temp_counter;
+    v->ranges = malloc(sizeof(Range) * (v->value_count ? v->value_count : 1));
+    v->updates = calloc(v->value_count ? v->value_count : 1, sizeof(uint8_t));
+    for (uint32_t i = 0; i < v->value_count; i++) {
+        v->ranges[i] = EMPTY;
+    }
+
+    solve(v);
+    record_return(v, func, node);
+    bool changed = rewrite(v, func);
+
+    free(v->ranges);
+    free(v->updates);
+    // Don't keep analyses alive for every function in the module
+    ir_cfg_invalidate(func);
+    return changed;
+}
+
+static bool vrp_run_module(IRModule *mod) {
+    VRP v = { .graph = ir_call_graph_build(mod) };
+    v.returns = malloc(sizeof(Range) * (v.graph->node_count ? v.graph->node_count : 1));
+    v.returns_known = calloc(v.graph->node_count ? v.graph->node_count : 1, sizeof(bool));
+    bool changed = false;
+    for (uint32_t i = 0; i < v.graph->node_count; i++) {
+        uint32_t node = v.graph->bottom_up[i];
+        changed |= vrp_function(&v, v.graph->nodes[node].function, node);
+    }
+    free(v.returns);
+    free(v.returns_known);
+    ir_call_graph_free(v.graph);
+    return changed;
+}
+
+const IRPass ir_pass_vrp = {
+    .name = "vrp",
+    .description = "Propagate integer ranges to fold decided compares, narrow l arithmetic and divide unsigned",
+    .run_module = vrp_run_module,
+    .preserves = IR_PRESERVES_CFG,
+};
@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/resource.h>
 #include "token.h"
 #include "ast.h"
 #include "ir.h"
+#include "ir_pass.h"
 #include "codegen.h"
 #include "arena.h"
 
@@ -17,12 +19,63 @@ typedef struct {
     char *filename;
 } BuildConfig;
 
+// Parse the whole program, then generate and emit the module
+static int compile_module(IRModule *module, Arena *arena, const char *source,
+                          const char *ir_output_file, bool verbose, bool print_stats) {
+    // Parse
+    printf("Parsing...\n");
+    ASTProgram *ast = ast_parse(arena, source);
+    
+    if (ast == NULL) {
+        printf("Error: Failed to parse\n");
+        return 1;
+    }
+    
+    // Print AST if verbose
+    if (verbose) {
+        printf("\n=== Generated AST ===\n");
+        ast_print(ast);
+        printf("====================\n\n");
+    }
+    
+    // Generate IR
+    printf("Generating IR...\n");
+    int ir_result = ir_generate(module, ast);
+    
+    if (ir_result != 0) {
+        printf("Error: Failed to generate IR\n");
+        return 1;
+    }
+    
+    if (print_stats) {
+        ir_print_stats(module, stdout);
+    }
+    
+    // Emit QBE IR
+    printf("Emitting QBE IR to %s...\n", ir_output_file);
+    int emit_result = ir_emit(module, ir_output_file);
+    
+    if (emit_result != 0) {
+        printf("Error: Failed to emit IR\n");
+        return 1;
+    }
+
+    return 0;
+}
+
 int main(int argc, char *argv[]) {
     char *filename = NULL;
     char *ir_output_file = "build/ir.ssa";
     char *exe_output_file = NULL;
     bool verbose = false;
     bool check_qbe = false;
+    bool print_stats = false;
+    bool merge_strings = false;
+    bool stream_mode = false;
+    bool verify_each = false;
+    size_t thread_count = 0;
+    int opt_level = 0;
+    const char *pass_list = NULL;
 
     // Parse arguments
     for (int i = 1; i < argc; i++) {
@@ -38,6 +91,23 @@ int main(int argc, char *argv[]) {
             verbose = true;
         } else if (strcmp(argv[i], "-qbe") == 0) {
             check_qbe = true;
+        } else if (strcmp(argv[i], "-stats") == 0) {
+            print_stats = true;
+        } else if (strcmp(argv[i], "-merge-strings") == 0) {
+            merge_strings = true;
+        } else if (strcmp(argv[i], "-stream") == 0) {
+            stream_mode = true;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            thread_count = (size_t)strtoul(argv[++i], NULL, 10);
+        } else if (strncmp(argv[i], "-O", 2) == 0) {
+            opt_level = argv[i][2] ? atoi(argv[i] + 2) : 2;
+        } else if (strncmp(argv[i], "--passes=", 9) == 0) {
+            pass_list = argv[i] + 9;
+        } else if (strcmp(argv[i], "-verify-each") == 0) {
+            verify_each = true;
+        } else if (strcmp(argv[i], "--list-passes") == 0) {
+            ir_pass_list(stdout);
+            return 0;
         } else if (!filename && argv[i][0] != '-') {
             filename = argv[i];
         }
@@ -63,6 +133,14 @@ int main(int argc, char *argv[]) {
         printf("  -c <OUTPUT>  Compile to executable (default: build/a.out)\n");
         printf("  -v           Enable verbose output (print AST)\n");
         printf("  -qbe         Check QBE availability\n");
+        printf("  -j <N>       Worker threads for IR generation (default: one per CPU)\n");
+        printf("  -stats       Print IR size statistics\n");
+        printf("  -merge-strings  Store strings that end another string as its tail\n");
+        printf("  -stream      Compile one function at a time with bounded memory\n");
+        printf("  -O<N>        Optimization level 0-3 (default: -O0, -O alone: -O2)\n");
+        printf("  --passes=<LIST>  Run these comma-separated passes instead of an -O pipeline\n");
+        printf("  --list-passes    List the available passes and -O pipelines\n");
+        printf("  -verify-each     Check the IR after every pass and stop at the first that breaks it\n");
         return 1;
     }
 
@@ -117,42 +195,51 @@ int main(int argc, char *argv[]) {
         return 1;
     }
     
-    // Parse
-    printf("Parsing...\n");
-    ASTProgram *ast = ast_parse(arena, file_data);
-    
-    if (ast == NULL) {
-        printf("Error: Failed to parse\n");
-        arena_destroy(arena);
-        free(file_data);
-        return 1;
-    }
-    
-    // Print AST if verbose
-    if (verbose) {
-        printf("\n=== Generated AST ===\n");
-        ast_print(ast);
-        printf("====================\n\n");
+    IRPassManager passes;
+    ir_pass_manager_init(&passes);
+    passes.verify_each = verify_each;
+    if (pass_list) {
+        if (!ir_pass_manager_add_list(&passes, pass_list)) {
+            ir_pass_manager_free(&passes);
+            arena_destroy(arena);
+            free(file_data);
+            return 1;
+        }
+    } else {
+        ir_pass_manager_add_level(&passes, opt_level);
     }
-    
-    // Generate IR
-    printf("Generating IR...\n");
+
     IRModule *module = ir_module_create(arena, "main");
-    int ir_result = ir_generate(module, ast);
-    
-    if (ir_result != 0) {
-        printf("Error: Failed to generate IR\n");
-        arena_destroy(arena);
-        free(file_data);
-        return 1;
+    module->thread_count = thread_count;
+    module->merge_strings = merge_strings;
+    if (passes.pass_count) {
+        module->pass_manager = &passes;
     }
-    
-    // Emit QBE IR
-    printf("Emitting QBE IR to %s...\n", ir_output_file);
-    int emit_result = ir_emit(module, ir_output_file);
-    
-    if (emit_result != 0) {
-        printf("Error: Failed to emit IR\n");
+
+    int compile_result;
+    if (stream_mode) {
+        printf("Compiling function by function to %s...\n", ir_output_file);
+        compile_result = ir_compile_stream(module, file_data, ir_output_file);
+        if (compile_result != 0) {
+            printf("Error: Failed to compile\n");
+        } else if (print_stats) {
+            ir_print_stats(module, stdout);
+        }
+    } else {
+        compile_result = compile_module(module, arena, file_data, ir_output_file, verbose, print_stats);
+    }
+    if (print_stats && compile_result == 0) {
+        ir_pass_manager_print_stats(&passes, stdout);
+    }
+    if (print_stats) {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        printf("Peak RSS: %ld KB\n", usage.ru_maxrss);
+    }
+
+    if (compile_result != 0) {
+        ir_module_free(module);
+        ir_pass_manager_free(&passes);
         arena_destroy(arena);
         free(file_data);
         return 1;
@@ -166,6 +253,8 @@ int main(int argc, char *argv[]) {
         int codegen_result = codegen_build_executable(ir_output_file, exe_output_file);
         if (codegen_result != 0) {
             printf("Error: Failed to build executable\n");
+            ir_module_free(module);
+            ir_pass_manager_free(&passes);
             arena_destroy(arena);
             free(file_data);
             return 1;
@@ -174,6 +263,8 @@ int main(int argc, char *argv[]) {
     }
 
     // Cleanup
+    ir_module_free(module);
+    ir_pass_manager_free(&passes);
     arena_destroy(arena);
     free(file_data);
 
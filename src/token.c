@@ -6,27 +6,29 @@
 
 // Forward declarations
 int is_operator(char c);
+int is_two_char_operator(const char* s);
 int is_punctuation(char c);
 void handle_identifier_and_keyword(Token* tokens, int token_index, const char* input, int* i, int* column);
 void handle_punctuation(Token* tokens, int token_index, const char* input, int* i, int* column);
 void handle_string(Token* tokens, int token_index, const char* input, int* i, int* column);
 
-Token* tokenize(const char* input) {
-    if (input == NULL) return NULL;
-    
-    Token *tokens = malloc(sizeof(Token) * 1024);
-    if (tokens == NULL) return NULL;
-    
-    int token_index = 0;
-    int i = 0;
-    int line = 1;
-    int column = 1;
+void lexer_init(Lexer* lexer, const char* input) {
+    lexer->input = input;
+    lexer->pos = 0;
+    lexer->line = 1;
+    lexer->column = 1;
+}
+
+bool lexer_next(Lexer* lexer, Token* token) {
+    const char* input = lexer->input;
+    int i = lexer->pos;
+    int column = lexer->column;
     
-    while (input[i] != '\0' && token_index < 1024) {
+    while (input[i] != '\0') {
         // Skip whitespace
         if (isspace(input[i])) {
             if (input[i] == '\n') {
-                line++;
+                lexer->line++;
                 column = 1;
             } else {
                 column++;
@@ -36,16 +38,16 @@ Token* tokenize(const char* input) {
         }
         
         // Start of a new token
-        tokens[token_index].line = line;
-        tokens[token_index].column = column;
+        token->line = lexer->line;
+        token->column = column;
         
         // Handle identifiers and keywords
         if (isalpha(input[i]) || input[i] == '_') {
-            handle_identifier_and_keyword(tokens, token_index, input, &i, &column);
+            handle_identifier_and_keyword(token, 0, input, &i, &column);
         }
         // Handle strings
         else if (input[i] == '"') {
-            handle_string(tokens, token_index, input, &i, &column);
+            handle_string(token, 0, input, &i, &column);
         }
         
     // Handle int
@@ -56,28 +58,12 @@ Token* tokenize(const char* input) {
             column++;
         }
         int length = i - start;
-        tokens[token_index].type = TOKEN_NUMBER;
-        tokens[token_index].value = strndup(input + start, length);
-        tokens[token_index].length = length;
+        token->type = TOKEN_NUMBER;
+        token->value = strndup(input + start, length);
+        token->length = length;
     }
 
-        // Handle operators
-        else if (is_operator(input[i])) {
-            if (input[i] == '=') {
-                tokens[token_index].type = TOKEN_ASSIGN;
-            } else {
-                tokens[token_index].type = TOKEN_OPERATOR;
-            }
-            tokens[token_index].value = strndup(input + i, 1);
-            tokens[token_index].length = 1;
-            i++;
-            column++;
-        }
-        // Handle punctuation
-        else if (is_punctuation(input[i])) {
-            handle_punctuation(tokens, token_index, input, &i, &column);
-        }
-        // Skip comments for now
+        // Skip comments for now; ahead of the operators, which take '/'
         else if (input[i] == '/' && input[i+1] == '/') {
             while (input[i] != '\n' && input[i] != '\0') {
                 i++;
@@ -85,24 +71,75 @@ Token* tokenize(const char* input) {
             }
             continue;
         }
+        // Handle operators, two-character ones first
+        else if (is_operator(input[i])) {
+            int length = is_two_char_operator(input + i) ? 2 : 1;
+            if (length == 1 && input[i] == '=') {
+                token->type = TOKEN_ASSIGN;
+            } else if (length == 1 && input[i] == '!') {
+                token->type = TOKEN_EXCLAMATION;
+            } else {
+                token->type = TOKEN_OPERATOR;
+            }
+            token->value = strndup(input + i, length);
+            token->length = length;
+            i += length;
+            column += length;
+        }
+        // Handle punctuation
+        else if (is_punctuation(input[i])) {
+            handle_punctuation(token, 0, input, &i, &column);
+        }
         // Handle unknown characters
         else {
             fprintf(stderr, "Error: Unknown character '%c' at line %d, column %d\n", 
-                   input[i], line, column);
+                   input[i], lexer->line, column);
             i++;
             column++;
             continue;
         }
         
-        token_index++;
+        lexer->pos = i;
+        lexer->column = column;
+        return true;
     }
     
-    // Add EOF token
-    tokens[token_index].type = TOKEN_EOF;
-    tokens[token_index].value = NULL;
-    tokens[token_index].length = 0;
-    tokens[token_index].line = line;
-    tokens[token_index].column = column;
+    // EOF token
+    token->type = TOKEN_EOF;
+    token->value = NULL;
+    token->length = 0;
+    token->line = lexer->line;
+    token->column = column;
+    lexer->pos = i;
+    lexer->column = column;
+    return false;
+}
+
+Token* tokenize(const char* input) {
+    if (input == NULL) return NULL;
+    
+    size_t capacity = 1024;
+    Token *tokens = malloc(sizeof(Token) * capacity);
+    if (tokens == NULL) return NULL;
+    
+    Lexer lexer;
+    lexer_init(&lexer, input);
+    size_t token_index = 0;
+    while (true) {
+        // Grow token buffer
+        if (token_index >= capacity) {
+            capacity *= 2;
+            Token *grown = realloc(tokens, sizeof(Token) * capacity);
+            if (grown == NULL) {
+                free(tokens);
+                return NULL;
+            }
+            tokens = grown;
+        }
+        if (!lexer_next(&lexer, &tokens[token_index++])) {
+            break; // EOF token stored
+        }
+    }
     return tokens;
 }
 
@@ -127,6 +164,16 @@ int is_operator(char c) {
     }
 }
 
+int is_two_char_operator(const char* s) {
+    static const char *const operators[] = {
+        "&&", "||", "==", "!=", "<=", ">=", "<<", ">>", "+=", "-=", "*=", "/=",
+    };
+    for (size_t k = 0; k < sizeof(operators) / sizeof(operators[0]); k++) {
+        if (s[0] == operators[k][0] && s[1] == operators[k][1]) return 1;
+    }
+    return 0;
+}
+
 int is_punctuation(char c) {
     switch (c) {
         case '(': case ')': case '{': case '}':
@@ -320,19 +367,52 @@ void handle_punctuation(Token* tokens, int token_index, const char* input, int*
     (*column)++;
 }
 
+// Decode the escape sequences of a string literal body. Unknown escapes
+// (including \0, which would end a C string) are kept verbatim.
+static char* decode_string(const char* start, int length) {
+    char* value = malloc(length + 1);
+    int out = 0;
+    for (int k = 0; k < length; k++) {
+        if (start[k] == '\\' && k + 1 < length) {
+            char c = start[k + 1];
+            char decoded = 0;
+            switch (c) {
+                case 'n': decoded = '\n'; break;
+                case 't': decoded = '\t'; break;
+                case 'r': decoded = '\r'; break;
+                case '\\': decoded = '\\'; break;
+                case '"': decoded = '"'; break;
+                case '\'': decoded = '\''; break;
+            }
+            if (decoded) {
+                value[out++] = decoded;
+                k++;
+                continue;
+            }
+        }
+        value[out++] = start[k];
+    }
+    value[out] = '\0';
+    return value;
+}
+
 // Handle string
 void handle_string(Token* tokens, int token_index, const char* input, int* i, int* column) {    
     (*i)++;
     (*column)++;
     int start = *i;
     while (input[*i] != '"' && input[*i] != '\0') {
+        if (input[*i] == '\\' && input[*i + 1] != '\0') {
+            (*i)++;
+            (*column)++;
+        }
         (*i)++;
         (*column)++;
     }
     if (input[*i] == '"') {
         int length = *i - start;
         tokens[token_index].type = TOKEN_STRING;
-        tokens[token_index].value = strndup(input + start, length);
+        tokens[token_index].value = decode_string(input + start, length);
         tokens[token_index].length = length;
         (*i)++;
         (*column)++;
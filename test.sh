@@ -1,7 +1,128 @@
 #!/usr/bin/bash
-set -e
+# Optimizer regression tests. Each tests/<pass>/*.em is compiled at -O0,
+# with --passes=<pass>,verify (or the list on its "// passes:" line, plus
+# verify), and at -O2 and -O3 checking the IR after every pass. All builds
+# must print the same thing. Where the toolchain has ThreadSanitizer, -O3
+# also runs with four threads under it. Programs run through qbe and cc
+# when qbe is installed, else through tests/qbe_interp.py.
+#
+# The IR of the --passes build must also pass the source's checks, each an
+# extended regex matched against lines of the emitted QBE IR:
+#   // check: RE            some line matches
+#   // check-not: RE        no line matches
+#   // check-count: N RE    exactly N lines match
+#   // check-next: RE       the line after the last one matched matches
+# A "// function: NAME" line limits the checks after it to that function,
+# and a "// block: LABEL" line to the block @LABEL of that function.
+set -u
+shopt -s nullglob
+cd "$(dirname "$0")"
+make -s || exit 1
+tsan=false
+make -s tsan 2>/dev/null && tsan=true
 
-./build/main ./examples/main.em
-# qbe -o out.s build/ir.ssa
-# cc out.s -o out
-# ./out
\ No newline at end of file
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+run_ssa() {
+    if command -v qbe >/dev/null; then
+        qbe -o "$out/prog.s" "$1" && cc "$out/prog.s" -o "$out/prog" && { "$out/prog"; echo "exit $?"; }
+    else
+        python3 tests/qbe_interp.py "$1"
+    fi
+}
+
+# Compile with the given flags and print what the program prints
+build_and_run() {
+    local source=$1
+    shift
+    "${compiler:-./build/main}" "$source" "$@" -o "$out/prog.ssa" >"$out/log" 2>&1 || { cat "$out/log"; return 1; }
+    run_ssa "$out/prog.ssa" 2>&1
+}
+
+# Print the lines of `ir` inside function `name` and, if given, its block
+# `label`; with no name, all of them
+function_ir() {
+    if [ -z "$2" ]; then cat "$1"; return; fi
+    awk -v name="$2" -v label="${3:+@$3}" '
+        index($0, "$" name "(") && /function/ { inside = 1; here = label == "" }
+        inside && /^@/ { here = label == "" || $0 == label }
+        inside && here { print } inside && /^}/ { inside = 0 }' "$1"
+}
+
+# Run the checks of `source` against `ir`; print each that fails
+check_ir() {
+    local source=$1 ir=$2 scope="" block="" line re count at=0 ok=true
+    while IFS= read -r line; do
+        case $line in
+            "// function: "*)
+                scope=${line#// function: }
+                block=""
+                ;;
+            "// block: "*)
+                block=${line#// block: }
+                ;;
+            "// check: "*)
+                re=${line#// check: }
+                at=$(function_ir "$ir" "$scope" "$block" | grep -nE -m1 -- "$re" | cut -d: -f1)
+                [ -n "$at" ] || { echo "  no line matches: $re"; ok=false; at=0; }
+                ;;
+            "// check-next: "*)
+                re=${line#// check-next: }
+                at=$((at + 1))
+                function_ir "$ir" "$scope" "$block" | sed -n "${at}p" | grep -qE -- "$re" ||
+                    { echo "  next line does not match: $re"; ok=false; }
+                ;;
+            "// check-not: "*)
+                re=${line#// check-not: }
+                function_ir "$ir" "$scope" "$block" | grep -E -- "$re" | sed 's/^/  unexpected: /' | grep . &&
+                    ok=false
+                ;;
+            "// check-count: "*)
+                re=${line#// check-count: }
+                count=${re%% *}
+                re=${re#* }
+                [ "$(function_ir "$ir" "$scope" "$block" | grep -cE -- "$re")" -eq "$count" ] ||
+                    { echo "  not $count lines match: $re"; ok=false; }
+                ;;
+        esac
+    done <"$source"
+    $ok
+}
+
+passed=0
+failed=0
+for source in tests/*/*.em; do
+    pass=$(basename "$(dirname "$source")")
+    passes=$(sed -n 's|^// passes: *||p' "$source" | head -1)
+    passes="${passes:-$pass},verify"
+
+    expected=$(build_and_run "$source") || { echo "FAIL $source: -O0 build"; failed=$((failed + 1)); continue; }
+    ok=true
+    for flags in "--passes=$passes" "-O2 -verify-each" "-O3 -verify-each"; do
+        # shellcheck disable=SC2086
+        actual=$(build_and_run "$source" $flags)
+        if [ "$actual" != "$expected" ]; then
+            echo "FAIL $source ($flags)"
+            diff <(echo "$expected") <(echo "$actual") | head -10
+            ok=false
+        fi
+        if [ "$flags" = "--passes=$passes" ] && ! check_ir "$source" "$out/prog.ssa" >"$out/checks"; then
+            echo "FAIL $source (checks after $passes)"
+            cat "$out/checks"
+            ok=false
+        fi
+    done
+    if $tsan; then
+        actual=$(compiler=./build/main_tsan build_and_run "$source" -O3 -j 4)
+        if [ "$actual" != "$expected" ]; then
+            echo "FAIL $source (-O3 -j 4 under ThreadSanitizer)"
+            diff <(echo "$expected") <(echo "$actual") | head -10
+            ok=false
+        fi
+    fi
+    if $ok; then passed=$((passed + 1)); else failed=$((failed + 1)); fi
+done
+
+echo "$passed passed, $failed failed"
+[ "$failed" -eq 0 ]
@@ -0,0 +1,30 @@
+// passes: mem2reg,sccp,simplifycfg
+// && and || must not evaluate their right side once the left decides,
+// and yield 0 or 1 whatever the operands are.
+// function: main
+// check-count: 6 =w phi
+// block: entry.0
+// check-not: \$side\(w [1-9]\)
+// block: and.rhs.4
+// check: call \$side\(w 1\)
+// block: or.rhs.12
+// check: call \$side\(w 5\)
+// The constant right sides fold away, leaving no test of side(7).
+// function: main
+// check: call \$side\(w 7\)$
+// check-next: call \$side\(w 8\)
+// check-count: 1 \$side\(w 9\)
+function side(x) {
+    print(x);
+    return x;
+}
+
+function main() {
+    print(side(0) && side(1));
+    print(side(2) && side(3));
+    print(side(4) || side(5));
+    print(side(0) || side(0));
+    print((side(7) && 0) || side(8));
+    print(1 && 1 && side(9));
+    return 0;
+}
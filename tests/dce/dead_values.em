@@ -0,0 +1,28 @@
+// passes: mem2reg,dce
+// Unused arithmetic goes, but a division that may trap and every call
+// that prints stay. Code after a return is unreachable.
+// function: work
+// check-not: mul|@unreachable
+// check: div
+// check-count: 1 call \$noisy
+function noisy(x) {
+    print(x);
+    return x;
+}
+
+function work(a, b) {
+    let unused = a * b + 7;
+    let kept = a / b;
+    noisy(a + 1);
+    if (a > 3) {
+        return kept;
+        unused = noisy(99);
+    }
+    return a - b;
+}
+
+function main() {
+    print(work(8, 2));
+    print(work(1, 5));
+    return 0;
+}
@@ -0,0 +1,29 @@
+// passes: mem2reg,funcattrs,dce,gvn
+// Unused calls to pure functions are deleted and repeated ones shared,
+// but a call to a function that prints, directly or through another,
+// must run as often as the program says.
+// function: main
+// check-count: 1 call \$square\(
+// check-count: 1 call \$indirect\(
+// check-count: 2 call \$loud\(
+function square(x) {
+    return x * x;
+}
+
+function loud(x) {
+    print(x);
+    return x;
+}
+
+function indirect(x) {
+    return loud(x) + 1;
+}
+
+function main() {
+    square(4);
+    indirect(5);
+    let a = square(6) + square(6);
+    let b = loud(7) + loud(7);
+    print(a + b);
+    return 0;
+}
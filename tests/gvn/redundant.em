@@ -0,0 +1,27 @@
+// passes: mem2reg,gvn
+// The same expressions in a dominating block, in both arms of a branch
+// and inside a loop. Only the dominated copies may be reused: the arm
+// that assigns to a between the two computations must recompute.
+// function: reuse
+// check-count: 1 mul %arg0, %arg1
+// check-count: 4 mul
+function reuse(a, b, n) {
+    let x = a * b + 3;
+    let y = 0;
+    if (a > b) {
+        y = a * b + 3;
+    } else {
+        a = a + 1;
+        y = a * b + 3;
+    }
+    for (let i = 0; i < n; i = i + 1) {
+        y = y + (a * b + 3) - x;
+    }
+    return x * 10 + y;
+}
+
+function main() {
+    print(reuse(5, 2, 3));
+    print(reuse(2, 5, 3));
+    return 0;
+}
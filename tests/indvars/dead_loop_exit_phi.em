@@ -0,0 +1,24 @@
+// passes: mem2reg,simplifycfg,indvars
+// A counted loop that computes nothing is deleted. Its exit is a join
+// whose phis must keep an entry for the header, still a predecessor until
+// the unreachable body goes, next to the new one for the preheader.
+// function: pick
+// block: if.then.1
+// check: jmp @if.end.2
+function pick(c, a, b) {
+    let x = a;
+    if (c > 0) {
+        x = b;
+        let t = 0;
+        for (let i = 0; i < 2; i = i + 1) {
+            t = t + i;
+        }
+    }
+    return x;
+}
+
+function main() {
+    print(pick(1, 3, 4));
+    print(pick(0, 3, 4));
+    return 0;
+}
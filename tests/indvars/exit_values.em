@@ -0,0 +1,24 @@
+// passes: mem2reg,indvars
+// A multiplication by the counter becomes an add, and the counter and sum
+// read after the loop come from the trip count. The trip counts include
+// zero and a negative bound.
+// function: series
+// block: for.init.1
+// check: jmp @for.end.5
+// block: for.body.4
+// check-not: mul
+function series(n) {
+    let s = 0;
+    let i = 0;
+    for (i = 0; i < n; i = i + 1) {
+        s = s + i * 3;
+    }
+    return s * 100 + i;
+}
+
+function main() {
+    print(series(5));
+    print(series(0));
+    print(series(-3));
+    return 0;
+}
@@ -0,0 +1,41 @@
+// passes: mem2reg,inline
+// Callees with several returns and with side effects are inlined into
+// loops and branches; the recursive one stays a call.
+// function: main
+// check-not: call \$(clamp|show)\(
+// check: call \$fib\(
+// function: fib
+// check-count: 2 call \$fib\(
+function clamp(x, lo, hi) {
+    if (x < lo) {
+        return lo;
+    }
+    if (x > hi) {
+        return hi;
+    }
+    return x;
+}
+
+function show(x) {
+    print(x);
+    return x + 1;
+}
+
+function fib(n) {
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+function main() {
+    let s = 0;
+    for (let i = -2; i < 6; i = i + 1) {
+        s = s + clamp(i * 3, 0, 10);
+    }
+    if (s > 20) {
+        s = show(s);
+    }
+    print(s + fib(10));
+    return 0;
+}
@@ -0,0 +1,24 @@
+// passes: mem2reg,instcombine
+// Multiplies and divides by powers of two become shifts, which must
+// round toward zero for negative numbers. Identities fold away.
+// function: mix
+// check-not: div|rem|mul .*, (1|8)$
+// check: shl .*, 3$
+// check: sar .*, 2$
+// check-not: xor|sub %arg0, %arg0|sub .*, 3$
+function mix(x) {
+    let a = x * 8;
+    let b = x / 4;
+    let c = x % 8;
+    let d = (x - x) + (x ^ 0) + (x * 1);
+    let e = (x + 3) - 3;
+    return a + b * 100 + c * 10000 + d * 1000000 + e;
+}
+
+function main() {
+    print(mix(13));
+    print(mix(-13));
+    print(mix(-1));
+    print(mix(0));
+    return 0;
+}
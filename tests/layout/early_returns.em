@@ -0,0 +1,32 @@
+// passes: mem2reg,layout
+// Error paths are cold and move to the end; the hot path falls through.
+// Moving blocks must not change where control goes.
+// function: check
+// check: jnz .*, @if.then.1, @if.end.2
+// check-next: ^@if.end.2
+// check: jnz .*, @if.then.9, @if.end.10
+// check-next: ^@if.end.10
+// check: ^@if.then.9
+// check-next: ret
+// check-next: ^@if.then.1
+function check(a, b) {
+    if (a < 0) {
+        print(-1);
+        return -1;
+    }
+    let s = 0;
+    for (let i = 0; i < a; i = i + 1) {
+        if (i == b) {
+            return s;
+        }
+        s = s + i;
+    }
+    return s * 2;
+}
+
+function main() {
+    print(check(-5, 0));
+    print(check(5, 3));
+    print(check(5, 9));
+    return 0;
+}
@@ -0,0 +1,29 @@
+// passes: mem2reg,licm
+// a * b is invariant and hoisted. 100 / d is invariant too, but it only
+// runs when d is not zero; hoisting it in front of the loop would trap for
+// d == 0.
+// function: sum
+// block: for.init.1
+// check: mul %arg0, %arg1
+// check-not: div
+// block: for.body.4
+// check-not: mul
+// block: if.then.6
+// check: div
+function sum(a, b, d, n) {
+    let s = 0;
+    for (let i = 0; i < n; i = i + 1) {
+        s = s + a * b;
+        if (d != 0) {
+            s = s + 100 / d;
+        }
+    }
+    return s;
+}
+
+function main() {
+    print(sum(3, 4, 5, 3));
+    print(sum(3, 4, 0, 3));
+    print(sum(3, 4, 0, 0));
+    return 0;
+}
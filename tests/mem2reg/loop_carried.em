@@ -0,0 +1,32 @@
+// passes: mem2reg
+// Variables assigned on some paths only, carried around nested loops and
+// read after them need phis at every join, with the old value on paths
+// that do not assign.
+// function: walk
+// check-not: alloc|load|store
+// check: =w phi
+function walk(n) {
+    let odd = 0;
+    let last = -1;
+    let total = 0;
+    for (let i = 0; i < n; i = i + 1) {
+        if (i % 2) {
+            odd = odd + 1;
+        } else {
+            last = i;
+        }
+        for (let j = 0; j < i; j = j + 1) {
+            if (j > 2) {
+                total = total + j;
+            }
+        }
+    }
+    return odd * 1000 + last * 100 + total;
+}
+
+function main() {
+    print(walk(0));
+    print(walk(1));
+    print(walk(7));
+    return 0;
+}
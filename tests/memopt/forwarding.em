@@ -0,0 +1,29 @@
+// passes: memopt
+// Without mem2reg locals stay in memory. A load takes the value stored
+// on every path to it; a store overwritten before any load is dead, but
+// not when a branch between them reads it.
+// function: fwd
+// check-count: 2 load
+// block: entry.0
+// check-not: load
+// check-count: 2 store
+// block: if.then.1
+// check-not: load
+function fwd(a) {
+    let x = a;
+    let y = x + 1;
+    x = 5;
+    x = a * 2;
+    if (a > 0) {
+        y = y + x;
+    } else {
+        x = 7;
+    }
+    return x * 100 + y;
+}
+
+function main() {
+    print(fwd(3));
+    print(fwd(-3));
+    return 0;
+}
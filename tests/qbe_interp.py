@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+# Interpreter for the subset of QBE IL the compiler emits, so the tests can
+# run programs where qbe is not installed. Prints what the program prints,
+# then "exit <status>".
+import re
+import sys
+
+MASK32 = (1 << 32) - 1
+MASK64 = (1 << 64) - 1
+STEP_LIMIT = 50_000_000
+
+
+def signed(value, bits):
+    value &= (1 << bits) - 1
+    return value - (1 << bits) if value >> (bits - 1) else value
+
+
+def parse(text):
+    data = {}
+    funcs = {}
+    lines = text.split('\n')
+    i = 0
+    while i < len(lines):
+        line = lines[i].strip()
+        if line.startswith('data '):
+            m = re.match(r'data \$(\w+) = \{(.*)\}', line)
+            contents = bytearray()
+            for part in re.findall(r'b ("(?:[^"\\]|\\.)*"|-?\d+)', m.group(2)):
+                if part.startswith('"'):
+                    contents += part[1:-1].encode()
+                else:
+                    contents.append(int(part) & 255)
+            data[m.group(1)] = bytes(contents)
+        elif 'function' in line and line.endswith('{'):
+            m = re.match(r'(?:export )?function (\w)? ?\$(\w+)\((.*)\) \{', line)
+            params = [p.split()[1][1:] for p in m.group(3).split(',') if p.strip()]
+            blocks = {}
+            order = []
+            current = None
+            i += 1
+            while lines[i].strip() != '}':
+                stmt = lines[i].strip()
+                if stmt.startswith('@'):
+                    current = stmt[1:]
+                    blocks[current] = []
+                    order.append(current)
+                elif stmt and not stmt.startswith('#'):
+                    blocks[current].append(stmt)
+                i += 1
+            funcs[m.group(2)] = (params, blocks, order)
+        i += 1
+    return data, funcs
+
+
+class Machine:
+    def __init__(self, data, funcs):
+        self.funcs = funcs
+        self.memory = {}
+        self.symbols = {}
+        self.next_address = 0x1000
+        self.output = []
+        self.steps = 0
+        for name, contents in data.items():
+            self.symbols[name] = self.next_address
+            for k, byte in enumerate(contents):
+                self.memory[self.next_address + k] = byte
+            self.next_address += len(contents) + 16
+
+    def c_string(self, address):
+        chars = bytearray()
+        while self.memory.get(address, 0):
+            chars.append(self.memory[address])
+            address += 1
+        return chars.decode('latin1')
+
+    def value(self, env, token):
+        if token.startswith('%'):
+            return env[token[1:]]
+        if token.startswith('$'):
+            return self.symbols[token[1:]]
+        return int(token)
+
+    def call_args(self, env, text):
+        return [self.value(env, arg.split()[1]) for arg in text.split(',') if arg.strip() and arg.strip() != '...']
+
+    def call(self, name, args):
+        if name == 'puts':
+            self.output.append(self.c_string(args[0]) + '\n')
+            return 0
+        if name == 'printf':
+            values = iter(args[1:])
+
+            def substitute(m):
+                return str(signed(next(values), 64 if m.group(0) == '%lld' else 32))
+            self.output.append(re.sub(r'%lld|%d', substitute, self.c_string(args[0])))
+            return 0
+
+        params, blocks, order = self.funcs[name]
+        env = dict(zip(params, args))
+        previous = None
+        block = order[0]
+        while True:
+            # Phis read their operands on entry, all at once
+            incoming = {}
+            for inst in blocks[block]:
+                m = re.match(r'%(\w+) =\w phi (.*)', inst)
+                if not m:
+                    continue
+                for label, operand in re.findall(r'@([\w.]+) (\S+?)(?:,|$)', m.group(2)):
+                    if label == previous:
+                        incoming[m.group(1)] = self.value(env, operand)
+            env.update(incoming)
+
+            target = None
+            for inst in blocks[block]:
+                self.steps += 1
+                if self.steps > STEP_LIMIT:
+                    raise RuntimeError('step limit')
+                m = re.match(r'%(\w+) =(\w) (\w+) ?(.*)', inst)
+                if m:
+                    dest, cls, op, rest = m.groups()
+                    if op == 'phi':
+                        continue
+                    if op == 'call':
+                        cm = re.match(r'\$(\w+)\((.*)\)', rest)
+                        result = self.call(cm.group(1), self.call_args(env, cm.group(2)))
+                        env[dest] = result & (MASK32 if cls == 'w' else MASK64)
+                        continue
+                    operands = [self.value(env, x.strip()) for x in rest.split(',')] if rest else []
+                    env[dest] = self.operate(cls, op, operands)
+                    continue
+
+                parts = inst.split(None, 1)
+                op = parts[0]
+                rest = parts[1] if len(parts) > 1 else ''
+                if op.startswith('store'):
+                    value, address = [self.value(env, x.strip()) for x in rest.split(',')]
+                    for k in range(4 if op == 'storew' else 8):
+                        self.memory[address + k] = (value >> (8 * k)) & 255
+                elif op == 'call':
+                    cm = re.match(r'\$(\w+)\((.*)\)', rest)
+                    self.call(cm.group(1), self.call_args(env, cm.group(2)))
+                elif op == 'jmp':
+                    target = rest[1:]
+                    break
+                elif op == 'jnz':
+                    cond, on_true, on_false = [x.strip() for x in rest.split(',')]
+                    target = (on_true if self.value(env, cond) & MASK32 else on_false)[1:]
+                    break
+                elif op == 'ret':
+                    return self.value(env, rest) if rest else 0
+                else:
+                    raise RuntimeError('unknown instruction: ' + inst)
+            if target is None:
+                target = order[order.index(block) + 1]  # Fall through
+            previous, block = block, target
+
+    def load(self, address, size):
+        return sum(self.memory.get(address + k, 0) << (8 * k) for k in range(size))
+
+    def operate(self, cls, op, a):
+        bits = 32 if cls == 'w' else 64
+        mask = (1 << bits) - 1
+        if op.startswith('alloc'):
+            address = self.next_address
+            self.next_address += a[0] + 16
+            return address
+        if op in ('loadw', 'loadsw'):
+            return self.load(a[0], 4) & mask
+        if op == 'loadl':
+            return self.load(a[0], 8)
+        if op == 'copy':
+            return a[0] & mask
+        if op == 'extsw':
+            return signed(a[0], 32) & mask
+        if op == 'extuw':
+            return a[0] & MASK32
+
+        x = signed(a[0], bits) if a else 0
+        y = signed(a[1], bits) if len(a) > 1 else 0
+        ux = a[0] & mask if a else 0
+        uy = a[1] & mask if len(a) > 1 else 0
+        if op in ('div', 'rem', 'udiv', 'urem') and (uy if op[0] == 'u' else y) == 0:
+            raise RuntimeError('division by zero')
+        if op == 'add':
+            r = x + y
+        elif op == 'sub':
+            r = x - y
+        elif op == 'mul':
+            r = x * y
+        elif op == 'div':
+            r = abs(x) // abs(y) * (1 if (x < 0) == (y < 0) else -1)
+        elif op == 'rem':
+            r = x - y * (abs(x) // abs(y) * (1 if (x < 0) == (y < 0) else -1))
+        elif op == 'udiv':
+            r = ux // uy
+        elif op == 'urem':
+            r = ux % uy
+        elif op == 'and':
+            r = x & y
+        elif op == 'or':
+            r = x | y
+        elif op == 'xor':
+            r = x ^ y
+        elif op == 'shl':
+            r = x << (y & (bits - 1))
+        elif op == 'shr':
+            r = ux >> (y & (bits - 1))
+        elif op == 'sar':
+            r = x >> (y & (bits - 1))
+        elif op.startswith('c'):
+            cmp_bits = 32 if op[-1] == 'w' else 64
+            cmp_mask = (1 << cmp_bits) - 1
+            sx, sy = signed(a[0], cmp_bits), signed(a[1], cmp_bits)
+            ux, uy = a[0] & cmp_mask, a[1] & cmp_mask
+            r = int({
+                'eq': sx == sy, 'ne': sx != sy,
+                'slt': sx < sy, 'sle': sx <= sy, 'sgt': sx > sy, 'sge': sx >= sy,
+                'ult': ux < uy, 'ule': ux <= uy, 'ugt': ux > uy, 'uge': ux >= uy,
+            }[op[1:-1]])
+        else:
+            raise RuntimeError('unknown operation: ' + op)
+        return r & mask
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1]) as f:
+        data, funcs = parse(f.read())
+    machine = Machine(data, funcs)
+    status = machine.call('main', [])
+    sys.stdout.write(''.join(machine.output))
+    print('exit', signed(status, 32))
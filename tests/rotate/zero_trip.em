@@ -0,0 +1,32 @@
+// passes: mem2reg,rotate
+// The rotated loop is guarded, so a loop that runs zero times must not
+// run its body once, and values of the old header read after the loop
+// must come from whichever test left it: the guard or the one at the
+// bottom.
+// function: count_over
+// block: for.init.1
+// check: jnz .*, @for.end.5
+// block: for.update.3
+// check: jnz .*, @for.body.4, @for.end.5
+// block: for.end.5
+// check-count: 3 phi @for.init.1 .*, @for.update.3
+function count_over(n, limit) {
+    let s = 0;
+    let over = 0;
+    let i = 0;
+    for (i = 0; i < n; i = i + 1) {
+        s = s + i;
+        if (s > limit) {
+            over = over + 1;
+        }
+    }
+    return over * 10000 + s * 100 + i;
+}
+
+function main() {
+    print(count_over(0, 5));
+    print(count_over(-2, 5));
+    print(count_over(3, 100));
+    print(count_over(10, 5));
+    return 0;
+}
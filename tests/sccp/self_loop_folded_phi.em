@@ -0,0 +1,23 @@
+// passes: mem2reg,simplifycfg,rotate,sccp
+// After rotation the loop is a single block branching back to itself. The
+// loop runs once, so sccp finds t and i constant and folds the back edge;
+// every phi of the block must lose its entry for that edge, including the
+// ones after the constant phis it has erased.
+// function: twice
+// check-not: jnz
+// check-count: 1 mul
+function twice(k) {
+    let t = 0;
+    let s = k;
+    for (let i = 0; i < 1; i = i + 1) {
+        t = t * 2;
+        s = s * 3 + t;
+    }
+    return s + t;
+}
+
+function main() {
+    print(twice(7));
+    print(twice(-4));
+    return 0;
+}
@@ -0,0 +1,36 @@
+// passes: mem2reg,simplifycfg
+// Constant conditions, empty arms and chains of jump-only blocks are
+// removed; the phis of the joins they fed must follow.
+// function: shape
+// check-not: sub|printf
+// check-count: 2 jnz
+// check-count: 2 phi
+function shape(a) {
+    let r = 1;
+    if (1) {
+        r = r + a;
+    } else {
+        r = r - a;
+    }
+    if (a > 0) {
+    } else {
+    }
+    if (0) {
+        print(111);
+    }
+    if (a > 2) {
+        if (a > 4) {
+            r = r * 3;
+        }
+    } else {
+        r = r * 5;
+    }
+    return r;
+}
+
+function main() {
+    print(shape(-1));
+    print(shape(3));
+    print(shape(6));
+    return 0;
+}
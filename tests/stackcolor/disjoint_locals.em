@@ -0,0 +1,34 @@
+// passes: stackcolor
+// Without mem2reg every local lives in a stack slot. Locals of disjoint
+// scopes may share a slot, but a loop's locals must not share with values
+// read after an earlier iteration, and a local declared in a loop body
+// starts fresh each time.
+// Eight locals fit in four slots: n and total live throughout, and the
+// six scoped ones share the other two.
+// function: slots
+// check-count: 4 alloc
+function slots(n) {
+    let total = 0;
+    for (let i = 0; i < n; i = i + 1) {
+        let t = i * 2;
+        total = total + t;
+    }
+    if (n > 2) {
+        let a = n + 1;
+        total = total + a;
+    } else {
+        let b = n - 1;
+        total = total - b;
+    }
+    for (let j = 0; j < n; j = j + 1) {
+        let u = total + j;
+        total = u;
+    }
+    return total;
+}
+
+function main() {
+    print(slots(1));
+    print(slots(4));
+    return 0;
+}
@@ -0,0 +1,40 @@
+// passes: mem2reg,tailrec
+// Self-recursive tail calls become loops. The argument values must all be
+// read before any parameter is updated (gcd swaps them). fact multiplies
+// the call's result, so it becomes a loop carrying the product instead.
+// function: gcd
+// check-not: call \$gcd\(
+// function: sum_to
+// check-not: call \$sum_to\(
+// function: fact
+// check-not: call \$fact\(
+// block: if.end.2
+// check: mul
+function gcd(a, b) {
+    if (b == 0) {
+        return a;
+    }
+    return gcd(b, a % b);
+}
+
+function sum_to(n, acc) {
+    if (n == 0) {
+        return acc;
+    }
+    return sum_to(n - 1, acc + n);
+}
+
+function fact(n) {
+    if (n < 2) {
+        return 1;
+    }
+    return n * fact(n - 1);
+}
+
+function main() {
+    print(gcd(1071, 462));
+    print(gcd(17, 0));
+    print(sum_to(200, 0));
+    print(fact(10));
+    return 0;
+}
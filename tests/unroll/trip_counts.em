@@ -0,0 +1,37 @@
+// passes: mem2reg,instcombine,unroll
+// A constant trip count unrolls completely; a runtime one unrolls by a
+// factor with a remainder loop, so counts below the factor and counts that
+// are not a multiple of it must still run every iteration. instcombine
+// folds the copies mem2reg leaves so the constant count is seen.
+// function: fixed
+// check-not: jnz
+// block: for.cond.2
+// check: jmp @for.end.5
+// function: counted
+// check-count: 9 mul
+// block: for.update.23
+// check: jmp @for.cond.7
+function fixed(x) {
+    let s = x;
+    for (let i = 0; i < 4; i = i + 1) {
+        s = s * 2 + i;
+    }
+    return s;
+}
+
+function counted(n) {
+    let s = 0;
+    for (let i = 0; i < n; i = i + 1) {
+        s = s + i * i;
+    }
+    return s;
+}
+
+function main() {
+    print(fixed(3));
+    print(counted(0));
+    print(counted(1));
+    print(counted(3));
+    print(counted(10));
+    return 0;
+}
@@ -0,0 +1,36 @@
+// passes: mem2reg,vrp
+// Division and remainder of values known not to be negative become
+// unsigned; the same operations on values that may be negative must stay
+// signed. Compares the ranges decide fold, up to the edge of int. Only
+// the division by 2 changes here: vrp leaves the other constant divisors
+// to instcombine.
+// function: divs
+// block: if.then.1
+// check: jnz 0, @if.then.4, @if.end.5
+// block: if.else.2
+// check-not: udiv|urem
+// block: if.then.6
+// check: udiv .*, 2$
+function divs(x) {
+    let r = 0;
+    if (x >= 0) {
+        r = x / 3 + x % 5;
+        if (x < -1) {
+            r = 1000;
+        }
+    } else {
+        r = x / 3 + x % 5;
+    }
+    if (x > 2147483640) {
+        r = r + (x + 1) / 2;
+    }
+    return r;
+}
+
+function main() {
+    print(divs(17));
+    print(divs(-17));
+    print(divs(0));
+    print(divs(2147483647));
+    return 0;
+}